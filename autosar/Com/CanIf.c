@@ -36,11 +36,390 @@
 #include "Det.h"
 #endif
 
+/**
+ * @defgroup CanIf_CanId_bits Can_IdType format bits
+ *
+ * @{ */
+#define CANID_IDE_BIT         31u /*!< Extended identifier bit */
+#define CANID_FD_BIT          30u /*!< CAN FD frame bit */
+/**
+ * @} */
+
+/**
+ * @defgroup CanIf_Frame_lengths Maximum payload per frame format
+ *
+ * @{ */
+#define CLASSIC_MAX_LENGTH    8u  /*!< Classic frame maximum payload */
+#define FD_MAX_LENGTH         64u /*!< CAN FD frame maximum payload */
+/**
+ * @} */
+
+/**
+ * @defgroup CanIf_Tx_buffers Transmit buffers parameters
+ *
+ * @{ */
+#define TX_BUFFER_NONE        0xFFu       /*!< The PDU HTH has no transmit buffer */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define CANID_STD_MASK        0x7FFu      /*!< Standard identifier bits */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define CANID_EXT_MASK        0x1FFFFFFFu /*!< Extended identifier bits */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define TX_PRIORITY_STD_SHIFT 19u         /*!< Standard id aligned with the extended base id bits */
+/**
+ * @} */
+
+/**
+ * @defgroup CanIf_Tx_requests Outcome of the checks of a transmit request
+ *
+ * @{ */
+#define TX_REQUEST_WRITE      0u    /*!< The PDU shall be handed to the CAN driver */
+#define TX_REQUEST_CONFIRMED  1u    /*!< Accepted without reaching the driver, offline active mode */
+#define TX_REQUEST_REJECTED   2u    /*!< Not accepted */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define TX_MULTIPLE_WORDS     8u    /*!< Words of the CanIf_TransmitMultiple bitmap, one bit per request */
+/**
+ * @} */
+
+/**
+ * @defgroup CanIf_Rx_lookup Receive PDU lookup parameters
+ *
+ * @{ */
+#define RX_LINEAR_MAX         4u    /*!< HRHs with up to this many ids are compared one by one */
+#define RX_PDU_NONE           0xFFu /*!< No receive PDU matches the frame */
+/**
+ * @} */
+
+/**
+ * @defgroup CanIf_Rx_filter Receive software filter parameters
+ *
+ * @{ */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define RX_FILTER_STD_WORDS   64u         /*!< Words of the 11 bits ids bitmap, one bit per id */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define RX_FILTER_EXT_WORDS   8u          /*!< Words of the 29 bits ids hashed set, 256 bits */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define RX_FILTER_EXT_SHIFT   24u         /*!< Hash product bits left out of the hashed set index */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define RX_FILTER_HASH        0x9E3779B1u /*!< Multiplier of the 29 bits ids hash */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define RX_FILTER_WORD_SHIFT  5u          /*!< Id or hash to filter word */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define RX_FILTER_BIT_MASK    31u         /*!< Id or hash to bit of its filter word */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define RX_FILTER_ALL_BITS    0xFFFFFFFFu /*!< Every id of a filter word */
+/**
+ * @} */
+
+/**
+ * @defgroup CanIf_Notif_status Notification status bitmaps parameters
+ *
+ * @{ */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define NOTIF_WORD_SHIFT      5u          /*!< PDU id to bitmap word */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define NOTIF_BIT_MASK        31u         /*!< PDU id to bit of its bitmap word */
+/**
+ * @} */
+
+/**
+ * @defgroup CanIf_Pdu_modes PDU modes bitmasks parameters
+ *
+ * @{ */
+#define PDU_MODE_MAX_CONTROLLERS 32u /*!< Controllers the PDU modes bitmasks hold, one bit each */
+/**
+ * @} */
+
+/**
+ * @defgroup CanIf_Mirror_ring Bus mirroring capture ring parameters
+ *
+ * @{ */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define MIRROR_RING_MASK      ( CANIF_MIRROR_RING_SIZE - 1u ) /*!< Frame counter to ring slot */
+/**
+ * @} */
+
+/**
+ * @brief  Entry of the receive lookup array, the key is the CAN id with the extended bit set for
+ *         29 bits ids and the FD bit cleared, so both id types share one ordered space.
+ */
+typedef struct _CanIf_RxLookupEntry
+{
+    Can_IdType Key;    /*!< CAN id the PDU accepts, the lower limit for a range PDU */
+    PduIdType RxPduId; /*!< Receive PDU the key belongs to */
+} CanIf_RxLookupEntry;
+
+/**
+ * @brief  Slice of the receive lookup array owned by one HRH, the single id PDUs come first
+ *         ordered by key, the range PDUs follow in configuration order.
+ */
+typedef struct _CanIf_RxHrhRuntime
+{
+    uint16 First;      /*!< First entry of the HRH in the lookup array */
+    uint16 Count;      /*!< Single id entries, ordered by key */
+    uint16 RangeCount; /*!< Range entries placed after the single id ones */
+} CanIf_RxHrhRuntime;
+
+/**
+ * @brief  Runtime view of a transmit PDU, built at init out of its configuration so the transmit
+ *         path only fills the length and the payload before handing it to the CAN driver.
+ */
+typedef struct _CanIf_TxPduRuntime
+{
+    Can_PduType Pdu;       /*!< PDU passed to Can_Write with the CAN id format bits already set */
+    Can_HwHandleType Hth;  /*!< Hardware transmit handle the PDU is sent through */
+    uint8 MaxLength;       /*!< Largest payload accepted, the configured one capped by the frame format */
+    uint8 Buffer;          /*!< Transmit buffer of the HTH, TX_BUFFER_NONE when it has none */
+    uint32 ControllerMask; /*!< Bit of the PDU controller in the PDU modes bitmasks */
+    uint8 ControllerId;    /*!< CAN controller of the HTH */
+} CanIf_TxPduRuntime;
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PRIVATE_SOFTWARE_FILTER == STD_ON
+/**
+ * @brief  Software filter of an HRH, built at init out of its receive PDUs. A frame whose bit is
+ *         clear is accepted by none of them, a bit set only means the lookup may find a PDU.
+ */
+typedef struct _CanIf_RxHrhFilter
+{
+    uint32 Standard[ RX_FILTER_STD_WORDS ]; /*!< Bit n set when a PDU accepts the 11 bits id n */
+    uint32 Extended[ RX_FILTER_EXT_WORDS ]; /*!< Bit of the hash of each 29 bits id accepted */
+} CanIf_RxHrhFilter;
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+/**
+ * @brief  Transmit buffer entry, a copy of the L-PDU rejected by the CAN driver.
+ */
+typedef struct _CanIf_TxBufferEntry
+{
+    uint8 Data[ CANIF_TX_BUFFER_MAX_LENGTH ]; /*!< Payload of the L-PDU */
+    PduIdType TxPduId;                        /*!< Buffered L-PDU */
+    uint8 Length;                             /*!< Payload length */
+    boolean Trigger;                          /*!< TRUE when the payload is requested on transmission */
+} CanIf_TxBufferEntry;
+
+/**
+ * @brief  Runtime view of a transmit buffer, its slice of TxBufferOrder lists the entries in use
+ *         from the lowest priority one up to the highest priority one followed by the free ones.
+ */
+typedef struct _CanIf_TxBufferRuntime
+{
+    uint16 First;         /*!< First entry of the buffer in TxBufferEntries and TxBufferOrder */
+    Can_HwHandleType Hth; /*!< Hardware transmit handle the buffer feeds */
+    uint8 ControllerId;   /*!< CAN controller of the HTH */
+    uint8 Size;           /*!< Entries of the buffer */
+    volatile uint8 Count; /*!< Entries in use */
+} CanIf_TxBufferRuntime;
+#endif
+
+#if CANIF_PUBLIC_READ_RX_PDU_DATA == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief  Last L-PDU received of a receive PDU, kept twice. The reception interrupt writes the copy
+ *         not published and then publishes it by incrementing Sequence, whose lowest bit selects
+ *         the published copy. The reception interrupt always runs to completion over the reader, so
+ *         a reader copies the published one and only retries when two receptions happened meanwhile,
+ *         the second one overwriting the copy being read. The reader never locks the interrupts and
+ *         the writer never waits.
+ */
+typedef struct _CanIf_RxPduData
+{
+    volatile uint8 Data[ 2u ][ CANIF_RX_BUFFER_MAX_LENGTH ]; /*!< Both copies of the payload */
+    volatile uint8 Length[ 2u ];                             /*!< Both copies of the payload length */
+    volatile uint32 Sequence;                                /*!< Receptions so far, zero when none */
+} CanIf_RxPduData;
+#endif
+
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief  Frame of a capture ring, CanIf_MirrorFrameType without the sequence, which is the frame
+ *         counter the slot was written with.
+ */
+typedef struct _CanIf_MirrorEntry
+{
+    uint32 TimeStamp;                      /*!< CANIF_MIRROR_TIMESTAMP when the frame was captured */
+    Can_IdType CanId;                      /*!< CAN id with the extended and FD bits */
+    uint8 Direction;                       /*!< CANIF_MIRROR_RX or CANIF_MIRROR_TX */
+    uint8 Length;                          /*!< Payload captured */
+    uint8 Data[ CANIF_MIRROR_MAX_LENGTH ]; /*!< Payload of the frame */
+} CanIf_MirrorEntry;
+
+/**
+ * @brief  Capture ring of a controller. The frames are written from both interrupt lines of the
+ *         controller and from task level, each write holds the controller interrupts while it
+ *         fills the slot of Head and then publishes it by incrementing Head, overwriting the
+ *         oldest frame when the ring is full. The reader never locks, a frame the writer lapped
+ *         while being copied is detected and skipped.
+ */
+typedef struct _CanIf_MirrorRing
+{
+    volatile CanIf_MirrorEntry Frames[ CANIF_MIRROR_RING_SIZE ]; /*!< Frames captured */
+    volatile uint32 Head;                                        /*!< Frames captured so far */
+} CanIf_MirrorRing;
+#endif
+
 /**
  * @brief Pointer to the configuration structure.
  */
 CAN_STATIC const CanIf_ConfigType *LocalConfigPtr = NULL_PTR;
 
+/**
+ * @brief  Runtime view of each transmit PDU of the configuration in use, indexed by TxPduId.
+ */
+CAN_STATIC CanIf_TxPduRuntime TxPduTable[ CANIF_NUMBER_OF_TX_PDUS ];
+
+/**
+ * @brief  Receive PDUs of the configuration in use grouped by HRH, see CanIf_RxHrhRuntime.
+ */
+CAN_STATIC CanIf_RxLookupEntry RxLookup[ CANIF_NUMBER_OF_RX_PDUS ];
+
+/**
+ * @brief  Slice of RxLookup of each HRH, indexed by HOH.
+ */
+CAN_STATIC CanIf_RxHrhRuntime RxHrhTable[ CAN_NUMBER_OF_HOHS ];
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PRIVATE_SOFTWARE_FILTER == STD_ON
+/**
+ * @brief  Software filter of each HRH, indexed by HOH.
+ */
+CAN_STATIC CanIf_RxHrhFilter RxFilters[ CAN_NUMBER_OF_HOHS ];
+
+CAN_STATIC void CanIf_SetupRxFilters( const CanIf_ConfigType *ConfigPtr );
+CAN_STATIC uint32 CanIf_RxFilterHash( Can_IdType CanId );
+CAN_STATIC boolean CanIf_RxFilterPass( Can_HwHandleType Hrh, Can_IdType CanId );
+#endif
+
+/**
+ * @brief  Controllers with the transmit path online, CANIF_ONLINE, bit n stands for ControllerId n.
+ *         The PDU mode of a controller is only kept in these bitmasks, the transmit and receive
+ *         paths test the bit of their controller with a single AND, see CanIf_SetChannelMode.
+ */
+CAN_STATIC volatile uint32 TxOnlineMask;
+
+/**
+ * @brief  Controllers in CANIF_TX_OFFLINE_ACTIVE, their transmissions are confirmed right away
+ *         without reaching the CAN driver.
+ */
+CAN_STATIC volatile uint32 TxOfflineActiveMask;
+
+/**
+ * @brief  Controllers with the receive path online, any PDU mode but CANIF_OFFLINE.
+ */
+CAN_STATIC volatile uint32 RxOnlineMask;
+
+/**
+ * @brief  Controllers in CAN_CS_STARTED, the only ones accepting a PDU mode request.
+ */
+CAN_STATIC volatile uint32 StartedMask;
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+/**
+ * @brief  Transmit buffers of the configuration in use.
+ */
+CAN_STATIC CanIf_TxBufferRuntime TxBuffers[ CANIF_NUMBER_OF_TX_BUFFERS ];
+
+/**
+ * @brief  Storage of the transmit buffers entries.
+ */
+CAN_STATIC CanIf_TxBufferEntry TxBufferEntries[ CANIF_TX_BUFFER_ENTRIES ];
+
+/**
+ * @brief  Entries of each transmit buffer ordered by priority, see CanIf_TxBufferRuntime.
+ */
+CAN_STATIC uint8 TxBufferOrder[ CANIF_TX_BUFFER_ENTRIES ];
+
+/**
+ * @brief  Controllers with at least one buffered HTH, bit n stands for ControllerId n. Their
+ *         transmit confirmation calls Can_Write, so every PDU of them is written with the
+ *         controller interrupts held.
+ */
+CAN_STATIC uint32 TxBufferedMask;
+
+CAN_STATIC boolean CanIf_TxBuffersFit( const CanIf_ConfigType *ConfigPtr );
+CAN_STATIC void CanIf_SetupTxBuffers( const CanIf_ConfigType *ConfigPtr );
+CAN_STATIC uint32 CanIf_TxPriority( Can_IdType CanId );
+CAN_STATIC uint8 CanIf_FindTxBuffered( const CanIf_TxBufferRuntime *Buffer, PduIdType TxPduId );
+CAN_STATIC void CanIf_StoreTxBuffered( CanIf_TxBufferRuntime *Buffer, uint8 Position, PduIdType TxPduId, const PduInfoType *PduInfoPtr );
+CAN_STATIC void CanIf_DrainTxBuffer( CanIf_TxBufferRuntime *Buffer );
+#endif
+
+#if CANIF_PUBLIC_READ_RX_PDU_DATA == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief  Last L-PDU received of each receive PDU, indexed by RxPduId.
+ */
+CAN_STATIC CanIf_RxPduData RxPduData[ CANIF_NUMBER_OF_RX_PDUS ];
+
+CAN_STATIC void CanIf_StoreRxPduData( CanIf_RxPduData *Buffer, const PduInfoType *PduInfoPtr );
+#endif
+
+#if CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief  Transmit confirmations, a PDU flag toggled by CanIf_TxConfirmation when it equals the
+ *         same flag of TxNotifAck, see CanIf_SetNotif.
+ */
+CAN_STATIC volatile uint8 TxNotifSet[ CANIF_NUMBER_OF_TX_PDUS ];
+
+/**
+ * @brief  Transmit confirmations already read, only written by the readers.
+ */
+CAN_STATIC volatile uint8 TxNotifAck[ CANIF_NUMBER_OF_TX_PDUS ];
+#endif
+
+#if CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief  Receive indications, a PDU flag toggled by CanIf_RxIndication when it equals the same
+ *         flag of RxNotifAck, see CanIf_SetNotif.
+ */
+CAN_STATIC volatile uint8 RxNotifSet[ CANIF_NUMBER_OF_RX_PDUS ];
+
+/**
+ * @brief  Receive indications already read, only written by the readers.
+ */
+CAN_STATIC volatile uint8 RxNotifAck[ CANIF_NUMBER_OF_RX_PDUS ];
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if ( CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS == STD_ON ) || ( CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS == STD_ON )
+CAN_STATIC void CanIf_SetNotif( volatile uint8 *Set, const volatile uint8 *Ack, PduIdType PduId );
+CAN_STATIC boolean CanIf_ClearNotif( const volatile uint8 *Set, volatile uint8 *Ack, PduIdType PduId );
+CAN_STATIC uint32 CanIf_ClearNotifWord( const volatile uint8 *Set, volatile uint8 *Ack, uint8 Word, PduIdType Pdus );
+#endif
+
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief  Controllers with bus mirroring enabled, bit n stands for ControllerId n.
+ */
+CAN_STATIC volatile uint32 MirrorMask;
+
+/**
+ * @brief  Capture ring of each controller, indexed by ControllerId.
+ */
+CAN_STATIC CanIf_MirrorRing MirrorRings[ CANIF_MIRROR_CONTROLLERS ];
+
+/**
+ * @brief  Next frame to read of each capture ring, only written by CanIf_ReadMirrorFrames.
+ */
+CAN_STATIC uint32 MirrorTail[ CANIF_MIRROR_CONTROLLERS ];
+
+CAN_STATIC void CanIf_MirrorFrame( uint8 ControllerId, uint8 Direction, Can_IdType CanId, PduLengthType Length, const uint8 *Data );
+#endif
+
+CAN_STATIC void CanIf_SetChannelMode( uint8 ControllerId, CanIf_PduModeType PduMode );
+CAN_STATIC void CanIf_SetControllerStarted( uint8 ControllerId, boolean Started );
+CAN_STATIC void CanIf_LockModes( void );
+CAN_STATIC void CanIf_UnlockModes( void );
+CAN_STATIC void CanIf_ConfirmTx( PduIdType TxPduId );
+CAN_STATIC uint8 CanIf_AcceptTx( uint8 ApiId, PduIdType TxPduId, const PduInfoType *PduInfoPtr );
+CAN_STATIC boolean CanIf_TxLocked( const CanIf_TxPduRuntime *TxPdu );
+CAN_STATIC Std_ReturnType CanIf_WriteTxPdu( PduIdType TxPduId, const PduInfoType *PduInfoPtr, boolean *HthBusy );
+CAN_STATIC boolean CanIf_PduRefsFit( const CanIf_ConfigType *ConfigPtr );
+CAN_STATIC void CanIf_SetupTxPduTable( const CanIf_ConfigType *ConfigPtr );
+CAN_STATIC void CanIf_SetupRxLookup( const CanIf_ConfigType *ConfigPtr );
+CAN_STATIC Can_IdType CanIf_RxKey( Can_IdType CanId, uint8 CanIdType );
+CAN_STATIC PduIdType CanIf_LookupRxPdu( Can_HwHandleType Hrh, Can_IdType Key );
+
 /**
  * @brief Initializes the CAN interface.
  *
@@ -52,7 +431,82 @@ CAN_STATIC const CanIf_ConfigType *LocalConfigPtr = NULL_PTR;
  */
 void CanIf_Init( const CanIf_ConfigType *ConfigPtr )
 {
-    LocalConfigPtr = ConfigPtr;
+    boolean Fits = TRUE;
+
+    if( ConfigPtr != NULL_PTR )
+    {
+        Fits = ( ( ConfigPtr->MaxTxPduCfg <= CANIF_NUMBER_OF_TX_PDUS ) && ( ConfigPtr->MaxRxPduCfg <= CANIF_NUMBER_OF_RX_PDUS ) &&
+                 ( ConfigPtr->NumberOfCanControllers <= PDU_MODE_MAX_CONTROLLERS ) ) ? TRUE : FALSE;
+        Fits = ( ( Fits == TRUE ) && ( CanIf_PduRefsFit( ConfigPtr ) == TRUE ) ) ? TRUE : FALSE;
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+        Fits = ( ( Fits == TRUE ) && ( CanIf_TxBuffersFit( ConfigPtr ) == TRUE ) ) ? TRUE : FALSE;
+#endif
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+        Fits = ( ( Fits == TRUE ) && ( ConfigPtr->NumberOfCanControllers <= CANIF_MIRROR_CONTROLLERS ) ) ? TRUE : FALSE;
+#endif
+    }
+
+    if( Fits == FALSE )
+    {
+        /*The configuration does not fit the runtime tables reserved at compile time, the module is
+        left uninitialized*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_INIT, CANIF_E_INIT_FAILED );
+    }
+    else
+    {
+        if( ConfigPtr != NULL_PTR )
+        {
+            /* Build the transmit PDUs and the receive lookup once, the transmit and receive paths
+            do not walk the configuration */
+            CanIf_SetupTxPduTable( ConfigPtr );
+            CanIf_SetupRxLookup( ConfigPtr );
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PRIVATE_SOFTWARE_FILTER == STD_ON
+            CanIf_SetupRxFilters( ConfigPtr );
+#endif
+            /* every controller starts stopped with its channel in CANIF_OFFLINE */
+            TxOnlineMask        = 0u;
+            TxOfflineActiveMask = 0u;
+            RxOnlineMask        = 0u;
+            StartedMask         = 0u;
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+            CanIf_SetupTxBuffers( ConfigPtr );
+#endif
+#if CANIF_PUBLIC_READ_RX_PDU_DATA == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+            for( PduIdType RxPduId = 0u; RxPduId < ConfigPtr->MaxRxPduCfg; RxPduId++ )
+            {
+                RxPduData[ RxPduId ].Sequence = 0u;
+            }
+#endif
+#if CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+            for( PduIdType TxPduId = 0u; TxPduId < CANIF_NUMBER_OF_TX_PDUS; TxPduId++ )
+            {
+                TxNotifSet[ TxPduId ] = 0u;
+                TxNotifAck[ TxPduId ] = 0u;
+            }
+#endif
+#if CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+            for( PduIdType RxPduId = 0u; RxPduId < CANIF_NUMBER_OF_RX_PDUS; RxPduId++ )
+            {
+                RxNotifSet[ RxPduId ] = 0u;
+                RxNotifAck[ RxPduId ] = 0u;
+            }
+#endif
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+            /* mirroring starts disabled with every ring empty */
+            MirrorMask = 0u;
+            for( uint8 Controller = 0u; Controller < ConfigPtr->NumberOfCanControllers; Controller++ )
+            {
+                MirrorRings[ Controller ].Head = 0u;
+                MirrorTail[ Controller ]       = 0u;
+            }
+#endif
+        }
+
+        LocalConfigPtr = ConfigPtr;
+    }
 }
 
 /**
@@ -83,6 +537,8 @@ void CanIf_DeInit( void )
  * @brief Sets the CAN controller mode.
  *
  * This service calls the corresponding CAN Driver service for changing of the CAN controller mode.
+ * The driver completes the transition before returning, a controller stopped sets its channel to
+ * CANIF_TX_OFFLINE and a controller put to sleep sets it to CANIF_OFFLINE.
  *
  * @param[in] ControllerId CAN controller for which the status shall be changed.
  * @param[in] ControllerMode Requested mode transition.
@@ -103,7 +559,7 @@ Std_ReturnType CanIf_SetControllerMode( uint8 ControllerId, Can_ControllerStateT
         preceding call of CanIf_Init */
         Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_SET_CTRL_MODE, CANIF_E_UNINIT );
     }
-    else if( ControllerId > LocalConfigPtr->NumberOfCanControllers )
+    else if( ControllerId >= LocalConfigPtr->NumberOfCanControllers )
     {
         /*If parameter ControllerId of CanIf_SetControllerMode() has an invalid value, the CanIf
         shall report development error code CANIF_E_PARAM_CONTROLLERID to the Det_ReportError
@@ -120,8 +576,29 @@ Std_ReturnType CanIf_SetControllerMode( uint8 ControllerId, Can_ControllerStateT
     }
     else
     {
-        /* Set controller mode */
-        RetVal = E_OK;
+        RetVal = Can_SetControllerMode( ControllerId, ControllerMode );
+
+        if( RetVal == E_OK )
+        {
+            CanIf_SetControllerStarted( ControllerId, ( ControllerMode == CAN_CS_STARTED ) ? TRUE : FALSE );
+
+            if( ControllerMode == CAN_CS_STOPPED )
+            {
+                /*If CanIf_SetControllerMode(ControllerId, CAN_CS_STOPPED) is called, CanIf shall set
+                the PDU channel mode of the corresponding channel to CANIF_TX_OFFLINE*/
+                CanIf_SetChannelMode( ControllerId, CANIF_TX_OFFLINE );
+            }
+            else if( ControllerMode == CAN_CS_SLEEP )
+            {
+                /*If CanIf_SetControllerMode(ControllerId, CAN_CS_SLEEP) is called, CanIf shall set
+                the PDU channel mode of the corresponding channel to CANIF_OFFLINE*/
+                CanIf_SetChannelMode( ControllerId, CANIF_OFFLINE );
+            }
+            else
+            {
+                /* A started controller keeps the PDU mode of its channel */
+            }
+        }
     }
 
     return RetVal;
@@ -229,7 +706,10 @@ Std_ReturnType CanIf_GetControllerErrorState( uint8 ControllerId, Can_ErrorState
 /**
  * @brief Transmits a CAN L-PDU.
  *
- * This service calls the corresponding CAN Driver service for transmission of a CAN L-PDU.
+ * This service calls the corresponding CAN Driver service for transmission of a CAN L-PDU. A PDU
+ * with trigger transmit may be requested without data, the upper layer is then asked for it by
+ * CanIf_TriggerTransmit once the driver is about to send the PDU. The channel of the PDU shall be
+ * CANIF_ONLINE, in CANIF_TX_OFFLINE_ACTIVE the PDU is confirmed without reaching the driver.
  *
  * @param[in] TxPduId Identifier of the PDU to be transmitted
  * @param[in] PduInfoPtr Length of and pointer to the PDU data and pointer to MetaData.
@@ -265,29 +745,143 @@ Std_ReturnType CanIf_Transmit( PduIdType TxPduId, const PduInfoType *PduInfoPtr
     }
     else
     {
-        /*Get the bit indicating if the message is in FD format, this will extracted from
-        the configuration TxPduIds array where we gonna extract FdFlag*/
-        // if( ( ( PduInfoPtr->SduLength > 8 ) && ( FdFlag == STD_OFF ) ) || ( ( PduInfoPtr->SduLength > 64 ) && ( FdFlag == STD_ON ) ) )
+        /* the PDU was built at init, no need to walk the configuration */
+        CanIf_TxPduRuntime *TxPdu = &TxPduTable[ TxPduId ];
+        uint8 Request             = CanIf_AcceptTx( CANIF_ID_TRANSMIT, TxPduId, PduInfoPtr );
 
-        if( PduInfoPtr->SduLength > 8 ) /*this is momentary while we define the TxPduIds arrays*/
+        if( Request == TX_REQUEST_CONFIRMED )
         {
-            /*When CanIf_Transmit() is called with PduInfoPtr->SduLength exceeding the maximum length
-            of the PDU referenced by TxPduId:
-                • SduLength > 8 if the Can_IdType indicates a classic CAN frame
-                • SduLength > 64 if the Can_IdType indicates a CAN FD frame
-            CanIf shall report runtime error code CANIF_E_DATA_LENGTH_MISMATCH to the
-            Det_ReportRuntimeError() service of the DET*/
-            Det_ReportRuntimeError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT, CANIF_E_DATA_LENGTH_MISMATCH );
+            RetVal = E_OK;
+        }
+        else if( Request == TX_REQUEST_REJECTED )
+        {
+            /* Length exceeded or channel not online */
+        }
+        else if( CanIf_TxLocked( TxPdu ) == TRUE )
+        {
+            boolean HthBusy = FALSE;
+
+            /* the transmit confirmation drains the Tx buffer and the controller interrupt writes
+            the capture ring, neither shall run while the PDU is handed over */
+            Can_DisableControllerInterrupts( TxPdu->ControllerId );
+            RetVal = CanIf_WriteTxPdu( TxPduId, PduInfoPtr, &HthBusy );
+            Can_EnableControllerInterrupts( TxPdu->ControllerId );
         }
         else
         {
-            /* Transmit */
-            RetVal = E_OK;
+            /* Only the length and the payload change from one request to the next, Can_Write copies
+            them into the message RAM before returning, so the PDU can be reused right away */
+            TxPdu->Pdu.length = (uint8)PduInfoPtr->SduLength;
+            TxPdu->Pdu.sdu    = PduInfoPtr->SduDataPtr;
+
+            /* CAN_BUSY is also taken as not accepted */
+            RetVal = ( Can_Write( TxPdu->Hth, &TxPdu->Pdu ) == E_OK ) ? E_OK : E_NOT_OK;
+        }
+    }
+
+    return RetVal;
+}
+
+#if CANIF_TRANSMIT_MULTIPLE_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief Transmits a burst of CAN L-PDUs.
+ *
+ * CanIf_Transmit for a group of PDUs, as forwarded by a gateway. All the requests are checked in a
+ * single pass, the ones to send are marked in a bitmap and then handed to the CAN driver HTH by
+ * HTH in the order of the requests, each HTH group in one pass with the interrupts of its
+ * controller held only once. Once the driver answers CAN_BUSY the rest of the HTH group goes to
+ * its Tx buffer, or is not accepted, without calling Can_Write again. Each request gets the result
+ * CanIf_Transmit would give it.
+ *
+ * @param[in] Requests Transmit requests, PDU id plus length of and pointer to the PDU data
+ * @param[out] Results E_OK or E_NOT_OK for each request, in the order of the requests
+ * @param[in] Count Number of requests
+ *
+ * @return  E_OK: The requests have been handled, Results tells the ones accepted
+ *          E_NOT_OK: No request has been handled
+ */
+Std_ReturnType CanIf_TransmitMultiple( const CanIf_TxRequestType *Requests, Std_ReturnType *Results, uint8 Count )
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if( LocalConfigPtr == NULL_PTR )
+    {
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_UNINIT );
+    }
+    else if( ( Requests == NULL_PTR ) || ( Results == NULL_PTR ) )
+    {
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_PARAM_POINTER );
+    }
+    else
+    {
+        /* requests accepted and not handed to the driver yet */
+        uint32 Pending[ TX_MULTIPLE_WORDS ] = { 0u };
+        uint8 Left                          = 0u;
+
+        for( uint8 Index = 0u; Index < Count; Index++ )
+        {
+            const CanIf_TxRequestType *Request = &Requests[ Index ];
+
+            Results[ Index ] = E_NOT_OK;
+            if( Request->TxPduId >= LocalConfigPtr->MaxTxPduCfg )
+            {
+                Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_INVALID_TXPDUID );
+            }
+            else if( Request->PduInfoPtr == NULL_PTR )
+            {
+                Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_PARAM_POINTER );
+            }
+            else
+            {
+                uint8 Accepted = CanIf_AcceptTx( CANIF_ID_TRANSMIT_MULTIPLE, Request->TxPduId, Request->PduInfoPtr );
+
+                if( Accepted == TX_REQUEST_WRITE )
+                {
+                    Pending[ Index >> 5u ] |= (uint32)1u << ( Index & 31u );
+                    Left++;
+                }
+                else if( Accepted == TX_REQUEST_CONFIRMED )
+                {
+                    Results[ Index ] = E_OK;
+                }
+                else
+                {
+                    /* Length exceeded or channel not online */
+                }
+            }
+        }
+
+        for( uint8 First = 0u; ( First < Count ) && ( Left > 0u ); First++ )
+        {
+            if( ( Pending[ First >> 5u ] & ( (uint32)1u << ( First & 31u ) ) ) != 0u )
+            {
+                const CanIf_TxPduRuntime *TxPdu = &TxPduTable[ Requests[ First ].TxPduId ];
+                boolean HthBusy                 = FALSE;
+
+                /* the first request still pending opens the group of its HTH, the later ones of the
+                same HTH join it, the transmit confirmation shall not drain the Tx buffer meanwhile */
+                Can_DisableControllerInterrupts( TxPdu->ControllerId );
+                for( uint8 Index = First; ( Index < Count ) && ( Left > 0u ); Index++ )
+                {
+                    uint32 Bit = (uint32)1u << ( Index & 31u );
+
+                    if( ( ( Pending[ Index >> 5u ] & Bit ) != 0u ) && ( TxPduTable[ Requests[ Index ].TxPduId ].Hth == TxPdu->Hth ) )
+                    {
+                        Results[ Index ] = CanIf_WriteTxPdu( Requests[ Index ].TxPduId, Requests[ Index ].PduInfoPtr, &HthBusy );
+                        Pending[ Index >> 5u ] &= ~Bit;
+                        Left--;
+                    }
+                }
+                Can_EnableControllerInterrupts( TxPdu->ControllerId );
+            }
         }
+
+        RetVal = E_OK;
     }
 
     return RetVal;
 }
+#endif
 
 #if CANIF_PUBLIC_READ_RX_PDU_DATA == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 /**
@@ -317,7 +911,7 @@ Std_ReturnType CanIf_ReadRxPduData( PduIdType CanIfRxSduId, PduInfoType *CanIfRx
         preceding call of CanIf_Init */
         Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_PDU_DATA, CANIF_E_UNINIT );
     }
-    else if( CanIfRxSduId >= LocalConfigPtr->MaxRxPduCfg )
+    else if( ( CanIfRxSduId >= LocalConfigPtr->MaxRxPduCfg ) || ( LocalConfigPtr->RxPduCfgs[ CanIfRxSduId ].ReadData == FALSE ) )
     {
         /*If parameter CanIfRxSduId of CanIf_ReadRxPduData() has an invalid value, e.g. not configured
         to be stored within CanIf via CanIfRxPduReadData, CanIf shall report development error code
@@ -334,9 +928,33 @@ Std_ReturnType CanIf_ReadRxPduData( PduIdType CanIfRxSduId, PduInfoType *CanIfRx
     }
     else
     {
-        /* Read Rx PDU data */
-        (void)CanIfRxInfoPtr;
-        RetVal = E_OK;
+        const CanIf_RxPduData *Buffer = &RxPduData[ CanIfRxSduId ];
+        PduLengthType Room            = CanIfRxInfoPtr->SduLength;
+        uint32 Sequence;
+
+        do
+        {
+            uint8 Copy;
+            uint8 Length;
+
+            Sequence = Buffer->Sequence;
+            Copy     = (uint8)( Sequence & 1u );
+            Length   = Buffer->Length[ Copy ];
+            RetVal   = E_NOT_OK;
+
+            /*Nothing received yet or the caller buffer is too small for the last L-PDU, the room is
+            the one given by the caller, a previous attempt already overwrote SduLength*/
+            if( ( Sequence != 0u ) && ( Length <= Room ) )
+            {
+                for( uint8 Byte = 0u; Byte < Length; Byte++ )
+                {
+                    CanIfRxInfoPtr->SduDataPtr[ Byte ] = Buffer->Data[ Copy ][ Byte ];
+                }
+                CanIfRxInfoPtr->SduLength = Length;
+                RetVal                    = E_OK;
+            }
+            /* one reception meanwhile wrote the other copy, two or more may have written this one */
+        } while( ( Buffer->Sequence - Sequence ) > 1u );
     }
 
     return RetVal;
@@ -379,61 +997,153 @@ CanIf_NotifStatusType CanIf_ReadTxNotifStatus( PduIdType CanIfTxSduId )
     }
     else
     {
-        /* Read Tx notification status */
-        RetVal = CANIF_TX_RX_NOTIFICATION;
+        /* Read and reset the Tx notification status */
+        if( CanIf_ClearNotif( TxNotifSet, TxNotifAck, CanIfTxSduId ) == TRUE )
+        {
+            RetVal = CANIF_TX_RX_NOTIFICATION;
+        }
     }
 
     return RetVal;
 }
-#endif
 
-#if CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 /**
- * @brief Sets the requested PDU mode.
- *
- * This service returns the indication status (indication occurred or not) of a specific CAN Rx L-PDU,
- * requested by the CanIfRxSduId.
+ * @brief Read the Tx notification status of every CAN L-PDU.
  *
- * @param[in] CanIfRxSduId Receive L-SDU handle specifying the corresponding CAN L-SDU ID and implicitly
- *                          the CAN Driver instance as well as the corresponding CAN controller device.
+ * Returns and resets at once the confirmation status of all the Tx L-PDUs as a bitmap, bit
+ * n % 32 of word n / 32 is set when the L-PDU n was transmitted since its status was last read.
+ * A polling upper layer scans the bitmap words instead of calling CanIf_ReadTxNotifStatus per
+ * L-PDU.
  *
- * @return  Current indication status of the corresponding CAN Rx L-PDU.
+ * @param[out] NotifStatusBits Array of CANIF_TX_NOTIF_WORDS words to write the bitmap to.
  *
- * @reqs    SWS_CANIF_00230, SWS_CANIF_00661, SWS_CANIF_00336
+ * @retval  E_OK: The bitmap has been written
+ *          E_NOT_OK: The bitmap has not been written
  */
-CanIf_NotifStatusType CanIf_ReadRxNotifStatus( PduIdType CanIfRxSduId )
+Std_ReturnType CanIf_ReadTxNotifStatusBits( uint32 *NotifStatusBits )
 {
-    CanIf_NotifStatusType RetVal = CANIF_NO_NOTIFICATION;
+    Std_ReturnType RetVal = E_NOT_OK;
 
     if( LocalConfigPtr == NULL_PTR )
     {
         /*All CanIf API services other than CanIf_Init() and CanIf_GetVersionInfo() shall not execute
         their normal operation and return E_NOT_OK unless the CanIf has been initialized with a
         preceding call of CanIf_Init */
-        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_NOTIF_STATUS, CANIF_E_UNINIT );
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_TX_NOTIF_BITS, CANIF_E_UNINIT );
     }
-    else if( CanIfRxSduId >= LocalConfigPtr->MaxRxPduCfg )
+    else if( NotifStatusBits == NULL_PTR )
     {
-        /*If parameter CanIfRxSduId of CanIf_ReadRxNotifStatus() is out of range or if status for
-        CanRxPduId was requested whereas CanIfRxPduReadData is disabled or if no status information
-        was configured for this CAN Rx L-SDU, CanIf shall report development error code CANIF_E_INVALID_RXPDUID
-        to the Det_ReportError service of the DET, when CanIf_ReadRxNotifStatus() is called */
-        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_NOTIF_STATUS, CANIF_E_INVALID_RXPDUID );
+        /*If parameter NotifStatusBits of CanIf_ReadTxNotifStatusBits() has an invalid value, the CanIf
+        shall report development error code CANIF_E_PARAM_POINTER to the Det_ReportError service of
+        the DET module, when CanIf_ReadTxNotifStatusBits() is called.*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_TX_NOTIF_BITS, CANIF_E_PARAM_POINTER );
     }
     else
     {
-        /* Read Rx notification status */
-        RetVal = CANIF_TX_RX_NOTIFICATION;
+        for( uint8 Word = 0u; Word < CANIF_TX_NOTIF_WORDS; Word++ )
+        {
+            NotifStatusBits[ Word ] = CanIf_ClearNotifWord( TxNotifSet, TxNotifAck, Word, CANIF_NUMBER_OF_TX_PDUS );
+        }
+        RetVal = E_OK;
     }
 
     return RetVal;
 }
 #endif
 
+#if CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 /**
  * @brief Sets the requested PDU mode.
  *
- * This service sets the requested mode at the L-PDUs of a predefined logical PDU channel.
+ * This service returns the indication status (indication occurred or not) of a specific CAN Rx L-PDU,
+ * requested by the CanIfRxSduId.
+ *
+ * @param[in] CanIfRxSduId Receive L-SDU handle specifying the corresponding CAN L-SDU ID and implicitly
+ *                          the CAN Driver instance as well as the corresponding CAN controller device.
+ *
+ * @return  Current indication status of the corresponding CAN Rx L-PDU.
+ *
+ * @reqs    SWS_CANIF_00230, SWS_CANIF_00661, SWS_CANIF_00336
+ */
+CanIf_NotifStatusType CanIf_ReadRxNotifStatus( PduIdType CanIfRxSduId )
+{
+    CanIf_NotifStatusType RetVal = CANIF_NO_NOTIFICATION;
+
+    if( LocalConfigPtr == NULL_PTR )
+    {
+        /*All CanIf API services other than CanIf_Init() and CanIf_GetVersionInfo() shall not execute
+        their normal operation and return E_NOT_OK unless the CanIf has been initialized with a
+        preceding call of CanIf_Init */
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_NOTIF_STATUS, CANIF_E_UNINIT );
+    }
+    else if( CanIfRxSduId >= LocalConfigPtr->MaxRxPduCfg )
+    {
+        /*If parameter CanIfRxSduId of CanIf_ReadRxNotifStatus() is out of range or if status for
+        CanRxPduId was requested whereas CanIfRxPduReadData is disabled or if no status information
+        was configured for this CAN Rx L-SDU, CanIf shall report development error code CANIF_E_INVALID_RXPDUID
+        to the Det_ReportError service of the DET, when CanIf_ReadRxNotifStatus() is called */
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_NOTIF_STATUS, CANIF_E_INVALID_RXPDUID );
+    }
+    else
+    {
+        /* Read and reset the Rx notification status */
+        if( CanIf_ClearNotif( RxNotifSet, RxNotifAck, CanIfRxSduId ) == TRUE )
+        {
+            RetVal = CANIF_TX_RX_NOTIFICATION;
+        }
+    }
+
+    return RetVal;
+}
+
+/**
+ * @brief Read the Rx notification status of every CAN L-PDU.
+ *
+ * Returns and resets at once the indication status of all the Rx L-PDUs as a bitmap, bit n % 32
+ * of word n / 32 is set when the L-PDU n was received since its status was last read. A polling
+ * upper layer scans the bitmap words instead of calling CanIf_ReadRxNotifStatus per L-PDU.
+ *
+ * @param[out] NotifStatusBits Array of CANIF_RX_NOTIF_WORDS words to write the bitmap to.
+ *
+ * @retval  E_OK: The bitmap has been written
+ *          E_NOT_OK: The bitmap has not been written
+ */
+Std_ReturnType CanIf_ReadRxNotifStatusBits( uint32 *NotifStatusBits )
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if( LocalConfigPtr == NULL_PTR )
+    {
+        /*All CanIf API services other than CanIf_Init() and CanIf_GetVersionInfo() shall not execute
+        their normal operation and return E_NOT_OK unless the CanIf has been initialized with a
+        preceding call of CanIf_Init */
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_NOTIF_BITS, CANIF_E_UNINIT );
+    }
+    else if( NotifStatusBits == NULL_PTR )
+    {
+        /*If parameter NotifStatusBits of CanIf_ReadRxNotifStatusBits() has an invalid value, the CanIf
+        shall report development error code CANIF_E_PARAM_POINTER to the Det_ReportError service of
+        the DET module, when CanIf_ReadRxNotifStatusBits() is called.*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_NOTIF_BITS, CANIF_E_PARAM_POINTER );
+    }
+    else
+    {
+        for( uint8 Word = 0u; Word < CANIF_RX_NOTIF_WORDS; Word++ )
+        {
+            NotifStatusBits[ Word ] = CanIf_ClearNotifWord( RxNotifSet, RxNotifAck, Word, CANIF_NUMBER_OF_RX_PDUS );
+        }
+        RetVal = E_OK;
+    }
+
+    return RetVal;
+}
+#endif
+
+/**
+ * @brief Sets the requested PDU mode.
+ *
+ * This service sets the requested mode at the L-PDUs of a predefined logical PDU channel. Leaving
+ * CANIF_ONLINE drops the L-PDUs waiting in the transmit buffers of the channel.
  *
  * @param[in] ControllerId All PDUs of the own ECU connected to the corresponding CanIf ControllerId,
  *                          which is assigned to a physical CAN controller are addressed.
@@ -467,9 +1177,14 @@ Std_ReturnType CanIf_SetPduMode( uint8 ControllerId, CanIf_PduModeType PduModeRe
         error code CANIF_E_PARAM_PDU_MODE to the Det_ReportError service of the DET module.*/
         Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_SET_PDU_MODE, CANIF_E_PARAM_PDU_MODE );
     }
+    else if( ( StartedMask & ( (uint32)1u << ControllerId ) ) == 0u )
+    {
+        /*The service CanIf_SetPduMode() shall not accept any request and shall return E_NOT_OK, if
+        the controller mode referenced by ControllerId is not in state CAN_CS_STARTED*/
+    }
     else
     {
-        /* Set PDU mode */
+        CanIf_SetChannelMode( ControllerId, PduModeRequest );
         RetVal = E_OK;
     }
 
@@ -515,8 +1230,25 @@ Std_ReturnType CanIf_GetPduMode( uint8 ControllerId, CanIf_PduModeType *PduModeP
     }
     else
     {
-        /* Get PDU mode */
-        (void)PduModePtr;
+        uint32 Bit = (uint32)1u << ControllerId;
+
+        /* the mode is rebuilt out of the bitmasks the transmit and receive paths test */
+        if( ( TxOnlineMask & Bit ) != 0u )
+        {
+            *PduModePtr = CANIF_ONLINE;
+        }
+        else if( ( TxOfflineActiveMask & Bit ) != 0u )
+        {
+            *PduModePtr = CANIF_TX_OFFLINE_ACTIVE;
+        }
+        else if( ( RxOnlineMask & Bit ) != 0u )
+        {
+            *PduModePtr = CANIF_TX_OFFLINE;
+        }
+        else
+        {
+            *PduModePtr = CANIF_OFFLINE;
+        }
         RetVal = E_OK;
     }
 
@@ -780,7 +1512,9 @@ Std_ReturnType CanIf_GetControllerTxErrorCounter( uint8 ControllerId, uint8 *TxE
 /**
  * @brief Enables/Disables the bus mirroring feature.
  *
- * Enables or disables mirroring for a CAN controller.
+ * Enables or disables mirroring for a CAN controller. While enabled every frame received by the
+ * controller and every frame handed to it for transmission is captured with its timestamp into
+ * the controller capture ring, to be read in bulk with CanIf_ReadMirrorFrames.
  *
  * @param[in] ControllerId CAN controller for which the status shall be changed.
  * @param[in] MirroringActive TRUE: Mirror_ReportCanFrame will be called for each
@@ -804,7 +1538,7 @@ Std_ReturnType CanIf_EnableBusMirroring( uint8 ControllerId, boolean MirroringAc
         preceding call of CanIf_Init */
         Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_ENABLE_BUS_MIRROR, CANIF_E_UNINIT );
     }
-    else if( ControllerId > LocalConfigPtr->NumberOfCanControllers )
+    else if( ControllerId >= LocalConfigPtr->NumberOfCanControllers )
     {
         /*If parameter ControllerId of CanIf_EnableBusMirroring() has an invalid value, the CanIf
         shall report development error code CANIF_E_PARAM_CONTROLLERID to the Det_ReportError
@@ -813,13 +1547,99 @@ Std_ReturnType CanIf_EnableBusMirroring( uint8 ControllerId, boolean MirroringAc
     }
     else
     {
-        /* Enable bus mirroring */
-        (void)MirroringActive;
+        uint32 Bit = (uint32)1u << ControllerId;
+
+        /* the capture paths only test the bit of their controller */
+        CanIf_LockModes( );
+        MirrorMask = ( MirroringActive == TRUE ) ? ( MirrorMask | Bit ) : ( MirrorMask & ~Bit );
+        CanIf_UnlockModes( );
         RetVal = E_OK;
     }
 
     return RetVal;
 }
+
+/**
+ * @brief Reads the frames captured by the bus mirroring.
+ *
+ * Copies the frames captured on a controller since the last call, oldest first, so an exporter can
+ * drain the capture ring in bulk. The capture never waits for the reader, a full ring overwrites
+ * its oldest frame and only its newest CANIF_MIRROR_RING_SIZE - 1 frames can be read, the frames
+ * lost show up as a gap in the Sequence of the frames read. Only one reader per controller is
+ * supported.
+ *
+ * @param[in] ControllerId CAN controller whose frames are read
+ * @param[out] Frames Buffer to copy the frames to
+ * @param[inout] FramesCountPtr Room of Frames in frames, updated with the frames copied
+ *
+ * @return  E_OK: Frames copied, none when the ring is empty
+ *          E_NOT_OK: Wrong parameters
+ */
+Std_ReturnType CanIf_ReadMirrorFrames( uint8 ControllerId, CanIf_MirrorFrameType *Frames, uint16 *FramesCountPtr )
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if( LocalConfigPtr == NULL_PTR )
+    {
+        /*All CanIf API services other than CanIf_Init() and CanIf_GetVersionInfo() shall not execute
+        their normal operation and return E_NOT_OK unless the CanIf has been initialized with a
+        preceding call of CanIf_Init */
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_MIRROR_FRAMES, CANIF_E_UNINIT );
+    }
+    else if( ControllerId >= LocalConfigPtr->NumberOfCanControllers )
+    {
+        /*The controller has no capture ring*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_MIRROR_FRAMES, CANIF_E_PARAM_CONTROLLERID );
+    }
+    else if( ( Frames == NULL_PTR ) || ( FramesCountPtr == NULL_PTR ) )
+    {
+        /*No buffer to copy the frames to*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_MIRROR_FRAMES, CANIF_E_PARAM_POINTER );
+    }
+    else
+    {
+        const CanIf_MirrorRing *Ring = &MirrorRings[ ControllerId ];
+        uint32 Head                  = Ring->Head;
+        uint32 Tail                  = MirrorTail[ ControllerId ];
+        uint16 Count                 = 0u;
+
+        /* the older frames are gone, the slot of the oldest one is the next the writer fills */
+        if( ( Head - Tail ) >= CANIF_MIRROR_RING_SIZE )
+        {
+            Tail = Head - ( CANIF_MIRROR_RING_SIZE - 1u );
+        }
+
+        while( ( Tail != Head ) && ( Count < *FramesCountPtr ) )
+        {
+            const volatile CanIf_MirrorEntry *Entry = &Ring->Frames[ Tail & MIRROR_RING_MASK ];
+            CanIf_MirrorFrameType *Frame            = &Frames[ Count ];
+
+            Frame->TimeStamp = Entry->TimeStamp;
+            Frame->Sequence  = Tail;
+            Frame->CanId     = Entry->CanId;
+            Frame->Direction = Entry->Direction;
+            Frame->Length    = Entry->Length;
+            for( uint8 Byte = 0u; ( Byte < Frame->Length ) && ( Byte < CANIF_MIRROR_MAX_LENGTH ); Byte++ )
+            {
+                Frame->Data[ Byte ] = Entry->Data[ Byte ];
+            }
+
+            /* the writer reuses the slot once Head gets a ring size ahead of the frame, the copy
+            is kept only if that did not happen before it was complete */
+            if( ( Ring->Head - Tail ) < CANIF_MIRROR_RING_SIZE )
+            {
+                Count++;
+            }
+            Tail++;
+        }
+
+        MirrorTail[ ControllerId ] = Tail;
+        *FramesCountPtr            = Count;
+        RetVal                     = E_OK;
+    }
+
+    return RetVal;
+}
 #endif
 
 #if CANIF_GLOBAL_TIME_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
@@ -1003,6 +1823,71 @@ Std_ReturnType CanIf_GetIngressTimeStamp( PduIdType RxPduId, Can_TimeStampType *
 }
 #endif
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_TRIGGER_TRANSMIT_SUPPORT == STD_ON
+/**
+ * @brief Requests the data of a transmit PDU.
+ *
+ * Called by the CAN driver when a PDU requested without data is about to be sent, the upper layer
+ * trigger transmit of the PDU copies its latest data straight into the Tx buffer element pointed
+ * by SduDataPtr, so the data is copied once and as late as possible.
+ *
+ * @param[in] TxPduId ID of the Tx L-PDU about to be sent
+ * @param[inout] PduInfoPtr Buffer to copy the data to and its size, updated with the bytes copied
+ *
+ * @retval  E_OK: The data has been copied
+ *          E_NOT_OK: No data has been copied, the PDU is not sent
+ *
+ * @reqs    SWS_CANIF_00883, SWS_CANIF_00884, SWS_CANIF_00885, SWS_CANIF_00886
+ */
+Std_ReturnType CanIf_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr )
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if( LocalConfigPtr == NULL_PTR )
+    {
+        /*All CanIf API services other than CanIf_Init() and CanIf_GetVersionInfo() shall not execute
+        their normal operation and return E_NOT_OK unless the CanIf has been initialized with a
+        preceding call of CanIf_Init */
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRIGGER_TRANSMIT, CANIF_E_UNINIT );
+    }
+    else if( TxPduId >= LocalConfigPtr->MaxTxPduCfg )
+    {
+        /*If parameter TxPduId of CanIf_TriggerTransmit() has an invalid value, CanIf shall report
+        development error code CANIF_E_INVALID_TXPDUID to the Det_ReportError service of the DET,
+        when CanIf_TriggerTransmit() is called*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRIGGER_TRANSMIT, CANIF_E_INVALID_TXPDUID );
+    }
+    else if( ( PduInfoPtr == NULL_PTR ) || ( PduInfoPtr->SduDataPtr == NULL_PTR ) )
+    {
+        /*If parameter PduInfoPtr of CanIf_TriggerTransmit() has an invalid value, CanIf shall report
+        development error code CANIF_E_PARAM_POINTER to the Det_ReportError service of the DET,
+        when CanIf_TriggerTransmit() is called*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRIGGER_TRANSMIT, CANIF_E_PARAM_POINTER );
+    }
+    else
+    {
+        CanIf_TriggerTransmitFct TriggerTransmit = LocalConfigPtr->TxPduCfgs[ TxPduId ].TriggerTransmit;
+
+        /* a PDU without trigger transmit has no data to give, the driver drops the request */
+        if( TriggerTransmit != NULL_PTR )
+        {
+            RetVal = TriggerTransmit( TxPduId, PduInfoPtr );
+        }
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+        /* called within Can_Write, from the transmit confirmation or with the interrupt held */
+        if( ( RetVal == E_OK ) && ( ( MirrorMask & TxPduTable[ TxPduId ].ControllerMask ) != 0u ) )
+        {
+            CanIf_MirrorFrame( TxPduTable[ TxPduId ].ControllerId, CANIF_MIRROR_TX, TxPduTable[ TxPduId ].Pdu.id,
+                               PduInfoPtr->SduLength, PduInfoPtr->SduDataPtr );
+        }
+#endif
+    }
+
+    return RetVal;
+}
+#endif
+
 /**
  * @brief Handles the transmit confirmation.
  *
@@ -1030,7 +1915,113 @@ void CanIf_TxConfirmation( PduIdType CanTxPduId )
     }
     else
     {
-        /* Tx confirmation */
+        CanIf_ConfirmTx( CanTxPduId );
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+        const CanIf_TxPduRuntime *TxPdu = &TxPduTable[ CanTxPduId ];
+
+        if( ( TxPdu->Buffer != TX_BUFFER_NONE ) && ( ( TxOnlineMask & TxPdu->ControllerMask ) != 0u ) )
+        {
+            /* a hardware object of the HTH was just freed, refill it from the interrupt */
+            CanIf_DrainTxBuffer( &TxBuffers[ TxPdu->Buffer ] );
+        }
+#endif
+    }
+}
+
+/**
+ * @brief Handles the cancellation of a transmit request.
+ *
+ * This service informs CanIf that a pending transmission was cancelled by the CAN driver in favour
+ * of a PDU with a higher priority, the L-PDU shall be stored back into the CanIf transmit buffer
+ * to be sent later. When its HTH has no buffer, or the buffer is full, the L-PDU is lost and the
+ * upper layer gets its transmit confirmation with E_NOT_OK. The hardware object freed by the
+ * cancellation is refilled right away with the highest priority PDU of the buffer.
+ *
+ * @param[in] CanTxPduId ID of the Tx L-PDU cancelled
+ * @param[in] PduInfoPtr Length of and pointer to the data of the cancelled L-PDU, the data is
+ *                       only valid during the call.
+ *
+ * @reqs    SWS_CANIF_00101, SWS_CANIF_00661, SWS_CANIF_00426, SWS_CANIF_00427
+ */
+void CanIf_CancelTxConfirmation( PduIdType CanTxPduId, const PduInfoType *PduInfoPtr )
+{
+    if( LocalConfigPtr == NULL_PTR )
+    {
+        /*All CanIf API services other than CanIf_Init() and CanIf_GetVersionInfo() shall not execute
+        their normal operation and return E_NOT_OK unless the CanIf has been initialized with a
+        preceding call of CanIf_Init */
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_CANCEL_TX_CONFIRM, CANIF_E_UNINIT );
+    }
+    else if( CanTxPduId >= LocalConfigPtr->MaxTxPduCfg )
+    {
+        /*If parameter CanTxPduId of CanIf_CancelTxConfirmation() has an invalid value, the CanIf
+        shall report development error code CANIF_E_PARAM_LPDU to the Det_ReportError service of
+        the DET module, when CanIf_CancelTxConfirmation() is called.*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_CANCEL_TX_CONFIRM, CANIF_E_PARAM_LPDU );
+    }
+    else if( PduInfoPtr == NULL_PTR )
+    {
+        /*If parameter PduInfoPtr of CanIf_CancelTxConfirmation() has an invalid value, the CanIf
+        shall report development error code CANIF_E_PARAM_POINTER to the Det_ReportError service of
+        the DET module, when CanIf_CancelTxConfirmation() is called.*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_CANCEL_TX_CONFIRM, CANIF_E_PARAM_POINTER );
+    }
+    else
+    {
+        CanIf_TxConfirmationFct TxConfirmation = LocalConfigPtr->TxPduCfgs[ CanTxPduId ].TxConfirmation;
+        boolean Lost                           = TRUE;
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+        uint8 Buffer = TxPduTable[ CanTxPduId ].Buffer;
+
+        if( Buffer != TX_BUFFER_NONE )
+        {
+            CanIf_TxBufferRuntime *TxBuffer = &TxBuffers[ Buffer ];
+            uint8 Position                  = CanIf_FindTxBuffered( TxBuffer, CanTxPduId );
+            PduInfoType Cancelled           = *PduInfoPtr;
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_TRIGGER_TRANSMIT_SUPPORT == STD_ON
+            if( LocalConfigPtr->TxPduCfgs[ CanTxPduId ].TriggerTransmit != NULL_PTR )
+            {
+                /* the upper layer is asked again for its latest data when the PDU is resent */
+                Cancelled.SduDataPtr = NULL_PTR;
+            }
+#endif
+
+            /*Store the cancelled PDU back into the transmit buffer, unless a newer request of the
+            same PDU is already waiting there*/
+            if( Position != TxBuffer->Count )
+            {
+                Lost = FALSE;
+            }
+            else if( ( TxBuffer->Count < TxBuffer->Size ) &&
+                     ( ( Cancelled.SduDataPtr == NULL_PTR ) || ( Cancelled.SduLength <= CANIF_TX_BUFFER_MAX_LENGTH ) ) )
+            {
+                CanIf_StoreTxBuffered( TxBuffer, Position, CanTxPduId, &Cancelled );
+                Lost = FALSE;
+            }
+            else
+            {
+                /* no room to take the PDU back */
+            }
+
+            /*The hardware object of the cancelled PDU is free now, refill it with the highest
+            priority PDU of the buffer, the one the cancellation was requested for*/
+            if( ( TxOnlineMask & TxPduTable[ CanTxPduId ].ControllerMask ) != 0u )
+            {
+                CanIf_DrainTxBuffer( TxBuffer );
+            }
+        }
+#endif
+
+        /*The cancelled L-PDU could not be taken back, it will never be sent so the upper layer is
+        told the transmission failed*/
+        if( ( Lost == TRUE ) && ( TxConfirmation != NULL_PTR ) )
+        {
+            TxConfirmation( CanTxPduId, E_NOT_OK );
+        }
     }
 }
 
@@ -1038,12 +2029,14 @@ void CanIf_TxConfirmation( PduIdType CanTxPduId )
  * @brief Handles the received CAN frame.
  *
  * This service indicates a successful reception of a received CAN Rx L-PDU to the CanIf after
- * passing all filters and validation checks.
+ * passing all filters and validation checks. A frame whose id no PDU of the HRH accepts is dropped
+ * by the software filter of the HRH before the lookup, and an L-PDU shorter than the data length of
+ * its PDU is dropped by the data length check.
  *
  * @param[in] Mailbox Identifies the HRH and its corresponding CAN Controller
  * @param[in] PduInfoPtr Pointer to the received L-PDU
  *
- * @reqs    SWS_CANIF_00006, SWS_CANIF_00661, SWS_CANIF_00416, SWS_CANIF_00417, SWS_CANIF_00419
+ * @reqs    SWS_CANIF_00006, SWS_CANIF_00661, SWS_CANIF_00416, SWS_CANIF_00417, SWS_CANIF_00419, SWS_CANIF_00026
  */
 void CanIf_RxIndication( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr )
 {
@@ -1061,7 +2054,7 @@ void CanIf_RxIndication( const Can_HwType *Mailbox, const PduInfoType *PduInfoPt
         DET module, when CanIf_RxIndication() is called.*/
         Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_RX_INDICATION, CANIF_E_PARAM_POINTER );
     }
-    else if( Mailbox->Hoh == 0xFFu ) /*need to figure it out how to detect an invalid Hoh*/
+    else if( Mailbox->Hoh >= CAN_NUMBER_OF_HOHS )
     {
         /*If parameter Mailbox->Hoh of CanIf_RxIndication() has an invalid value, CanIf shall report
         development error code CANIF_E_PARAM_HOH to the Det_ReportError service of the DET module,
@@ -1077,7 +2070,68 @@ void CanIf_RxIndication( const Can_HwType *Mailbox, const PduInfoType *PduInfoPt
     }
     else
     {
-        /* Rx indication */
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+        /* the frame is mirrored as seen on the bus, before the PDU mode and the lookup filter it */
+        if( ( MirrorMask & ( (uint32)1u << Mailbox->ControllerId ) ) != 0u )
+        {
+            CanIf_MirrorFrame( Mailbox->ControllerId, CANIF_MIRROR_RX, Mailbox->CanId, PduInfoPtr->SduLength, PduInfoPtr->SduDataPtr );
+        }
+#endif
+
+        if( ( RxOnlineMask & ( (uint32)1u << Mailbox->ControllerId ) ) == 0u )
+        {
+            /* The receive path of the channel is offline, the frame is dropped before the lookup */
+        }
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PRIVATE_SOFTWARE_FILTER == STD_ON
+        else if( CanIf_RxFilterPass( Mailbox->Hoh, Mailbox->CanId ) == FALSE )
+        {
+            /* No PDU of the HRH accepts the id, the frame is dropped before the lookup */
+        }
+#endif
+        else
+        {
+            Can_IdType Key = Mailbox->CanId;
+            PduIdType RxPduId;
+
+            /* The frame format does not take part in the match, only the id and its type */
+            Bfx_ClrBit_u32u8( &Key, CANID_FD_BIT );
+            RxPduId = CanIf_LookupRxPdu( Mailbox->Hoh, Key );
+
+            if( RxPduId == RX_PDU_NONE )
+            {
+                /* the id passed the filter but no PDU of the HRH accepts it */
+            }
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PRIVATE_DATA_LENGTH_CHECK == STD_ON
+            else if( PduInfoPtr->SduLength < LocalConfigPtr->RxPduCfgs[ RxPduId ].DataLength )
+            {
+                /*If the DLC check is enabled and the received length is smaller than the one configured
+                for the PDU, CanIf shall report runtime error code CANIF_E_INVALID_DATA_LENGTH to the
+                Det_ReportRuntimeError() service of the DET and not process the L-PDU any further*/
+                Det_ReportRuntimeError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_RX_INDICATION, CANIF_E_INVALID_DATA_LENGTH );
+            }
+#endif
+            else
+            {
+                const CanIf_RxPduCfgType *RxPdu = &LocalConfigPtr->RxPduCfgs[ RxPduId ];
+
+#if CANIF_PUBLIC_READ_RX_PDU_DATA == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+                if( RxPdu->ReadData == TRUE )
+                {
+                    CanIf_StoreRxPduData( &RxPduData[ RxPduId ], PduInfoPtr );
+                }
+#endif
+#if CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+                CanIf_SetNotif( RxNotifSet, RxNotifAck, RxPduId );
+#endif
+
+                if( RxPdu->RxIndication != NULL_PTR )
+                {
+                    RxPdu->RxIndication( RxPduId, PduInfoPtr );
+                }
+            }
+        }
     }
 }
 
@@ -1109,7 +2163,10 @@ void CanIf_ControllerBusOff( uint8 ControllerId )
     }
     else
     {
-        /* Controller bus-off */
+        /*If a controller goes bus-off, the CanIf shall set the PDU channel mode of the corresponding
+        channel to CANIF_TX_OFFLINE, the controller is left stopped by the driver*/
+        CanIf_SetControllerStarted( ControllerId, FALSE );
+        CanIf_SetChannelMode( ControllerId, CANIF_TX_OFFLINE );
     }
 }
 
@@ -1149,7 +2206,7 @@ void CanIf_ControllerModeIndication( uint8 ControllerId, Can_ControllerStateType
     }
     else
     {
-        /* Controller mode indication */
+        CanIf_SetControllerStarted( ControllerId, ( ControllerMode == CAN_CS_STARTED ) ? TRUE : FALSE );
     }
 }
 
@@ -1231,3 +2288,955 @@ void CanIf_ErrorNotification( uint8 ControllerId, Can_ErrorType CanError )
         /* Error notification */
     }
 }
+
+/**
+ * @brief Sets the PDU mode of a channel.
+ *
+ * The mode is spread over the bitmasks of each path, so the transmit and receive paths gate their
+ * L-PDUs with a single AND. A channel leaving CANIF_ONLINE drops its buffered L-PDUs, they would
+ * go out with stale data once the channel is back online.
+ *
+ * @param[in] ControllerId Controller of the channel
+ * @param[in] PduMode New PDU mode of the channel
+ */
+CAN_STATIC void CanIf_SetChannelMode( uint8 ControllerId, CanIf_PduModeType PduMode )
+{
+    uint32 Bit = (uint32)1u << ControllerId;
+
+    CanIf_LockModes( );
+
+    TxOnlineMask        = ( PduMode == CANIF_ONLINE ) ? ( TxOnlineMask | Bit ) : ( TxOnlineMask & ~Bit );
+    TxOfflineActiveMask = ( PduMode == CANIF_TX_OFFLINE_ACTIVE ) ? ( TxOfflineActiveMask | Bit ) : ( TxOfflineActiveMask & ~Bit );
+    RxOnlineMask        = ( PduMode != CANIF_OFFLINE ) ? ( RxOnlineMask | Bit ) : ( RxOnlineMask & ~Bit );
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+    for( uint8 Buffer = 0u; ( PduMode != CANIF_ONLINE ) && ( Buffer < LocalConfigPtr->NumberOfBuffers ); Buffer++ )
+    {
+        if( TxBuffers[ Buffer ].ControllerId == ControllerId )
+        {
+            TxBuffers[ Buffer ].Count = 0u;
+        }
+    }
+#endif
+
+    CanIf_UnlockModes( );
+}
+
+/**
+ * @brief Sets whether a controller is in CAN_CS_STARTED.
+ *
+ * @param[in] ControllerId Controller whose mode changed
+ * @param[in] Started TRUE when the controller is started
+ */
+CAN_STATIC void CanIf_SetControllerStarted( uint8 ControllerId, boolean Started )
+{
+    uint32 Bit = (uint32)1u << ControllerId;
+
+    CanIf_LockModes( );
+    StartedMask = ( Started == TRUE ) ? ( StartedMask | Bit ) : ( StartedMask & ~Bit );
+    CanIf_UnlockModes( );
+}
+
+/**
+ * @brief Locks the PDU modes bitmasks.
+ *
+ * The bitmasks hold every controller, the bus-off of one controller is not allowed to update them
+ * while the mode of another one is being changed, so the interrupts of all of them are held.
+ */
+CAN_STATIC void CanIf_LockModes( void )
+{
+    for( uint8 Controller = 0u; Controller < LocalConfigPtr->NumberOfCanControllers; Controller++ )
+    {
+        Can_DisableControllerInterrupts( Controller );
+    }
+}
+
+/**
+ * @brief Unlocks the PDU modes bitmasks, see CanIf_LockModes.
+ */
+CAN_STATIC void CanIf_UnlockModes( void )
+{
+    for( uint8 Controller = 0u; Controller < LocalConfigPtr->NumberOfCanControllers; Controller++ )
+    {
+        Can_EnableControllerInterrupts( Controller );
+    }
+}
+
+/**
+ * @brief Confirms the transmission of a PDU.
+ *
+ * Flags the PDU notification status and calls the upper layer confirmation of the PDU, either on
+ * the transmit confirmation of the driver or straight from CanIf_Transmit in offline active mode.
+ *
+ * @param[in] TxPduId PDU transmitted
+ */
+CAN_STATIC void CanIf_ConfirmTx( PduIdType TxPduId )
+{
+    CanIf_TxConfirmationFct TxConfirmation = LocalConfigPtr->TxPduCfgs[ TxPduId ].TxConfirmation;
+
+#if CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+    CanIf_SetNotif( TxNotifSet, TxNotifAck, TxPduId );
+#endif
+
+    if( TxConfirmation != NULL_PTR )
+    {
+        TxConfirmation( TxPduId, E_OK );
+    }
+}
+
+/**
+ * @brief Checks a transmit request against its PDU and the PDU mode of its channel.
+ *
+ * The data shall be given unless the PDU has a trigger transmit, the length shall fit the PDU and
+ * the channel shall be CANIF_ONLINE, in CANIF_TX_OFFLINE_ACTIVE the PDU is confirmed right away
+ * without reaching the driver.
+ *
+ * @param[in] ApiId Service the request came from, for the errors reported
+ * @param[in] TxPduId Valid identifier of the PDU to be transmitted
+ * @param[in] PduInfoPtr Length of and pointer to the PDU data
+ *
+ * @retval  TX_REQUEST_WRITE, TX_REQUEST_CONFIRMED or TX_REQUEST_REJECTED
+ */
+CAN_STATIC uint8 CanIf_AcceptTx( uint8 ApiId, PduIdType TxPduId, const PduInfoType *PduInfoPtr )
+{
+    const CanIf_TxPduRuntime *TxPdu = &TxPduTable[ TxPduId ];
+    uint8 Request                   = TX_REQUEST_REJECTED;
+
+    /* only used to report errors */
+    (void)ApiId;
+
+    if( ( PduInfoPtr->SduDataPtr == NULL_PTR ) && ( LocalConfigPtr->TxPduCfgs[ TxPduId ].TriggerTransmit == NULL_PTR ) )
+    {
+        /*If the SduDataPtr of the PduInfoPtr is NULL_PTR and the PDU has no trigger transmit to
+        request its data from the upper layer, CanIf shall report development error code
+        CANIF_E_PARAM_POINTER to the Det_ReportError service of the DET and return E_NOT_OK*/
+        Det_ReportError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, ApiId, CANIF_E_PARAM_POINTER );
+    }
+    else if( PduInfoPtr->SduLength > TxPdu->MaxLength )
+    {
+        if( PduInfoPtr->SduLength > ( ( Bfx_GetBit_u32u8_u8( TxPdu->Pdu.id, CANID_FD_BIT ) == TRUE ) ? FD_MAX_LENGTH : CLASSIC_MAX_LENGTH ) )
+        {
+            /*When CanIf_Transmit() is called with PduInfoPtr->SduLength exceeding the maximum length
+            of the PDU referenced by TxPduId:
+                • SduLength > 8 if the Can_IdType indicates a classic CAN frame
+                • SduLength > 64 if the Can_IdType indicates a CAN FD frame
+            CanIf shall report runtime error code CANIF_E_DATA_LENGTH_MISMATCH to the
+            Det_ReportRuntimeError() service of the DET*/
+            Det_ReportRuntimeError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, ApiId, CANIF_E_DATA_LENGTH_MISMATCH );
+        }
+        else
+        {
+            /*If the length exceeds the one configured for the PDU and truncation is not supported,
+            CanIf shall report runtime error code CANIF_E_TXPDU_LENGTH_EXCEEDED and return E_NOT_OK
+            without further actions*/
+            Det_ReportRuntimeError( CANIF_MODULE_ID, CANIF_INSTANCE_ID, ApiId, CANIF_E_TXPDU_LENGTH_EXCEEDED );
+        }
+    }
+    else if( ( TxOnlineMask & TxPdu->ControllerMask ) == 0u )
+    {
+        if( ( TxOfflineActiveMask & TxPdu->ControllerMask ) != 0u )
+        {
+            /*In CANIF_TX_OFFLINE_ACTIVE the L-PDU is not handed to the driver, it is confirmed to
+            the upper layer as if it was sent*/
+            CanIf_ConfirmTx( TxPduId );
+            Request = TX_REQUEST_CONFIRMED;
+        }
+    }
+    else
+    {
+        Request = TX_REQUEST_WRITE;
+    }
+
+    return Request;
+}
+
+/**
+ * @brief Tells if a transmit PDU is handed to the driver with its controller interrupts held.
+ *
+ * It is when any HTH of its controller has a Tx buffer, the transmit confirmation drains it calling
+ * Can_Write which is not reentrant, or when the bus mirroring of its controller is active, the
+ * capture ring being written by the controller interrupt.
+ *
+ * @param[in] TxPdu Runtime view of the PDU
+ *
+ * @retval  TRUE: CanIf_WriteTxPdu shall be called with the interrupts held, FALSE: Can_Write is enough
+ */
+CAN_STATIC boolean CanIf_TxLocked( const CanIf_TxPduRuntime *TxPdu )
+{
+    boolean Locked = FALSE;
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+    Locked = ( ( TxBufferedMask & TxPdu->ControllerMask ) != 0u ) ? TRUE : Locked;
+#endif
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+    Locked = ( ( MirrorMask & TxPdu->ControllerMask ) != 0u ) ? TRUE : Locked;
+#endif
+    (void)TxPdu;
+
+    return Locked;
+}
+
+/**
+ * @brief Hands a transmit PDU to the CAN driver, with the interrupts of its controller held.
+ *
+ * A PDU already waiting in the Tx buffer gets the new data in place, sending it now would let the
+ * older data go after the newer one. Otherwise the PDU goes to Can_Write and, when the HTH is busy,
+ * to the Tx buffer. Once the driver answered CAN_BUSY, HthBusy sends the next PDUs of a burst for
+ * the same HTH straight to the Tx buffer, the buffered ones leave on the next confirmation.
+ *
+ * @param[in] TxPduId PDU accepted by CanIf_AcceptTx
+ * @param[in] PduInfoPtr Length of and pointer to the PDU data
+ * @param[in,out] HthBusy TRUE once the driver answered CAN_BUSY for the HTH
+ *
+ * @retval  E_OK: Handed to the driver or buffered, E_NOT_OK: Not accepted
+ */
+CAN_STATIC Std_ReturnType CanIf_WriteTxPdu( PduIdType TxPduId, const PduInfoType *PduInfoPtr, boolean *HthBusy )
+{
+    CanIf_TxPduRuntime *TxPdu = &TxPduTable[ TxPduId ];
+    Std_ReturnType RetVal     = E_NOT_OK;
+    Std_ReturnType CanRetVal  = CAN_BUSY;
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+    CanIf_TxBufferRuntime *Buffer = NULL_PTR;
+    uint8 Position                = 0u;
+
+    if( TxPdu->Buffer != TX_BUFFER_NONE )
+    {
+        Buffer   = &TxBuffers[ TxPdu->Buffer ];
+        Position = CanIf_FindTxBuffered( Buffer, TxPduId );
+    }
+#endif
+
+    /* Only the length and the payload change from one request to the next, Can_Write copies
+    them into the message RAM before returning, so the PDU can be reused right away */
+    TxPdu->Pdu.length = (uint8)PduInfoPtr->SduLength;
+    TxPdu->Pdu.sdu    = PduInfoPtr->SduDataPtr;
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+    if( ( Buffer != NULL_PTR ) && ( Position < Buffer->Count ) )
+    {
+        /*The PDU is already waiting, the new data overwrites the old one and keeps its place*/
+        CanIf_StoreTxBuffered( Buffer, Position, TxPduId, PduInfoPtr );
+        RetVal = E_OK;
+    }
+    else
+#endif
+    {
+        if( *HthBusy == FALSE )
+        {
+            CanRetVal = Can_Write( TxPdu->Hth, &TxPdu->Pdu );
+            *HthBusy  = ( CanRetVal == CAN_BUSY ) ? TRUE : FALSE;
+        }
+
+        if( CanRetVal == E_OK )
+        {
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+            /* a PDU without data was captured by CanIf_TriggerTransmit */
+            if( ( ( MirrorMask & TxPdu->ControllerMask ) != 0u ) && ( TxPdu->Pdu.sdu != NULL_PTR ) )
+            {
+                CanIf_MirrorFrame( TxPdu->ControllerId, CANIF_MIRROR_TX, TxPdu->Pdu.id, TxPdu->Pdu.length, TxPdu->Pdu.sdu );
+            }
+#endif
+            RetVal = E_OK;
+        }
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+        else if( ( CanRetVal == CAN_BUSY ) && ( Buffer != NULL_PTR ) && ( Buffer->Count < Buffer->Size ) &&
+                 ( ( PduInfoPtr->SduDataPtr == NULL_PTR ) || ( PduInfoPtr->SduLength <= CANIF_TX_BUFFER_MAX_LENGTH ) ) )
+        {
+            /*No hardware object is free, the PDU waits for the next confirmation*/
+            CanIf_StoreTxBuffered( Buffer, Position, TxPduId, PduInfoPtr );
+            RetVal = E_OK;
+        }
+#endif
+        else
+        {
+            /* Rejected by the driver, the HTH is busy or the buffer is full */
+        }
+    }
+
+    return RetVal;
+}
+
+/**
+ * @brief Checks the PDUs only reference HRHs and controllers the runtime tables hold.
+ *
+ * The HRH of a receive PDU indexes the receive lookup and the software filters, the controller of
+ * a transmit PDU is shifted into the PDU mode bitmasks, an out of range value would write past
+ * them. The controllers are already known to fit the bitmasks.
+ *
+ * @param[in] ConfigPtr Pointer to the CAN Interface configuration structure.
+ *
+ * @retval  TRUE when every reference is in range, FALSE otherwise
+ */
+CAN_STATIC boolean CanIf_PduRefsFit( const CanIf_ConfigType *ConfigPtr )
+{
+    boolean Fits = TRUE;
+
+    for( PduIdType TxPduId = 0u; TxPduId < ConfigPtr->MaxTxPduCfg; TxPduId++ )
+    {
+        if( ConfigPtr->TxPduCfgs[ TxPduId ].ControllerId >= ConfigPtr->NumberOfCanControllers )
+        {
+            Fits = FALSE;
+        }
+    }
+
+    for( PduIdType RxPduId = 0u; RxPduId < ConfigPtr->MaxRxPduCfg; RxPduId++ )
+    {
+        if( ConfigPtr->RxPduCfgs[ RxPduId ].Hrh >= CAN_NUMBER_OF_HOHS )
+        {
+            Fits = FALSE;
+        }
+    }
+
+    return Fits;
+}
+
+/**
+ * @brief Builds the runtime view of the transmit PDUs.
+ *
+ * The CAN id of each PDU is written with its format bits as Can_Write expects them, the extended
+ * identifier bit 31 and the CAN FD bit 30, and the maximum length is capped by the frame format.
+ *
+ * @param[in] ConfigPtr Pointer to the CAN Interface configuration structure.
+ */
+CAN_STATIC void CanIf_SetupTxPduTable( const CanIf_ConfigType *ConfigPtr )
+{
+    for( PduIdType TxPduId = 0u; TxPduId < ConfigPtr->MaxTxPduCfg; TxPduId++ )
+    {
+        const CanIf_TxPduCfgType *TxPduCfg = &ConfigPtr->TxPduCfgs[ TxPduId ];
+        CanIf_TxPduRuntime *TxPdu         = &TxPduTable[ TxPduId ];
+        uint8 FrameLength                 = ( TxPduCfg->FdFlag == TRUE ) ? FD_MAX_LENGTH : CLASSIC_MAX_LENGTH;
+
+        TxPdu->Pdu.id          = TxPduCfg->CanId;
+        Bfx_PutBit_u32u8u8( &TxPdu->Pdu.id, CANID_IDE_BIT, TxPduCfg->CanIdType );
+        Bfx_PutBit_u32u8u8( &TxPdu->Pdu.id, CANID_FD_BIT, TxPduCfg->FdFlag );
+        TxPdu->Pdu.swPduHandle = TxPduId;
+        TxPdu->Pdu.length      = 0u;
+        TxPdu->Pdu.sdu         = NULL_PTR;
+        TxPdu->Hth             = TxPduCfg->Hth;
+        TxPdu->MaxLength       = ( TxPduCfg->MaxLength < FrameLength ) ? TxPduCfg->MaxLength : FrameLength;
+        TxPdu->Buffer          = TX_BUFFER_NONE;
+        TxPdu->ControllerMask  = (uint32)1u << TxPduCfg->ControllerId;
+        TxPdu->ControllerId    = TxPduCfg->ControllerId;
+    }
+}
+
+/**
+ * @brief Builds the receive lookup array.
+ *
+ * The PDUs are counted per HRH to reserve a slice of the array for each one, then every single id
+ * PDU is inserted in order of key into its slice and the range PDUs are appended after them in
+ * configuration order, so the first configured range wins when two of them overlap.
+ *
+ * @param[in] ConfigPtr Pointer to the CAN Interface configuration structure.
+ */
+CAN_STATIC void CanIf_SetupRxLookup( const CanIf_ConfigType *ConfigPtr )
+{
+    uint16 Single[ CAN_NUMBER_OF_HOHS ] = { 0u };
+    uint16 Ranges[ CAN_NUMBER_OF_HOHS ] = { 0u };
+    uint16 First                        = 0u;
+
+    for( Can_HwHandleType Hrh = 0u; Hrh < CAN_NUMBER_OF_HOHS; Hrh++ )
+    {
+        RxHrhTable[ Hrh ].Count      = 0u;
+        RxHrhTable[ Hrh ].RangeCount = 0u;
+    }
+
+    for( PduIdType RxPduId = 0u; RxPduId < ConfigPtr->MaxRxPduCfg; RxPduId++ )
+    {
+        const CanIf_RxPduCfgType *RxPduCfg = &ConfigPtr->RxPduCfgs[ RxPduId ];
+
+        if( RxPduCfg->CanIdRange == TRUE )
+        {
+            RxHrhTable[ RxPduCfg->Hrh ].RangeCount++;
+        }
+        else
+        {
+            RxHrhTable[ RxPduCfg->Hrh ].Count++;
+        }
+    }
+
+    for( Can_HwHandleType Hrh = 0u; Hrh < CAN_NUMBER_OF_HOHS; Hrh++ )
+    {
+        RxHrhTable[ Hrh ].First = First;
+        First += RxHrhTable[ Hrh ].Count + RxHrhTable[ Hrh ].RangeCount;
+    }
+
+    for( PduIdType RxPduId = 0u; RxPduId < ConfigPtr->MaxRxPduCfg; RxPduId++ )
+    {
+        const CanIf_RxPduCfgType *RxPduCfg = &ConfigPtr->RxPduCfgs[ RxPduId ];
+        const CanIf_RxHrhRuntime *HrhRt    = &RxHrhTable[ RxPduCfg->Hrh ];
+        Can_IdType Key                     = CanIf_RxKey( RxPduCfg->CanId, RxPduCfg->CanIdType );
+        uint16 Entry;
+
+        if( RxPduCfg->CanIdRange == TRUE )
+        {
+            Entry = HrhRt->First + HrhRt->Count + Ranges[ RxPduCfg->Hrh ];
+            Ranges[ RxPduCfg->Hrh ]++;
+        }
+        else
+        {
+            /* Insertion in order, the configurations are small and this runs once */
+            Entry = HrhRt->First + Single[ RxPduCfg->Hrh ];
+            Single[ RxPduCfg->Hrh ]++;
+
+            while( ( Entry > HrhRt->First ) && ( RxLookup[ Entry - 1u ].Key > Key ) )
+            {
+                RxLookup[ Entry ] = RxLookup[ Entry - 1u ];
+                Entry--;
+            }
+        }
+
+        RxLookup[ Entry ].Key     = Key;
+        RxLookup[ Entry ].RxPduId = RxPduId;
+    }
+}
+
+/**
+ * @brief Receive lookup key of a configured CAN id.
+ *
+ * @param[in] CanId CAN identifier, 11 or 29 bits
+ * @param[in] CanIdType CANIF_CANID_STANDARD or CANIF_CANID_EXTENDED
+ *
+ * @retval  The id with the extended identifier bit set for 29 bits ids
+ */
+CAN_STATIC Can_IdType CanIf_RxKey( Can_IdType CanId, uint8 CanIdType )
+{
+    Can_IdType Key = CanId;
+
+    Bfx_PutBit_u32u8u8( &Key, CANID_IDE_BIT, CanIdType );
+
+    return Key;
+}
+
+/**
+ * @brief Looks for the receive PDU a frame belongs to.
+ *
+ * The single id PDUs of the HRH are tried first, a FullCAN HRH or a BasicCAN one with a few ids is
+ * compared entry by entry, larger sets are binary searched. When none matches the ranges of the HRH
+ * are tried in configuration order.
+ *
+ * @param[in] Hrh Hardware receive handle the frame was received from
+ * @param[in] Key CAN id of the frame with the extended identifier bit and the FD bit cleared
+ *
+ * @retval  The RxPduId or RX_PDU_NONE when no PDU accepts the frame
+ */
+CAN_STATIC PduIdType CanIf_LookupRxPdu( Can_HwHandleType Hrh, Can_IdType Key )
+{
+    const CanIf_RxHrhRuntime *HrhRt  = &RxHrhTable[ Hrh ];
+    const CanIf_RxLookupEntry *Slice = &RxLookup[ HrhRt->First ];
+    PduIdType RxPduId                = RX_PDU_NONE;
+
+    if( HrhRt->Count <= RX_LINEAR_MAX )
+    {
+        for( uint16 Entry = 0u; Entry < HrhRt->Count; Entry++ )
+        {
+            if( Slice[ Entry ].Key == Key )
+            {
+                RxPduId = Slice[ Entry ].RxPduId;
+                break;
+            }
+        }
+    }
+    else
+    {
+        uint16 Low  = 0u;
+        uint16 High = HrhRt->Count;
+
+        while( Low < High )
+        {
+            uint16 Middle = Low + ( ( High - Low ) >> 1u );
+
+            if( Slice[ Middle ].Key < Key )
+            {
+                Low = Middle + 1u;
+            }
+            else
+            {
+                High = Middle;
+            }
+        }
+
+        if( ( Low < HrhRt->Count ) && ( Slice[ Low ].Key == Key ) )
+        {
+            RxPduId = Slice[ Low ].RxPduId;
+        }
+    }
+
+    for( uint16 Entry = HrhRt->Count; ( RxPduId == RX_PDU_NONE ) && ( Entry < ( HrhRt->Count + HrhRt->RangeCount ) ); Entry++ )
+    {
+        const CanIf_RxPduCfgType *RxPduCfg = &LocalConfigPtr->RxPduCfgs[ Slice[ Entry ].RxPduId ];
+
+        if( ( Key >= Slice[ Entry ].Key ) && ( Key <= CanIf_RxKey( RxPduCfg->CanIdUpper, RxPduCfg->CanIdType ) ) )
+        {
+            RxPduId = Slice[ Entry ].RxPduId;
+        }
+    }
+
+    return RxPduId;
+}
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PRIVATE_SOFTWARE_FILTER == STD_ON
+/**
+ * @brief Builds the software filter of every HRH.
+ *
+ * Each 11 bits id accepted by a receive PDU sets its bit of the HRH bitmap, ranges included. Each
+ * 29 bits id sets the bit of its hash, an HRH with a 29 bits range accepts any 29 bits id since a
+ * range does not hash.
+ *
+ * @param[in] ConfigPtr Pointer to the CAN Interface configuration structure.
+ */
+CAN_STATIC void CanIf_SetupRxFilters( const CanIf_ConfigType *ConfigPtr )
+{
+    for( Can_HwHandleType Hrh = 0u; Hrh < CAN_NUMBER_OF_HOHS; Hrh++ )
+    {
+        for( uint8 Word = 0u; Word < RX_FILTER_STD_WORDS; Word++ )
+        {
+            RxFilters[ Hrh ].Standard[ Word ] = 0u;
+        }
+        for( uint8 Word = 0u; Word < RX_FILTER_EXT_WORDS; Word++ )
+        {
+            RxFilters[ Hrh ].Extended[ Word ] = 0u;
+        }
+    }
+
+    for( PduIdType RxPduId = 0u; RxPduId < ConfigPtr->MaxRxPduCfg; RxPduId++ )
+    {
+        const CanIf_RxPduCfgType *RxPduCfg = &ConfigPtr->RxPduCfgs[ RxPduId ];
+        CanIf_RxHrhFilter *Filter          = &RxFilters[ RxPduCfg->Hrh ];
+
+        if( RxPduCfg->CanIdType == CANIF_CANID_STANDARD )
+        {
+            Can_IdType Upper = ( RxPduCfg->CanIdRange == TRUE ) ? RxPduCfg->CanIdUpper : RxPduCfg->CanId;
+
+            for( Can_IdType Id = RxPduCfg->CanId; ( Id <= Upper ) && ( Id <= CANID_STD_MASK ); Id++ )
+            {
+                Filter->Standard[ Id >> RX_FILTER_WORD_SHIFT ] |= (uint32)1u << ( Id & RX_FILTER_BIT_MASK );
+            }
+        }
+        else if( RxPduCfg->CanIdRange == TRUE )
+        {
+            for( uint8 Word = 0u; Word < RX_FILTER_EXT_WORDS; Word++ )
+            {
+                Filter->Extended[ Word ] = RX_FILTER_ALL_BITS;
+            }
+        }
+        else
+        {
+            uint32 Hash = CanIf_RxFilterHash( RxPduCfg->CanId );
+
+            Filter->Extended[ Hash >> RX_FILTER_WORD_SHIFT ] |= (uint32)1u << ( Hash & RX_FILTER_BIT_MASK );
+        }
+    }
+}
+
+/**
+ * @brief Hashes a 29 bits id to a bit of the hashed set.
+ *
+ * Multiplicative hash, the top bits of the product depend on every bit of the id, so ids that
+ * only differ in their lowest byte, as the addressing of diagnostic ids, spread over the set.
+ *
+ * @param[in] CanId CAN id, the format bits are left out
+ *
+ * @retval  Bit of the hashed set
+ */
+CAN_STATIC uint32 CanIf_RxFilterHash( Can_IdType CanId )
+{
+    return ( ( CanId & CANID_EXT_MASK ) * RX_FILTER_HASH ) >> RX_FILTER_EXT_SHIFT;
+}
+
+/**
+ * @brief Tests a received frame against the software filter of its HRH.
+ *
+ * A single word of the HRH filter is tested, the bitmap one for 11 bits ids or the hashed set one
+ * for 29 bits ids.
+ *
+ * @param[in] Hrh Hardware receive handle the frame was received from
+ * @param[in] CanId CAN id of the frame with its format bits
+ *
+ * @retval  TRUE: A PDU of the HRH may accept the frame
+ *          FALSE: No PDU of the HRH accepts the frame
+ */
+CAN_STATIC boolean CanIf_RxFilterPass( Can_HwHandleType Hrh, Can_IdType CanId )
+{
+    const CanIf_RxHrhFilter *Filter = &RxFilters[ Hrh ];
+    uint32 Word;
+    uint32 Bit;
+
+    if( Bfx_GetBit_u32u8_u8( CanId, CANID_IDE_BIT ) == TRUE )
+    {
+        Bit  = CanIf_RxFilterHash( CanId );
+        Word = Filter->Extended[ Bit >> RX_FILTER_WORD_SHIFT ];
+    }
+    else
+    {
+        Bit  = CanId & CANID_STD_MASK;
+        Word = Filter->Standard[ Bit >> RX_FILTER_WORD_SHIFT ];
+    }
+
+    return ( ( Word & ( (uint32)1u << ( Bit & RX_FILTER_BIT_MASK ) ) ) != 0u ) ? TRUE : FALSE;
+}
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if CANIF_PUBLIC_TX_BUFFERING == STD_ON
+/**
+ * @brief Checks the transmit buffers fit the room reserved for them and reference a configured
+ *        controller.
+ *
+ * @param[in] ConfigPtr Pointer to the CAN Interface configuration structure.
+ *
+ * @retval  TRUE when the buffers and their entries fit, FALSE otherwise
+ */
+CAN_STATIC boolean CanIf_TxBuffersFit( const CanIf_ConfigType *ConfigPtr )
+{
+    boolean Fits = FALSE;
+
+    if( ConfigPtr->NumberOfBuffers <= CANIF_NUMBER_OF_TX_BUFFERS )
+    {
+        uint32 Entries = 0u;
+
+        boolean Controllers = TRUE;
+
+        for( uint8 Buffer = 0u; Buffer < ConfigPtr->NumberOfBuffers; Buffer++ )
+        {
+            Entries += ConfigPtr->BufferCfgs[ Buffer ].Size;
+            /* the controller is shifted into TxBufferedMask */
+            Controllers = ( ConfigPtr->BufferCfgs[ Buffer ].ControllerId < ConfigPtr->NumberOfCanControllers ) ? Controllers : FALSE;
+        }
+
+        Fits = ( ( Entries <= CANIF_TX_BUFFER_ENTRIES ) && ( Controllers == TRUE ) ) ? TRUE : FALSE;
+    }
+
+    return Fits;
+}
+
+/**
+ * @brief Builds the transmit buffers.
+ *
+ * Each buffer takes its slice of the entries, all of them free, and every transmit PDU sent
+ * through a buffered HTH is linked to its buffer. The controllers owning a buffer are marked in
+ * TxBufferedMask.
+ *
+ * @param[in] ConfigPtr Pointer to the CAN Interface configuration structure.
+ */
+CAN_STATIC void CanIf_SetupTxBuffers( const CanIf_ConfigType *ConfigPtr )
+{
+    uint16 First = 0u;
+
+    TxBufferedMask = 0u;
+
+    for( uint8 Buffer = 0u; Buffer < ConfigPtr->NumberOfBuffers; Buffer++ )
+    {
+        const CanIf_BufferCfgType *BufferCfg = &ConfigPtr->BufferCfgs[ Buffer ];
+        CanIf_TxBufferRuntime *TxBuffer      = &TxBuffers[ Buffer ];
+
+        TxBuffer->First        = First;
+        TxBuffer->Hth          = BufferCfg->Hth;
+        TxBuffer->ControllerId = BufferCfg->ControllerId;
+        TxBuffer->Size         = BufferCfg->Size;
+        TxBuffer->Count        = 0u;
+
+        for( uint8 Entry = 0u; Entry < BufferCfg->Size; Entry++ )
+        {
+            TxBufferOrder[ First + Entry ] = (uint8)( First + Entry );
+        }
+        First += BufferCfg->Size;
+
+        if( BufferCfg->Size > 0u )
+        {
+            TxBufferedMask |= (uint32)1u << BufferCfg->ControllerId;
+        }
+
+        for( PduIdType TxPduId = 0u; TxPduId < ConfigPtr->MaxTxPduCfg; TxPduId++ )
+        {
+            if( ( TxPduTable[ TxPduId ].Hth == BufferCfg->Hth ) && ( BufferCfg->Size > 0u ) )
+            {
+                TxPduTable[ TxPduId ].Buffer = Buffer;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Bus arbitration priority of a CAN id.
+ *
+ * The standard ids are aligned with the base id of the extended ones and the extended ids carry
+ * one more bit set for the SRR and IDE bits, so a standard id wins over the extended ids with
+ * the same base id, just like on the bus.
+ *
+ * @param[in] CanId CAN id with its format bits as Can_Write expects them
+ *
+ * @retval  Priority, the lower the value the higher the priority
+ */
+CAN_STATIC uint32 CanIf_TxPriority( Can_IdType CanId )
+{
+    uint32 Priority;
+
+    if( Bfx_GetBit_u32u8_u8( CanId, CANID_IDE_BIT ) == TRUE )
+    {
+        Priority = ( ( CanId & CANID_EXT_MASK ) << 1u ) | 1u;
+    }
+    else
+    {
+        Priority = ( CanId & CANID_STD_MASK ) << TX_PRIORITY_STD_SHIFT;
+    }
+
+    return Priority;
+}
+
+/**
+ * @brief Looks for a PDU in a transmit buffer.
+ *
+ * @param[in] Buffer Transmit buffer
+ * @param[in] TxPduId PDU to look for
+ *
+ * @retval  Position of the PDU in the buffer order, Count when it is not buffered
+ */
+CAN_STATIC uint8 CanIf_FindTxBuffered( const CanIf_TxBufferRuntime *Buffer, PduIdType TxPduId )
+{
+    uint8 Position = 0u;
+
+    while( ( Position < Buffer->Count ) && ( TxBufferEntries[ TxBufferOrder[ Buffer->First + Position ] ].TxPduId != TxPduId ) )
+    {
+        Position++;
+    }
+
+    return Position;
+}
+
+/**
+ * @brief Stores a PDU into a transmit buffer.
+ *
+ * A PDU already buffered gets its data overwritten in place, otherwise the first free entry takes
+ * it and is inserted in order of priority, after the entries with the same priority so those
+ * leave first.
+ *
+ * @param[in] Buffer Transmit buffer
+ * @param[in] Position Position returned by CanIf_FindTxBuffered, Count requires a free entry
+ * @param[in] TxPduId PDU to store
+ * @param[in] PduInfoPtr Payload of the PDU
+ */
+CAN_STATIC void CanIf_StoreTxBuffered( CanIf_TxBufferRuntime *Buffer, uint8 Position, PduIdType TxPduId, const PduInfoType *PduInfoPtr )
+{
+    uint8 *Order               = &TxBufferOrder[ Buffer->First ];
+    uint8 Slot                 = Order[ Position ];
+    CanIf_TxBufferEntry *Entry = &TxBufferEntries[ Slot ];
+
+    /* a PDU requested without data gets it from the upper layer when it is finally sent */
+    Entry->Trigger = ( PduInfoPtr->SduDataPtr == NULL_PTR ) ? TRUE : FALSE;
+    for( uint8 Byte = 0u; ( Entry->Trigger == FALSE ) && ( Byte < PduInfoPtr->SduLength ); Byte++ )
+    {
+        Entry->Data[ Byte ] = PduInfoPtr->SduDataPtr[ Byte ];
+    }
+    Entry->Length  = (uint8)PduInfoPtr->SduLength;
+    Entry->TxPduId = TxPduId;
+
+    if( Position == Buffer->Count )
+    {
+        uint32 Priority = CanIf_TxPriority( TxPduTable[ TxPduId ].Pdu.id );
+
+        while( ( Position > 0u ) && ( CanIf_TxPriority( TxPduTable[ TxBufferEntries[ Order[ Position - 1u ] ].TxPduId ].Pdu.id ) <= Priority ) )
+        {
+            Order[ Position ] = Order[ Position - 1u ];
+            Position--;
+        }
+        Order[ Position ] = Slot;
+        Buffer->Count++;
+    }
+}
+
+/**
+ * @brief Sends the highest priority PDU of a transmit buffer.
+ *
+ * Called from the transmit confirmation, the entry is released unless the driver is still busy,
+ * a PDU the driver rejects is dropped so it does not block the buffer and its upper layer is told
+ * the transmission failed.
+ *
+ * @param[in] Buffer Transmit buffer
+ */
+CAN_STATIC void CanIf_DrainTxBuffer( CanIf_TxBufferRuntime *Buffer )
+{
+    if( Buffer->Count > 0u )
+    {
+        CanIf_TxBufferEntry *Entry = &TxBufferEntries[ TxBufferOrder[ Buffer->First + Buffer->Count - 1u ] ];
+        Can_PduType Pdu            = TxPduTable[ Entry->TxPduId ].Pdu;
+        Std_ReturnType CanRetVal;
+
+        Pdu.length = Entry->Length;
+        Pdu.sdu    = ( Entry->Trigger == TRUE ) ? NULL_PTR : Entry->Data;
+
+        CanRetVal = Can_Write( Buffer->Hth, &Pdu );
+
+        if( CanRetVal != CAN_BUSY )
+        {
+            Buffer->Count--;
+        }
+
+        if( CanRetVal == E_NOT_OK )
+        {
+            CanIf_TxConfirmationFct TxConfirmation = LocalConfigPtr->TxPduCfgs[ Entry->TxPduId ].TxConfirmation;
+
+            /* the dropped PDU will never be sent */
+            if( TxConfirmation != NULL_PTR )
+            {
+                TxConfirmation( Entry->TxPduId, E_NOT_OK );
+            }
+        }
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+        /* a PDU without data was captured by CanIf_TriggerTransmit */
+        if( ( CanRetVal == E_OK ) && ( ( MirrorMask & ( (uint32)1u << Buffer->ControllerId ) ) != 0u ) && ( Pdu.sdu != NULL_PTR ) )
+        {
+            CanIf_MirrorFrame( Buffer->ControllerId, CANIF_MIRROR_TX, Pdu.id, Pdu.length, Pdu.sdu );
+        }
+#endif
+    }
+}
+#endif
+
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief Captures a frame into the capture ring of its controller.
+ *
+ * Called from both interrupt lines of the controller, which can run at different priorities and
+ * preempt each other, and from task level, so the interrupts of the controller are held while the
+ * slot of Head is filled and then published by incrementing Head. The reader is never waited for
+ * and a full ring overwrites its oldest frame. The payload is truncated to CANIF_MIRROR_MAX_LENGTH.
+ *
+ * @param[in] ControllerId Controller the frame went through
+ * @param[in] Direction CANIF_MIRROR_RX or CANIF_MIRROR_TX
+ * @param[in] CanId CAN id with the extended and FD bits
+ * @param[in] Length Payload length
+ * @param[in] Data Payload of the frame
+ */
+CAN_STATIC void CanIf_MirrorFrame( uint8 ControllerId, uint8 Direction, Can_IdType CanId, PduLengthType Length, const uint8 *Data )
+{
+    CanIf_MirrorRing *Ring = &MirrorRings[ ControllerId ];
+    uint8 Copy             = ( Length < CANIF_MIRROR_MAX_LENGTH ) ? (uint8)Length : CANIF_MIRROR_MAX_LENGTH;
+    volatile CanIf_MirrorEntry *Entry;
+    uint32 Head;
+
+    /* Head is read, the slot filled and Head written back with no other writer in between */
+    Can_DisableControllerInterrupts( ControllerId );
+
+    Head  = Ring->Head;
+    Entry = &Ring->Frames[ Head & MIRROR_RING_MASK ];
+
+    Entry->TimeStamp = CANIF_MIRROR_TIMESTAMP( );
+    Entry->CanId     = CanId;
+    Entry->Direction = Direction;
+    Entry->Length    = Copy;
+    for( uint8 Byte = 0u; Byte < Copy; Byte++ )
+    {
+        Entry->Data[ Byte ] = Data[ Byte ];
+    }
+
+    Ring->Head = Head + 1u;
+
+    Can_EnableControllerInterrupts( ControllerId );
+}
+#endif
+
+#if CANIF_PUBLIC_READ_RX_PDU_DATA == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief Keeps a received L-PDU for CanIf_ReadRxPduData.
+ *
+ * Called from the reception interrupt, the payload goes into the copy not published, truncated to
+ * CANIF_RX_BUFFER_MAX_LENGTH, and the copy is published afterwards. The sequence skips zero when
+ * it wraps around, zero is kept for nothing received.
+ *
+ * @param[in] Buffer Storage of the receive PDU
+ * @param[in] PduInfoPtr Received L-PDU
+ */
+CAN_STATIC void CanIf_StoreRxPduData( CanIf_RxPduData *Buffer, const PduInfoType *PduInfoPtr )
+{
+    uint32 Sequence = Buffer->Sequence + 1u;
+    uint8 Copy      = (uint8)( Sequence & 1u );
+    uint8 Length    = ( PduInfoPtr->SduLength < CANIF_RX_BUFFER_MAX_LENGTH ) ? (uint8)PduInfoPtr->SduLength : CANIF_RX_BUFFER_MAX_LENGTH;
+
+    for( uint8 Byte = 0u; Byte < Length; Byte++ )
+    {
+        Buffer->Data[ Copy ][ Byte ] = PduInfoPtr->SduDataPtr[ Byte ];
+    }
+    Buffer->Length[ Copy ] = Length;
+
+    Buffer->Sequence = ( Sequence == 0u ) ? 2u : Sequence;
+}
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at CanIf_Cfg.h */
+#if ( CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS == STD_ON ) || ( CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS == STD_ON )
+/**
+ * @brief Flags the notification of a PDU.
+ *
+ * A notification is pending while the PDU flag differs between the Set and the Ack arrays, the
+ * notifications only write Set and the readers only write Ack, so neither of them needs to lock
+ * the other out. Every PDU owns a byte, the flag is updated with a single store and a notification
+ * preempting another one of any PDU cannot undo it. The flag of Set takes the inverse of the Ack
+ * one, a notification already pending stays as it is.
+ *
+ * @param[in] Set Flags written by the notifications
+ * @param[in] Ack Flags written by the readers
+ * @param[in] PduId PDU notified
+ */
+CAN_STATIC void CanIf_SetNotif( volatile uint8 *Set, const volatile uint8 *Ack, PduIdType PduId )
+{
+    Set[ PduId ] = (uint8)( Ack[ PduId ] ^ 1u );
+}
+
+/**
+ * @brief Reads and resets the pending notification of a PDU.
+ *
+ * The flag read from Set is copied into Ack with a single store, a notification flagged after Set
+ * was read stays pending for the next call. Readers of the same PDU shall not preempt each other.
+ *
+ * @param[in] Set Flags written by the notifications
+ * @param[in] Ack Flags written by the readers
+ * @param[in] PduId PDU to read
+ *
+ * @retval  TRUE when the PDU was notified since the last read
+ */
+CAN_STATIC boolean CanIf_ClearNotif( const volatile uint8 *Set, volatile uint8 *Ack, PduIdType PduId )
+{
+    uint8 Flag      = Set[ PduId ];
+    boolean Pending = ( Flag != Ack[ PduId ] ) ? TRUE : FALSE;
+
+    Ack[ PduId ] = Flag;
+
+    return Pending;
+}
+
+/**
+ * @brief Reads and resets the pending notifications of a bitmap word.
+ *
+ * Packs the flags of the 32 PDUs of the word into a bitmap, each PDU is reset on its own with
+ * CanIf_ClearNotif so no store spans the flags of other PDUs.
+ *
+ * @param[in] Set Flags written by the notifications
+ * @param[in] Ack Flags written by the readers
+ * @param[in] Word Bitmap word to read
+ * @param[in] Pdus Number of PDUs of the arrays
+ *
+ * @retval  Pending notifications of the word, bit n stands for the PDU 32 * Word + n
+ */
+CAN_STATIC uint32 CanIf_ClearNotifWord( const volatile uint8 *Set, volatile uint8 *Ack, uint8 Word, PduIdType Pdus )
+{
+    uint32 Pending = 0u;
+    PduIdType First = (PduIdType)Word << NOTIF_WORD_SHIFT;
+
+    for( PduIdType PduId = First; ( PduId < Pdus ) && ( PduId <= ( First + NOTIF_BIT_MASK ) ); PduId++ )
+    {
+        if( CanIf_ClearNotif( Set, Ack, PduId ) == TRUE )
+        {
+            Pending |= (uint32)1u << ( PduId & NOTIF_BIT_MASK );
+        }
+    }
+
+    return Pending;
+}
+#endif
@@ -14,6 +14,56 @@
 
 #include "CanIf_Cfg.h"
 
+/**
+ * @defgroup CanIf_Notif_bits Notification status bitmaps
+ *
+ * Words of the bitmaps returned by CanIf_ReadTxNotifStatusBits and CanIf_ReadRxNotifStatusBits,
+ * bit n % 32 of word n / 32 stands for the PDU n
+ *
+ * @{ */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define CANIF_TX_NOTIF_WORDS ( ( CANIF_NUMBER_OF_TX_PDUS + 31u ) / 32u ) /*!< Words of the Tx bitmap */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define CANIF_RX_NOTIF_WORDS ( ( CANIF_NUMBER_OF_RX_PDUS + 31u ) / 32u ) /*!< Words of the Rx bitmap */
+/**
+ * @} */
+
+#if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @defgroup CanIf_Mirror_direction Direction of a mirrored frame
+ *
+ * @{ */
+#define CANIF_MIRROR_RX 0u /*!< Frame received by the controller */
+#define CANIF_MIRROR_TX 1u /*!< Frame handed to the controller for transmission */
+/**
+ * @} */
+
+/**
+ * @brief  Frame captured by the bus mirroring, as returned by CanIf_ReadMirrorFrames.
+ */
+typedef struct _CanIf_MirrorFrameType
+{
+    uint32 TimeStamp;                      /*!< CANIF_MIRROR_TIMESTAMP when the frame was captured */
+    uint32 Sequence;                       /*!< Frames captured on the controller before this one */
+    Can_IdType CanId;                      /*!< CAN id with the extended and FD bits */
+    uint8 Direction;                       /*!< CANIF_MIRROR_RX or CANIF_MIRROR_TX */
+    uint8 Length;                          /*!< Payload captured, truncated to CANIF_MIRROR_MAX_LENGTH */
+    uint8 Data[ CANIF_MIRROR_MAX_LENGTH ]; /*!< Payload of the frame */
+} CanIf_MirrorFrameType;
+#endif
+
+#if CANIF_TRANSMIT_MULTIPLE_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief  Transmit request of a burst passed to CanIf_TransmitMultiple, the same parameters as
+ *         CanIf_Transmit. The result of each request is E_OK or E_NOT_OK, the same CanIf_Transmit
+ *         would return for it.
+ */
+typedef struct _CanIf_TxRequestType
+{
+    PduIdType TxPduId;             /*!< Identifier of the PDU to be transmitted */
+    const PduInfoType *PduInfoPtr; /*!< Length of and pointer to the PDU data */
+} CanIf_TxRequestType;
+#endif
 
 void CanIf_Init( const CanIf_ConfigType *ConfigPtr );
 void CanIf_DeInit( void );
@@ -21,14 +71,19 @@ Std_ReturnType CanIf_SetControllerMode( uint8 ControllerId, Can_ControllerStateT
 Std_ReturnType CanIf_GetControllerMode( uint8 ControllerId, Can_ControllerStateType *ControllerModePtr );
 Std_ReturnType CanIf_GetControllerErrorState( uint8 ControllerId, Can_ErrorStateType *ErrorStatePtr );
 Std_ReturnType CanIf_Transmit( PduIdType TxPduId, const PduInfoType *PduInfoPtr );
+#if CANIF_TRANSMIT_MULTIPLE_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+Std_ReturnType CanIf_TransmitMultiple( const CanIf_TxRequestType *Requests, Std_ReturnType *Results, uint8 Count );
+#endif
 #if CANIF_PUBLIC_READ_RX_PDU_DATA == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 Std_ReturnType CanIf_ReadRxPduData( PduIdType CanIfRxSduId, PduInfoType *CanIfRxInfoPtr );
 #endif
 #if CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 CanIf_NotifStatusType CanIf_ReadTxNotifStatus( PduIdType CanIfTxSduId );
+Std_ReturnType CanIf_ReadTxNotifStatusBits( uint32 *NotifStatusBits );
 #endif
 #if CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 CanIf_NotifStatusType CanIf_ReadRxNotifStatus( PduIdType CanIfRxSduId );
+Std_ReturnType CanIf_ReadRxNotifStatusBits( uint32 *NotifStatusBits );
 #endif
 Std_ReturnType CanIf_SetPduMode( uint8 ControllerId, CanIf_PduModeType PduModeRequest );
 Std_ReturnType CanIf_GetPduMode( uint8 ControllerId, CanIf_PduModeType *PduModePtr );
@@ -44,6 +99,7 @@ Std_ReturnType CanIf_GetControllerRxErrorCounter( uint8 ControllerId, uint8 *RxE
 Std_ReturnType CanIf_GetControllerTxErrorCounter( uint8 ControllerId, uint8 *TxErrorCounterPtr );
 #if CANIF_BUS_MIRRORING_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 Std_ReturnType CanIf_EnableBusMirroring( uint8 ControllerId, boolean MirroringActive );
+Std_ReturnType CanIf_ReadMirrorFrames( uint8 ControllerId, CanIf_MirrorFrameType *Frames, uint16 *FramesCountPtr );
 #endif
 #if CANIF_GLOBAL_TIME_SUPPORT == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 Std_ReturnType CanIf_GetCurrentTime( uint8 Controller, Can_TimeStampType *timeStampPtr );
@@ -13,10 +13,12 @@
 #include "Can_Types.h"
 
 void CanIf_TxConfirmation( PduIdType CanTxPduId );
+void CanIf_CancelTxConfirmation( PduIdType CanTxPduId, const PduInfoType *PduInfoPtr );
 void CanIf_RxIndication( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr );
 void CanIf_ControllerBusOff( uint8 ControllerId );
 void CanIf_ControllerModeIndication( uint8 ControllerId, Can_ControllerStateType ControllerMode );
 void CanIf_ControllerErrorStatePassive( uint8 ControllerId, uint16 RxErrorCounter, uint16 TxErrorCounter );
 void CanIf_ErrorNotification( uint8 ControllerId, Can_ErrorType CanError );
+Std_ReturnType CanIf_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr );
 
 #endif /* CANIF_CAN_H__ */
@@ -38,12 +38,18 @@
 #define CANIF_ID_ENABLE_EGRESS_TS     0x52 /*!< CanIf_EnableEgressTimeStamp() */
 #define CANIF_ID_GET_EGRESS_TS        0x53 /*!< CanIf_GetEgressTimeStamp() */
 #define CANIF_ID_GET_INGRESS_TS       0x54 /*!< CanIf_GetIngressTimeStamp() */
+#define CANIF_ID_TRIGGER_TRANSMIT     0x41 /*!< CanIf_TriggerTransmit() */
 #define CANIF_ID_TX_CONFIRMATION      0x13 /*!< CanIf_TxConfirmation() */
+#define CANIF_ID_CANCEL_TX_CONFIRM    0x15 /*!< CanIf_CancelTxConfirmation() */
 #define CANIF_ID_RX_INDICATION        0x14 /*!< CanIf_RxIndication() */
 #define CANIF_ID_CTRL_BUS_OFF         0x16 /*!< CanIf_ControllerBusOff() */
 #define CANIF_ID_CTRL_MODE_INDICATION 0x17 /*!< CanIf_ControllerModeIndication() */
 #define CANIF_ID_CTRL_ERR_ST_PASIVE   0x4f /*!< CanIf_ControllerErrorStatePassive() */
 #define CANIF_ID_ERR_NOTIF            0x50 /*!< CanIf_ErrorNotification() */
+#define CANIF_ID_READ_TX_NOTIF_BITS   0x60 /*!< CanIf_ReadTxNotifStatusBits() */
+#define CANIF_ID_READ_RX_NOTIF_BITS   0x61 /*!< CanIf_ReadRxNotifStatusBits() */
+#define CANIF_ID_READ_MIRROR_FRAMES   0x62 /*!< CanIf_ReadMirrorFrames() */
+#define CANIF_ID_TRANSMIT_MULTIPLE    0x63 /*!< CanIf_TransmitMultiple() */
 /**
  * @} */
 
@@ -85,6 +91,15 @@
 /**
  * @} */
 
+/**
+ * @defgroup CanIf_CanId_Types CanIf CAN identifier types
+ *
+ * @{ */
+#define CANIF_CANID_STANDARD          0u /*!< 11 bits CAN identifier */
+#define CANIF_CANID_EXTENDED          1u /*!< 29 bits CAN identifier */
+/**
+ * @} */
+
 /**
  * @brief Pdu mode type.
  *
@@ -141,6 +156,101 @@ typedef struct _CanIf_CtrlCfgType
                                     from the CAN Driver module to be served by the CAN Interface module. */
 } CanIf_CtrlCfgType;
 
+/**
+ * @brief Upper layer trigger transmit.
+ *
+ * Callback the CanIf invokes when the CAN driver is about to send a transmit PDU requested without
+ * data, the upper layer copies its latest data to SduDataPtr, up to SduLength bytes, and updates
+ * SduLength with the bytes written. TxPduId is the index of the PDU configuration.
+ */
+typedef Std_ReturnType ( *CanIf_TriggerTransmitFct )( PduIdType TxPduId, PduInfoType *PduInfoPtr );
+
+/**
+ * @brief Upper layer transmit confirmation.
+ *
+ * Callback the CanIf invokes once a transmit PDU has been sent, or right away from CanIf_Transmit
+ * when the channel of the PDU is in CANIF_TX_OFFLINE_ACTIVE mode. TxPduId is the index of the PDU
+ * configuration.
+ */
+typedef void ( *CanIf_TxConfirmationFct )( PduIdType TxPduId, Std_ReturnType Result );
+
+/**
+ * @brief CanIf Tx PDU configuration type.
+ *
+ * This container contains the configuration (parameters) of a transmit CAN L-PDU, the TxPduId
+ * used by the upper layers to transmit the L-PDU is its index in the configuration array.
+ */
+typedef struct _CanIf_TxPduCfgType
+{
+    Can_IdType CanId; /*!< CAN identifier of the transmit CAN L-PDU, 11 or 29 bits as per CanIdType */
+
+    Can_HwHandleType Hth; /*!< Hardware transmit handle of the CAN Driver the L-PDU is sent through */
+
+    uint8 ControllerId; /*!< CAN controller of the HTH, its PDU mode gates the transmission */
+
+    uint8 CanIdType; /*!< Type of CAN identifier, CANIF_CANID_STANDARD or CANIF_CANID_EXTENDED */
+
+    boolean FdFlag; /*!< TRUE when the L-PDU is sent as a CAN FD frame, FALSE for a classic frame */
+
+    uint8 MaxLength; /*!< Maximum data length of the L-PDU, it shall not exceed 8 for classic frames
+                     and 64 for CAN FD frames */
+
+    CanIf_TriggerTransmitFct TriggerTransmit; /*!< Upper layer trigger transmit, NULL_PTR when the data
+                                              is always passed to CanIf_Transmit */
+
+    CanIf_TxConfirmationFct TxConfirmation; /*!< Upper layer confirmation, NULL_PTR when nobody is notified */
+} CanIf_TxPduCfgType;
+
+/**
+ * @brief CanIf Tx buffer configuration type.
+ *
+ * This container contains the configuration (parameters) of a transmit buffer, the L-PDUs sent
+ * through its HTH are stored there when the CAN driver has no free hardware object for them and
+ * sent on the next transmit confirmation of the same HTH, highest priority first.
+ */
+typedef struct _CanIf_BufferCfgType
+{
+    Can_HwHandleType Hth; /*!< Hardware transmit handle the buffer feeds */
+
+    uint8 ControllerId; /*!< CAN controller of the HTH, its interrupts are held while the buffer is updated */
+
+    uint8 Size; /*!< Number of L-PDUs the buffer can hold, zero for no buffering */
+} CanIf_BufferCfgType;
+
+/**
+ * @brief Upper layer reception indication.
+ *
+ * Callback the CanIf invokes for every received L-PDU that matches a receive PDU configuration,
+ * RxPduId is the index of the matching configuration.
+ */
+typedef void ( *CanIf_RxIndicationFct )( PduIdType RxPduId, const PduInfoType *PduInfoPtr );
+
+/**
+ * @brief CanIf Rx PDU configuration type.
+ *
+ * This container contains the configuration (parameters) of a receive CAN L-PDU, the RxPduId
+ * is its index in the configuration array. A PDU either accepts a single CAN identifier or, when
+ * CanIdRange is set, every identifier of the same type from CanId up to CanIdUpper.
+ */
+typedef struct _CanIf_RxPduCfgType
+{
+    Can_IdType CanId; /*!< CAN identifier of the receive CAN L-PDU, lower limit when CanIdRange is TRUE */
+
+    Can_IdType CanIdUpper; /*!< Upper limit of the CanIfRxPduCanIdRange, only used when CanIdRange is TRUE */
+
+    Can_HwHandleType Hrh; /*!< Hardware receive handle of the CAN Driver the L-PDU is received from */
+
+    uint8 CanIdType; /*!< Type of CAN identifier, CANIF_CANID_STANDARD or CANIF_CANID_EXTENDED */
+
+    boolean CanIdRange; /*!< TRUE when the PDU accepts the CanId to CanIdUpper range */
+
+    boolean ReadData; /*!< TRUE when the last L-PDU received is kept for CanIf_ReadRxPduData */
+
+    uint8 DataLength; /*!< Shortest payload accepted by the data length check, 0 accepts any */
+
+    CanIf_RxIndicationFct RxIndication; /*!< Upper layer indication, NULL_PTR when nobody is notified */
+} CanIf_RxPduCfgType;
+
 /**
  * @brief Configuration structure for the CAN interface.
  *
@@ -154,12 +264,20 @@ typedef struct _CanIf_ConfigType
 {
     const CanIf_CtrlCfgType *CtrlCfgs; /*!< Can controllers configuration array */
 
+    const CanIf_TxPduCfgType *TxPduCfgs; /*!< Tx PDUs configuration array, indexed by TxPduId */
+
+    const CanIf_RxPduCfgType *RxPduCfgs; /*!< Rx PDUs configuration array, indexed by RxPduId */
+
+    const CanIf_BufferCfgType *BufferCfgs; /*!< Tx buffers configuration array, one per buffered HTH */
+
     uint8 NumberOfCanControllers; /*!< Number of controllers */
 
     uint8 MaxRxPduCfg; /*!< Maximum number of Pdus. */
 
     uint8 MaxTxPduCfg; /*!< Maximum number of Pdus */
 
+    uint8 NumberOfBuffers; /*!< Number of Tx buffers */
+
 } CanIf_ConfigType;
 
 #endif /* CANIF_TYPES_H__ */
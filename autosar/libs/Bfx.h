@@ -1,3 +1,8 @@
+#ifndef BFX_H__
+#define BFX_H__
+
 #include "Bfx_8bits.h"
 #include "Bfx_16bits.h"
-#include "Bfx_32bits.h"
\ No newline at end of file
+#include "Bfx_32bits.h"
+
+#endif
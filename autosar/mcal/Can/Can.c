@@ -27,6 +27,15 @@
 #include "Det.h"
 #endif
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_CONFIGURATION_VARIANT == CAN_VARIANT_PRE_COMPILE
+/* The architecture code, and with it the configuration, becomes part of this translation unit,
+the entry points see the configuration values and the lookups of their hot paths fold instead of
+being walked at run time across the Can_Arch calls */
+#define CAN_ARCH_PRE_COMPILE
+#include "Can_Arch.c"
+#endif
+
 /* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared at Can.h */
 /* cppcheck-suppress misra-config ; this is declared at Can_Cfg.h */
 /* clang-format off */
@@ -54,7 +63,8 @@ CAN_STATIC Can_HwUnit HwUnit =
  * @brief    **Can Initialization**
  *
  * This function initializes the module and the CAN controller. The CAN controller is initialized
- * according to the parameter Config.
+ * according to the parameter Config, a controller whose reception filters do not fit in message
+ * RAM is left in CAN_CS_UNINIT state.
  *
  * @param    Config Pointer to driver configuration
  *
@@ -73,10 +83,11 @@ void Can_Init( const Can_ConfigType *Config )
     {
         for( uint8 Controller = 0; Controller < CAN_NUMBER_OF_CONTROLLERS; Controller++ )
         {
-            /*Init driver */
-            Can_Arch_Init( &HwUnit, Config, Controller );
-            /*set configured state*/
-            HwUnit.ControllerState[ Controller ] = CAN_CS_STOPPED;
+            /*Init driver and set configured state*/
+            if( Can_Arch_Init( &HwUnit, Config, Controller ) == E_OK )
+            {
+                HwUnit.ControllerState[ Controller ] = CAN_CS_STOPPED;
+            }
         }
 
         /*update Hardware init state*/
@@ -143,7 +154,7 @@ Std_ReturnType Can_SetBaudrate( uint8 Controller, uint16 BaudRateConfigID )
         initialized.⌋*/
         Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_SET_BAUDRATE, CAN_E_UNINIT );
     }
-    else if( BaudRateConfigID >= HwUnit.Config->Controllers[ Controller ].BaudrateConfigsCount )
+    else if( BaudRateConfigID >= CAN_CONFIG( HwUnit.Config )->Controllers[ Controller ].BaudrateConfigsCount )
     {
         /* If development error detection for the Can module is enabled:
         The function Can_SetBaudrate shall raise the error CAN_E_PARAM_BAUDRATE if the parameter
@@ -586,7 +597,7 @@ void Can_EnableEgressTimeStamp( Can_HwHandleType Hth )
         the function shall raise the development error CAN_E_UNINIT. */
         Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_ENABLE_EGRESS_TS, CAN_E_UNINIT );
     }
-    else if( HwUnit.Config->Hohs[ Hth ].ObjectType != CAN_HOH_TYPE_TRANSMIT )
+    else if( CAN_CONFIG( HwUnit.Config )->Hohs[ Hth ].ObjectType != CAN_HOH_TYPE_TRANSMIT )
     {
         /* If development error detection for the Can module is enabled:
         The function Can_Write shall raise the error CAN_E_PARAM_HANDLE if the parameter Hth is not
@@ -635,7 +646,7 @@ Std_ReturnType Can_GetEgressTimeStamp( PduIdType TxPduId, Can_HwHandleType Hth,
         function shall raise the development error CAN_E_PARAM_LPDU */
         Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_GET_EGRESS_TS, CAN_E_PARAM_LPDU );
     }
-    else if( HwUnit.Config->Hohs[ Hth ].ObjectType != CAN_HOH_TYPE_TRANSMIT )
+    else if( CAN_CONFIG( HwUnit.Config )->Hohs[ Hth ].ObjectType != CAN_HOH_TYPE_TRANSMIT )
     {
         /* If development error detection for the Can module is enabled:
         The function Can_GetEgressTimeStamp shall raise the error CAN_E_PARAM_HANDLE if the parameter
@@ -683,7 +694,7 @@ Std_ReturnType Can_GetIngressTimeStamp( Can_HwHandleType Hrh, Can_TimeStampType
         the function shall raise the development error CAN_E_UNINIT.⌋() */
         Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_GET_INGRESS_TS, CAN_E_UNINIT );
     }
-    else if( HwUnit.Config->Hohs[ Hrh ].ObjectType != CAN_HOH_TYPE_RECEIVE )
+    else if( CAN_CONFIG( HwUnit.Config )->Hohs[ Hrh ].ObjectType != CAN_HOH_TYPE_RECEIVE )
     {
         /* If development error detection for the Can module is enabled:
         The function Can_GetIngressTimeStamp shall raise the error CAN_E_PARAM_HANDLE if the parameter
@@ -739,7 +750,7 @@ Std_ReturnType Can_Write( Can_HwHandleType Hth, const Can_PduType *PduInfo )
         initialized */
         Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE, CAN_E_UNINIT );
     }
-    else if( HwUnit.Config->Hohs[ Hth ].ObjectType != CAN_HOH_TYPE_TRANSMIT )
+    else if( CAN_CONFIG( HwUnit.Config )->Hohs[ Hth ].ObjectType != CAN_HOH_TYPE_TRANSMIT )
     {
         /* If development error detection for the Can module is enabled:
         The function Can_Write shall raise the error CAN_E_PARAM_HANDLE if the parameter Hth is not
@@ -752,10 +763,20 @@ Std_ReturnType Can_Write( Can_HwHandleType Hth, const Can_PduType *PduInfo )
         Can_Write() shall raise CAN_E_PARAM_POINTER if the parameter PduInfo is a null pointer */
         Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE, CAN_E_PARAM_POINTER );
     }
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_TRIGGER_TRANSMIT_ENABLE == STD_OFF
+    else if( PduInfo->sdu == NULL_PTR )
+    {
+        /* If development error detection for CanDrv is enabled:
+        Can_Write() shall raise CAN_E_PARAM_POINTER if the sdu pointer inside PduInfo is a null
+        pointer and the trigger transmit is not enabled */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE, CAN_E_PARAM_POINTER );
+    }
+#endif
     else
     {
         uint8 FdFlag  = Bfx_GetBit_u32u8_u8( PduInfo->id, 30u );
-        uint32 FdMode = HwUnit.Config->Hohs[ Hth ].ControllerRef->FrameFormat;
+        uint32 FdMode = CAN_CONFIG( HwUnit.Config )->Hohs[ Hth ].ControllerRef->FrameFormat;
 
         if( ( PduInfo->length > 64u ) || ( ( PduInfo->length > 8u ) && ( FdMode == CAN_FRAME_CLASSIC ) ) ||
             ( ( PduInfo->length > 8u ) && ( FdMode != CAN_FRAME_CLASSIC ) && ( FdFlag == STD_OFF ) ) )
@@ -780,6 +801,193 @@ Std_ReturnType Can_Write( Can_HwHandleType Hth, const Can_PduType *PduInfo )
     return ReturnValue;
 }
 
+/**
+ * @brief    **Can Interrupt Line 0**
+ *
+ * Serves the interrupts assigned to line 0 on every controller, the function shall be called
+ * from TIM16_FDCAN_IT0_IRQHandler. Rx and Tx interrupts can be placed in this line while the
+ * error and bookkeeping ones are moved to line 1 using Line1ITs, each line with its own NVIC
+ * priority set by CDD_Nvic_SetPriority. The vector is shared by FDCAN1 and FDCAN2, a controller
+ * with its interrupts disabled by Can_DisableControllerInterrupts is skipped. With the lines at
+ * different NVIC priorities the CanIf callbacks of one line can preempt the ones of the other line.
+ */
+void Can_IsrLine0( void )
+{
+    if( HwUnit.HwUnitState == CAN_CS_READY )
+    {
+        for( uint8 Controller = 0; Controller < CAN_NUMBER_OF_CONTROLLERS; Controller++ )
+        {
+            Can_Arch_IsrLineHandler( &HwUnit, Controller, CAN_INTERRUPT_LINE0 );
+        }
+    }
+}
+
+/**
+ * @brief    **Can Interrupt Line 1**
+ *
+ * Serves the interrupts assigned to line 1 on every controller, the function shall be called
+ * from TIM17_FDCAN_IT1_IRQHandler. Same as line 0, the vector is shared by both controllers and
+ * a controller with its interrupts disabled is skipped.
+ */
+void Can_IsrLine1( void )
+{
+    if( HwUnit.HwUnitState == CAN_CS_READY )
+    {
+        for( uint8 Controller = 0; Controller < CAN_NUMBER_OF_CONTROLLERS; Controller++ )
+        {
+            Can_Arch_IsrLineHandler( &HwUnit, Controller, CAN_INTERRUPT_LINE1 );
+        }
+    }
+}
+
+#if CAN_STATISTICS_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief    **Can Get Statistics**
+ *
+ * This function returns the runtime statistics collected for the CAN controller since it was
+ * initialized: frames received and transmitted, CAN_BUSY rejections, Rx FIFO full and lost
+ * events, bus-off events and the execution times of the interrupt handler and Can_Write.
+ *
+ * @param    Controller CAN controller whose statistics shall be read
+ * @param    StatisticsPtr Pointer to a memory location, where the statistics will be stored.
+ *
+ * @retval  E_OK: request accepted
+ *          E_NOT_OK: request not accepted
+ */
+Std_ReturnType Can_GetStatistics( uint8 Controller, Can_StatisticsType *StatisticsPtr )
+{
+    Std_ReturnType ReturnValue = E_NOT_OK;
+
+    if( HwUnit.HwUnitState == CAN_CS_UNINIT )
+    {
+        /* if the module is not yet initialized, the function Can_GetStatistics shall raise
+        development error CAN_E_UNINIT */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_GET_STATISTICS, CAN_E_UNINIT );
+    }
+    else if( Controller >= CAN_NUMBER_OF_CONTROLLERS )
+    {
+        /* if the parameter Controller is out of range, the function Can_GetStatistics shall
+        raise development error CAN_E_PARAM_CONTROLLER */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_GET_STATISTICS, CAN_E_PARAM_CONTROLLER );
+    }
+    else if( StatisticsPtr == NULL_PTR )
+    {
+        /* if the parameter StatisticsPtr is a null pointer, the function Can_GetStatistics shall
+        raise development error CAN_E_PARAM_POINTER */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_GET_STATISTICS, CAN_E_PARAM_POINTER );
+    }
+    else
+    {
+        /* Copy the statistics of the controller */
+        ReturnValue = Can_Arch_GetStatistics( &HwUnit, Controller, StatisticsPtr );
+    }
+
+    return ReturnValue;
+}
+#endif
+
+#if CAN_BUS_MONITOR_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+/**
+ * @brief    **Can Bus Monitor main function**
+ *
+ * This function shall be called cyclically, on each call it takes the bus time elapsed on every
+ * controller and every CAN_BUS_MONITOR_WINDOW calls it closes a window working out the bus load
+ * and the error rates out of the frames and errors counted by the interrupts. The function does
+ * nothing while the driver is not initialized.
+ */
+void Can_MainFunction_BusMonitor( void )
+{
+    if( HwUnit.HwUnitState == CAN_CS_READY )
+    {
+        for( uint8 Controller = 0; Controller < CAN_NUMBER_OF_CONTROLLERS; Controller++ )
+        {
+            Can_Arch_MainFunctionBusMonitor( &HwUnit, Controller );
+        }
+    }
+}
+
+/**
+ * @brief    **Can Get Bus Monitor**
+ *
+ * This function returns the bus load and the error rates of the CAN controller out of the last
+ * window closed by Can_MainFunction_BusMonitor.
+ *
+ * @param    Controller CAN controller whose bus monitor shall be read
+ * @param    MonitorPtr Pointer to a memory location, where the bus monitor will be stored.
+ *
+ * @retval  E_OK: request accepted
+ *          E_NOT_OK: request not accepted
+ */
+Std_ReturnType Can_GetBusMonitor( uint8 Controller, Can_BusMonitorType *MonitorPtr )
+{
+    Std_ReturnType ReturnValue = E_NOT_OK;
+
+    if( HwUnit.HwUnitState == CAN_CS_UNINIT )
+    {
+        /* if the module is not yet initialized, the function Can_GetBusMonitor shall raise
+        development error CAN_E_UNINIT */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_GET_BUS_MONITOR, CAN_E_UNINIT );
+    }
+    else if( Controller >= CAN_NUMBER_OF_CONTROLLERS )
+    {
+        /* if the parameter Controller is out of range, the function Can_GetBusMonitor shall
+        raise development error CAN_E_PARAM_CONTROLLER */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_GET_BUS_MONITOR, CAN_E_PARAM_CONTROLLER );
+    }
+    else if( MonitorPtr == NULL_PTR )
+    {
+        /* if the parameter MonitorPtr is a null pointer, the function Can_GetBusMonitor shall
+        raise development error CAN_E_PARAM_POINTER */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_GET_BUS_MONITOR, CAN_E_PARAM_POINTER );
+    }
+    else
+    {
+        /* Copy the last window of the controller */
+        ReturnValue = Can_Arch_GetBusMonitor( &HwUnit, Controller, MonitorPtr );
+    }
+
+    return ReturnValue;
+}
+#endif
+
+/**
+ * @brief    **Can Release Rx Message**
+ *
+ * This function releases the oldest message indicated through the Hrh while its controller uses
+ * the CAN_RX_DELIVERY_DEFERRED mode, the SduDataPtr indicated with the message points into the
+ * message RAM and stays valid until this function is called. Messages shall be released in the same
+ * order they were indicated, it can be called from CanIf_RxIndication itself.
+ *
+ * @param    Hrh Hardware receive object the message was indicated with
+ *
+ * @retval  E_OK: The oldest message held was released
+ *          E_NOT_OK: development error occurred or there is no message held for the Hrh
+ */
+Std_ReturnType Can_ReleaseRxMessage( Can_HwHandleType Hrh )
+{
+    Std_ReturnType ReturnValue = E_NOT_OK;
+
+    if( HwUnit.HwUnitState == CAN_CS_UNINIT )
+    {
+        /* if the module is not yet initialized, the function Can_ReleaseRxMessage shall raise
+        development error CAN_E_UNINIT */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_RELEASE_RX_MESSAGE, CAN_E_UNINIT );
+    }
+    else if( ( Hrh >= CAN_NUMBER_OF_HOHS ) || ( CAN_CONFIG( HwUnit.Config )->Hohs[ Hrh ].ObjectType != CAN_HOH_TYPE_RECEIVE ) )
+    {
+        /* if the parameter Hrh is not a configured Hardware Receive Handle, the function
+        Can_ReleaseRxMessage shall raise development error CAN_E_PARAM_HANDLE */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_RELEASE_RX_MESSAGE, CAN_E_PARAM_HANDLE );
+    }
+    else
+    {
+        /* Release the oldest Rx FIFO element held */
+        ReturnValue = Can_Arch_ReleaseRxMessage( &HwUnit, Hrh );
+    }
+
+    return ReturnValue;
+}
+
 #if CAN_VERSION_INFO_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 /**
  * @brief    **Can Get Version**
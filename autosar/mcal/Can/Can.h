@@ -29,6 +29,16 @@ Std_ReturnType Can_GetControllerMode( uint8 Controller, Can_ControllerStateType
 Std_ReturnType Can_GetControllerRxErrorCounter( uint8 ControllerId, uint8 *RxErrorCounterPtr );
 Std_ReturnType Can_GetControllerTxErrorCounter( uint8 ControllerId, uint8 *TxErrorCounterPtr );
 Std_ReturnType Can_Write( Can_HwHandleType Hth, const Can_PduType *PduInfo );
+void Can_IsrLine0( void );
+void Can_IsrLine1( void );
+Std_ReturnType Can_ReleaseRxMessage( Can_HwHandleType Hrh );
+#if CAN_STATISTICS_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+Std_ReturnType Can_GetStatistics( uint8 Controller, Can_StatisticsType *StatisticsPtr );
+#endif
+#if CAN_BUS_MONITOR_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
+void Can_MainFunction_BusMonitor( void );
+Std_ReturnType Can_GetBusMonitor( uint8 Controller, Can_BusMonitorType *MonitorPtr );
+#endif
 #if CAN_VERSION_INFO_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 void Can_GetVersionInfo( Std_VersionInfoType *versioninfo );
 #endif
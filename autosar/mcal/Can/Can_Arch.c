@@ -15,6 +15,18 @@
 #include "Bfx.h"
 #include "CanIf_Can.h"
 
+/* With the pre-compile variant this file is compiled only as part of Can.c */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if ( CAN_CONFIGURATION_VARIANT == CAN_VARIANT_POST_BUILD ) || defined( CAN_ARCH_PRE_COMPILE )
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_CONFIGURATION_VARIANT == CAN_VARIANT_PRE_COMPILE
+/* The configuration becomes part of this translation unit, the compiler sees its values and folds
+the lookups of the hot paths instead of walking the configuration pointers at run time */
+#define CAN_LCFG_PRE_COMPILE
+#include "Can_Lcfg.c"
+#endif
+
 /* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
 #if CAN_DEV_ERROR_DETECT == STD_OFF
 /**
@@ -28,6 +40,37 @@
 #include "Det.h"
 #endif
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_OFF
+/**
+ * @param   Reference   Can peripheral the statistics belong to
+ * @param   Counter     Statistics counter to increment
+ */
+#define Can_StatisticsIncrement( Reference, Counter ) (void)0
+#else
+/**
+ * @param   Reference   Can peripheral the statistics belong to
+ * @param   Counter     Statistics counter to increment
+ */
+#define Can_StatisticsIncrement( Reference, Counter ) Statistics[ Reference ].Counter++
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_BUS_MONITOR_API == STD_OFF
+/**
+ * @param   Reference   Can peripheral the frame belongs to
+ * @param   Direction   Traffic the frame is counted on
+ * @param   Header1     First word of the message RAM element
+ * @param   Header2     Second word of the message RAM element
+ */
+#define Can_BusMonitorFrame( Reference, Direction, Header1, Header2 ) (void)0
+/**
+ * @param   Reference   Can peripheral the error belongs to
+ * @param   ErrorCode   Last error code read from PSR
+ */
+#define Can_BusMonitorError( Reference, ErrorCode ) (void)0
+#endif
+
 /**
  * @defgroup CCR_bits CCCR register bits
  *
@@ -55,50 +98,6 @@
 /**
  * @} */
 
-/**
- * @defgroup NBTP_bits NBTP register bits
- *
- * @{ */
-#define NBTP_NTSEG2_BIT      0u  /*!< Nominal Time Segment 2 */
-#define NBTP_NTSEG1_BIT      8u  /*!< Nominal Time Segment 1 */
-#define NBTP_NBRP_BIT        16u /*!< Nominal Baud Rate Prescaler */
-#define NBTP_NSJW_BIT        25u /*!< Nominal (Re)Synchronization Jump Width */
-/**
- * @} */
-
-/**
- * @defgroup NBTP_sizes NBTP register bit sizes
- *
- * @{ */
-#define NBTP_NSJW_SIZE       7u /*!< Nominal Jump Width bitfiled size*/
-#define NBTP_NTSEG1_SIZE     8u /*!< Nominal Time Segment 1 bitfiled size*/
-#define NBTP_NTSEG2_SIZE     7u /*!< Nominal Time Segment 2 bitfiled size*/
-#define NBTP_NBRP_SIZE       9u /*!< Nominal Baud Rate Prescaler bitfiled size*/
-/**
- * @} */
-
-/**
- * @defgroup DBTP_bits DBTP register bits
- *
- * @{ */
-#define DBTP_DSJW_BIT        0u  /*!< Data (Re)Synchronization Jump Width */
-#define DBTP_DTSEG1_BIT      8u  /*!< Data Time Segment 1 */
-#define DBTP_DTSEG2_BIT      4u  /*!< Data Time Segment 2 */
-#define DBTP_DBRP_BIT        16u /*!< Data Baud Rate Prescaler */
-/**
- * @} */
-
-/**
- * @defgroup DBTP_sizes DBTP register bit sizes
- *
- * @{ */
-#define DBTP_DSJW_SIZE       4u /*!< Data Jump Width bitfiled size*/
-#define DBTP_DTSEG1_SIZE     5u /*!< Data Time Segment 1 bitfiled size*/
-#define DBTP_DTSEG2_SIZE     4u /*!< Data Time Segment 2 bitfiled size*/
-#define DBTP_DBRP_SIZE       5u /*!< Nominal Baud Rate Preescaler bitfiled size*/
-/**
- * @} */
-
 #define TXBC_TFQM_BIT        24u /*!< Tx FIFO/Queue Mode bit */
 
 /**
@@ -148,7 +147,7 @@
  * @defgroup TXFQS_bits TXFQS register bits
  *
  * @{ */
-#define TXFQS_TFQF_BIT       20u /*!< Tx FIFO/Queue Full */
+#define TXFQS_TFQF_BIT       21u /*!< Tx FIFO/Queue Full */
 #define TXFQS_TFQPI_BIT      16u /*!< Tx FIFO/Queue Put Index */
 /**
  * @} */
@@ -197,6 +196,48 @@
 /**
  * @} */
 
+/**
+ * @defgroup HPMS_bits HPMS register bits
+ *
+ * @{ */
+#define HPMS_BIDX_BIT        0u /*!< Buffer Index */
+#define HPMS_MSI_BIT         6u /*!< Message Storage Indicator */
+/**
+ * @} */
+
+/**
+ * @defgroup HPMS_sizes HPMS register bit sizes
+ *
+ * @{ */
+#define HPMS_BIDX_SIZE       3u /*!< Buffer Index bitfield size */
+#define HPMS_MSI_SIZE        2u /*!< Message Storage Indicator bitfield size */
+/**
+ * @} */
+
+/**
+ * @defgroup HPMS_values HPMS Message Storage Indicator values
+ *
+ * @{ */
+#define HPMS_MSI_FIFO0       2u /*!< High priority message stored in FIFO 0 */
+#define HPMS_MSI_FIFO1       3u /*!< High priority message stored in FIFO 1 */
+/**
+ * @} */
+
+/**
+ * @defgroup IR_bits IR register bits
+ *
+ * @{ */
+#define IR_HPM_BIT           6u /*!< High Priority Message */
+#define IR_PEA_BIT           21u /*!< Protocol Error in Arbitration Phase */
+/**
+ * @} */
+
+/**
+ * @brief  Interrupt groups reading and acknowledging the Rx FIFOs, with the high priority message
+ *         enabled they are served by the same line, see Can_SetupConfiguredInterrupts.
+ */
+#define IT_LIST_RX_PATH      ( CAN_IT_LIST_RX_FIFO0 | CAN_IT_LIST_RX_FIFO1 | CAN_IT_LIST_SMSG )
+
 /**
  * @defgroup PSRs_bits PSR register bits
  *
@@ -256,6 +297,8 @@
 #define RX_BUFFER_DLC_BIT    16u /*!< Data length code bit */
 #define RX_BUFFER_XTD_BIT    30u /*!< Extended identifier bit */
 #define RX_BUFFER_FDF_BIT    21u /*!< FD format bit */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define RX_BUFFER_BRS_BIT    20u /*!< Bit rate switch bit */
 /**
  * @} */
 
@@ -269,6 +312,54 @@
 /**
  * @} */
 
+/**
+ * @defgroup TSCC_bits TSCC register bits
+ *
+ * @{ */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define TSCC_TSS_BIT         0u  /*!< Timestamp Select bit */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define TSCC_TSS_SIZE        2u  /*!< Timestamp Select bitfield size */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define TSCC_TSS_PRESCALED   1u  /*!< Timestamp counter incremented every TCP + 1 nominal bit times */
+/**
+ * @} */
+
+/**
+ * @defgroup Frame_bits Bits of a frame on the bus, stuff bits are not counted
+ *
+ * @{ */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define FRAME_CLASSIC_BITS   47u /*!< Classic frame with standard id and no payload, intermission included */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define FRAME_CLASSIC_XTD    20u /*!< Bits added to a classic frame by the extended id */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define FRAME_FD_BITS        29u /*!< FD frame bits always sent at the nominal bit rate with standard id */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define FRAME_FD_XTD         19u /*!< Bits added to a FD frame by the extended id */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define FRAME_FD_DATA_BITS   27u /*!< FD data phase with no payload: ESI, DLC, stuff count and CRC17 */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define FRAME_FD_CRC21       4u  /*!< Bits added to the data phase by the CRC21 */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define FRAME_FD_CRC17_BYTES 16u /*!< Largest payload protected by the CRC17 */
+/**
+ * @} */
+
+/**
+ * @defgroup Bus_Monitor_traffic Traffic counted by the bus monitor
+ *
+ * @{ */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define BUS_MONITOR_RX       0u     /*!< Frames received */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define BUS_MONITOR_TX       1u     /*!< Frames transmitted */
+#define BUS_MONITOR_TRAFFIC  2u     /*!< Directions counted */
+/* cppcheck-suppress misra-c2012-2.5 ; the use of this define is precompile conditioned */
+#define BUS_MONITOR_FULL     10000u /*!< Ratio of a window fully used, hundredths of percent */
+/**
+ * @} */
+
 /**
  * @defgroup ID_Msg_bits ID message bits
  *
@@ -317,6 +408,44 @@
 /**
  * @} */
 
+/**
+ * @defgroup Filter_Element_Config    Filter element configuration values
+ *
+ * @{ */
+#define FILTER_EC_PRIORITY   4u /*!< Set priority flag, to be or'ed with the Rx FIFO to store into */
+/**
+ * @} */
+
+/**
+ * @defgroup Filter_Capacity    Filter elements available in message RAM
+ *
+ * @{ */
+#define FILTER_STD_ELEMENTS  28u         /*!< Standard ID filter elements per controller */
+#define FILTER_EXT_ELEMENTS  8u          /*!< Extended ID filter elements per controller */
+#define FILTER_STD_ID_MASK   0x7FFu      /*!< Mask matching all the bits of a standard ID */
+#define FILTER_EXT_ID_MASK   0x1FFFFFFFu /*!< Mask matching all the bits of an extended ID */
+/**
+ * @} */
+
+/**
+ * @defgroup Rx_Fifo_Elements    Rx FIFO number of elements
+ *
+ * @{ */
+#define RX_FIFO_ELEMENTS     3u /*!< Elements per Rx FIFO in message RAM */
+#define RX_FIFO_0            0u /*!< Index of the Rx FIFO 0 */
+#define RX_FIFO_1            1u /*!< Index of the Rx FIFO 1 */
+#define RX_FIFOS             2u /*!< Rx FIFOs per controller */
+/**
+ * @} */
+
+/**
+ * @defgroup Tx_Buffer_Elements    Tx FIFO/queue number of elements
+ *
+ * @{ */
+#define TX_BUFFER_ELEMENTS   3u /*!< Tx buffers per controller in message RAM */
+/**
+ * @} */
+
 /**
  * @brief  Tx Hardware objecj descriptor.
  */
@@ -336,6 +465,97 @@ typedef struct _HwExtFilter
     uint32 ExtFilterHeader2; /*!< Extended Filter Standard Address Header 2 */
 } HwExtFilter;
 
+/**
+ * @brief  Adjacent filters sharing the same ID type and element configuration.
+ *
+ * All the filters in a group can be merged since a frame matching any of them ends up in the
+ * same place, and no filter with another action or target sits between them.
+ */
+typedef struct _Can_FilterGroup
+{
+    const Can_ConfigType *Config;  /*!< Hardware unit configuration */
+    uint8 ControllerId;            /*!< Controller the filters belong to */
+    Can_IdType IdType;             /*!< Standard or extended identifiers */
+    uint8 ElementConfig;           /*!< SFEC/EFEC value shared by the group */
+    uint16 First;                  /*!< Position of the first filter of the group */
+    uint16 Last;                   /*!< Position of the last filter of the group */
+    SramCan_RegisterType *SramCan; /*!< Message RAM where the elements are written */
+    uint8 *Elements;               /*!< Filter elements used so far for the ID type */
+} Can_FilterGroup;
+
+/**
+ * @brief  Position while walking the Rx filters of a controller.
+ */
+typedef struct _Can_FilterCursor
+{
+    uint8 Hoh;                        /*!< Hardware object being walked */
+    uint8 Filter;                     /*!< Next filter of the hardware object */
+    uint16 Position;                  /*!< Filters walked so far */
+    const Can_HardwareObject *Object; /*!< Hardware object of the last filter returned */
+} Can_FilterCursor;
+
+/**
+ * @brief  Interval of IDs accepted by a filter, a single ID has the same low and high values.
+ */
+typedef struct _Can_FilterInterval
+{
+    uint32 Low;      /*!< Lowest ID accepted */
+    uint32 High;     /*!< Highest ID accepted */
+    uint16 Sequence; /*!< Order in the configuration, sorts intervals with the same low ID */
+} Can_FilterInterval;
+
+/**
+ * @brief  Flattened view of a transmit hardware object, built at init from the configuration set
+ *         so Can_Arch_Write gets all it needs with a single indexed load.
+ */
+typedef struct _Can_HthRuntime
+{
+    Can_RegisterType *Can;            /*!< Registers of the controller owning the object */
+    HwObjectHandler *TxBuffers;       /*!< Tx buffers of the controller in message RAM */
+    const Can_Controller *Controller; /*!< Controller configuration, for the slow paths */
+    uint8 CanReference;               /*!< Can controller peripheral */
+    uint8 PaddingValue;               /*!< Value to fill the unused bytes of CAN FD frames */
+} Can_HthRuntime;
+
+/**
+ * @brief  Traffic counted by the bus monitor, the counters are free running and only their
+ *         difference between two windows is used.
+ */
+typedef struct _Can_BusTraffic
+{
+    uint32 Frames;      /*!< Frames counted */
+    uint32 NominalBits; /*!< Bits sent at the nominal bit rate */
+    uint32 DataBits;    /*!< Bits of the FD data phases sent at the data bit rate */
+} Can_BusTraffic;
+
+/**
+ * @brief  Bus monitor state of a controller. The interrupts only increment the traffic and error
+ *         counters while the main function owns the rest of the fields, so no field is written
+ *         from both contexts and no lock is needed.
+ */
+typedef struct _Can_BusMonitorState
+{
+    Can_BusTraffic Traffic[ BUS_MONITOR_TRAFFIC ]; /*!< Rx and Tx traffic counted by the interrupts */
+    Can_BusTraffic Start[ BUS_MONITOR_TRAFFIC ];   /*!< Traffic counted when the window started */
+    uint32 Errors[ CAN_BUS_ERRORS ];               /*!< Protocol errors counted by the interrupts */
+    uint32 ErrorsStart[ CAN_BUS_ERRORS ];          /*!< Protocol errors counted when the window started */
+    uint32 BusTime;                                /*!< Nominal bit times elapsed on the window */
+    uint16 Timestamp;                              /*!< Timestamp counter read on the last cycle */
+    uint16 Cycles;                                 /*!< Main function cycles elapsed on the window */
+    Can_BusMonitorType Result;                     /*!< Figures of the last window closed */
+} Can_BusMonitorState;
+
+/**
+ * @brief  Layout check of the configuration structures, the build fails when a new or moved field
+ *         brings back the padding removed from them. Sizes are given in words and pointers so
+ *         the check holds for the target and for the host where the tests run.
+ */
+/* cppcheck-suppress misra-c2012-2.3 ; the type is only declared to evaluate the checks */
+typedef uint8 Can_ConfigLayoutCheck[ CAN_STATIC_ASSERT( sizeof( Can_Controller ) == ( ( 4u * sizeof( uint32 ) ) + ( 4u * sizeof( void * ) ) ) ) +
+                                     CAN_STATIC_ASSERT( sizeof( Can_HardwareObject ) == ( ( 2u * sizeof( uint32 ) ) + ( 2u * sizeof( void * ) ) ) ) +
+                                     CAN_STATIC_ASSERT( sizeof( Can_HwFilter ) == ( 3u * sizeof( uint32 ) ) ) +
+                                     CAN_STATIC_ASSERT( sizeof( Can_ConfigType ) == ( 3u * sizeof( void * ) ) ) + 1u ];
+
 /**
  * @brief  Autosar errors to report
  */
@@ -354,17 +574,41 @@ static const Can_ErrorType AutosarError[] = {
 /**
  * @brief  Can controller register structure.
  */
-static Can_RegisterType *CanPeripherals[] = { CAN1, CAN2 };
+static Can_RegisterType *const CanPeripherals[] = { CAN1, CAN2 };
 
 /**
  * @brief  Can controller SRAM register structure.
  */
-static SramCan_RegisterType *SramCanPeripherals[] = { SRAMCAN1, SRAMCAN2 };
+static SramCan_RegisterType *const SramCanPeripherals[] = { SRAMCAN1, SRAMCAN2 };
+
+/**
+ * @brief  Dlc defines to actual bytes, used by the Tx and Rx paths.
+ */
+static const uint8 DlcToBytes[ CAN_OBJECT_PL_64 + 1u ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
 
+/* clang-format off */
 /**
- * @brief  Dlc defines to actual bytes.
+ * @brief  Payload length in bytes to the smallest Dlc define able to hold it, used by the Tx path.
  */
-static const uint8 DlcToBytes[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+static const uint8 LengthToDlc[ CAN_MAX_FD_PAYLOAD + 1u ] =
+{
+    0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u,
+    CAN_OBJECT_PL_12, CAN_OBJECT_PL_12, CAN_OBJECT_PL_12, CAN_OBJECT_PL_12,
+    CAN_OBJECT_PL_16, CAN_OBJECT_PL_16, CAN_OBJECT_PL_16, CAN_OBJECT_PL_16,
+    CAN_OBJECT_PL_20, CAN_OBJECT_PL_20, CAN_OBJECT_PL_20, CAN_OBJECT_PL_20,
+    CAN_OBJECT_PL_24, CAN_OBJECT_PL_24, CAN_OBJECT_PL_24, CAN_OBJECT_PL_24,
+    CAN_OBJECT_PL_32, CAN_OBJECT_PL_32, CAN_OBJECT_PL_32, CAN_OBJECT_PL_32,
+    CAN_OBJECT_PL_32, CAN_OBJECT_PL_32, CAN_OBJECT_PL_32, CAN_OBJECT_PL_32,
+    CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48,
+    CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48,
+    CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48,
+    CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48,
+    CAN_OBJECT_PL_64, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64,
+    CAN_OBJECT_PL_64, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64,
+    CAN_OBJECT_PL_64, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64,
+    CAN_OBJECT_PL_64, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64
+};
+/* clang-format on */
 
 /**
  * @brief  Fifo 0 to controller id decoder.
@@ -376,12 +620,88 @@ static const uint8 Fifo0ToCtrlIds[] = { CAN_OBJ_HRH_RX00, CAN_OBJ_HRH_RX10 };
  */
 static const uint8 Fifo1ToCtrlIds[] = { CAN_OBJ_HRH_RX01, CAN_OBJ_HRH_RX11 };
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+/**
+ * @brief  Runtime statistics of each Can controller peripheral.
+ */
+CAN_STATIC Can_StatisticsType Statistics[ sizeof( CanPeripherals ) / sizeof( CanPeripherals[ 0 ] ) ];
+
+/**
+ * @brief  Statistics initial values.
+ */
+static const Can_StatisticsType StatisticsReset = { 0u };
+#endif
+
+/**
+ * @brief  Rx FIFO elements indicated and not yet released of each Can controller peripheral, only
+ *         used by the CAN_RX_DELIVERY_DEFERRED mode.
+ */
+CAN_STATIC uint8 RxHeld[ sizeof( CanPeripherals ) / sizeof( CanPeripherals[ 0 ] ) ][ RX_FIFOS ];
+
+/**
+ * @brief  Tx buffers cancelled by Can_Arch_Write in favour of a higher priority PDU and not yet
+ *         notified to the upper layer, one bit per buffer of each Can controller peripheral.
+ */
+CAN_STATIC uint8 TxCancelled[ sizeof( CanPeripherals ) / sizeof( CanPeripherals[ 0 ] ) ];
+
+/**
+ * @brief  PSR register of each Can controller peripheral as read by the last dispatch serving a
+ *         protocol error, reading PSR clears both LEC and DLEC so the arbitration and data phase
+ *         errors are taken from this single read.
+ */
+CAN_STATIC uint32 ProtocolStatus[ sizeof( CanPeripherals ) / sizeof( CanPeripherals[ 0 ] ) ];
+
+/**
+ * @brief  Runtime view of each transmit hardware object of the configuration set in use, indexed
+ *         by Hth and filled at init, objects of other types are left empty.
+ */
+CAN_STATIC Can_HthRuntime HthTable[ CAN_NUMBER_OF_HOHS ];
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_BUS_MONITOR_API == STD_ON
+/**
+ * @brief  Bus monitor state of each Can controller peripheral.
+ */
+CAN_STATIC Can_BusMonitorState BusMonitor[ sizeof( CanPeripherals ) / sizeof( CanPeripherals[ 0 ] ) ];
+
+/**
+ * @brief  Bus monitor initial values.
+ */
+static const Can_BusMonitorState BusMonitorReset = { 0u };
+#endif
+
 CAN_STATIC void Can_SetupConfiguredInterrupts( const Can_Controller *Controller, Can_RegisterType *Can );
-CAN_STATIC void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8 Controller );
+CAN_STATIC Std_ReturnType Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8 Controller );
 CAN_STATIC void Can_SetupBaudrateConfig( const Can_ControllerBaudrateConfig *Baudrate, Can_RegisterType *Can );
+CAN_STATIC void Can_SetupHthTable( const Can_ConfigType *Config, uint8 Controller );
 CAN_STATIC uint8 Can_GetClosestDlcWithPadding( uint8 Dlc, uint32 *RamBuffer, uint8 PaddingValue );
 CAN_STATIC uint8 Can_GetTxPduId( const Can_Controller *Controller, PduIdType *CanPduId );
 CAN_STATIC void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uint32 *CanId );
+CAN_STATIC boolean Can_GetRxFifoElement( const Can_Controller *Controller, uint8 Fifo, uint8 *Index );
+CAN_STATIC void Can_DeliverRxMessage( const Can_Controller *Controller, uint8 ControllerId, uint8 Fifo, uint8 Index,
+                                      Can_HighPriorityRxCallbackType Callback );
+CAN_STATIC void Can_CopyRxPayload( const volatile uint32 *Payload, uint8 *Buffer, PduLengthType Length );
+CAN_STATIC uint32 Can_GetArbitrationKey( uint32 Header );
+CAN_STATIC void Can_CancelLowerPriorityTx( const Can_Controller *Controller, uint32 Header );
+CAN_STATIC uint8 Can_GetFilterElementConfig( const Can_HardwareObject *Hoh, const Can_HwFilter *HwFilter );
+CAN_STATIC Can_IdType Can_GetFilterIdType( const Can_HardwareObject *Hoh, const Can_HwFilter *HwFilter );
+CAN_STATIC const Can_HwFilter *Can_GetNextRxFilter( const Can_ConfigType *Config, uint8 ControllerId, Can_FilterCursor *Cursor );
+CAN_STATIC boolean Can_IsFilterInGroup( const Can_FilterGroup *Group, const Can_FilterCursor *Cursor, const Can_HwFilter *HwFilter );
+CAN_STATIC boolean Can_GetNextFilterInterval( const Can_FilterGroup *Group, Can_FilterInterval *Interval );
+CAN_STATIC void Can_CompileFilterGroup( Can_FilterGroup *Group );
+CAN_STATIC void Can_WriteFilterElement( Can_FilterGroup *Group, uint32 Type, uint32 Id1, uint32 Id2 );
+CAN_STATIC void Can_IsrDispatch( Can_HwUnit *HwUnit, uint8 Controller, uint8 Lines );
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+CAN_STATIC void Can_StatisticsDuration( Can_DurationType *Duration, uint32 Start );
+#endif
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_BUS_MONITOR_API == STD_ON
+CAN_STATIC void Can_BusMonitorFrame( uint8 Reference, uint8 Direction, uint32 Header1, uint32 Header2 );
+CAN_STATIC void Can_BusMonitorError( uint8 Reference, uint8 ErrorCode );
+CAN_STATIC void Can_BusMonitorWindow( const Can_RegisterType *Can, Can_BusMonitorState *Monitor );
+#endif
 
 CAN_STATIC void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller );
 CAN_STATIC void Can_Isr_RxFifo0Full( Can_HwUnit *HwUnit, uint8 Controller );
@@ -407,6 +727,71 @@ CAN_STATIC void Can_Isr_WatchdogInterrupt( Can_HwUnit *HwUnit, uint8 Controller
 CAN_STATIC void Can_Isr_ProtocolErrorInArbitrationPhase( Can_HwUnit *HwUnit, uint8 Controller );
 CAN_STATIC void Can_Isr_ProtocolErrorInDataPhase( Can_HwUnit *HwUnit, uint8 Controller );
 
+/**
+ * @brief  Interrupt service routines indexed by their bit in IR register.
+ */
+/* clang-format off */
+static void ( *const IsrPointer[] )( Can_HwUnit *HwUnit, uint8 Controller ) =
+{
+    Can_Isr_RxFifo0NewMessage,
+    Can_Isr_RxFifo0Full,
+    Can_Isr_RxFifo0MessageLost,
+    Can_Isr_RxFifo1NewMessage,
+    Can_Isr_RxFifo1Full,
+    Can_Isr_RxFifo1MessageLost,
+    Can_Isr_HighPriorityMessageRx,
+    Can_Isr_TransmissionCompleted,
+    Can_Isr_TransmissionCancellationFinished,
+    Can_Isr_TxEventFifoElementLost,
+    Can_Isr_TxEventFifoFull,
+    Can_Isr_TxEventFifoNewEntry,
+    Can_Isr_TxFifoEmpty,
+    Can_Isr_TimestampWraparound,
+    Can_Isr_MessageRamAccessFailure,
+    Can_Isr_TimeoutOccurred,
+    Can_Isr_ErrorLoggingOverflow,
+    Can_Isr_ErrorPassive,
+    Can_Isr_WarningStatus,
+    Can_Isr_BusOffStatus,
+    Can_Isr_WatchdogInterrupt,
+    Can_Isr_ProtocolErrorInArbitrationPhase,
+    Can_Isr_ProtocolErrorInDataPhase
+};
+/* clang-format on */
+
+/**
+ * @brief  Interrupt group (ILS register bit) indexed by the interrupt bit in IR register.
+ */
+/* clang-format off */
+static const uint8 IsrGroup[] =
+{
+    CAN_IT_GROUP_RX_FIFO0, CAN_IT_GROUP_RX_FIFO0, CAN_IT_GROUP_RX_FIFO0,
+    CAN_IT_GROUP_RX_FIFO1, CAN_IT_GROUP_RX_FIFO1, CAN_IT_GROUP_RX_FIFO1,
+    CAN_IT_GROUP_SMSG, CAN_IT_GROUP_SMSG, CAN_IT_GROUP_SMSG,
+    CAN_IT_GROUP_TX_FIFO_ERROR, CAN_IT_GROUP_TX_FIFO_ERROR, CAN_IT_GROUP_TX_FIFO_ERROR, CAN_IT_GROUP_TX_FIFO_ERROR,
+    CAN_IT_GROUP_MISC, CAN_IT_GROUP_MISC, CAN_IT_GROUP_MISC,
+    CAN_IT_GROUP_BIT_LINE_ERROR, CAN_IT_GROUP_BIT_LINE_ERROR,
+    CAN_IT_GROUP_PROTOCOL_ERROR, CAN_IT_GROUP_PROTOCOL_ERROR, CAN_IT_GROUP_PROTOCOL_ERROR,
+    CAN_IT_GROUP_PROTOCOL_ERROR, CAN_IT_GROUP_PROTOCOL_ERROR
+};
+/* clang-format on */
+
+/**
+ * @brief  Interrupts belonging to each group, indexed by ILS register bit.
+ */
+/* clang-format off */
+static const uint32 IsrGroupList[] =
+{
+    CAN_IT_LIST_RX_FIFO0,
+    CAN_IT_LIST_RX_FIFO1,
+    CAN_IT_LIST_SMSG,
+    CAN_IT_LIST_TX_FIFO_ERROR,
+    CAN_IT_LIST_MISC,
+    CAN_IT_LIST_BIT_LINE_ERROR,
+    CAN_IT_LIST_PROTOCOL_ERROR
+};
+/* clang-format on */
+
 /**
  * @brief    **Can low level Initialization**
  *
@@ -419,20 +804,48 @@ CAN_STATIC void Can_Isr_ProtocolErrorInDataPhase( Can_HwUnit *HwUnit, uint8 Cont
  * @param    Config Pointer to driver configuration
  * @param    Controller Index of the controller to be initialized
  *
+ * @retval  E_OK: The controller was initialized
+ *          E_NOT_OK: The reception filters do not fit in message RAM
+ *
  * @reqs    SWS_Can_00237, SWS_Can_00236, SWS_Can_00238, SWS_Can_00239, SWS_Can_00419, SWS_Can_00250,
  *          SWS_Can_00053, SWS_Can_00407, SWS_Can_00021, SWS_Can_00291, SWS_Can_00413, SWS_Can_00223
  *          SWS_Can_00245
  */
-void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Controller )
+Std_ReturnType Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Controller )
 {
+    /* configuration set in use */
+    const Can_ConfigType *ConfigSet = CAN_CONFIG( Config );
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &ConfigSet->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+    Std_ReturnType RetVal;
 
     /* Configure Clock divider */
     Can->CKDIV = ControllerConfig->ClockDivider;
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+    /* Start collecting statistics from scratch */
+    Statistics[ ControllerConfig->CanReference ] = StatisticsReset;
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_BUS_MONITOR_API == STD_ON
+    /* Start monitoring the bus from scratch */
+    BusMonitor[ ControllerConfig->CanReference ] = BusMonitorReset;
+#endif
+
+    /* No Rx FIFO element is held by the upper layer */
+    RxHeld[ ControllerConfig->CanReference ][ RX_FIFO_0 ] = 0u;
+    RxHeld[ ControllerConfig->CanReference ][ RX_FIFO_1 ] = 0u;
+
+    /* No Tx cancellation is waiting to be notified */
+    TxCancelled[ ControllerConfig->CanReference ] = 0u;
+
+    /* Flatten the transmit objects of the controller for the Tx path */
+    Can_SetupHthTable( ConfigSet, Controller );
+
     /* Flush the allocated Message RAM area */
     for( uint8 i = 0u; i < ( sizeof( SramCan_RegisterType ) / sizeof( uint32 ) ); i++ )
     {
@@ -526,8 +939,15 @@ void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Cont
     /* Select between Tx FIFO and Tx Queue operation modes */
     Bfx_PutBit_u32u8u8( (uint32 *)&Can->TXBC, TXBC_TFQM_BIT, ControllerConfig->TxFifoQueueMode );
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_BUS_MONITOR_API == STD_ON
+    /* Timestamp counter incremented once per nominal bit time, it measures the window lengths */
+    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->TSCC, TSCC_TSS_BIT, TSCC_TSS_SIZE, TSCC_TSS_PRESCALED );
+    Can->TSCV = 0u;
+#endif
+
     /* Setup filter for Fifo 0 and Fifo 1*/
-    Can_SetupConfiguredFilters( Config, Controller );
+    RetVal = Can_SetupConfiguredFilters( ConfigSet, Controller );
 
     /* As per autosar reject all Std remote frames*/
     Bfx_SetBit_u32u8( (uint32 *)&Can->RXGFC, RXGFC_RRFS_BIT );
@@ -540,10 +960,12 @@ void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Cont
     Bfx_SetBit_u32u8( (uint32 *)&Can->RXGFC, RXGFC_RRFE_BIT );
 
     /* Setup the interrupt to line 0 or 1*/
-    Can_SetupConfiguredInterrupts( &Config->Controllers[ Controller ], Can );
+    Can_SetupConfiguredInterrupts( ControllerConfig, Can );
 
     /*paramter not in use, placed to keep standard and for potential future use*/
     (void)HwUnit;
+
+    return RetVal;
 }
 
 /**
@@ -560,7 +982,7 @@ void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Cont
 void Can_Arch_DeInit( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
@@ -618,7 +1040,7 @@ Std_ReturnType Can_Arch_SetBaudrate( Can_HwUnit *HwUnit, uint8 Controller, uint1
     if( HwUnit->ControllerState[ Controller ] == CAN_CS_STOPPED )
     {
         /* get controller configuration */
-        const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+        const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
         /*Get the Can controller register structure*/
         Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
         /* get baudrate configuration */
@@ -654,7 +1076,7 @@ Std_ReturnType Can_Arch_SetControllerMode( Can_HwUnit *HwUnit, uint8 Controller,
 {
     Std_ReturnType RetVal = E_NOT_OK;
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
@@ -680,6 +1102,8 @@ Std_ReturnType Can_Arch_SetControllerMode( Can_HwUnit *HwUnit, uint8 Controller,
             {
                 /* Add cancellation request for all buffers */
                 Can->TXBCR = 0x03u;
+                /* Pending frames are dropped without notification, also the ones already cancelled */
+                TxCancelled[ ControllerConfig->CanReference ] = 0u;
 
                 /* Request initialisation */
                 Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_INIT_BIT );
@@ -756,10 +1180,15 @@ Std_ReturnType Can_Arch_SetControllerMode( Can_HwUnit *HwUnit, uint8 Controller,
 void Can_Arch_EnableControllerInterrupts( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
+    if( HwUnit->DisableIntsLvl[ Controller ] > 0u )
+    {
+        HwUnit->DisableIntsLvl[ Controller ]--;
+    }
+
     /*enable interrupts only if this function is called the same number of times than
     disable interrupts*/
     if( HwUnit->DisableIntsLvl[ Controller ] == 0u )
@@ -769,10 +1198,6 @@ void Can_Arch_EnableControllerInterrupts( Can_HwUnit *HwUnit, uint8 Controller )
         /* Enable Interrupt line 1 */
         Bfx_SetBit_u32u8( (uint32 *)&Can->ILE, CAN_INTERRUPT_LINE1 );
     }
-    else
-    {
-        HwUnit->DisableIntsLvl[ Controller ]--;
-    }
 }
 
 /**
@@ -790,7 +1215,7 @@ void Can_Arch_EnableControllerInterrupts( Can_HwUnit *HwUnit, uint8 Controller )
 void Can_Arch_DisableControllerInterrupts( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
@@ -844,7 +1269,7 @@ Std_ReturnType Can_Arch_CheckWakeup( Can_HwUnit *HwUnit, uint8 Controller )
 Std_ReturnType Can_Arch_GetControllerErrorState( Can_HwUnit *HwUnit, uint8 ControllerId, Can_ErrorStateType *ErrorStatePtr )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ ControllerId ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ ControllerId ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
@@ -909,7 +1334,7 @@ Std_ReturnType Can_Arch_GetControllerMode( Can_HwUnit *HwUnit, uint8 Controller,
 Std_ReturnType Can_Arch_GetControllerRxErrorCounter( Can_HwUnit *HwUnit, uint8 ControllerId, uint8 *RxErrorCounterPtr )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ ControllerId ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ ControllerId ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
@@ -937,7 +1362,7 @@ Std_ReturnType Can_Arch_GetControllerRxErrorCounter( Can_HwUnit *HwUnit, uint8 C
 Std_ReturnType Can_Arch_GetControllerTxErrorCounter( Can_HwUnit *HwUnit, uint8 ControllerId, uint8 *TxErrorCounterPtr )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ ControllerId ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ ControllerId ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
@@ -1037,7 +1462,10 @@ Std_ReturnType Can_Arch_GetIngressTimeStamp( Can_HwUnit *HwUnit, Can_HwHandleTyp
  * The function stores the message pointed to by PduInfo into the internal Tx message buffer of the CAN
  * Sram area and activates the corresponding hardware transmit bits. It reades the hardware fifo index
  * to know which of the three buffers is available for transmission. The function will return CAN_BUSY
- * if no buffer is available.
+ * if no buffer is available, in such case and with hardware cancellation on the lowest priority
+ * pending frame is cancelled when the PDU has a higher priority, see Can_CancelLowerPriorityTx.
+ * A PDU without sdu gets its payload from CanIf_TriggerTransmit, written in place into the Tx buffer
+ * element right before the transmission request, the write fails when the upper layer has no data.
  *
  * @param    HwUnit: Pointer to the hardware unit configuration
  * @param    Hth: information which HW-transmit handle shall be used for transmit. Implicitly this
@@ -1052,6 +1480,7 @@ Std_ReturnType Can_Arch_GetIngressTimeStamp( Can_HwUnit *HwUnit, Can_HwHandleTyp
  *
  * @reqs    SWS_Can_00213, SWS_Can_00214, SWS_Can_00275, SWS_Can_00277, SWS_Can_00401, SWS_Can_00402
  *          SWS_Can_00403, SWS_Can_00011, SWS_Can_00486, SWS_Can_00502, SWS_Can_00276
+ *          SWS_Can_00286
  */
 Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const Can_PduType *PduInfo )
 {
@@ -1059,10 +1488,18 @@ Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const C
     uint8 DataLenght;
     uint32 RamBuffer[ 16u ];
 
-    /* get controller configuration */
-    const Can_Controller *ControllerConfig = HwUnit->Config->Hohs[ Hth ].ControllerRef;
+    /* get the flattened transmit object, no need to walk the configuration */
+    const Can_HthRuntime *Object = &HthTable[ Hth ];
     /*Get the Can controller register structure*/
-    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+    Can_RegisterType *Can = Object->Can;
+
+    (void)HwUnit;
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+    /* Take the time the write starts */
+    uint32 Start = CAN_STATISTICS_CYCLE_COUNTER( );
+#endif
 
     /* Check that the Tx FIFO/Queue is not full*/
     if( ( Bfx_GetBit_u32u8_u8( Can->TXFQS, TXFQS_TFQF_BIT ) == FALSE ) )
@@ -1071,7 +1508,7 @@ Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const C
         uint32 PutIndex = Bfx_GetBits_u32u8u8_u32( Can->TXFQS, TXFQS_TFQPI_BIT, TXFQS_TFQPI_SIZE );
 
         /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
-        HwObjectHandler *HthObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->TBSA;
+        HwObjectHandler *HthObject = Object->TxBuffers;
 
         /*get the message ID type*/
         uint8 IdType = Bfx_GetBit_u32u8_u8( PduInfo->id, MSG_ID_BIT );
@@ -1101,15 +1538,11 @@ Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const C
         {
             /*Frame format*/
             Bfx_ClrBit_u32u8( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_FDF_BIT );
-            /* Set the actual data lenght (DLC) */
-            DataLenght = PduInfo->length;
         }
         else
         {
             /*Frame format*/
             Bfx_SetBit_u32u8( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_FDF_BIT );
-            /* Get the actual data lenght (DLC) */
-            DataLenght = Can_GetClosestDlcWithPadding( PduInfo->length, RamBuffer, HwUnit->Config->Hohs[ Hth ].FdPaddingValue );
             /* Bit rate switch */
             if( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_BRSE_BIT ) == STD_ON )
             {
@@ -1120,30 +1553,77 @@ Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const C
         /*Store Tx Events*/
         Bfx_SetBit_u32u8( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_EFC_BIT );
 
-        /* copy message into a 32bit wide buffer*/
-        for( uint8 Byte = 0; Byte < PduInfo->length; Byte++ )
+        /* Payload staged in a 32bit wide buffer unless the upper layer writes it in place */
+        uint32 *Payload      = RamBuffer;
+        PduLengthType Length = PduInfo->length;
+        Std_ReturnType Data  = E_OK;
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_TRIGGER_TRANSMIT_ENABLE == STD_ON
+        if( PduInfo->sdu == NULL_PTR )
         {
-            ( (uint8 *)RamBuffer )[ Byte ] = PduInfo->sdu[ Byte ];
+            /* The upper layer copies its latest data straight into the element payload, it may
+            write less than the length requested but never more */
+            PduInfoType TriggerInfo = { .SduDataPtr = (uint8 *)HthObject[ PutIndex ].ObjPayload, .MetaDataPtr = NULL_PTR, .SduLength = Length };
+
+            Payload = HthObject[ PutIndex ].ObjPayload;
+            Data    = CanIf_TriggerTransmit( PduInfo->swPduHandle, &TriggerInfo );
+            Data    = ( TriggerInfo.SduLength <= Length ) ? Data : E_NOT_OK;
+            Length  = TriggerInfo.SduLength;
         }
-
-        /* Write message data lenght */
-        Bfx_PutBits_u32u8u8u32( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_DLC_BIT, TX_BUFFER_DLC_SIZE, DataLenght );
-
-        /* Write Tx payload with padding value to the message RAM */
-        for( uint8 Word = 0; Word < ( DlcToBytes[ DataLenght ] / sizeof( uint32 ) ); Word++ )
+        else
+#endif
         {
-            HthObject[ PutIndex ].ObjPayload[ Word ] = RamBuffer[ Word ];
+            /* copy message into a 32bit wide buffer*/
+            for( uint8 Byte = 0; Byte < Length; Byte++ )
+            {
+                ( (uint8 *)RamBuffer )[ Byte ] = PduInfo->sdu[ Byte ];
+            }
         }
 
-        /* Activate the corresponding transmission request */
-        Bfx_SetBit_u32u8( (uint32 *)&Can->TXBAR, PutIndex );
+        if( Data == E_OK )
+        {
+            /* Set the actual data lenght (DLC), FD frames padded up to the closest DLC */
+            DataLenght = ( FrameType == CAN_FRAME_CLASSIC ) ? (uint8)Length : Can_GetClosestDlcWithPadding( (uint8)Length, Payload, Object->PaddingValue );
 
-        RetVal = E_OK;
-    }
-    else
-    {
-        RetVal = CAN_BUSY;
+            /* Write message data lenght */
+            Bfx_PutBits_u32u8u8u32( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_DLC_BIT, TX_BUFFER_DLC_SIZE, DataLenght );
+
+            /* Write Tx payload with padding value to the message RAM, a partial last word still goes */
+            for( uint8 Word = 0; ( Payload == RamBuffer ) && ( Word < ( ( DlcToBytes[ DataLenght ] + 3u ) / sizeof( uint32 ) ) ); Word++ )
+            {
+                HthObject[ PutIndex ].ObjPayload[ Word ] = RamBuffer[ Word ];
+            }
+
+            /* Activate the corresponding transmission request */
+            Bfx_SetBit_u32u8( (uint32 *)&Can->TXBAR, PutIndex );
+
+            RetVal = E_OK;
+        }
     }
+    else
+    {
+        /* Make room for the PDU if a lower priority one is pending, the PDU is not stored, CanIf
+        shall retry once the cancellation is notified */
+        const Can_Controller *ControllerConfig = Object->Controller;
+
+        if( ( ControllerConfig->HardwareCancellation == STD_ON ) && ( ControllerConfig->TxFifoQueueMode == CAN_TX_QUEUE_OPERATION ) )
+        {
+            uint32 Header = ( Bfx_GetBit_u32u8_u8( PduInfo->id, MSG_ID_BIT ) == CAN_ID_STANDARD )
+                                ? ( ( PduInfo->id & FILTER_STD_ID_MASK ) << TX_BUFFER_ID_11_BITS )
+                                : ( ( PduInfo->id & FILTER_EXT_ID_MASK ) | ( 1u << TX_BUFFER_XTD_BIT ) );
+
+            Can_CancelLowerPriorityTx( ControllerConfig, Header );
+        }
+
+        RetVal = CAN_BUSY;
+        Can_StatisticsIncrement( Object->CanReference, TxBusy );
+    }
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+    Can_StatisticsDuration( &Statistics[ Object->CanReference ].WriteDuration, Start );
+#endif
 
     return RetVal;
 }
@@ -1152,7 +1632,7 @@ Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const C
  * @brief    **Can Interrupt Handler**
  *
  * This function is the interrupt handler for the Can controller, it will check the interrupt flags
- * and call the corresponding callback functions.
+ * and call the corresponding callback functions regardless of the line they are assigned to.
  *
  * @param    HwUnit Pointer to the hardware unit configuration
  * @param    Controller CAN controller for which the status shall be changed.
@@ -1160,46 +1640,679 @@ Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const C
  * @reqs    SWS_Can_00420, SWS_Can_00033
  */
 void Can_Arch_IsrMainHandler( Can_HwUnit *HwUnit, uint8 Controller )
+{
+    /* Serve the interrupts of both lines */
+    Can_IsrDispatch( HwUnit, Controller, ( 1u << CAN_INTERRUPT_LINE0 ) | ( 1u << CAN_INTERRUPT_LINE1 ) );
+}
+
+/**
+ * @brief    **Can Interrupt Line Handler**
+ *
+ * This function is the interrupt handler for one of the Can controller interrupt lines, only the
+ * interrupts whose group is assigned to the line in ILS register are served. Line 0 shall be
+ * called from TIM16_FDCAN_IT0_IRQHandler and line 1 from TIM17_FDCAN_IT1_IRQHandler, so each line
+ * can run with its own NVIC priority. Both controllers share the same vectors, a controller whose
+ * line is disabled in ILE register by Can_Arch_DisableControllerInterrupts is not served when the
+ * vector fires because of the other controller.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller for which the status shall be changed.
+ * @param    Line Interrupt line to serve, a value of @ref CAN_IntLines
+ *
+ * @reqs    SWS_Can_00420, SWS_Can_00033
+ */
+void Can_Arch_IsrLineHandler( Can_HwUnit *HwUnit, uint8 Controller, uint8 Line )
+{
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+
+    /* Serve only the interrupts of the requested line and only if the line is enabled */
+    if( Bfx_GetBit_u32u8_u8( Can->ILE, Line ) == STD_ON )
+    {
+        Can_IsrDispatch( HwUnit, Controller, (uint8)( 1u << Line ) );
+    }
+}
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+/**
+ * @brief    **Get Controller Statistics**
+ *
+ * This function copies the runtime statistics collected for the given controller since its last
+ * initialization and calculates the average execution times. The counters are updated from
+ * interrupt context, so a value can be one event behind the other ones.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller whose statistics shall be read
+ * @param    StatisticsPtr Pointer to where to store the statistics
+ *
+ * @retval  E_OK: Statistics copied
+ */
+Std_ReturnType Can_Arch_GetStatistics( Can_HwUnit *HwUnit, uint8 Controller, Can_StatisticsType *StatisticsPtr )
+{
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+
+    *StatisticsPtr = Statistics[ ControllerConfig->CanReference ];
+
+    /* Averages are only calculated here to keep the divisions out of the interrupts */
+    if( StatisticsPtr->IsrDuration.Samples > 0u )
+    {
+        StatisticsPtr->IsrDuration.Avg = (uint32)( StatisticsPtr->IsrDuration.Total / StatisticsPtr->IsrDuration.Samples );
+    }
+
+    if( StatisticsPtr->WriteDuration.Samples > 0u )
+    {
+        StatisticsPtr->WriteDuration.Avg = (uint32)( StatisticsPtr->WriteDuration.Total / StatisticsPtr->WriteDuration.Samples );
+    }
+
+    return E_OK;
+}
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_BUS_MONITOR_API == STD_ON
+/**
+ * @brief    **Bus monitor cycle**
+ *
+ * This function measures the time elapsed since the last cycle with the timestamp counter, which
+ * runs once per nominal bit time, and closes the window every CAN_BUS_MONITOR_WINDOW cycles. A
+ * cycle only costs a register read, the divisions are left for the end of the window. The counter
+ * is 16 bits wide so the function shall be called more often than once every 65536 bit times.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller to monitor
+ */
+void Can_Arch_MainFunctionBusMonitor( Can_HwUnit *HwUnit, uint8 Controller )
+{
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+    /*Get the bus monitor state of the controller*/
+    Can_BusMonitorState *Monitor = &BusMonitor[ ControllerConfig->CanReference ];
+
+    /* The substraction is done on 16 bits so the counter wrap around is handled */
+    uint16 Timestamp = (uint16)Can->TSCV;
+    Monitor->BusTime += (uint16)( Timestamp - Monitor->Timestamp );
+    Monitor->Timestamp = Timestamp;
+    Monitor->Cycles++;
+
+    if( Monitor->Cycles >= CAN_BUS_MONITOR_WINDOW )
+    {
+        Can_BusMonitorWindow( Can, Monitor );
+        Monitor->Cycles  = 0u;
+        Monitor->BusTime = 0u;
+    }
+}
+
+/**
+ * @brief    **Get Controller Bus Monitor**
+ *
+ * This function copies the figures of the last window closed for the given controller.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller whose bus monitor shall be read
+ * @param    MonitorPtr Pointer to where to store the bus monitor
+ *
+ * @retval  E_OK: Bus monitor copied
+ */
+Std_ReturnType Can_Arch_GetBusMonitor( Can_HwUnit *HwUnit, uint8 Controller, Can_BusMonitorType *MonitorPtr )
+{
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+
+    *MonitorPtr = BusMonitor[ ControllerConfig->CanReference ].Result;
+
+    return E_OK;
+}
+#endif
+
+/**
+ * @brief    **Can low level Release Rx Message**
+ *
+ * This function releases the oldest Rx FIFO element held by the upper layer with the
+ * CAN_RX_DELIVERY_DEFERRED mode, the payload indicated with it shall not be accessed anymore. The
+ * elements shall be released in the same order they were indicated. The controller interrupts are
+ * disabled meanwhile since the Rx ISRs hold new elements, once the element is acknowledged the
+ * elements stored and not indicated yet are delivered right away.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Hrh Hardware receive object the message was indicated with
+ *
+ * @retval  E_OK: The oldest element held was released
+ *          E_NOT_OK: There is no element held for the Hrh
+ */
+Std_ReturnType Can_Arch_ReleaseRxMessage( Can_HwUnit *HwUnit, Can_HwHandleType Hrh )
+{
+    /* get the controller configuration the hardware object belongs to */
+    const Can_Controller *ControllerConfig = CAN_CONFIG( HwUnit->Config )->Hohs[ Hrh ].ControllerRef;
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+
+    uint8 Fifo            = ( CAN_CONFIG( HwUnit->Config )->Hohs[ Hrh ].RxFifo == CAN_RX_FIFO1 ) ? RX_FIFO_1 : RX_FIFO_0;
+    Std_ReturnType RetVal = E_NOT_OK;
+    uint8 Index;
+
+    /* The Rx ISRs hold new elements, keep them out until the counter is updated */
+    Can_Arch_DisableControllerInterrupts( HwUnit, ControllerConfig->ControllerId );
+
+    if( RxHeld[ ControllerConfig->CanReference ][ Fifo ] > 0u )
+    {
+        /* The oldest element held is the one at the get index */
+        uint32 Status = ( Fifo == RX_FIFO_0 ) ? Can->RXF0S : Can->RXF1S;
+        Index         = Bfx_GetBits_u32u8u8_u32( Status, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
+
+        if( Fifo == RX_FIFO_0 )
+        {
+            Can->RXF0A = Index;
+        }
+        else
+        {
+            Can->RXF1A = Index;
+        }
+
+        RxHeld[ ControllerConfig->CanReference ][ Fifo ]--;
+        RetVal = E_OK;
+
+        /* Deliver the elements stored meanwhile without waiting for the next new message interrupt */
+        for( uint8 Pending = 0u; Pending < RX_FIFO_ELEMENTS; Pending++ )
+        {
+            if( Can_GetRxFifoElement( ControllerConfig, Fifo, &Index ) == TRUE )
+            {
+                Can_DeliverRxMessage( ControllerConfig, ControllerConfig->ControllerId, Fifo, Index, CanIf_RxIndication );
+            }
+        }
+    }
+
+    Can_Arch_EnableControllerInterrupts( HwUnit, ControllerConfig->ControllerId );
+
+    return RetVal;
+}
+
+/**
+ * @brief    **Setup reception Filters**
+ *
+ * This function compiles the reception filters of the given controller into the minimal number
+ * of filter elements. Adjacent filters with the same ID type and element configuration, that is
+ * the same action and target, are grouped, single IDs and ranges of each group are sorted and
+ * merged into range elements when they are contiguous or overlap, the remaining single IDs are
+ * packed in pairs into dual ID elements, and classic filters with a partial mask are written as
+ * they are. A filter with another action or target in between starts a new group, so the groups
+ * are written in the configured order and the first match still goes to the first configured
+ * filter. Non matching frames are rejected by hardware.
+ *
+ * If the elements needed do not fit into the 28 standard or 8 extended elements available no
+ * filter list is enabled, a CAN_E_INIT_FAILED runtime error is reported and E_NOT_OK returned.
+ *
+ * @param    Config Pointer to the hardware unit configuration
+ * @param    Controller CAN controller for which the status shall be changed.
+ *
+ * @retval  E_OK: The filters were set up
+ *          E_NOT_OK: The filters do not fit in message RAM
+ */
+CAN_STATIC Std_ReturnType Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8 Controller )
+{
+    uint8 StdFilterIndex    = 0u;
+    uint8 ExtFilterIndex    = 0u;
+    Can_FilterCursor Cursor = { 0u };
+    Can_FilterCursor Walk   = { 0u };
+    Std_ReturnType RetVal   = E_OK;
+    Can_FilterGroup Group;
+
+    const Can_Controller *ControllerConfig = &Config->Controllers[ Controller ];
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+
+    Group.Config       = Config;
+    Group.ControllerId = ControllerConfig->ControllerId;
+    Group.SramCan      = SramCanPeripherals[ ControllerConfig->CanReference ];
+
+    /* Walk all the Rx filters of the controller looking for the first filter of each group */
+    const Can_HwFilter *HwFilter = Can_GetNextRxFilter( Config, Group.ControllerId, &Cursor );
+    while( HwFilter != NULL_PTR )
+    {
+        Group.IdType        = Can_GetFilterIdType( Cursor.Object, HwFilter );
+        Group.ElementConfig = Can_GetFilterElementConfig( Cursor.Object, HwFilter );
+        Group.Elements      = ( Group.IdType == CAN_ID_STANDARD ) ? &StdFilterIndex : &ExtFilterIndex;
+        Group.First         = Cursor.Position;
+        Group.Last          = Cursor.Position;
+
+        /* only standard and extended identifiers are valid */
+        boolean ValidId    = ( Group.IdType == CAN_ID_STANDARD ) || ( Group.IdType == CAN_ID_EXTENDED );
+        boolean Joined     = FALSE;
+        boolean GroupEnded = FALSE;
+
+        /* the group is already compiled if the previous filter of the same ID type belongs to it,
+        otherwise it takes the following filters of the same ID type up to another configuration */
+        Walk.Hoh      = 0u;
+        Walk.Filter   = 0u;
+        Walk.Position = 0u;
+        const Can_HwFilter *WalkFilter = Can_GetNextRxFilter( Config, Group.ControllerId, &Walk );
+        while( ( ValidId == TRUE ) && ( GroupEnded == FALSE ) && ( WalkFilter != NULL_PTR ) )
+        {
+            if( Can_GetFilterIdType( Walk.Object, WalkFilter ) != Group.IdType )
+            {
+                /* Filters of the other ID type are kept in their own list */
+            }
+            else if( Walk.Position < Group.First )
+            {
+                Joined = ( Can_GetFilterElementConfig( Walk.Object, WalkFilter ) == Group.ElementConfig );
+            }
+            else if( Joined == TRUE )
+            {
+                /* Compiled along with the previous filter */
+                GroupEnded = TRUE;
+            }
+            else if( Can_GetFilterElementConfig( Walk.Object, WalkFilter ) == Group.ElementConfig )
+            {
+                Group.Last = Walk.Position;
+            }
+            else
+            {
+                GroupEnded = TRUE;
+            }
+
+            WalkFilter = Can_GetNextRxFilter( Config, Group.ControllerId, &Walk );
+        }
+
+        if( ( ValidId == TRUE ) && ( Joined == FALSE ) )
+        {
+            Can_CompileFilterGroup( &Group );
+        }
+
+        HwFilter = Can_GetNextRxFilter( Config, Group.ControllerId, &Cursor );
+    }
+
+    if( ( StdFilterIndex > FILTER_STD_ELEMENTS ) || ( ExtFilterIndex > FILTER_EXT_ELEMENTS ) )
+    {
+        /* The filters do not fit in message RAM, the controller can not receive as configured */
+        Det_ReportRuntimeError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_INIT, CAN_E_INIT_FAILED );
+        RetVal = E_NOT_OK;
+    }
+    else
+    {
+        if( StdFilterIndex != 0u )
+        {
+            /* Standard filter elements number */
+            Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_LSS_BIT, RXGFC_LSS_SIZE, StdFilterIndex );
+            /*Reject all messages that do not match with filters*/
+            Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_ANFS_BIT, RXGFC_ANFS_SIZE, 3u );
+        }
+
+        if( ExtFilterIndex != 0u )
+        {
+            /* Extended filter elements number */
+            Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_LSE_BIT, RXGFC_LSE_SIZE, ExtFilterIndex );
+            /*Reject all messages that do not match with filters*/
+            Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_ANFE_BIT, RXGFC_ANFE_SIZE, 3u );
+        }
+    }
+
+    return RetVal;
+}
+
+/**
+ * @brief    **Compile a filter group**
+ *
+ * Walk the intervals of IDs accepted by the group in ascending order merging the ones that are
+ * contiguous or overlap. Every merged interval becomes a range element, two consecutive IDs or
+ * two isolated IDs become a dual ID element. Classic filters with a partial mask can not be
+ * merged and are written after the intervals.
+ *
+ * @param    Group Filter group to compile
+ */
+CAN_STATIC void Can_CompileFilterGroup( Can_FilterGroup *Group )
+{
+    Can_FilterInterval Interval = { 0u };
+    Can_FilterCursor Cursor     = { 0u };
+    uint32 IdMask               = ( Group->IdType == CAN_ID_STANDARD ) ? FILTER_STD_ID_MASK : FILTER_EXT_ID_MASK;
+    uint32 Low                  = 0u;
+    uint32 High                 = 0u;
+    uint32 Single               = 0u;
+    boolean Merging             = FALSE;
+    boolean Pending             = FALSE;
+    boolean Found;
+
+    do
+    {
+        Found = Can_GetNextFilterInterval( Group, &Interval );
+
+        if( ( Found == TRUE ) && ( Merging == TRUE ) && ( Interval.Low <= ( High + 1u ) ) )
+        {
+            /* Contiguous or overlaped, extend the interval being merged */
+            High = ( Interval.High > High ) ? Interval.High : High;
+        }
+        else
+        {
+            if( Merging == TRUE )
+            {
+                if( Low == High )
+                {
+                    if( Pending == TRUE )
+                    {
+                        /* Pair two isolated IDs */
+                        Can_WriteFilterElement( Group, CAN_FILTER_TYPE_DUAL, Single, Low );
+                        Pending = FALSE;
+                    }
+                    else
+                    {
+                        /* Wait for another isolated ID to share the element */
+                        Single  = Low;
+                        Pending = TRUE;
+                    }
+                }
+                else if( High == ( Low + 1u ) )
+                {
+                    Can_WriteFilterElement( Group, CAN_FILTER_TYPE_DUAL, Low, High );
+                }
+                else
+                {
+                    Can_WriteFilterElement( Group, CAN_FILTER_TYPE_RANGE, Low, High );
+                }
+            }
+
+            /* Start merging a new interval */
+            Low     = Interval.Low;
+            High    = Interval.High;
+            Merging = Found;
+        }
+    } while( Found == TRUE );
+
+    if( Pending == TRUE )
+    {
+        /* The last isolated ID takes a whole element */
+        Can_WriteFilterElement( Group, CAN_FILTER_TYPE_DUAL, Single, Single );
+    }
+
+    /* Classic filters with a partial mask are written as they are */
+    const Can_HwFilter *HwFilter = Can_GetNextRxFilter( Group->Config, Group->ControllerId, &Cursor );
+    while( HwFilter != NULL_PTR )
+    {
+        if( ( Can_IsFilterInGroup( Group, &Cursor, HwFilter ) == TRUE ) &&
+            ( HwFilter->HwFilterType == CAN_FILTER_TYPE_CLASSIC ) && ( ( HwFilter->HwFilterMask & IdMask ) != IdMask ) )
+        {
+            Can_WriteFilterElement( Group, CAN_FILTER_TYPE_CLASSIC, HwFilter->HwFilterCode, HwFilter->HwFilterMask );
+        }
+
+        HwFilter = Can_GetNextRxFilter( Group->Config, Group->ControllerId, &Cursor );
+    }
+}
+
+/**
+ * @brief    **Get next filter interval**
+ *
+ * Look for the interval of IDs in the group that follows the given one in ascending order of its
+ * lowest ID, and configuration order when two intervals start with the same ID. Range filters
+ * give one interval, dual ID filters two single IDs and classic filters with all the mask bits
+ * set one single ID. Ranges with the limits reversed accept no ID and are skipped.
+ *
+ * @param    Group Filter group to look into
+ * @param    Interval Last interval returned, zero to get the first one, updated with the next one
+ *
+ * @retval  TRUE: next interval found, FALSE: no more intervals in the group
+ */
+CAN_STATIC boolean Can_GetNextFilterInterval( const Can_FilterGroup *Group, Can_FilterInterval *Interval )
+{
+    Can_FilterCursor Cursor = { 0u };
+    Can_FilterInterval Candidate[ 2u ];
+    Can_FilterInterval Next = { 0u };
+    uint32 IdMask  = ( Group->IdType == CAN_ID_STANDARD ) ? FILTER_STD_ID_MASK : FILTER_EXT_ID_MASK;
+    uint64 Current = ( (uint64)Interval->Low << 16u ) | Interval->Sequence;
+    uint64 Best    = 0u;
+    boolean Found  = FALSE;
+
+    const Can_HwFilter *HwFilter = Can_GetNextRxFilter( Group->Config, Group->ControllerId, &Cursor );
+    while( HwFilter != NULL_PTR )
+    {
+        uint8 Candidates = 0u;
+
+        if( Can_IsFilterInGroup( Group, &Cursor, HwFilter ) == TRUE )
+        {
+            /* sequence zero is reserved to start the search */
+            uint16 Sequence = (uint16)( Cursor.Position << 1u );
+
+            if( ( HwFilter->HwFilterType == CAN_FILTER_TYPE_RANGE ) && ( HwFilter->HwFilterCode <= HwFilter->HwFilterMask ) )
+            {
+                Candidate[ 0u ].Low      = HwFilter->HwFilterCode;
+                Candidate[ 0u ].High     = HwFilter->HwFilterMask;
+                Candidate[ 0u ].Sequence = Sequence;
+                Candidates               = 1u;
+            }
+            else if( HwFilter->HwFilterType == CAN_FILTER_TYPE_DUAL )
+            {
+                Candidate[ 0u ].Low      = HwFilter->HwFilterCode;
+                Candidate[ 0u ].High     = HwFilter->HwFilterCode;
+                Candidate[ 0u ].Sequence = Sequence;
+                Candidate[ 1u ].Low      = HwFilter->HwFilterMask;
+                Candidate[ 1u ].High     = HwFilter->HwFilterMask;
+                Candidate[ 1u ].Sequence = Sequence + 1u;
+                Candidates               = 2u;
+            }
+            else if( ( HwFilter->HwFilterType == CAN_FILTER_TYPE_CLASSIC ) && ( ( HwFilter->HwFilterMask & IdMask ) == IdMask ) )
+            {
+                Candidate[ 0u ].Low      = HwFilter->HwFilterCode;
+                Candidate[ 0u ].High     = HwFilter->HwFilterCode;
+                Candidate[ 0u ].Sequence = Sequence;
+                Candidates               = 1u;
+            }
+            else
+            {
+                /* Not an interval of IDs */
+            }
+        }
+
+        for( uint8 i = 0u; i < Candidates; i++ )
+        {
+            uint64 Key = ( (uint64)Candidate[ i ].Low << 16u ) | Candidate[ i ].Sequence;
+
+            /* keep the smallest interval that follows the current one */
+            if( ( Key > Current ) && ( ( Found == FALSE ) || ( Key < Best ) ) )
+            {
+                Best  = Key;
+                Next  = Candidate[ i ];
+                Found = TRUE;
+            }
+        }
+
+        HwFilter = Can_GetNextRxFilter( Group->Config, Group->ControllerId, &Cursor );
+    }
+
+    if( Found == TRUE )
+    {
+        *Interval = Next;
+    }
+
+    return Found;
+}
+
+/**
+ * @brief    **Get next Rx filter**
+ *
+ * Walk the filters of the receive hardware objects assigned to the controller, in the same order
+ * they are configured.
+ *
+ * @param    Config Pointer to the hardware unit configuration
+ * @param    ControllerId Controller the hardware objects belong to
+ * @param    Cursor Position of the walk, zero to start, updated with the filter returned
+ *
+ * @retval  Next filter or NULL_PTR when all filters were walked
+ */
+CAN_STATIC const Can_HwFilter *Can_GetNextRxFilter( const Can_ConfigType *Config, uint8 ControllerId, Can_FilterCursor *Cursor )
+{
+    const Can_HwFilter *HwFilter = NULL_PTR;
+
+    while( ( HwFilter == NULL_PTR ) && ( Cursor->Hoh < Config->HohsCount ) )
+    {
+        const Can_HardwareObject *Hoh = &Config->Hohs[ Cursor->Hoh ];
+
+        /*explore only the receive objects with filters of the controller assigned*/
+        if( ( Hoh->ControllerRef->ControllerId == ControllerId ) && ( Hoh->ObjectType == CAN_HOH_TYPE_RECEIVE ) &&
+            ( Hoh->HwFilter != NULL_PTR ) && ( Cursor->Filter < Hoh->HwFilterCount ) )
+        {
+            HwFilter       = &Hoh->HwFilter[ Cursor->Filter ];
+            Cursor->Object = Hoh;
+            Cursor->Filter++;
+            Cursor->Position++;
+        }
+        else
+        {
+            Cursor->Hoh++;
+            Cursor->Filter = 0u;
+        }
+    }
+
+    return HwFilter;
+}
+
+/**
+ * @brief    **Filter belongs to group**
+ *
+ * @param    Group Filter group
+ * @param    Cursor Position of the filter, with the hardware object it belongs to
+ * @param    HwFilter Filter to check
+ *
+ * @retval  TRUE: same ID type and element configuration than the group and within its filters,
+ *          FALSE: otherwise
+ */
+CAN_STATIC boolean Can_IsFilterInGroup( const Can_FilterGroup *Group, const Can_FilterCursor *Cursor, const Can_HwFilter *HwFilter )
+{
+    return ( Cursor->Position >= Group->First ) && ( Cursor->Position <= Group->Last ) &&
+           ( Can_GetFilterIdType( Cursor->Object, HwFilter ) == Group->IdType ) &&
+           ( Can_GetFilterElementConfig( Cursor->Object, HwFilter ) == Group->ElementConfig );
+}
+
+/**
+ * @brief    **Get filter ID type**
+ *
+ * @param    Hoh Hardware object the filter belongs to
+ * @param    HwFilter Filter to check
+ *
+ * @retval  ID type of the hardware object, or of the filter when the object accepts mixed IDs
+ */
+CAN_STATIC Can_IdType Can_GetFilterIdType( const Can_HardwareObject *Hoh, const Can_HwFilter *HwFilter )
+{
+    return ( Hoh->IdType == CAN_ID_MIXED ) ? HwFilter->HwFilterIdType : Hoh->IdType;
+}
+
+/**
+ * @brief    **Write filter element**
+ *
+ * Write the next standard or extended filter element of the group ID type, elements that do
+ * not fit in message RAM are only counted.
+ *
+ * @param    Group Filter group the element belongs to
+ * @param    Type Filter type, a value of @ref CAN_Filter_Type
+ * @param    Id1 First ID, lowest ID for ranges or filter code for classic filters
+ * @param    Id2 Second ID, highest ID for ranges or mask for classic filters
+ */
+CAN_STATIC void Can_WriteFilterElement( Can_FilterGroup *Group, uint32 Type, uint32 Id1, uint32 Id2 )
+{
+    uint8 Index = *Group->Elements;
+
+    if( ( Group->IdType == CAN_ID_STANDARD ) && ( Index < FILTER_STD_ELEMENTS ) )
+    {
+        uint32 *StdFilter = (uint32 *)&Group->SramCan->FLSSA[ Index ];
+
+        Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFID1_BIT, RX_BUFFER_ID_11_SIZE, Id1 );
+        Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFID2_BIT, RX_BUFFER_ID_11_SIZE, Id2 );
+        Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFEC_BIT, FLSSA_SFEC_SIZE, Group->ElementConfig );
+        Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFT_BIT, FLSSA_SFT_SIZE, Type );
+    }
+    else if( ( Group->IdType == CAN_ID_EXTENDED ) && ( Index < FILTER_EXT_ELEMENTS ) )
+    {
+        /* extended elements take two words */
+        HwExtFilter *ExtFilter = &( (HwExtFilter *)Group->SramCan->FLESA )[ Index ];
+
+        Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader1, FLESA_EFID_BIT, RX_BUFFER_ID_29_SIZE, Id1 );
+        Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader2, FLESA_EFID_BIT, RX_BUFFER_ID_29_SIZE, Id2 );
+        Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader2, FLESA_EFT_BIT, FLESA_EFT_SIZE, Type );
+        Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader1, FLESA_EFEC_BIT, FLESA_EFEC_SIZE, Group->ElementConfig );
+    }
+    else
+    {
+        /* No room left, the element is only counted */
+    }
+
+    *Group->Elements = Index + 1u;
+}
+
+/**
+ * @brief    **Get filter element configuration**
+ *
+ * Returns the value for the SFEC/EFEC field of a filter element, the matching frames are stored
+ * in the Rx FIFO assigned to the hardware object and if the filter is flagged as high priority
+ * the priority bit is added so the controller raises the high priority message interrupt.
+ *
+ * @param    Hoh Hardware object the filter belongs to
+ * @param    HwFilter Filter to get the element configuration
+ *
+ * @retval  Element configuration value
+ */
+CAN_STATIC uint8 Can_GetFilterElementConfig( const Can_HardwareObject *Hoh, const Can_HwFilter *HwFilter )
+{
+    uint8 ElementConfig = Hoh->RxFifo;
+
+    if( HwFilter->HwFilterPriority == CAN_FILTER_PRIORITY_HIGH )
+    {
+        ElementConfig |= FILTER_EC_PRIORITY;
+    }
+
+    return ElementConfig;
+}
+
+/**
+ * @brief    **Dispatch interrupt service routines**
+ *
+ * Check the interrupt flags assigned to the requested lines and call the corresponding callback
+ * functions, high priority messages are served ahead of any other source, this way the frame is
+ * not picked up first by the regular Rx FIFO new message callbacks. PSR is read once before the
+ * protocol error callbacks run, both take their error code out of that read.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller for which the status shall be changed.
+ * @param    Lines Bit mask with the interrupt lines to serve, bit 0 for line 0 and bit 1 for line 1
+ */
+CAN_STATIC void Can_IsrDispatch( Can_HwUnit *HwUnit, uint8 Controller, uint8 Lines )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+    /*Interrupt lines assigned to each group*/
+    uint32 Ils = Can->ILS;
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+    /* Take the time the interrupt starts */
+    uint32 Start = CAN_STATISTICS_CYCLE_COUNTER( );
+    Statistics[ ControllerConfig->CanReference ].IsrCalls++;
+#endif
 
-    /* clang-format off */
-    void (*IsrPointer[])(Can_HwUnit*, uint8) = 
-    {
-        Can_Isr_RxFifo0NewMessage,
-        Can_Isr_RxFifo0Full,
-        Can_Isr_RxFifo0MessageLost,
-        Can_Isr_RxFifo1NewMessage,
-        Can_Isr_RxFifo1Full,
-        Can_Isr_RxFifo1MessageLost,
-        Can_Isr_HighPriorityMessageRx,
-        Can_Isr_TransmissionCompleted,
-        Can_Isr_TransmissionCancellationFinished,
-        Can_Isr_TxEventFifoElementLost,
-        Can_Isr_TxEventFifoFull,
-        Can_Isr_TxEventFifoNewEntry,
-        Can_Isr_TxFifoEmpty,
-        Can_Isr_TimestampWraparound,
-        Can_Isr_MessageRamAccessFailure,
-        Can_Isr_TimeoutOccurred,
-        Can_Isr_ErrorLoggingOverflow,
-        Can_Isr_ErrorPassive,
-        Can_Isr_WarningStatus,
-        Can_Isr_BusOffStatus,
-        Can_Isr_WatchdogInterrupt,
-        Can_Isr_ProtocolErrorInArbitrationPhase,
-        Can_Isr_ProtocolErrorInDataPhase
-    };
-    /* clang-format on */
+    /* High priority message first, only if its group belongs to the requested lines */
+    if( ( ( Lines & ( 1u << Bfx_GetBit_u32u8_u8( Ils, IsrGroup[ IR_HPM_BIT ] ) ) ) != 0u ) &&
+        ( Bfx_GetBit_u32u8_u8( Can->IR, IR_HPM_BIT ) == STD_ON ) && ( Bfx_GetBit_u32u8_u8( Can->IE, IR_HPM_BIT ) == STD_ON ) )
+    {
+        Can_Isr_HighPriorityMessageRx( HwUnit, Controller );
+        /* Clear the interrupt flag */
+        Bfx_SetBit_u32u8( (uint32 *)&Can->IR, IR_HPM_BIT );
+    }
+
+    /* Reading PSR clears LEC and DLEC, a second read would lose the code of the other phase */
+    if( ( ( Lines & ( 1u << Bfx_GetBit_u32u8_u8( Ils, IsrGroup[ IR_PEA_BIT ] ) ) ) != 0u ) &&
+        ( ( Can->IR & Can->IE & ( CAN_IT_ARB_PROTOCOL_ERROR | CAN_IT_DATA_PROTOCOL_ERROR ) ) != 0u ) )
+    {
+        ProtocolStatus[ ControllerConfig->CanReference ] = Can->PSR;
+    }
 
     /*Go throu all interrupts potentianly enable*/
-    for( uint8 Interrupt = 0u; Interrupt < sizeof( IsrPointer ) / sizeof( IsrPointer[ 0 ] ); Interrupt++ )
+    for( uint8 Interrupt = 0u; Interrupt < ( sizeof( IsrPointer ) / sizeof( IsrPointer[ 0 ] ) ); Interrupt++ )
     {
-        /* If interrupt in turn is active */
-        if( Bfx_GetBit_u32u8_u8( Can->IR, Interrupt ) == STD_ON )
+        /* Skip the interrupts assigned to a line not requested, high priority message was already served */
+        if( ( ( Lines & ( 1u << Bfx_GetBit_u32u8_u8( Ils, IsrGroup[ Interrupt ] ) ) ) != 0u ) &&
+            ( Interrupt != IR_HPM_BIT ) && ( Bfx_GetBit_u32u8_u8( Can->IR, Interrupt ) == STD_ON ) )
         {
             /*Double check if the interrupt is enable*/
             if( Bfx_GetBit_u32u8_u8( Can->IE, Interrupt ) == STD_ON )
@@ -1211,127 +2324,251 @@ void Can_Arch_IsrMainHandler( Can_HwUnit *HwUnit, uint8 Controller )
             Bfx_SetBit_u32u8( (uint32 *)&Can->IR, Interrupt );
         }
     }
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+    Can_StatisticsDuration( &Statistics[ ControllerConfig->CanReference ].IsrDuration, Start );
+#endif
+}
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_STATISTICS_API == STD_ON
+/**
+ * @brief    **Update execution time statistics**
+ *
+ * Measure the time elapsed since the given start tick and accumulate it into the duration
+ * statistics, the counter width mask takes care of the counter wrap around.
+ *
+ * @param    Duration Duration statistics to update
+ * @param    Start Counter value taken when the measured routine started
+ */
+CAN_STATIC void Can_StatisticsDuration( Can_DurationType *Duration, uint32 Start )
+{
+    uint32 Elapsed = ( CAN_STATISTICS_CYCLE_COUNTER( ) - Start ) & CAN_STATISTICS_COUNTER_MASK;
+
+    if( ( Duration->Samples == 0u ) || ( Elapsed < Duration->Min ) )
+    {
+        Duration->Min = Elapsed;
+    }
+
+    if( Elapsed > Duration->Max )
+    {
+        Duration->Max = Elapsed;
+    }
+
+    Duration->Total += Elapsed;
+    Duration->Samples++;
+}
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_BUS_MONITOR_API == STD_ON
+/**
+ * @brief    **Count a frame on the bus monitor**
+ *
+ * The bits the frame took on the bus are calculated out of the header of its Rx FIFO or Tx event
+ * FIFO element, both share the same layout. Stuff bits depend on the frame content and are not
+ * counted, so the bus load calculated is a lower bound. Data phase bits of FD frames sent with bit
+ * rate switching are counted apart since they are converted to nominal bit times at the end of
+ * the window.
+ *
+ * @param    Reference Can peripheral the frame belongs to
+ * @param    Direction Traffic the frame is counted on, BUS_MONITOR_RX or BUS_MONITOR_TX
+ * @param    Header1 First word of the element
+ * @param    Header2 Second word of the element
+ */
+CAN_STATIC void Can_BusMonitorFrame( uint8 Reference, uint8 Direction, uint32 Header1, uint32 Header2 )
+{
+    Can_BusTraffic *Traffic = &BusMonitor[ Reference ].Traffic[ Direction ];
+    uint32 Bytes = DlcToBytes[ Bfx_GetBits_u32u8u8_u32( Header2, RX_BUFFER_DLC_BIT, RX_BUFFER_DLC_SIZE ) ];
+    uint32 Extended = Bfx_GetBit_u32u8_u8( Header1, RX_BUFFER_XTD_BIT );
+
+    if( Bfx_GetBit_u32u8_u8( Header2, RX_BUFFER_FDF_BIT ) == STD_OFF )
+    {
+        Traffic->NominalBits += FRAME_CLASSIC_BITS + ( Extended * FRAME_CLASSIC_XTD ) + ( Bytes * 8u );
+    }
+    else
+    {
+        /* The data phase goes from the ESI bit up to the CRC delimiter */
+        uint32 DataPhase = FRAME_FD_DATA_BITS + ( ( Bytes > FRAME_FD_CRC17_BYTES ) ? FRAME_FD_CRC21 : 0u ) + ( Bytes * 8u );
+        Traffic->NominalBits += FRAME_FD_BITS + ( Extended * FRAME_FD_XTD );
+
+        if( Bfx_GetBit_u32u8_u8( Header2, RX_BUFFER_BRS_BIT ) == STD_ON )
+        {
+            Traffic->DataBits += DataPhase;
+        }
+        else
+        {
+            Traffic->NominalBits += DataPhase;
+        }
+    }
+
+    Traffic->Frames++;
+}
+
+/**
+ * @brief    **Count a protocol error on the bus monitor**
+ *
+ * @param    Reference Can peripheral the error belongs to
+ * @param    ErrorCode Last error code read from PSR, no error and no change codes are not counted
+ */
+CAN_STATIC void Can_BusMonitorError( uint8 Reference, uint8 ErrorCode )
+{
+    /* Last error codes 1 to 6 map to CAN_BUS_ERROR_STUFF up to CAN_BUS_ERROR_CRC */
+    if( ( ErrorCode > 0u ) && ( ErrorCode <= CAN_BUS_ERRORS ) )
+    {
+        BusMonitor[ Reference ].Errors[ ErrorCode - 1u ]++;
+    }
 }
 
 /**
- * @brief    **Setup reception Filters**
+ * @brief    **Close a bus monitor window**
  *
- * This function sets up the reception filters for the given controller. It will set the filters
- * for the standard and extended ID's. The function will only set the filters if the HwFilter
- * pointer is not NULL.
+ * The traffic and errors counted by the interrupts since the window started are taken as the
+ * difference with the values saved when it started, the interrupts never stop counting so nothing
+ * gets lost in between windows. Data phase bits are converted to nominal bit times with the bit
+ * timing registers, the bus load is the time the frames took over the time elapsed.
  *
- * @param    Config Pointer to the hardware unit configuration
- * @param    Controller CAN controller for which the status shall be changed.
+ * @param    Can Registers of the controller
+ * @param    Monitor Bus monitor state of the controller
  */
-CAN_STATIC void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8 Controller )
+CAN_STATIC void Can_BusMonitorWindow( const Can_RegisterType *Can, Can_BusMonitorState *Monitor )
 {
-    uint8 StdFilterIndex = 0u;
-    uint8 ExtFilterIndex = 0u;
+    Can_BusMonitorType *Result = &Monitor->Result;
+    uint32 NominalBits         = 0u;
+    uint32 DataBits            = 0u;
+    uint32 Frames[ BUS_MONITOR_TRAFFIC ];
+    uint32 ErrorCount = 0u;
+    uint32 Load       = 0u;
+
+    for( uint8 Direction = 0u; Direction < BUS_MONITOR_TRAFFIC; Direction++ )
+    {
+        /* Copy the counters once, a frame counted after the copy falls on the next window */
+        Can_BusTraffic Traffic = Monitor->Traffic[ Direction ];
 
-    const Can_Controller *ControllerConfig = &Config->Controllers[ Controller ];
-    /*Get the Can controller register structure*/
-    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+        NominalBits += Traffic.NominalBits - Monitor->Start[ Direction ].NominalBits;
+        DataBits += Traffic.DataBits - Monitor->Start[ Direction ].DataBits;
+        Frames[ Direction ]         = Traffic.Frames - Monitor->Start[ Direction ].Frames;
+        Monitor->Start[ Direction ] = Traffic;
+    }
+
+    Result->RxFrames = Frames[ BUS_MONITOR_RX ];
+    Result->TxFrames = Frames[ BUS_MONITOR_TX ];
 
-    for( uint8 Hoh = 0; Hoh < Config->HohsCount; Hoh++ )
+    for( uint8 Error = 0u; Error < CAN_BUS_ERRORS; Error++ )
     {
-        /*explore only those Hardware Objects for the Controller assigned*/
-        if( Config->Hohs[ Hoh ].ControllerRef->ControllerId == ControllerConfig->ControllerId )
-        {
-            /*look only for Receive objects*/
-            if( Config->Hohs[ Hoh ].ObjectType == CAN_HOH_TYPE_RECEIVE )
-            {
-                /* set the filter only if filters are availables*/
-                if( Config->Hohs[ Hoh ].HwFilter != NULL_PTR )
-                {
-                    /* Loop for all filters set */
-                    for( uint8 Filter = 0; Filter < Config->Hohs[ Hoh ].HwFilterCount; Filter++ )
-                    {
-                        /* Set the filter ID, standard (11 bits) or extended (29 bits) */
-                        if( ( Config->Hohs[ Hoh ].IdType == CAN_ID_STANDARD ) || ( ( Config->Hohs[ Hoh ].IdType == CAN_ID_MIXED ) && ( Config->Hohs[ Hoh ].HwFilter->HwFilterIdType == CAN_ID_STANDARD ) ) )
-                        {
-                            uint32 *StdFilter            = (uint32 *)&SramCanPeripherals[ ControllerConfig->CanReference ]->FLSSA[ StdFilterIndex ];
-                            const Can_HwFilter *HwFilter = &Config->Hohs[ Hoh ].HwFilter[ Filter ];
-
-                            Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFID1_BIT, RX_BUFFER_ID_11_SIZE, HwFilter->HwFilterCode );
-                            Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFID2_BIT, RX_BUFFER_ID_11_SIZE, HwFilter->HwFilterMask );
-                            Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFEC_BIT, FLSSA_SFEC_SIZE, Config->Hohs[ Hoh ].RxFifo );
-                            Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFT_BIT, FLSSA_SFT_SIZE, HwFilter->HwFilterType );
-                            StdFilterIndex++;
-                        }
-                        else if( ( Config->Hohs[ Hoh ].IdType == CAN_ID_EXTENDED ) || ( ( Config->Hohs[ Hoh ].IdType == CAN_ID_MIXED ) && ( Config->Hohs[ Hoh ].HwFilter->HwFilterIdType == CAN_ID_EXTENDED ) ) )
-                        {
-                            HwExtFilter *ExtFilter       = (HwExtFilter *)&SramCanPeripherals[ ControllerConfig->CanReference ]->FLESA[ ExtFilterIndex ];
-                            const Can_HwFilter *HwFilter = &Config->Hohs[ Hoh ].HwFilter[ Filter ];
-
-                            Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader1, FLESA_EFID_BIT, RX_BUFFER_ID_29_SIZE, HwFilter->HwFilterCode );
-                            Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader2, FLESA_EFID_BIT, RX_BUFFER_ID_29_SIZE, HwFilter->HwFilterMask );
-                            Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader2, FLESA_EFT_BIT, FLESA_EFT_SIZE, HwFilter->HwFilterType );
-                            Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader1, FLESA_EFEC_BIT, FLESA_EFEC_SIZE, Config->Hohs[ Hoh ].RxFifo );
-                            ExtFilterIndex++;
-                        }
-                        else
-                        {
-                            /*Do nothing*/
-                        }
-                    }
-                }
-            }
-        }
+        uint32 Count = Monitor->Errors[ Error ];
+
+        Result->Errors[ Error ] = Count - Monitor->ErrorsStart[ Error ];
+        ErrorCount += Result->Errors[ Error ];
+        Monitor->ErrorsStart[ Error ] = Count;
+    }
+
+    if( DataBits > 0u )
+    {
+        /* Clock cycles per bit, prescaler times the sync segment plus both time segments */
+        uint32 NominalClocks = ( Bfx_GetBits_u32u8u8_u32( Can->NBTP, NBTP_NBRP_BIT, NBTP_NBRP_SIZE ) + 1u ) *
+                               ( Bfx_GetBits_u32u8u8_u32( Can->NBTP, NBTP_NTSEG1_BIT, NBTP_NTSEG1_SIZE ) +
+                                 Bfx_GetBits_u32u8u8_u32( Can->NBTP, NBTP_NTSEG2_BIT, NBTP_NTSEG2_SIZE ) + 3u );
+        uint32 DataClocks = ( Bfx_GetBits_u32u8u8_u32( Can->DBTP, DBTP_DBRP_BIT, DBTP_DBRP_SIZE ) + 1u ) *
+                            ( Bfx_GetBits_u32u8u8_u32( Can->DBTP, DBTP_DTSEG1_BIT, DBTP_DTSEG1_SIZE ) +
+                              Bfx_GetBits_u32u8u8_u32( Can->DBTP, DBTP_DTSEG2_BIT, DBTP_DTSEG2_SIZE ) + 3u );
+
+        NominalBits += (uint32)( ( (uint64)DataBits * DataClocks ) / NominalClocks );
     }
 
-    if( StdFilterIndex != 0u )
+    if( Monitor->BusTime > 0u )
     {
-        /* Standard filter elements number */
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_LSS_BIT, RXGFC_LSS_SIZE, StdFilterIndex );
-        /*Reject all messages that do not match with filters*/
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_ANFS_BIT, RXGFC_ANFS_SIZE, 3u );
+        Load = (uint32)( ( (uint64)NominalBits * BUS_MONITOR_FULL ) / Monitor->BusTime );
+        Load = ( Load > BUS_MONITOR_FULL ) ? BUS_MONITOR_FULL : Load;
     }
 
-    if( ExtFilterIndex != 0u )
+    /* Exponential average with a weight of 1 / 2^CAN_BUS_MONITOR_SMOOTHING, seeded with the first window */
+    if( Result->Windows == 0u )
     {
-        /* Extended filter elements number */
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_LSE_BIT, RXGFC_LSE_SIZE, ExtFilterIndex );
-        /*Reject all messages that do not match with filters*/
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_ANFE_BIT, RXGFC_ANFE_SIZE, 3u );
+        Result->BusLoadAvg = (uint16)Load;
     }
+    else
+    {
+        Result->BusLoadAvg = (uint16)( ( ( (uint32)Result->BusLoadAvg << CAN_BUS_MONITOR_SMOOTHING ) - Result->BusLoadAvg + Load ) >>
+                                       CAN_BUS_MONITOR_SMOOTHING );
+    }
+
+    Result->BusLoad    = (uint16)Load;
+    Result->BusLoadMax = ( Result->BusLoad > Result->BusLoadMax ) ? Result->BusLoad : Result->BusLoadMax;
+    Result->ErrorRatio = ( ErrorCount > 0u ) ? (uint16)( ( (uint64)ErrorCount * BUS_MONITOR_FULL ) / ( ErrorCount + Result->RxFrames + Result->TxFrames ) ) : 0u;
+    Result->BusTime    = Monitor->BusTime;
+    Result->Windows++;
 }
+#endif
 
 /**
  * @brief    **setup Can controller baudrate**
  *
- * This function sets up the baudrate for the given controller. It will set the baudrate for the
- * nominal and data bit timing registers. The function will only set the baudrate if the Baudrate
- * pointer is not NULL.
+ * This function sets up the baudrate for the given controller. The nominal and data bit timing
+ * registers are written in one go with the images built by CAN_NBTP_VALUE and CAN_DBTP_VALUE when
+ * the configuration was compiled, the data bit timing and the transmitter delay compensation are
+ * only written if FD is active.
  *
  * @param    Baudrate: Baudrate configuration
  * @param    Can: Register structure of the CAN controller
  */
 CAN_STATIC void Can_SetupBaudrateConfig( const Can_ControllerBaudrateConfig *Baudrate, Can_RegisterType *Can )
 {
-    /* Set the default nominal bit timing register */
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->NBTP, NBTP_NSJW_BIT, NBTP_NSJW_SIZE, ( Baudrate->SyncJumpWidth - 1u ) );
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->NBTP, NBTP_NTSEG1_BIT, NBTP_NTSEG1_SIZE, ( Baudrate->Seg1 - 1u ) );
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->NBTP, NBTP_NTSEG2_BIT, NBTP_NTSEG2_SIZE, ( Baudrate->Seg2 - 1u ) );
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->NBTP, NBTP_NBRP_BIT, NBTP_NBRP_SIZE, ( Baudrate->Prescaler - 1u ) );
+    /* Set the nominal bit timing register, the image is built at configuration time */
+    Can->NBTP = Baudrate->Nbtp;
 
-    /*set default data bit timing register if FD is active*/
+    /*set data bit timing register if FD is active*/
     if( Baudrate->FdTxBitRateSwitch == STD_ON )
     {
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->DBTP, DBTP_DSJW_BIT, DBTP_DSJW_SIZE, ( Baudrate->FdSyncJumpWidth - 1u ) );
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->DBTP, DBTP_DTSEG1_BIT, DBTP_DTSEG1_SIZE, ( Baudrate->FdSeg1 - 1u ) );
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->DBTP, DBTP_DTSEG2_BIT, DBTP_DTSEG2_SIZE, ( Baudrate->FdSeg2 - 1u ) );
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->DBTP, DBTP_DBRP_BIT, DBTP_DBRP_SIZE, ( Baudrate->FdPrescaler - 1u ) );
+        Can->DBTP = Baudrate->Dbtp;
+        /* Offset and filter window of the secondary sample point, ignored if DBTP.TDC is clear */
+        Can->TDCR = Baudrate->Tdcr;
     }
 
     /* set data bit rate switch */
     Bfx_PutBit_u32u8u8( (uint32 *)&Can->CCCR, CCCR_BRSE_BIT, Baudrate->FdTxBitRateSwitch );
 }
 
+/**
+ * @brief    **setup Can transmit objects runtime table**
+ *
+ * This function flattens the transmit hardware objects of the given controller into the Hth
+ * indexed runtime table, the register and message RAM base addresses and the padding value are
+ * resolved once here instead of walking Hohs, ControllerRef and the peripheral tables on every
+ * write. The configuration set selected at Can_Init is the one used.
+ *
+ * @param    Config: Pointer to the hardware unit configuration
+ * @param    Controller: CAN controller whose transmit objects shall be flattened
+ */
+CAN_STATIC void Can_SetupHthTable( const Can_ConfigType *Config, uint8 Controller )
+{
+    const Can_Controller *ControllerConfig = &Config->Controllers[ Controller ];
+
+    for( uint8 Hth = 0u; ( Hth < Config->HohsCount ) && ( Hth < CAN_NUMBER_OF_HOHS ); Hth++ )
+    {
+        const Can_HardwareObject *Hoh = &Config->Hohs[ Hth ];
+
+        if( ( Hoh->ObjectType == CAN_HOH_TYPE_TRANSMIT ) && ( Hoh->ControllerRef == ControllerConfig ) )
+        {
+            HthTable[ Hth ].Can          = CanPeripherals[ ControllerConfig->CanReference ];
+            HthTable[ Hth ].TxBuffers    = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->TBSA;
+            HthTable[ Hth ].Controller   = ControllerConfig;
+            HthTable[ Hth ].CanReference = ControllerConfig->CanReference;
+            HthTable[ Hth ].PaddingValue = Hoh->FdPaddingValue;
+        }
+    }
+}
+
 /**
  * @brief    **setup Can controller interrupts**
  *
- * This function setup the interrupts for the Can controller, tkaes the values in Line0ActiveITs and
- * Line1ActiveITs and assign to interrupt lines plus enable the Tx complete and abort interrupts
+ * This function setup the interrupts for the Can controller, enables the values in ActiveITs and
+ * assign to line 1 the groups of the interrupts in Line1ITs, the rest remain in line 0, plus
+ * enable the Tx complete and abort interrupts. With the high priority message enabled the Rx FIFO
+ * 0, Rx FIFO 1 and status message groups are moved to line 1 together if any of them is requested
+ * there, the high priority message callback reads and acknowledges the same Rx FIFOs the new
+ * message callbacks do and shall not preempt them.
  *
  * @param    Controller: CAN controller for which the status shall be changed.
  * @param    Can: Pointer to the Can controller register structure
@@ -1354,13 +2591,21 @@ CAN_STATIC void Can_SetupConfiguredInterrupts( const Can_Controller *Controller,
     /*Enable interrupts*/
     Bfx_SetBitMask_u32u32( (uint32 *)&Can->IE, Controller->ActiveITs | Line0ITs | Line1ITs );
 
-    /* Assign group of interrupts Tx Event Fifo to line 1*/
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->ILS, CAN_IT_GROUP_MISC, (uint8)( ( Line1ITs & CAN_IT_LIST_MISC ) != 0 ) );
-    /* Assign group of interrupts Bit line errors to line 1*/
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->ILS, CAN_IT_GROUP_BIT_LINE_ERROR, (uint8)( ( Line1ITs & CAN_IT_LIST_BIT_LINE_ERROR ) != 0 ) );
+    /* Interrupts requested by the configuration to be served by line 1 */
+    Line1ITs |= Controller->Line1ITs;
 
-    /* Assign group of interrupts Protocol errors to line 1*/
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->ILS, CAN_IT_GROUP_PROTOCOL_ERROR, (uint8)( ( Line1ITs & CAN_IT_LIST_PROTOCOL_ERROR ) != 0 ) );
+    /* The Rx FIFOs get index and acknowledge are shared by the high priority message and the new
+    message callbacks, all of them go to the same line */
+    if( ( ( Controller->ActiveITs & CAN_IT_RX_HIGH_PRIORITY_MSG ) != 0u ) && ( ( Line1ITs & IT_LIST_RX_PATH ) != 0u ) )
+    {
+        Line1ITs |= IT_LIST_RX_PATH;
+    }
+
+    /* Assign to line 1 the groups with at least one interrupt requested on that line */
+    for( uint8 Group = 0u; Group < ( sizeof( IsrGroupList ) / sizeof( IsrGroupList[ 0 ] ) ); Group++ )
+    {
+        Bfx_PutBit_u32u8u8( (uint32 *)&Can->ILS, Group, (uint8)( ( Line1ITs & IsrGroupList[ Group ] ) != 0u ) );
+    }
 
 
     /* Enable Tx Buffer Transmission Interrupt to set TC flag in IR register,
@@ -1383,62 +2628,30 @@ CAN_STATIC void Can_SetupConfiguredInterrupts( const Can_Controller *Controller,
  *
  * This function determines the data lenght to send according to the CAN FD specification, in case
  * the actual data lenght do not match with any of the available data lenghts, the function will
- * return the closest data lenght with padding.
+ * return the closest data lenght and only the bytes between the actual length and the closest one
+ * are padded, the payload bytes are left to be copied by the caller. Lengths above 64 bytes are
+ * not expected since Can_Write checks them against the object payload, the whole 8 bytes are
+ * padded in such case.
  *
- * @param    Dlc: Data lenght to send
+ * @param    Length: Data lenght to send
  * @param    RamBuffer: Pointer to the buffer where the data will be stored
  * @param    PaddingValue: Value to use for padding
  *
  * @retval  DataLenght: Define with for data lenght to send
  */
-CAN_STATIC uint8 Can_GetClosestDlcWithPadding( uint8 Dlc, uint32 *RamBuffer, uint8 PaddingValue )
+CAN_STATIC uint8 Can_GetClosestDlcWithPadding( uint8 Length, uint32 *RamBuffer, uint8 PaddingValue )
 {
-    uint8 DataLenght = 0u;
-    uint8 Counter;
+    uint8 DataLenght = CAN_OBJECT_PL_8;
+    uint8 Byte       = 0u;
 
-    if( ( Dlc > 8u ) && ( Dlc <= 12u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_12;
-        Counter    = 12;
-    }
-    else if( ( Dlc > 12u ) && ( Dlc <= 16u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_16;
-        Counter    = 16;
-    }
-    else if( ( Dlc > 16u ) && ( Dlc <= 20u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_20;
-        Counter    = 20;
-    }
-    else if( ( Dlc > 20u ) && ( Dlc <= 24u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_24;
-        Counter    = 24;
-    }
-    else if( ( Dlc > 24u ) && ( Dlc <= 32u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_32;
-        Counter    = 32;
-    }
-    else if( ( Dlc > 32u ) && ( Dlc <= 48u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_48;
-        Counter    = 48;
-    }
-    else if( ( Dlc > 48u ) && ( Dlc <= 64u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_64;
-        Counter    = 64;
-    }
-    else
+    if( Length <= CAN_MAX_FD_PAYLOAD )
     {
-        DataLenght = CAN_OBJECT_PL_8;
-        Counter    = 8;
+        DataLenght = LengthToDlc[ Length ];
+        Byte       = Length;
     }
 
-    /*set padding value*/
-    for( uint8 Byte = 0u; Byte < Counter; Byte++ )
+    /*set padding value only on the unused tail*/
+    for( ; Byte < DlcToBytes[ DataLenght ]; Byte++ )
     {
         ( (uint8 *)RamBuffer )[ Byte ] = PaddingValue;
     }
@@ -1468,8 +2681,11 @@ CAN_STATIC uint8 Can_GetTxPduId( const Can_Controller *Controller, PduIdType *Ca
     /* Calculate Tx event FIFO element address */
     uint8 GetIndex = Bfx_GetBits_u32u8u8_u32( Can->TXEFS, TXEFS_EFGI_BIT, TXEFS_EFGI_SIZE );
 
-    /* Get the CAN Pdu store in the message marker field */
-    *CanPduId = Bfx_GetBits_u32u8u8_u32( SramCan->EFSA[ GetIndex ], TX_BUFFER_MM_BIT, TX_BUFFER_MM_SIZE );
+    /* Get the CAN Pdu store in the message marker field, it is in the second word of the element */
+    *CanPduId = Bfx_GetBits_u32u8u8_u32( SramCan->EFSA[ ( GetIndex * 2u ) + 1u ], TX_BUFFER_MM_BIT, TX_BUFFER_MM_SIZE );
+
+    /* Count the frame on the bus before the element is handed back to the hardware */
+    Can_BusMonitorFrame( Controller->CanReference, BUS_MONITOR_TX, SramCan->EFSA[ GetIndex * 2u ], SramCan->EFSA[ ( GetIndex * 2u ) + 1u ] );
 
     /* Acknowledge the Tx Event FIFO that the oldest element is read so that it increments the GetIndex */
     Can->TXEFA = GetIndex;
@@ -1520,6 +2736,196 @@ CAN_STATIC void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uin
     Bfx_PutBit_u32u8u8( CanId, MSG_FORMAT_BIT, Format );
 }
 
+/**
+ * @brief    **Get the next Rx FIFO element to indicate**
+ *
+ * This function looks for the oldest element of the Rx FIFO not yet indicated to the upper layer,
+ * the elements held with the CAN_RX_DELIVERY_DEFERRED mode are still counted by the FIFO fill
+ * level and placed right after the get index, so they are skipped.
+ *
+ * @param    Controller Controller configuration the FIFO belongs to
+ * @param    Fifo Rx FIFO to look into, RX_FIFO_0 or RX_FIFO_1
+ * @param    Index Pointer to the variable where the element index will be stored
+ *
+ * @retval  TRUE if there is an element to indicate, otherwise FALSE
+ */
+CAN_STATIC boolean Can_GetRxFifoElement( const Can_Controller *Controller, uint8 Fifo, uint8 *Index )
+{
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ Controller->CanReference ];
+    /* Rx FIFO status register */
+    uint32 Status   = ( Fifo == RX_FIFO_0 ) ? Can->RXF0S : Can->RXF1S;
+    uint8 Held      = RxHeld[ Controller->CanReference ][ Fifo ];
+    boolean Pending = FALSE;
+
+    if( Bfx_GetBits_u32u8u8_u32( Status, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE ) > Held )
+    {
+        *Index  = ( Bfx_GetBits_u32u8u8_u32( Status, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE ) + Held ) % RX_FIFO_ELEMENTS;
+        Pending = TRUE;
+    }
+
+    return Pending;
+}
+
+/**
+ * @brief    **Indicate a Rx FIFO element to the upper layer**
+ *
+ * This function reads the element and passes it to the callback as per the controller delivery
+ * mode. With CAN_RX_DELIVERY_IMMEDIATE the payload points into message RAM and the element is
+ * acknowledged right after the callback returns. With CAN_RX_DELIVERY_DEFERRED the element is held
+ * before the callback is called, so the payload stays valid until Can_ReleaseRxMessage is called,
+ * even from the callback itself. With CAN_RX_DELIVERY_COPY the payload is copied once into the
+ * buffer returned by the RxBufferCallback and the element is acknowledged before the callback.
+ *
+ * @param    Controller Controller configuration the FIFO belongs to
+ * @param    ControllerId CAN controller the message was received
+ * @param    Fifo Rx FIFO to read from, RX_FIFO_0 or RX_FIFO_1
+ * @param    Index Element to read
+ * @param    Callback Function to indicate the message to
+ */
+CAN_STATIC void Can_DeliverRxMessage( const Can_Controller *Controller, uint8 ControllerId, uint8 Fifo, uint8 Index,
+                                      Can_HighPriorityRxCallbackType Callback )
+{
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ Controller->CanReference ];
+    /*Get the message RAM where the controller is mapped*/
+    SramCan_RegisterType *SramCan = SramCanPeripherals[ Controller->CanReference ];
+
+    HwObjectHandler *HrhObject = (HwObjectHandler *)( ( Fifo == RX_FIFO_0 ) ? SramCan->F0SA : SramCan->F1SA );
+    volatile uint32 *RxFifoAck = ( Fifo == RX_FIFO_0 ) ? &Can->RXF0A : &Can->RXF1A;
+    uint8 *Buffer              = NULL_PTR;
+    PduInfoType PduInfo;
+    Can_HwType Mailbox;
+
+    /* Set Hoh and controller Ids */
+    Mailbox.Hoh          = ( Fifo == RX_FIFO_0 ) ? Fifo0ToCtrlIds[ ControllerId ] : Fifo1ToCtrlIds[ ControllerId ];
+    Mailbox.ControllerId = ControllerId;
+
+    /* Read the message */
+    Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
+    Can_BusMonitorFrame( Controller->CanReference, BUS_MONITOR_RX, HrhObject[ Index ].ObjHeader1, HrhObject[ Index ].ObjHeader2 );
+
+    if( ( Controller->RxDelivery == CAN_RX_DELIVERY_COPY ) && ( Controller->RxBufferCallback != NULL_PTR ) )
+    {
+        Buffer = Controller->RxBufferCallback( &Mailbox, PduInfo.SduLength );
+    }
+
+    if( Buffer != NULL_PTR )
+    {
+        /* Copy the payload once straight into the upper layer buffer, the element is not needed anymore */
+        Can_CopyRxPayload( HrhObject[ Index ].ObjPayload, Buffer, PduInfo.SduLength );
+        PduInfo.SduDataPtr = Buffer;
+        *RxFifoAck         = Index;
+        Callback( &Mailbox, &PduInfo );
+    }
+    else if( Controller->RxDelivery == CAN_RX_DELIVERY_DEFERRED )
+    {
+        /* The upper layer owns the element until it is released */
+        RxHeld[ Controller->CanReference ][ Fifo ]++;
+        Callback( &Mailbox, &PduInfo );
+    }
+    else
+    {
+        Callback( &Mailbox, &PduInfo );
+        /* Acknowledge the element so the FIFO get index is incremented */
+        *RxFifoAck = Index;
+    }
+
+    Can_StatisticsIncrement( Controller->CanReference, RxFrames );
+}
+
+/**
+ * @brief    **Copy a payload out of message RAM**
+ *
+ * The message RAM is read in words, the bytes of the last word beyond the length are not copied.
+ *
+ * @param    Payload Payload of the Rx FIFO element
+ * @param    Buffer Upper layer buffer with room for Length bytes
+ * @param    Length Payload length in bytes
+ */
+CAN_STATIC void Can_CopyRxPayload( const volatile uint32 *Payload, uint8 *Buffer, PduLengthType Length )
+{
+    for( PduLengthType Byte = 0u; Byte < Length; Byte += sizeof( uint32 ) )
+    {
+        uint32 Word = Payload[ Byte / sizeof( uint32 ) ];
+
+        for( PduLengthType Shift = 0u; ( Shift < sizeof( uint32 ) ) && ( ( Byte + Shift ) < Length ); Shift++ )
+        {
+            Buffer[ Byte + Shift ] = (uint8)( Word >> ( Shift * 8u ) );
+        }
+    }
+}
+
+/**
+ * @brief    **Arbitration key of a frame**
+ *
+ * Build from a Tx buffer header a value that sorts the frames the same way the bus arbitration
+ * does, the lower the key the higher the priority. The base identifier goes first, then a
+ * standard frame wins over an extended one with the same base identifier and last the extension
+ * bits of the extended identifier are compared.
+ *
+ * @param    Header Tx buffer header word 1 with the identifier and the XTD bit
+ *
+ * @retval  Arbitration key
+ */
+CAN_STATIC uint32 Can_GetArbitrationKey( uint32 Header )
+{
+    /* The base identifier sits on the same bits for both types */
+    uint32 Key = Bfx_GetBits_u32u8u8_u32( Header, TX_BUFFER_ID_11_BITS, TX_BUFFER_ID_11_SIZE ) << ( TX_BUFFER_ID_11_BITS + 1u );
+
+    /* The bits below the base identifier are not cleared when a standard id is written */
+    if( Bfx_GetBit_u32u8_u8( Header, TX_BUFFER_XTD_BIT ) == CAN_ID_EXTENDED )
+    {
+        Key |= ( 1u << TX_BUFFER_ID_11_BITS ) | Bfx_GetBits_u32u8u8_u32( Header, TX_BUFFER_ID_29_BITS, TX_BUFFER_ID_11_BITS );
+    }
+
+    return Key;
+}
+
+/**
+ * @brief    **Cancel a lower priority pending frame**
+ *
+ * Look for the pending Tx buffer with the lowest priority and request its cancellation if its
+ * priority is lower than the one of the frame that found the Tx queue full, this way a high
+ * priority PDU does not wait behind the low priority ones. Only one cancellation is requested at
+ * a time, the buffer freed is enough for the PDU that asked for it. Once the cancellation is
+ * finished Can_Isr_TransmissionCancellationFinished notifies the cancelled PDU to CanIf.
+ *
+ * @param    Controller Controller configuration
+ * @param    Header Tx buffer header word 1 of the new frame
+ *
+ * @reqs    SWS_Can_00286, SWS_Can_00399
+ */
+CAN_STATIC void Can_CancelLowerPriorityTx( const Can_Controller *Controller, uint32 Header )
+{
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ Controller->CanReference ];
+    /*Get the Tx buffers from Sram*/
+    const HwObjectHandler *Buffers = (const HwObjectHandler *)SramCanPeripherals[ Controller->CanReference ]->TBSA;
+
+    uint32 Lowest = Can_GetArbitrationKey( Header );
+    uint8 Victim  = TX_BUFFER_ELEMENTS;
+
+    if( ( Can->TXBCR & Can->TXBRP ) == 0u )
+    {
+        for( uint8 Buffer = 0u; Buffer < TX_BUFFER_ELEMENTS; Buffer++ )
+        {
+            /* Equal identifiers are never cancelled, the frames shall go out in request order */
+            if( ( Bfx_GetBit_u32u8_u8( Can->TXBRP, Buffer ) == TRUE ) && ( Can_GetArbitrationKey( Buffers[ Buffer ].ObjHeader1 ) > Lowest ) )
+            {
+                Lowest = Can_GetArbitrationKey( Buffers[ Buffer ].ObjHeader1 );
+                Victim = Buffer;
+            }
+        }
+    }
+
+    if( Victim < TX_BUFFER_ELEMENTS )
+    {
+        TxCancelled[ Controller->CanReference ] |= (uint8)( 1u << Victim );
+        Bfx_SetBit_u32u8( (uint32 *)&Can->TXBCR, Victim );
+    }
+}
+
 
 /**
  * @brief    **Can Rx Fifo 0 New Message Callback**
@@ -1535,29 +2941,15 @@ CAN_STATIC void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uin
 CAN_STATIC void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
-    /*Get the Can controller register structure*/
-    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
-    /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
-    HwObjectHandler *HrhObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->F0SA;
-
-    PduInfoType PduInfo;
-    Can_HwType Mailbox;
-
-    /* Set Hoh and controller Ids */
-    Mailbox.Hoh          = Fifo0ToCtrlIds[ Controller ];
-    Mailbox.ControllerId = Controller;
-
-    /* Get Rx FIFO Get index */
-    uint8 Index = Bfx_GetBits_u32u8u8_u32( Can->RXF0S, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
-
-    /* Read the oldest message arrived */
-    Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
-    /* Pass the messages to upper layer */
-    CanIf_RxIndication( &Mailbox, &PduInfo );
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+    uint8 Index;
 
-    /* Acknowledge the Rx FIFO 0 that the oldest element is read so that it increments the GetIndex */
-    Can->RXF0A = Index;
+    /* The message could be already taken by the high priority message callback */
+    if( Can_GetRxFifoElement( ControllerConfig, RX_FIFO_0, &Index ) == TRUE )
+    {
+        /* Pass the oldest message arrived to the upper layer */
+        Can_DeliverRxMessage( ControllerConfig, Controller, RX_FIFO_0, Index, CanIf_RxIndication );
+    }
 }
 
 /**
@@ -1574,30 +2966,15 @@ CAN_STATIC void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller
 CAN_STATIC void Can_Isr_RxFifo0Full( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
-    /*Get the Can controller register structure*/
-    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
-    /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
-    HwObjectHandler *HrhObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->F0SA;
-
-    PduInfoType PduInfo;
-    Can_HwType Mailbox;
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     uint8 Index;
 
-    /* Set Hoh and controller Ids, same for all messages */
-    Mailbox.Hoh          = Fifo0ToCtrlIds[ Controller ];
-    Mailbox.ControllerId = Controller;
+    Can_StatisticsIncrement( ControllerConfig->CanReference, RxFifoFull );
 
-    while( Bfx_GetBits_u32u8u8_u32( Can->RXF0S, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE ) > 0u )
+    while( Can_GetRxFifoElement( ControllerConfig, RX_FIFO_0, &Index ) == TRUE )
     {
-        /* Get Rx FIFO Get index */
-        Index = Bfx_GetBits_u32u8u8_u32( Can->RXF0S, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
-        /* Read the oldest message arrived */
-        Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
-        /* Pass the messages to upper layer */
-        CanIf_RxIndication( &Mailbox, &PduInfo );
-        /* Acknowledge the Rx FIFO 0 that the oldest element is read so that it increments the GetIndex */
-        Can->RXF0A = Index;
+        /* Pass the oldest message arrived to the upper layer */
+        Can_DeliverRxMessage( ControllerConfig, Controller, RX_FIFO_0, Index, CanIf_RxIndication );
     }
 }
 
@@ -1620,12 +2997,13 @@ CAN_STATIC void Can_Isr_RxFifo0MessageLost( Can_HwUnit *HwUnit, uint8 Controller
     (void)Controller;
 #else
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     Can_ErrorType Error = CAN_ERROR_OVERLOAD;
     CanIf_ErrorNotification( ControllerConfig->ControllerId, Error );
 #endif
 
+    Can_StatisticsIncrement( CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ].CanReference, RxFifoLost );
     Det_ReportRuntimeError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_ISR_RECEPTION, CAN_E_DATALOST );
 }
 
@@ -1643,29 +3021,15 @@ CAN_STATIC void Can_Isr_RxFifo0MessageLost( Can_HwUnit *HwUnit, uint8 Controller
 CAN_STATIC void Can_Isr_RxFifo1NewMessage( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
-    /*Get the Can controller register structure*/
-    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
-    /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
-    HwObjectHandler *HrhObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->F1SA;
-
-    PduInfoType PduInfo;
-    Can_HwType Mailbox;
-
-    /* Set Hoh and controller Ids */
-    Mailbox.Hoh          = Fifo1ToCtrlIds[ Controller ];
-    Mailbox.ControllerId = Controller;
-
-    /* Get Rx FIFO Get index */
-    uint8 Index = Bfx_GetBits_u32u8u8_u32( Can->RXF1S, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
-
-    /* Read the oldest message arrived */
-    Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
-    /* Pass the messages to upper layer */
-    CanIf_RxIndication( &Mailbox, &PduInfo );
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+    uint8 Index;
 
-    /* Acknowledge the Rx FIFO 0 that the oldest element is read so that it increments the GetIndex */
-    Can->RXF1A = Index;
+    /* The message could be already taken by the high priority message callback */
+    if( Can_GetRxFifoElement( ControllerConfig, RX_FIFO_1, &Index ) == TRUE )
+    {
+        /* Pass the oldest message arrived to the upper layer */
+        Can_DeliverRxMessage( ControllerConfig, Controller, RX_FIFO_1, Index, CanIf_RxIndication );
+    }
 }
 
 /**
@@ -1682,30 +3046,15 @@ CAN_STATIC void Can_Isr_RxFifo1NewMessage( Can_HwUnit *HwUnit, uint8 Controller
 CAN_STATIC void Can_Isr_RxFifo1Full( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
-    /*Get the Can controller register structure*/
-    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
-    /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
-    HwObjectHandler *HrhObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->F1SA;
-
-    PduInfoType PduInfo;
-    Can_HwType Mailbox;
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     uint8 Index;
 
-    /* Set Hoh and controller Ids, same for all messages */
-    Mailbox.Hoh          = Fifo1ToCtrlIds[ Controller ];
-    Mailbox.ControllerId = Controller;
+    Can_StatisticsIncrement( ControllerConfig->CanReference, RxFifoFull );
 
-    while( Bfx_GetBits_u32u8u8_u32( Can->RXF1S, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE ) > 0u )
+    while( Can_GetRxFifoElement( ControllerConfig, RX_FIFO_1, &Index ) == TRUE )
     {
-        /* Get Rx FIFO Get index */
-        Index = Bfx_GetBits_u32u8u8_u32( Can->RXF1S, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
-        /* Read the oldest message arrived */
-        Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
-        /* Pass the messages to upper layer */
-        CanIf_RxIndication( &Mailbox, &PduInfo );
-        /* Acknowledge the Rx FIFO 1 that the oldest element is read so that it increments the GetIndex */
-        Can->RXF1A = Index;
+        /* Pass the oldest message arrived to the upper layer */
+        Can_DeliverRxMessage( ControllerConfig, Controller, RX_FIFO_1, Index, CanIf_RxIndication );
     }
 }
 
@@ -1728,25 +3077,87 @@ CAN_STATIC void Can_Isr_RxFifo1MessageLost( Can_HwUnit *HwUnit, uint8 Controller
     (void)Controller;
 #else
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     Can_ErrorType Error = CAN_ERROR_OVERLOAD;
     CanIf_ErrorNotification( ControllerConfig->ControllerId, Error );
 #endif
 
+    Can_StatisticsIncrement( CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ].CanReference, RxFifoLost );
     Det_ReportRuntimeError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_ISR_RECEPTION, CAN_E_DATALOST );
 }
 
 /**
- * @brief    **Can Tx Fifo/Queue Error Callback**
+ * @brief    **Can High Priority Message Callback**
+ *
+ * This function is the callback for the High Priority Message interrupt, the message pointed by
+ * HPMS is delivered straight to the controller high priority callback (CanIf_RxIndication when
+ * not configured). Elements older than the high priority one are passed first to the upper layer
+ * to keep the FIFO order, the loop is bounded by the number of elements in the Rx FIFO and stops
+ * once the FIFO is empty, so an element already read is never taken as a new one.
  *
  * @param    HwUnit: Pointer to the hardware unit configuration
  * @param    Controller: CAN controller for which the status shall be changed.
+ *
+ * @reqs    SWS_Can_00489, SWS_Can_00501, SWS_Can_00423, SWS_Can_00279
  */
 CAN_STATIC void Can_Isr_HighPriorityMessageRx( Can_HwUnit *HwUnit, uint8 Controller )
 {
-    (void)HwUnit;
-    (void)Controller;
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+
+    Can_HighPriorityRxCallbackType Callback = ControllerConfig->HighPriorityRxCallback;
+    uint8 Fifo                              = RX_FIFOS;
+    uint8 Index;
+    uint8 Delivered = FALSE;
+
+    /* Find out in which FIFO the high priority message was stored */
+    uint8 Storage = Bfx_GetBits_u32u8u8_u32( Can->HPMS, HPMS_MSI_BIT, HPMS_MSI_SIZE );
+    /* Element index of the high priority message */
+    uint8 Element = Bfx_GetBits_u32u8u8_u32( Can->HPMS, HPMS_BIDX_BIT, HPMS_BIDX_SIZE );
+
+    if( Storage == HPMS_MSI_FIFO0 )
+    {
+        Fifo = RX_FIFO_0;
+    }
+    else if( Storage == HPMS_MSI_FIFO1 )
+    {
+        Fifo = RX_FIFO_1;
+    }
+    else
+    {
+        /* No FIFO selected or message lost, the later is reported by the Rx FIFO lost callbacks */
+    }
+
+    if( Fifo != RX_FIFOS )
+    {
+        if( Callback == NULL_PTR )
+        {
+            Callback = CanIf_RxIndication;
+        }
+
+        for( uint8 Pending = 0u; ( Pending < RX_FIFO_ELEMENTS ) && ( Delivered == FALSE ); Pending++ )
+        {
+            if( Can_GetRxFifoElement( ControllerConfig, Fifo, &Index ) == FALSE )
+            {
+                /* The high priority message was already indicated */
+                Delivered = TRUE;
+            }
+            else if( Index == Element )
+            {
+                /* Deliver the high priority message */
+                Can_DeliverRxMessage( ControllerConfig, Controller, Fifo, Index, Callback );
+                Delivered = TRUE;
+            }
+            else
+            {
+                /* Older messages still take the regular path */
+                Can_DeliverRxMessage( ControllerConfig, Controller, Fifo, Index, CanIf_RxIndication );
+            }
+        }
+    }
 }
 
 /**
@@ -1766,7 +3177,7 @@ CAN_STATIC void Can_Isr_HighPriorityMessageRx( Can_HwUnit *HwUnit, uint8 Control
 CAN_STATIC void Can_Isr_TransmissionCompleted( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
 
     PduIdType CanPduId;
 
@@ -1775,18 +3186,50 @@ CAN_STATIC void Can_Isr_TransmissionCompleted( Can_HwUnit *HwUnit, uint8 Control
 
     /*Pass the PduId od the senede message to upper layer*/
     CanIf_TxConfirmation( CanPduId );
+    Can_StatisticsIncrement( ControllerConfig->CanReference, TxFrames );
 }
 
 /**
  * @brief    **Can Transmission cancellation finished Callback**
  *
+ * This function is the callback for the Transmission cancellation finished interrupt, it will pass
+ * to the upper layer the PduId and the payload of each frame cancelled in favour of a higher
+ * priority one, so CanIf can store it back and send it later. The cancellations requested when the
+ * controller is stopped or goes bus off are not notified.
+ *
  * @param    HwUnit: Pointer to the hardware unit configuration
  * @param    Controller: CAN controller for which the status shall be changed.
  */
 CAN_STATIC void Can_Isr_TransmissionCancellationFinished( Can_HwUnit *HwUnit, uint8 Controller )
 {
-    (void)HwUnit;
-    (void)Controller;
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+    /*Get the Tx buffers from Sram*/
+    HwObjectHandler *Buffers = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->TBSA;
+
+    /* Cancellations requested by Can_Arch_Write and already finished */
+    uint8 Finished = TxCancelled[ ControllerConfig->CanReference ] & (uint8)Can->TXBCF;
+    TxCancelled[ ControllerConfig->CanReference ] &= (uint8)~Finished;
+
+    for( uint8 Buffer = 0u; Buffer < TX_BUFFER_ELEMENTS; Buffer++ )
+    {
+        /* A frame already on the bus when the request came is sent anyway and confirmed as usual */
+        if( ( Bfx_GetBit_u32u8_u8( Finished, Buffer ) == TRUE ) && ( Bfx_GetBit_u32u8_u8( Can->TXBTO, Buffer ) == FALSE ) )
+        {
+            PduInfoType PduInfo;
+            PduIdType CanPduId = (PduIdType)Bfx_GetBits_u32u8u8_u32( Buffers[ Buffer ].ObjHeader2, TX_BUFFER_MM_BIT, TX_BUFFER_MM_SIZE );
+
+            /* The payload is handed from message RAM, CanIf shall copy it before writing again */
+            PduInfo.SduDataPtr  = (uint8 *)Buffers[ Buffer ].ObjPayload;
+            PduInfo.MetaDataPtr = NULL_PTR;
+            PduInfo.SduLength   = DlcToBytes[ Bfx_GetBits_u32u8u8_u32( Buffers[ Buffer ].ObjHeader2, TX_BUFFER_DLC_BIT, TX_BUFFER_DLC_SIZE ) ];
+
+            CanIf_CancelTxConfirmation( CanPduId, &PduInfo );
+            Can_StatisticsIncrement( ControllerConfig->CanReference, TxCancelled );
+        }
+    }
 }
 
 /**
@@ -1808,7 +3251,7 @@ CAN_STATIC void Can_Isr_TxEventFifoElementLost( Can_HwUnit *HwUnit, uint8 Contro
     (void)Controller;
 #else
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     Can_ErrorType Error = CAN_ERROR_OVERLOAD;
     CanIf_ErrorNotification( ControllerConfig->ControllerId, Error );
@@ -1832,7 +3275,7 @@ CAN_STATIC void Can_Isr_TxEventFifoElementLost( Can_HwUnit *HwUnit, uint8 Contro
 CAN_STATIC void Can_Isr_TxEventFifoFull( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
 
     PduIdType CanPduId;
     uint8 Msgs;
@@ -1843,6 +3286,7 @@ CAN_STATIC void Can_Isr_TxEventFifoFull( Can_HwUnit *HwUnit, uint8 Controller )
         Msgs = Can_GetTxPduId( ControllerConfig, &CanPduId );
         /*Pass the PduId od the senede message to upper layer*/
         CanIf_TxConfirmation( CanPduId );
+        Can_StatisticsIncrement( ControllerConfig->CanReference, TxFrames );
     } while( Msgs > 0u );
 }
 
@@ -1863,7 +3307,7 @@ CAN_STATIC void Can_Isr_TxEventFifoFull( Can_HwUnit *HwUnit, uint8 Controller )
 CAN_STATIC void Can_Isr_TxEventFifoNewEntry( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
 
     PduIdType CanPduId;
 
@@ -1872,6 +3316,7 @@ CAN_STATIC void Can_Isr_TxEventFifoNewEntry( Can_HwUnit *HwUnit, uint8 Controlle
 
     /*Pass the PduId od the senede message to upper layer*/
     CanIf_TxConfirmation( CanPduId );
+    Can_StatisticsIncrement( ControllerConfig->CanReference, TxFrames );
 }
 
 /**
@@ -1891,7 +3336,7 @@ CAN_STATIC void Can_Isr_TxEventFifoNewEntry( Can_HwUnit *HwUnit, uint8 Controlle
 CAN_STATIC void Can_Isr_TxFifoEmpty( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
 
     PduIdType CanPduId;
     uint8 Msgs;
@@ -1902,6 +3347,7 @@ CAN_STATIC void Can_Isr_TxFifoEmpty( Can_HwUnit *HwUnit, uint8 Controller )
         Msgs = Can_GetTxPduId( ControllerConfig, &CanPduId );
         /*Pass the PduId od the senede message to upper layer*/
         CanIf_TxConfirmation( CanPduId );
+        Can_StatisticsIncrement( ControllerConfig->CanReference, TxFrames );
     } while( Msgs > 0u );
 }
 
@@ -1971,7 +3417,7 @@ CAN_STATIC void Can_Isr_ErrorPassive( Can_HwUnit *HwUnit, uint8 Controller )
     uint8 RxErrorCounter;
     uint8 TxErrorCounter;
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
@@ -2012,7 +3458,7 @@ CAN_STATIC void Can_Isr_WarningStatus( Can_HwUnit *HwUnit, uint8 Controller )
 CAN_STATIC void Can_Isr_BusOffStatus( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
@@ -2022,6 +3468,8 @@ CAN_STATIC void Can_Isr_BusOffStatus( Can_HwUnit *HwUnit, uint8 Controller )
         /* Add cancellation request for all buffers */
         /*we don't know if this gonna take time */
         Can->TXBCR = 0x03u;
+        /* Pending frames are dropped without notification, also the ones already cancelled */
+        TxCancelled[ ControllerConfig->CanReference ] = 0u;
 
         /* Wait until the INIT bit into CCCR register is set, this bit was set
         automatically by the Bus_Off event */
@@ -2039,6 +3487,7 @@ CAN_STATIC void Can_Isr_BusOffStatus( Can_HwUnit *HwUnit, uint8 Controller )
         HwUnit->ControllerState[ Controller ] = CAN_CS_STOPPED;
         /* Notify Bus off */
         CanIf_ControllerBusOff( ControllerConfig->ControllerId );
+        Can_StatisticsIncrement( ControllerConfig->CanReference, BusOff );
     }
 }
 
@@ -2059,6 +3508,7 @@ CAN_STATIC void Can_Isr_WatchdogInterrupt( Can_HwUnit *HwUnit, uint8 Controller
  *
  * The function report the Error code to upper layer CanIf in error happens in arbitration phase, errors
  * reported are only tose the Mcu supports, if the Mcu doesn't support the error it will be ignored
+ * The error code comes from the PSR read by Can_IsrDispatch, PSR is not read here again.
  *
  * @param    HwUnit: Pointer to the hardware unit configuration
  * @param    Controller: CAN controller for which the status shall be changed.
@@ -2068,19 +3518,24 @@ CAN_STATIC void Can_Isr_WatchdogInterrupt( Can_HwUnit *HwUnit, uint8 Controller
 CAN_STATIC void Can_Isr_ProtocolErrorInArbitrationPhase( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
-#if CAN_ENABLE_SECURITY_EVENT_REPORTING == STD_OFF
+#if ( CAN_ENABLE_SECURITY_EVENT_REPORTING == STD_OFF ) && ( CAN_BUS_MONITOR_API == STD_OFF )
     (void)HwUnit;
     (void)Controller;
     (void)AutosarError;
 #else
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
-    /*Get the Can controller register structure*/
-    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
-    /*Get the erro code */
-    uint8 ErrorCode = Bfx_GetBits_u32u8u8_u32( Can->PSR, PSR_LEC_BIT, PSR_LEC_SIZE );
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+    /*Get the erro code out of the PSR read by the dispatch */
+    uint8 ErrorCode = Bfx_GetBits_u32u8u8_u32( ProtocolStatus[ ControllerConfig->CanReference ], PSR_LEC_BIT, PSR_LEC_SIZE );
+    /* Count the error on the bus monitor */
+    Can_BusMonitorError( ControllerConfig->CanReference, ErrorCode );
+    /* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_ENABLE_SECURITY_EVENT_REPORTING == STD_ON
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     CanIf_ErrorNotification( ControllerConfig->ControllerId, AutosarError[ ErrorCode ] );
+#else
+    (void)AutosarError;
+#endif
 #endif
 }
 
@@ -2089,6 +3544,7 @@ CAN_STATIC void Can_Isr_ProtocolErrorInArbitrationPhase( Can_HwUnit *HwUnit, uin
  *
  * The function report the Error code to upper layer CanIf in error happens in data phase, errors
  * reported are only tose the Mcu supports, if the Mcu doesn't support the error it will be ignored
+ * The error code comes from the PSR read by Can_IsrDispatch, PSR is not read here again.
  *
  * @param    HwUnit: Pointer to the hardware unit configuration
  * @param    Controller: CAN controller for which the status shall be changed.
@@ -2098,18 +3554,25 @@ CAN_STATIC void Can_Isr_ProtocolErrorInArbitrationPhase( Can_HwUnit *HwUnit, uin
 CAN_STATIC void Can_Isr_ProtocolErrorInDataPhase( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
-#if CAN_ENABLE_SECURITY_EVENT_REPORTING == STD_OFF
+#if ( CAN_ENABLE_SECURITY_EVENT_REPORTING == STD_OFF ) && ( CAN_BUS_MONITOR_API == STD_OFF )
     (void)HwUnit;
     (void)Controller;
     (void)AutosarError;
 #else
     /* get controller configuration */
-    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
-    /*Get the Can controller register structure*/
-    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
-    /*Get the erro code */
-    uint8 ErrorCode = Bfx_GetBits_u32u8u8_u32( Can->PSR, PSR_DLEC_BIT, PSR_DLEC_SIZE );
+    const Can_Controller *ControllerConfig = &CAN_CONFIG( HwUnit->Config )->Controllers[ Controller ];
+    /*Get the erro code out of the PSR read by the dispatch */
+    uint8 ErrorCode = Bfx_GetBits_u32u8u8_u32( ProtocolStatus[ ControllerConfig->CanReference ], PSR_DLEC_BIT, PSR_DLEC_SIZE );
+    /* Count the error on the bus monitor */
+    Can_BusMonitorError( ControllerConfig->CanReference, ErrorCode );
+    /* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_ENABLE_SECURITY_EVENT_REPORTING == STD_ON
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     CanIf_ErrorNotification( ControllerConfig->ControllerId, AutosarError[ ErrorCode ] );
+#else
+    (void)AutosarError;
+#endif
 #endif
 }
+
+#endif
@@ -54,6 +54,142 @@
 /**
  * @} */
 
+/**
+ * @defgroup NBTP_bits NBTP register bits
+ *
+ * @{ */
+#define NBTP_NTSEG2_BIT                0u  /*!< Nominal Time Segment 2 */
+#define NBTP_NTSEG1_BIT                8u  /*!< Nominal Time Segment 1 */
+#define NBTP_NBRP_BIT                  16u /*!< Nominal Baud Rate Prescaler */
+#define NBTP_NSJW_BIT                  25u /*!< Nominal (Re)Synchronization Jump Width */
+/**
+ * @} */
+
+/**
+ * @defgroup DBTP_bits DBTP register bits
+ *
+ * @{ */
+#define DBTP_DSJW_BIT                  0u  /*!< Data (Re)Synchronization Jump Width */
+#define DBTP_DTSEG1_BIT                8u  /*!< Data Time Segment 1 */
+#define DBTP_DTSEG2_BIT                4u  /*!< Data Time Segment 2 */
+#define DBTP_DBRP_BIT                  16u /*!< Data Baud Rate Prescaler */
+#define DBTP_TDC_BIT                   23u /*!< Transceiver Delay Compensation */
+/**
+ * @} */
+
+/**
+ * @defgroup NBTP_sizes NBTP register bit sizes
+ *
+ * @{ */
+#define NBTP_NTSEG2_SIZE               7u /*!< Nominal Time Segment 2 bitfield size */
+#define NBTP_NTSEG1_SIZE               8u /*!< Nominal Time Segment 1 bitfield size */
+#define NBTP_NBRP_SIZE                 9u /*!< Nominal Baud Rate Prescaler bitfield size */
+/**
+ * @} */
+
+/**
+ * @defgroup DBTP_sizes DBTP register bit sizes
+ *
+ * @{ */
+#define DBTP_DTSEG2_SIZE               4u /*!< Data Time Segment 2 bitfield size */
+#define DBTP_DTSEG1_SIZE               5u /*!< Data Time Segment 1 bitfield size */
+#define DBTP_DBRP_SIZE                 5u /*!< Data Baud Rate Prescaler bitfield size */
+/**
+ * @} */
+
+/**
+ * @defgroup TDCR_bits TDCR register bits
+ *
+ * @{ */
+#define TDCR_TDCF_BIT                  0u /*!< Transmitter Delay Compensation Filter Window Length */
+#define TDCR_TDCO_BIT                  8u /*!< Transmitter Delay Compensation Offset */
+/**
+ * @} */
+
+/**
+ * @brief Compile time check that can be placed in a constant expression, it evaluates to zero
+ * or breaks the build with a negative array size when the condition is false.
+ *
+ * @param   Cond    Condition to check
+ */
+#define CAN_STATIC_ASSERT( Cond )      ( sizeof( char[ ( Cond ) ? 1 : -1 ] ) * 0u )
+
+/**
+ * @defgroup CAN_Bit_Timing CAN bit timing register images
+ *
+ * Build the NBTP, DBTP and TDCR register values at compile time out of the bit timing in time
+ * quanta, values out of range stop the build.
+ *
+ * @{ */
+/**
+ * @param   Seg1        Segment 1 in time quanta, from 2 to 256
+ * @param   Seg2        Segment 2 in time quanta, from 2 to 128
+ * @param   Sjw         Synchronization jump width in time quanta, from 1 to 128 and up to Seg2
+ * @param   Prescaler   Baudrate prescaler, from 1 to 512
+ */
+#define CAN_NBTP_VALUE( Seg1, Seg2, Sjw, Prescaler )                                        \
+    ( (uint32)( CAN_STATIC_ASSERT( ( ( Seg1 ) >= 2u ) && ( ( Seg1 ) <= 256u ) ) +           \
+                CAN_STATIC_ASSERT( ( ( Seg2 ) >= 2u ) && ( ( Seg2 ) <= 128u ) ) +           \
+                CAN_STATIC_ASSERT( ( ( Sjw ) >= 1u ) && ( ( Sjw ) <= ( Seg2 ) ) ) +         \
+                CAN_STATIC_ASSERT( ( ( Prescaler ) >= 1u ) && ( ( Prescaler ) <= 512u ) ) ) | \
+      ( ( (uint32)( Sjw ) - 1u ) << NBTP_NSJW_BIT ) |                                       \
+      ( ( (uint32)( Prescaler ) - 1u ) << NBTP_NBRP_BIT ) |                                 \
+      ( ( (uint32)( Seg1 ) - 1u ) << NBTP_NTSEG1_BIT ) |                                    \
+      ( ( (uint32)( Seg2 ) - 1u ) << NBTP_NTSEG2_BIT ) )
+
+/**
+ * @param   Seg1        Data segment 1 in time quanta, from 1 to 32
+ * @param   Seg2        Data segment 2 in time quanta, from 1 to 16
+ * @param   Sjw         Data synchronization jump width in time quanta, from 1 to 16 and up to Seg2
+ * @param   Prescaler   Data baudrate prescaler, from 1 to 32
+ */
+#define CAN_DBTP_VALUE( Seg1, Seg2, Sjw, Prescaler )                                        \
+    ( (uint32)( CAN_STATIC_ASSERT( ( ( Seg1 ) >= 1u ) && ( ( Seg1 ) <= 32u ) ) +            \
+                CAN_STATIC_ASSERT( ( ( Seg2 ) >= 1u ) && ( ( Seg2 ) <= 16u ) ) +            \
+                CAN_STATIC_ASSERT( ( ( Sjw ) >= 1u ) && ( ( Sjw ) <= ( Seg2 ) ) ) +         \
+                CAN_STATIC_ASSERT( ( ( Prescaler ) >= 1u ) && ( ( Prescaler ) <= 32u ) ) ) |  \
+      ( ( (uint32)( Prescaler ) - 1u ) << DBTP_DBRP_BIT ) |                                 \
+      ( ( (uint32)( Seg1 ) - 1u ) << DBTP_DTSEG1_BIT ) |                                    \
+      ( ( (uint32)( Seg2 ) - 1u ) << DBTP_DTSEG2_BIT ) |                                    \
+      ( ( (uint32)( Sjw ) - 1u ) << DBTP_DSJW_BIT ) )
+
+/**
+ * Same as CAN_DBTP_VALUE plus the transmitter delay compensation enabled, it is needed at data
+ * rates where the transceiver loop delay reaches the sample point. The FDCAN only compensates the
+ * delay with a data prescaler of 1 or 2.
+ *
+ * @param   Seg1        Data segment 1 in time quanta, from 1 to 32
+ * @param   Seg2        Data segment 2 in time quanta, from 1 to 16
+ * @param   Sjw         Data synchronization jump width in time quanta, from 1 to 16 and up to Seg2
+ * @param   Prescaler   Data baudrate prescaler, 1 or 2
+ */
+#define CAN_DBTP_TDC_VALUE( Seg1, Seg2, Sjw, Prescaler )                                    \
+    ( CAN_DBTP_VALUE( Seg1, Seg2, Sjw, Prescaler ) |                                        \
+      (uint32)CAN_STATIC_ASSERT( ( Prescaler ) <= 2u ) | ( (uint32)1u << DBTP_TDC_BIT ) )
+
+/**
+ * Secondary sample point offset placed at the data sample point, the value is given in minimum
+ * time quanta (kernel clock periods after the clock divider) as the TDCR register expects it.
+ *
+ * @param   Seg1        Data segment 1 in time quanta, same as used with CAN_DBTP_TDC_VALUE
+ * @param   Prescaler   Data baudrate prescaler, same as used with CAN_DBTP_TDC_VALUE
+ */
+#define CAN_TDC_OFFSET( Seg1, Prescaler ) ( ( (uint32)( Seg1 ) + 1u ) * (uint32)( Prescaler ) )
+
+/**
+ * @param   Offset      Secondary sample point offset in minimum time quanta, from 0 to 127, usually
+ *                      CAN_TDC_OFFSET
+ * @param   Filter      Filter window length in minimum time quanta, from 0 to 127, edges on the Rx
+ *                      pin placing the secondary sample point before it are ignored, 0 disables it
+ */
+#define CAN_TDCR_VALUE( Offset, Filter )                                                    \
+    ( (uint32)( CAN_STATIC_ASSERT( ( Offset ) <= 127u ) +                                    \
+                CAN_STATIC_ASSERT( ( Filter ) <= 127u ) ) |                                  \
+      ( (uint32)( Offset ) << TDCR_TDCO_BIT ) |                                             \
+      ( (uint32)( Filter ) << TDCR_TDCF_BIT ) )
+/**
+ * @} */
+
 /**
  * @defgroup CAN_frame_format CAN Frame Format
  *
@@ -231,6 +367,15 @@
 /**
  * @} */
 
+/**
+ * @defgroup CAN_Filter_Priority CAN Filter Priority
+ *
+ * @{ */
+#define CAN_FILTER_PRIORITY_NORMAL     0x00u /*!< Matching frames follow the regular Rx FIFO path */
+#define CAN_FILTER_PRIORITY_HIGH       0x01u /*!< Matching frames raise the high priority message interrupt */
+/**
+ * @} */
+
 /**
  * @defgroup CAN_Hardware_Object_Type CAN Hardware Object Type
  *
@@ -252,6 +397,7 @@
 #define CAN_OBJECT_PL_32               0x0Du /*!< 32 bytes payload length */
 #define CAN_OBJECT_PL_48               0x0Eu /*!< 48 bytes payload length */
 #define CAN_OBJECT_PL_64               0x0Fu /*!< 64 bytes payload length */
+#define CAN_MAX_FD_PAYLOAD             64u   /*!< Largest payload of a CAN FD frame in bytes */
 /**
  * @} */
 
@@ -283,6 +429,44 @@
 /**
  * @} */
 
+/**
+ * @defgroup CAN_Rx_Delivery CAN Rx delivery modes
+ *
+ * @{ */
+#define CAN_RX_DELIVERY_IMMEDIATE      0u /*!< Payload points into message RAM, element released once indicated */
+#define CAN_RX_DELIVERY_DEFERRED       1u /*!< Payload points into message RAM until Can_ReleaseRxMessage is called */
+#define CAN_RX_DELIVERY_COPY           2u /*!< Payload copied once into the buffer from RxBufferCallback */
+/**
+ * @} */
+
+/**
+ * @defgroup CAN_Config_Variant CAN configuration variants
+ *
+ * @{ */
+#define CAN_VARIANT_PRE_COMPILE        1u /*!< Single configuration known when the driver is compiled */
+#define CAN_VARIANT_POST_BUILD         2u /*!< Configuration set selected when Can_Init is called */
+/**
+ * @} */
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_CONFIGURATION_VARIANT == CAN_VARIANT_PRE_COMPILE
+/**
+ * @brief Configuration in use, the pre-compile variant ignores the pointer and takes CanConfig
+ *        so the compiler can fold the lookups into its values.
+ *
+ * @param   Config  Configuration pointer given to Can_Init
+ */
+/* cppcheck-suppress misra-c2012-12.3 ; the pointer is only evaluated to keep it as used */
+#define CAN_CONFIG( Config )           ( (void)( Config ), &CanConfig )
+#else
+/**
+ * @brief Configuration in use, the post-build variant takes the set passed to Can_Init.
+ *
+ * @param   Config  Configuration pointer given to Can_Init
+ */
+#define CAN_CONFIG( Config )           ( Config )
+#endif
+
 /**
  * @defgroup CAN_Hohs CAN Hardware Object Handlers
  *
@@ -297,7 +481,7 @@
  * @} */
 
 
-void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Controller );
+Std_ReturnType Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Controller );
 void Can_Arch_DeInit( Can_HwUnit *HwUnit, uint8 Controller );
 Std_ReturnType Can_Arch_SetBaudrate( Can_HwUnit *HwUnit, uint8 Controller, uint16 BaudRateConfigID );
 Std_ReturnType Can_Arch_SetControllerMode( Can_HwUnit *HwUnit, uint8 Controller, Can_ControllerStateType Transition );
@@ -314,5 +498,10 @@ void Can_Arch_EnableEgressTimeStamp( Can_HwUnit *HwUnit, Can_HwHandleType Hth );
 Std_ReturnType Can_Arch_GetEgressTimeStamp( Can_HwUnit *HwUnit, PduIdType TxPduId, Can_HwHandleType Hth, Can_TimeStampType *timeStampPtr );
 Std_ReturnType Can_Arch_GetIngressTimeStamp( Can_HwUnit *HwUnit, Can_HwHandleType Hrh, Can_TimeStampType *timeStampPtr );
 void Can_Arch_IsrMainHandler( Can_HwUnit *HwUnit, uint8 Controller );
+void Can_Arch_IsrLineHandler( Can_HwUnit *HwUnit, uint8 Controller, uint8 Line );
+Std_ReturnType Can_Arch_GetStatistics( Can_HwUnit *HwUnit, uint8 Controller, Can_StatisticsType *StatisticsPtr );
+Std_ReturnType Can_Arch_ReleaseRxMessage( Can_HwUnit *HwUnit, Can_HwHandleType Hrh );
+void Can_Arch_MainFunctionBusMonitor( Can_HwUnit *HwUnit, uint8 Controller );
+Std_ReturnType Can_Arch_GetBusMonitor( Can_HwUnit *HwUnit, uint8 Controller, Can_BusMonitorType *MonitorPtr );
 
 #endif /* CAN_ARCH_H__ */
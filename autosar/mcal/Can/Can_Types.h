@@ -51,6 +51,9 @@
 #define CAN_ID_ENABLE_EGRESS_TS    0x33u /*!< Can_EnableEgressTimeStamp() api service id */
 #define CAN_ID_GET_EGRESS_TS       0x34u /*!< Can_GetEgressTimeStamp() api service id */
 #define CAN_ID_GET_INGRESS_TS      0x35u /*!< Can_GetIngressTimeStamp() api service id */
+#define CAN_ID_GET_STATISTICS      0x36u /*!< Can_GetStatistics() api service id */
+#define CAN_ID_RELEASE_RX_MESSAGE  0x37u /*!< Can_ReleaseRxMessage() api service id */
+#define CAN_ID_GET_BUS_MONITOR     0x38u /*!< Can_GetBusMonitor() api service id */
 #define CAN_ID_ISR_TRANSMITION     0x02u /*!< Can_IsrTransmition() api service id */
 #define CAN_ID_ISR_RECEPTION       0x0du /*!< Can_IsrReception() api service id */
 /**
@@ -74,6 +77,23 @@
  * @} */
 
 
+/**
+ * @brief **High priority reception callback**
+ *
+ * Function called straight from the high priority message interrupt with the frame stored by a
+ * filter flagged as high priority, it shares the signature of CanIf_RxIndication.
+ */
+typedef void ( *Can_HighPriorityRxCallbackType )( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr );
+
+/**
+ * @brief **Reception buffer callback**
+ *
+ * Function called by the copy once reception mode before a frame is indicated, it returns the
+ * upper layer buffer with room for Length bytes where the payload is copied from message RAM, or
+ * NULL_PTR to have the frame indicated straight from message RAM.
+ */
+typedef uint8 *( *Can_RxBufferCallbackType )( const Can_HwType *Mailbox, PduLengthType Length );
+
 /**
  * @brief **CAN Controller Baudrate Configuration**
  *
@@ -84,35 +104,18 @@
  */
 typedef struct _Can_ControllerBaudrateConfig
 {
-    uint8 BaudRateConfigID; /*!< Unique identifier for a baudrate configuration
-                                This parameter value is defined in Can_Cfg.h */
-
-    uint32 Seg1; /*!< Segment 1 in time quanta
-                     This parameter must be a number between 2 and 256 */
+    uint32 Nbtp; /*!< Nominal bit timing register image, shall be built with CAN_NBTP_VALUE
+                     out of segment 1, segment 2, jump width and prescaler */
 
-    uint32 Seg2; /*!< Segment 2 in time quanta
-                     This parameter must be a number between 2 and 128 */
+    uint32 Dbtp; /*!< Data bit timing register image for the data payload, shall be built with
+                     CAN_DBTP_VALUE or CAN_DBTP_TDC_VALUE, only used when FdTxBitRateSwitch is
+                     STD_ON */
 
-    uint32 SyncJumpWidth; /*!< Synchronization jump width in time quanta
-                              This parameter must be a number between 1 and 128 */
+    uint32 Tdcr; /*!< Transmitter delay compensation register image, shall be built with
+                     CAN_TDCR_VALUE, only used when Dbtp enables the compensation */
 
-    uint32 Prescaler; /*!< Baudrate prescaler
-                          This parameter must be a number between 1 and 512 */
-
-    uint32 FdSeg1; /*!< Segment 1 in time quanta for data payload
-                     this parameter must be a number between 1 and 32 */
-
-    uint32 FdSeg2; /*!< Segment 2 in time quanta for data payload
-                     this parameter must be a number between 1 and 16 */
-
-    uint32 FdPrescaler; /*!< Baudrate prescaler
-                          this parameter must be a number between 1 and 32 */
-
-    uint32 FdSspOffset; /*!< Sample point offset in time quanta
-                          Field not in use for stm32g0 Mcu */
-
-    uint32 FdSyncJumpWidth; /*!< Synchronization jump width in time quanta
-                              this parameter must be a number between 1 and 16 */
+    uint8 BaudRateConfigID; /*!< Unique identifier for a baudrate configuration
+                                This parameter value is defined in Can_Cfg.h */
 
     uint8 FdTxBitRateSwitch; /*!< Bit rate switching for transmission
                                this paramter can be STD_OFF or STD_ON */
@@ -127,46 +130,70 @@ typedef struct _Can_ControllerBaudrateConfig
  * @note the element ID defined by autosar is suppressed due to the fact that the index array it
  *       is used as an ID. the default baud rate element is not a pointer but rather an index to the
  *      baud rate array
+ * @note the fields read by Can_Write and the interrupts come first and the flags share a single
+ *       word, the layout is checked at Can_Arch.c
  */
 typedef struct _Can_Controller
 {
+    uint8 CanReference; /*!< Base address of the Mcu CAN controller
+                                  this paramter must be CAN_FDCAN1 or CAN_FDCAN2 */
+
     uint8 ControllerId; /*!< Specifies the ID of a CAN controller.
                             This parameter value is defined in Can_Cfg.h */
 
-    uint32 Mode; /*!< Specifies the CAN peripheral operation mode.
-                     This parameter can be a value of @ref CAN_mode   */
+    uint8 BaudrateConfigsCount; /*!< Number of baudrate configurations for the controller */
 
-    uint32 ClockDivider; /*!< Specifies the clock divider for the CAN controller
-                           This parameter can be a value of @ref CAN_clock_divider */
+    uint32 FrameFormat : 1; /*!< Specifies the CAN frame format FD or Classic.
+                                 This parameter can be a value of @ref CAN_frame_format     */
 
-    uint8 FrameFormat; /*!< Specifies the CAN frame format FD or Classic.
-                            This parameter can be a value of @ref CAN_frame_format     */
+    uint32 RxDelivery : 2; /*!< Specifies how the received payloads are handed to the upper layer and when
+                                the Rx FIFO elements are released.
+                                This parameter can be a value of @ref CAN_Rx_Delivery */
 
-    uint8 TransmitPause; /*!< Enable or disable the Transmit Pause feature.
-                              This parameter can be set to STD_ON or STD_OFF  */
+    uint32 HardwareCancellation : 1; /*!< Cancel the lowest priority pending frame when Can_Write finds the Tx
+                                          queue full and the new PDU has a higher priority, only works with
+                                          CAN_TX_QUEUE_OPERATION and CAN_IT_TX_ABORT_COMPLETE active.
+                                          This parameter can be set to STD_ON or STD_OFF  */
 
-    uint8 ProtocolException; /*!< Enable or disable the Protocol Exception Handling.
-                                  This parameter can be set to STD_ON or STD_OFF  */
+    uint32 TxFifoQueueMode : 1; /*!< Tx FIFO/Queue Mode selection. Queue mode is basically multiplexed tx
+                                     This parameter can be a value of @ref CAN_txFifoQueue_Mode */
 
-    uint8 AutoRetransmission; /*!< Enable or disable the automatic retransmission mode.
+    uint32 TransmitPause : 1; /*!< Enable or disable the Transmit Pause feature.
                                    This parameter can be set to STD_ON or STD_OFF  */
 
-    uint8 TxFifoQueueMode; /*!< Tx FIFO/Queue Mode selection. Queue mode is basically multiplexed tx
-                                This parameter can be a value of @ref CAN_txFifoQueue_Mode */
+    uint32 ProtocolException : 1; /*!< Enable or disable the Protocol Exception Handling.
+                                       This parameter can be set to STD_ON or STD_OFF  */
+
+    uint32 AutoRetransmission : 1; /*!< Enable or disable the automatic retransmission mode.
+                                        This parameter can be set to STD_ON or STD_OFF  */
+
+    uint32 Mode : 3; /*!< Specifies the CAN peripheral operation mode.
+                          This parameter can be a value of @ref CAN_mode   */
 
-    uint32 ActiveITs; /*!< Specifies the interrupts to be enabled on Line0.
+    uint32 ClockDivider : 4; /*!< Specifies the clock divider for the CAN controller
+                                  This parameter can be a value of @ref CAN_clock_divider */
+
+    uint32 ActiveITs; /*!< Specifies the interrupts to be enabled.
                                This parameter can be a value of CAN_IT_<interrupt> */
 
-    uint8 CanReference; /*!< Base address of the Mcu CAN controller
-                                  this paramter must be CAN_FDCAN1 or CAN_FDCAN2 */
+    uint32 Line1ITs; /*!< Specifies the interrupts to be served by interrupt line 1, the rest are
+                          served by line 0. The line is selected per group of interrupts, then
+                          the whole group the interrupt belongs to is moved to line 1. With
+                          CAN_IT_RX_HIGH_PRIORITY_MSG active the Rx FIFO 0, Rx FIFO 1 and status
+                          message groups always share a line, moving one of them moves all three.
+                          This parameter can be a value of CAN_IT_<interrupt> */
+
+    Can_HighPriorityRxCallbackType HighPriorityRxCallback; /*!< Function to deliver frames accepted by high
+                                                           priority filters, NULL_PTR to use CanIf_RxIndication */
+
+    Can_RxBufferCallbackType RxBufferCallback; /*!< Function returning the upper layer buffer to copy the
+                                               payloads into, only used with CAN_RX_DELIVERY_COPY */
 
     const Can_ControllerBaudrateConfig *DefaultBaudrate; /*!< Reference to baudrate configuration container configured for the
                                                         Can Controller*/
 
     const Can_ControllerBaudrateConfig *BaudrateConfigs; /*!< This container contains bit timing related configuration
                                                          parameters */
-
-    uint8 BaudrateConfigsCount; /*!< Number of baudrate configurations for the controller */
 } Can_Controller;
 
 /**
@@ -181,11 +208,14 @@ typedef struct _Can_HwFilter
 
     uint32 HwFilterMask; /*!< Describes a mask for hardware-based filtering of CAN identifiers */
 
-    uint32 HwFilterType; /*!< Specifies the type of the hardware filter.
-                             This parameter can be a value of @ref CAN_Id_Type */
+    uint8 HwFilterType; /*!< Specifies the type of the hardware filter.
+                            This parameter can be a value of @ref CAN_Id_Type */
+
+    uint8 HwFilterIdType; /*!< Specifies whether the HOH handles standard identifiers or
+                              extended, @ref CAN_Id_Type */
 
-    Can_IdType HwFilterIdType; /*!< Specifies whether the HOH handles standard identifiers or
-                                extended, @ref CAN_Id_Type */
+    uint8 HwFilterPriority; /*!< Flag the matching frames as high priority messages.
+                                This parameter can be a value of @ref CAN_Filter_Priority */
 } Can_HwFilter;
 
 /**
@@ -195,33 +225,33 @@ typedef struct _Can_HwFilter
  */
 typedef struct _Can_HardwareObject
 {
-    uint8 CanObjectId; /*!< Specifies the ID of a hardware object.
-                           This paramter can be a set of @ref CAN_Hohs */
-
-    uint8 HandleType; /*!< Specifies the type (Full-CAN or Basic-CAN) of a hardware object.
-                          This paramter can be a set of @ref CAN_Hardware_Handler_Type */
-
-    Can_IdType IdType; /*!< Specifies whether the HOH handles standard identifiers, extended
-                           or mixed, @ref CAN_Id_Type */
-
-    uint8 ObjectPayloadLength; /*!< Specifies the maximum L-PDU payload length in bytes the hardware object can
-                                   store. 8 byes for classic or 64 for extended */
+    const Can_Controller *ControllerRef; /*!< Reference to CAN Controller to which the HOH is associated to
+                                         this paramter must be a address of a valid controller structure  */
 
     uint8 ObjectType; /*!< Select the type of HOH object, for Tx or Rx
                           This paramter can be a set of  @ref CAN_Hardware_Object_Type */
 
+    uint8 RxFifo; /*!< Specifies the receive FIFO number for the hardware object.
+                      This paramter can be a set of @ref CAN_RxFifo */
+
     uint8 FdPaddingValue; /*!< Specifies the value which is used to pad unspecified data in CAN FD frames > 8
                               bytes for transmission. Any number form 0x00 to 0xff. */
 
-    uint8 RxFifo; /*!< Specifies the receive FIFO number for the hardware object.
-                      This paramter can be a set of @ref CAN_RxFifo */
+    uint8 ObjectPayloadLength; /*!< Specifies the maximum L-PDU payload length in bytes the hardware object can
+                                   store. 8 byes for classic or 64 for extended */
 
-    const Can_HwFilter *HwFilter; /*!< Reference to array of hardware filters structures*/
+    uint8 CanObjectId; /*!< Specifies the ID of a hardware object.
+                           This paramter can be a set of @ref CAN_Hohs */
+
+    uint8 HandleType; /*!< Specifies the type (Full-CAN or Basic-CAN) of a hardware object.
+                          This paramter can be a set of @ref CAN_Hardware_Handler_Type */
+
+    uint8 IdType; /*!< Specifies whether the HOH handles standard identifiers, extended
+                      or mixed, @ref CAN_Id_Type */
 
     uint8 HwFilterCount; /*!< Number of hardware filters used to implement */
 
-    const Can_Controller *ControllerRef; /*!< Reference to CAN Controller to which the HOH is associated to
-                                         this paramter must be a address of a valid controller structure  */
+    const Can_HwFilter *HwFilter; /*!< Reference to array of hardware filters structures*/
 } Can_HardwareObject;
 
 
@@ -236,8 +266,8 @@ typedef struct _Can_HardwareObject
 typedef struct _Can_ConfigType
 {
     const Can_Controller *Controllers; /*!< Pointer to the controller structure */
-    uint8 ControllersCount;            /*!< Number of controllers */
     const Can_HardwareObject *Hohs;    /*!< Pointer to the hardware object structure */
+    uint8 ControllersCount;            /*!< Number of controllers */
     uint8 HohsCount;                   /*!< Number of hardware objects */
 } Can_ConfigType;
 
@@ -255,4 +285,74 @@ typedef struct _Can_HwUnit
     uint8 DisableIntsLvl[ 2u ];               /*!< Disable interrupts counter */
 } Can_HwUnit;
 
+/**
+ * @brief **Execution time measurement**
+ *
+ * Min, max and average duration of a driver routine measured in ticks of the counter configured
+ * with CAN_STATISTICS_CYCLE_COUNTER
+ */
+typedef struct _Can_DurationType
+{
+    uint32 Min;     /*!< Shortest duration measured */
+    uint32 Max;     /*!< Longest duration measured */
+    uint32 Avg;     /*!< Average duration, only calculated when the statistics are read */
+    uint64 Total;   /*!< Accumulated duration of all the samples */
+    uint32 Samples; /*!< Number of measurements taken */
+} Can_DurationType;
+
+/**
+ * @brief **Controller runtime statistics**
+ *
+ * Counters and execution times collected per controller when CAN_STATISTICS_API is enabled, the
+ * values are cleared every time the controller is initialized
+ */
+typedef struct _Can_StatisticsType
+{
+    uint32 RxFrames;                /*!< Frames passed to the upper layer */
+    uint32 TxFrames;                /*!< Transmissions confirmed to the upper layer */
+    uint32 TxBusy;                  /*!< Can_Write calls rejected with CAN_BUSY */
+    uint32 TxCancelled;             /*!< Frames cancelled in favour of a higher priority PDU */
+    uint32 RxFifoFull;              /*!< Rx FIFO full events */
+    uint32 RxFifoLost;              /*!< Rx FIFO message lost events */
+    uint32 BusOff;                  /*!< Bus-off events */
+    uint32 IsrCalls;                /*!< Interrupt handler invocations */
+    Can_DurationType IsrDuration;   /*!< Interrupt handler execution time */
+    Can_DurationType WriteDuration; /*!< Can_Write execution time */
+} Can_StatisticsType;
+
+/**
+ * @defgroup CAN_Bus_Errors Protocol error types counted by the bus monitor, same order as the
+ * last error code of the PSR register minus one
+ *
+ * @{ */
+#define CAN_BUS_ERROR_STUFF        0u /*!< Stuff error */
+#define CAN_BUS_ERROR_FORM         1u /*!< Form error */
+#define CAN_BUS_ERROR_ACK          2u /*!< Acknowledge error */
+#define CAN_BUS_ERROR_BIT1         3u /*!< Recessive bit sent and dominant bit monitored */
+#define CAN_BUS_ERROR_BIT0         4u /*!< Dominant bit sent and recessive bit monitored */
+#define CAN_BUS_ERROR_CRC          5u /*!< CRC error */
+#define CAN_BUS_ERRORS             6u /*!< Number of protocol error types */
+/**
+ * @} */
+
+/**
+ * @brief **Controller bus monitor**
+ *
+ * Bus load and error rates of the last window closed by Can_MainFunction_BusMonitor, the window
+ * spans CAN_BUS_MONITOR_WINDOW cycles. Loads and ratios are given in hundredths of percent, 10000
+ * is a bus busy all the window long.
+ */
+typedef struct _Can_BusMonitorType
+{
+    uint16 BusLoad;                   /*!< Bus load of the last window */
+    uint16 BusLoadAvg;                /*!< Bus load smoothed over the windows with CAN_BUS_MONITOR_SMOOTHING */
+    uint16 BusLoadMax;                /*!< Highest window bus load since the controller was initialized */
+    uint16 ErrorRatio;                /*!< Protocol errors over the frames plus errors of the last window */
+    uint32 RxFrames;                  /*!< Frames received on the last window */
+    uint32 TxFrames;                  /*!< Frames transmitted on the last window */
+    uint32 BusTime;                   /*!< Nominal bit times elapsed on the last window */
+    uint32 Errors[ CAN_BUS_ERRORS ];  /*!< Protocol errors of the last window, indexed by @ref CAN_Bus_Errors */
+    uint32 Windows;                   /*!< Windows closed since the controller was initialized */
+} Can_BusMonitorType;
+
 #endif /* CAN_TYPES_H__ */
@@ -0,0 +1,85 @@
+/**
+ * @file    Bench.c
+ * @brief   **Benchmark helpers**
+ * @author  Diego Perez
+ *
+ * Routines to reduce the samples taken by the benchmarks into the figures they report, they only
+ * depend on the standard types so the same file builds for the host and for the target.
+ */
+#include "Std_Types.h"
+#include "Bench.h"
+
+/**
+ * @brief    **Summarize samples**
+ *
+ * Sort the samples in place and get the minimum, median, 99th percentile and maximum. Insertion
+ * sort is used, it does not need extra memory and it is fast enough for the few thousand samples a
+ * target benchmark can keep in RAM.
+ *
+ * @param    Samples Samples to summarize, they are sorted on return
+ * @param    Count Number of samples
+ * @param    Summary Pointer to store the distribution
+ */
+void Bench_Summarize( uint32 *Samples, uint32 Count, Bench_Summary *Summary )
+{
+    for( uint32 i = 1u; i < Count; i++ )
+    {
+        uint32 Sample = Samples[ i ];
+        uint32 j      = i;
+
+        while( ( j > 0u ) && ( Samples[ j - 1u ] > Sample ) )
+        {
+            Samples[ j ] = Samples[ j - 1u ];
+            j--;
+        }
+
+        Samples[ j ] = Sample;
+    }
+
+    Summary->Count = Count;
+    Summary->Min   = ( Count > 0u ) ? Samples[ 0u ] : 0u;
+    Summary->P50   = Bench_Percentile( Samples, Count, 50u );
+    Summary->P99   = Bench_Percentile( Samples, Count, 99u );
+    Summary->Max   = ( Count > 0u ) ? Samples[ Count - 1u ] : 0u;
+}
+
+/**
+ * @brief    **Percentile**
+ *
+ * Nearest rank percentile, the smallest sample with at least the requested percent of the samples
+ * equal or below it.
+ *
+ * @param    Sorted Samples sorted in ascending order
+ * @param    Count Number of samples
+ * @param    Percent Percentile from 1 to 100
+ *
+ * @retval  Sample at the requested percentile, zero with no samples
+ */
+uint32 Bench_Percentile( const uint32 *Sorted, uint32 Count, uint8 Percent )
+{
+    uint32 Value = 0u;
+
+    if( Count > 0u )
+    {
+        /* Rank rounded up, ranks start at one */
+        uint32 Rank = (uint32)( ( ( (uint64)Count * Percent ) + 99u ) / 100u );
+
+        Value = Sorted[ ( Rank > 0u ) ? ( Rank - 1u ) : 0u ];
+    }
+
+    return Value;
+}
+
+/**
+ * @brief    **Event rate**
+ *
+ * @param    Events Events counted
+ * @param    Elapsed Time the events took, in ticks
+ * @param    Frequency Ticks per second
+ *
+ * @retval  Events per second, zero if no time elapsed
+ */
+uint32 Bench_Rate( uint32 Events, uint64 Elapsed, uint32 Frequency )
+{
+    return ( Elapsed > 0u ) ? (uint32)( ( (uint64)Events * Frequency ) / Elapsed ) : 0u;
+}
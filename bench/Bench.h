@@ -0,0 +1,31 @@
+/**
+ * @file    Bench.h
+ * @brief   **Benchmark helpers**
+ * @author  Diego Perez
+ *
+ * Small set of routines shared by the host benchmarks running over the FDCAN model and the target
+ * benchmark images, both sides reduce their samples the same way so the numbers can be compared
+ * from one driver change to the next.
+ */
+#ifndef BENCH_H__
+#define BENCH_H__
+
+#include "Std_Types.h"
+
+/**
+ * @brief   Distribution of a set of samples
+ */
+typedef struct _Bench_Summary
+{
+    uint32 Count; /*!< Number of samples */
+    uint32 Min;   /*!< Smallest sample */
+    uint32 P50;   /*!< Median, half of the samples are equal or below */
+    uint32 P99;   /*!< 99th percentile, 99% of the samples are equal or below */
+    uint32 Max;   /*!< Largest sample */
+} Bench_Summary;
+
+void Bench_Summarize( uint32 *Samples, uint32 Count, Bench_Summary *Summary );
+uint32 Bench_Percentile( const uint32 *Sorted, uint32 Count, uint8 Percent );
+uint32 Bench_Rate( uint32 Events, uint64 Elapsed, uint32 Frequency );
+
+#endif
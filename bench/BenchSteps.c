@@ -0,0 +1,56 @@
+/**
+ * @file    BenchSteps.c
+ * @brief   **Host instruction counter**
+ * @author  Diego Perez
+ *
+ * The image is run again as a child traced with ptrace and single stepped until it exits, every
+ * step is one user space instruction. Only built for the host benchmarks, it needs a Linux host.
+ */
+#include "Std_Types.h"
+#include "BenchSteps.h"
+#include <stdio.h> /* cppcheck-suppress misra-c2012-21.6 ; Necessary for the argument strings */
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * @brief    **Count the instructions of a scenario**
+ *
+ * The image is started with the scenario name and the number of calls as arguments, it shall run
+ * the scenario that many times and exit. The steps taken with zero calls are the cost of the start
+ * up and the initialization, subtracting them from a run with calls leaves the cost of the calls.
+ *
+ * @param    Image Path of the benchmark image
+ * @param    Scenario Name of the scenario passed as first argument
+ * @param    Calls Calls to run, passed as second argument
+ *
+ * @retval  Instructions executed by the child, zero if it could not be traced
+ */
+uint64 Bench_CountSteps( const char *Image, const char *Scenario, uint32 Calls )
+{
+    uint64 Steps = 0u;
+    char Count[ 12u ];
+    int Status;
+    pid_t Child;
+
+    (void)snprintf( Count, sizeof( Count ), "%lu", (unsigned long)Calls );
+    Child = fork( );
+
+    if( Child == 0 )
+    {
+        (void)ptrace( PTRACE_TRACEME, 0, NULL, NULL );
+        (void)execl( Image, Image, Scenario, Count, (char *)NULL );
+        _exit( 1 );
+    }
+
+    if( ( Child > 0 ) && ( waitpid( Child, &Status, 0 ) == Child ) && ( WIFSTOPPED( Status ) != 0 ) )
+    {
+        while( ( ptrace( PTRACE_SINGLESTEP, Child, NULL, NULL ) == 0 ) && ( waitpid( Child, &Status, 0 ) == Child ) &&
+               ( WIFSTOPPED( Status ) != 0 ) )
+        {
+            Steps++;
+        }
+    }
+
+    return Steps;
+}
@@ -0,0 +1,16 @@
+/**
+ * @file    BenchSteps.h
+ * @brief   **Host instruction counter**
+ * @author  Diego Perez
+ *
+ * Counts the instructions a host benchmark image executes by single stepping a copy of itself,
+ * the figure does not depend on the host load the way the elapsed time does.
+ */
+#ifndef BENCH_STEPS_H__
+#define BENCH_STEPS_H__
+
+#include "Std_Types.h"
+
+uint64 Bench_CountSteps( const char *Image, const char *Scenario, uint32 Calls );
+
+#endif
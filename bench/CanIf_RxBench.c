@@ -0,0 +1,255 @@
+/**
+ * @file    CanIf_RxBench.c
+ * @brief   **CanIf receive lookup benchmark, host image**
+ * @author  Diego Perez
+ *
+ * Application built on the host by make bench-host out of the CanIf sources with the configuration
+ * in bench/cfg and optimizations on. The receive PDUs are built at runtime, all of them on the same
+ * HRH with standard ids, which is the worst case for the lookup. The image reports the host time
+ * per call of CanIf_RxIndication for frames that match a PDU and for frames that do not, with a
+ * growing number of configured receive PDUs, and for the smallest set once more with every frame
+ * captured by the bus mirroring.
+ */
+#include "Std_Types.h"
+#include "Can.h"
+#include "CanIf.h"
+#include "CanIf_Can.h"
+#include "Det.h"
+#include "Bench.h"
+#include <stdio.h> /* cppcheck-suppress misra-c2012-21.6 ; Necessary for printing the results */
+#include <time.h>
+
+/**
+ * @defgroup rx_bench_defines benchmark parameters
+ *
+ * @{ */
+#define RX_BENCH_SAMPLES 201u   /*!< Samples taken per scenario */
+#define RX_BENCH_BATCH   1000u  /*!< Calls timed on each sample */
+#define RX_BENCH_ID_BASE 0x100u /*!< First configured CAN id */
+#define RX_BENCH_ID_STEP 2u     /*!< Distance between configured ids, odd ids never match */
+#define RX_BENCH_SIZES   4u     /*!< Number of configuration sizes measured */
+/**
+ * @} */
+
+/**
+ * @brief   Host time per call of each sample, in picoseconds
+ */
+static uint32 Samples[ RX_BENCH_SAMPLES ];
+
+/**
+ * @brief   Receive PDUs of the configuration under test
+ */
+static CanIf_RxPduCfgType RxPdus[ CANIF_NUMBER_OF_RX_PDUS ];
+
+/**
+ * @brief   Frames indicated to the upper layer
+ */
+static volatile uint32 RxIndications;
+
+/**
+ * @brief   Timestamp of the frames captured by the bus mirroring, a volatile read as the timer
+ *          register of the target
+ */
+volatile uint32 CanIf_Bench_TimeStamp;
+
+static uint64 RxBench_HostTime( void );
+static void RxBench_Configure( CanIf_ConfigType *Config, uint8 Pdus );
+static void RxBench_Lookup( uint8 Pdus, uint32 Miss, Bench_Summary *Summary );
+static void RxBench_Indication( PduIdType RxPduId, const PduInfoType *PduInfoPtr );
+
+/**
+ * @brief    **Benchmark entry point**
+ *
+ * For each configuration size the CanIf is initialized and the hit and miss scenarios measured,
+ * two PDUs are compared one by one while the larger sets are binary searched.
+ */
+int main( void )
+{
+    static const uint8 Sizes[ RX_BENCH_SIZES ] = { 2u, 10u, 100u, 250u };
+    CanIf_ConfigType Config;
+    Bench_Summary Hit;
+    Bench_Summary Miss;
+    uint32 Expected = 0u;
+
+    (void)printf( "canif rx lookup, host time per call, min/p50/p99\n" );
+
+    for( uint8 Size = 0u; Size < RX_BENCH_SIZES; Size++ )
+    {
+        RxBench_Configure( &Config, Sizes[ Size ] );
+        CanIf_Init( &Config );
+        CanIf_ControllerModeIndication( 0u, CAN_CS_STARTED );
+        (void)CanIf_SetPduMode( 0u, CANIF_ONLINE );
+
+        RxBench_Lookup( Sizes[ Size ], 0u, &Hit );
+        RxBench_Lookup( Sizes[ Size ], 1u, &Miss );
+        Expected += RX_BENCH_SAMPLES * RX_BENCH_BATCH;
+
+        (void)printf( "%3u pdus hit: %lu/%lu/%lu ps miss: %lu/%lu/%lu ps\n", Sizes[ Size ], (unsigned long)Hit.Min,
+                      (unsigned long)Hit.P50, (unsigned long)Hit.P99, (unsigned long)Miss.Min,
+                      (unsigned long)Miss.P50, (unsigned long)Miss.P99 );
+    }
+
+    /* same lookup as the first size with each frame also captured into the mirroring ring */
+    RxBench_Configure( &Config, Sizes[ 0 ] );
+    CanIf_Init( &Config );
+    CanIf_ControllerModeIndication( 0u, CAN_CS_STARTED );
+    (void)CanIf_SetPduMode( 0u, CANIF_ONLINE );
+    (void)CanIf_EnableBusMirroring( 0u, TRUE );
+
+    RxBench_Lookup( Sizes[ 0 ], 0u, &Hit );
+    Expected += RX_BENCH_SAMPLES * RX_BENCH_BATCH;
+
+    (void)printf( "%3u pdus mirrored hit: %lu/%lu/%lu ps\n", Sizes[ 0 ], (unsigned long)Hit.Min, (unsigned long)Hit.P50,
+                  (unsigned long)Hit.P99 );
+
+    return ( RxIndications == Expected ) ? 0 : 1;
+}
+
+/**
+ * @brief    **Host monotonic time**
+ *
+ * @retval  Nanoseconds elapsed since an arbitrary point
+ */
+static uint64 RxBench_HostTime( void )
+{
+    struct timespec Now;
+
+    (void)clock_gettime( CLOCK_MONOTONIC, &Now );
+
+    return ( (uint64)Now.tv_sec * 1000000000u ) + (uint64)Now.tv_nsec;
+}
+
+/**
+ * @brief    **Build a configuration**
+ *
+ * The ids are configured in descending order so the lookup setup has to sort all of them.
+ *
+ * @param    Config Configuration to fill
+ * @param    Pdus Number of receive PDUs
+ */
+static void RxBench_Configure( CanIf_ConfigType *Config, uint8 Pdus )
+{
+    for( PduIdType RxPduId = 0u; RxPduId < Pdus; RxPduId++ )
+    {
+        RxPdus[ RxPduId ].CanId        = RX_BENCH_ID_BASE + ( ( Pdus - 1u - RxPduId ) * RX_BENCH_ID_STEP );
+        RxPdus[ RxPduId ].CanIdUpper   = RxPdus[ RxPduId ].CanId;
+        RxPdus[ RxPduId ].Hrh          = CAN_HRH_0_CTRL_0;
+        RxPdus[ RxPduId ].CanIdType    = CANIF_CANID_STANDARD;
+        RxPdus[ RxPduId ].CanIdRange   = FALSE;
+        RxPdus[ RxPduId ].ReadData     = FALSE;
+        RxPdus[ RxPduId ].DataLength   = 0u;
+        RxPdus[ RxPduId ].RxIndication = RxBench_Indication;
+    }
+
+    Config->CtrlCfgs               = NULL_PTR;
+    Config->TxPduCfgs              = NULL_PTR;
+    Config->RxPduCfgs              = RxPdus;
+    Config->BufferCfgs             = NULL_PTR;
+    Config->NumberOfCanControllers = 1u;
+    Config->MaxRxPduCfg            = Pdus;
+    Config->MaxTxPduCfg            = 0u;
+    Config->NumberOfBuffers        = 0u;
+}
+
+/**
+ * @brief    **Time CanIf_RxIndication**
+ *
+ * Every call takes the next configured id, so the searches spread over the whole set.
+ *
+ * @param    Pdus Number of configured receive PDUs
+ * @param    Miss 1 to offset the ids so no PDU matches, 0 to hit a PDU on every call
+ * @param    Summary Host time per call distribution in picoseconds
+ */
+static void RxBench_Lookup( uint8 Pdus, uint32 Miss, Bench_Summary *Summary )
+{
+    uint8 Payload[ 8u ]       = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    const PduInfoType PduInfo = { .SduDataPtr = Payload, .SduLength = 8u, .MetaDataPtr = NULL_PTR };
+    Can_HwType Mailbox        = { .CanId = 0u, .Hoh = CAN_HRH_0_CTRL_0, .ControllerId = 0u };
+    uint32 Next               = 0u;
+
+    for( uint32 Sample = 0u; Sample < RX_BENCH_SAMPLES; Sample++ )
+    {
+        uint64 Start = RxBench_HostTime( );
+
+        for( uint32 Call = 0u; Call < RX_BENCH_BATCH; Call++ )
+        {
+            Mailbox.CanId = RX_BENCH_ID_BASE + ( Next * RX_BENCH_ID_STEP ) + Miss;
+            CanIf_RxIndication( &Mailbox, &PduInfo );
+            Next = ( ( Next + 1u ) < Pdus ) ? ( Next + 1u ) : 0u;
+        }
+
+        Samples[ Sample ] = (uint32)( ( ( RxBench_HostTime( ) - Start ) * 1000u ) / RX_BENCH_BATCH );
+    }
+
+    Bench_Summarize( Samples, RX_BENCH_SAMPLES, Summary );
+}
+
+/**
+ * @brief   Upper layer reception indication
+ */
+static void RxBench_Indication( PduIdType RxPduId, const PduInfoType *PduInfoPtr )
+{
+    (void)RxPduId;
+    (void)PduInfoPtr;
+    RxIndications++;
+}
+
+/**
+ * @brief   Det development error, the benchmark keeps the parameters right
+ */
+Std_ReturnType Det_ReportError( uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId )
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    (void)ApiId;
+    (void)ErrorId;
+    return E_OK;
+}
+
+/**
+ * @brief   Det runtime error
+ */
+Std_ReturnType Det_ReportRuntimeError( uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId )
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    (void)ApiId;
+    (void)ErrorId;
+    return E_OK;
+}
+
+/**
+ * @brief   Can driver write, no frame is sent by the benchmark
+ */
+Std_ReturnType Can_Write( Can_HwHandleType Hth, const Can_PduType *PduInfo )
+{
+    (void)Hth;
+    (void)PduInfo;
+    return E_OK;
+}
+
+/**
+ * @brief   Can driver mode change, the benchmark only receives
+ */
+Std_ReturnType Can_SetControllerMode( uint8 Controller, Can_ControllerStateType Transition )
+{
+    (void)Controller;
+    (void)Transition;
+    return E_OK;
+}
+
+/**
+ * @brief   Can driver interrupts lock, the benchmark has no interrupts
+ */
+void Can_DisableControllerInterrupts( uint8 Controller )
+{
+    (void)Controller;
+}
+
+/**
+ * @brief   Can driver interrupts unlock, the benchmark has no interrupts
+ */
+void Can_EnableControllerInterrupts( uint8 Controller )
+{
+    (void)Controller;
+}
@@ -0,0 +1,417 @@
+/**
+ * @file    Can_LoopbackBench.c
+ * @brief   **Can loopback latency benchmark, target image**
+ * @author  Diego Perez
+ *
+ * Application replacing main.c and the CanIf into the image built with make bench. FDCAN1 runs in
+ * internal loopback at 500k, frames are sent through Can_Write and received back into
+ * CanIf_RxIndication, TIM6 running at the core clock timestamps each round trip. The image prints
+ * over semihosting the same figures test/test_Can_Loopback.c reports over the FDCAN model: the
+ * round trip latency distribution, the time the driver takes per round trip and the sustained
+ * frames per second.
+ */
+#include "Std_Types.h"
+#include "Registers.h"
+#include "Can.h"
+#include "Can_Arch.h"
+#include "CanIf_Can.h"
+#include "Nvic.h"
+#include "Det.h"
+#include "Bench.h"
+#include <stdio.h> /* cppcheck-suppress misra-c2012-21.6 ; Necessary for using semihosting  */
+
+/**
+ * @defgroup    bench_defines benchmark parameters
+ *
+ * @{ */
+#define BENCH_SAMPLES       1000u     /*!< Round trips measured */
+#define BENCH_FRAMES        2000u     /*!< Frames counted by the sustained scenario */
+#define BENCH_TIMER_HZ      16000000u /*!< TIM6 frequency, core clock out of reset (HSI16) */
+#define BENCH_TIMER_MASK    0xFFFFu   /*!< TIM6 is a 16 bits counter */
+#define BENCH_TIMEOUT       0x8000u   /*!< Ticks to give up waiting for a frame, about 2ms */
+#define BENCH_HTH           0u        /*!< Transmit object of the loopback controller */
+#define BENCH_HRH           1u        /*!< Receive object of the loopback controller */
+#define BENCH_ID            0x123u    /*!< CAN id used by the benchmark */
+#define BENCH_RCC_TIM6EN    4u        /*!< TIM6 clock enable bit into RCC_APBENR1 */
+#define BENCH_RCC_FDCANEN   12u       /*!< FDCAN clock enable bit into RCC_APBENR1 */
+/**
+ * @} */
+
+/**
+ * @brief   Tick counts to nanoseconds
+ */
+#define BENCH_TICKS_TO_NS( Ticks ) ( (uint32)( ( (uint64)( Ticks ) * 1000000000u ) / BENCH_TIMER_HZ ) )
+
+/**
+ * @brief   Round trip latency of each frame, in nanoseconds
+ */
+static uint32 Latency[ BENCH_SAMPLES ];
+
+/**
+ * @brief   Time the driver takes on each round trip, Can_Write plus the interrupts, in nanoseconds
+ */
+static uint32 DriverTime[ BENCH_SAMPLES ];
+
+/**
+ * @brief   Frames indicated to CanIf
+ */
+static volatile uint32 RxIndications;
+
+/**
+ * @brief   Timer value at the last indication
+ */
+static volatile uint32 RxTick;
+
+/**
+ * @brief   Sequence number carried into the first payload byte of the last frame
+ */
+static volatile uint8 RxSequence = 0xFFu;
+
+/**
+ * @brief   Frames received out of sequence
+ */
+static volatile uint32 RxOutOfSequence;
+
+/**
+ * @brief   Tx confirmations indicated to CanIf
+ */
+static volatile uint32 TxConfirmations;
+
+/**
+ * @brief   Ticks spent into the Can interrupt since the last reset
+ */
+static volatile uint32 IsrTicks;
+
+/* clang-format off */
+static const Can_ControllerBaudrateConfig BenchBaudrate =
+{
+    .BaudRateConfigID  = 0u,
+    .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 2u ),
+    .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 2u ),
+    .FdTxBitRateSwitch = STD_OFF
+};
+
+static const Can_Controller BenchControllers[ CAN_NUMBER_OF_CONTROLLERS ] =
+{
+    {
+        .ControllerId         = CAN_CONTROLLER_0,
+        .Mode                 = CAN_MODE_INTERNAL_LOOPBACK,
+        .ClockDivider         = CAN_CLOCK_DIV1,
+        .FrameFormat          = CAN_FRAME_CLASSIC,
+        .TransmitPause        = STD_OFF,
+        .ProtocolException    = STD_OFF,
+        .AutoRetransmission   = STD_OFF,
+        .TxFifoQueueMode      = CAN_TX_FIFO_OPERATION,
+        .ActiveITs            = CAN_IT_LIST_RX_FIFO0 | CAN_IT_TX_COMPLETE,
+        .Line1ITs             = 0u,
+        .DefaultBaudrate      = &BenchBaudrate,
+        .BaudrateConfigs      = &BenchBaudrate,
+        .BaudrateConfigsCount = 1u,
+        .CanReference         = CAN_FDCAN1
+    },
+    {
+        .ControllerId         = CAN_CONTROLLER_1,
+        .Mode                 = CAN_MODE_NORMAL,
+        .ClockDivider         = CAN_CLOCK_DIV1,
+        .FrameFormat          = CAN_FRAME_CLASSIC,
+        .TransmitPause        = STD_OFF,
+        .ProtocolException    = STD_OFF,
+        .AutoRetransmission   = STD_OFF,
+        .TxFifoQueueMode      = CAN_TX_FIFO_OPERATION,
+        .ActiveITs            = 0u,
+        .Line1ITs             = 0u,
+        .DefaultBaudrate      = &BenchBaudrate,
+        .BaudrateConfigs      = &BenchBaudrate,
+        .BaudrateConfigsCount = 1u,
+        .CanReference         = CAN_FDCAN2
+    }
+};
+
+static const Can_HwFilter BenchFilters[ 1u ] =
+{
+    {
+        .HwFilterCode   = 0x000u,
+        .HwFilterMask   = 0x7FFu,
+        .HwFilterType   = CAN_FILTER_TYPE_RANGE,
+        .HwFilterIdType = CAN_ID_STANDARD
+    }
+};
+
+static const Can_HardwareObject BenchHohs[ 2u ] =
+{
+    {
+        .CanObjectId         = BENCH_HTH,
+        .HandleType          = CAN_FULL,
+        .IdType              = CAN_ID_STANDARD,
+        .ObjectPayloadLength = 8u,
+        .ObjectType          = CAN_HOH_TYPE_TRANSMIT,
+        .ControllerRef       = &BenchControllers[ CAN_CONTROLLER_0 ]
+    },
+    {
+        .CanObjectId         = BENCH_HRH,
+        .HandleType          = CAN_FULL,
+        .IdType              = CAN_ID_STANDARD,
+        .ObjectPayloadLength = 8u,
+        .ObjectType          = CAN_HOH_TYPE_RECEIVE,
+        .RxFifo              = CAN_RX_FIFO0,
+        .HwFilter            = BenchFilters,
+        .HwFilterCount       = 1u,
+        .ControllerRef       = &BenchControllers[ CAN_CONTROLLER_0 ]
+    }
+};
+
+static const Can_ConfigType BenchConfig =
+{
+    .Controllers      = BenchControllers,
+    .ControllersCount = CAN_NUMBER_OF_CONTROLLERS,
+    .Hohs             = BenchHohs,
+    .HohsCount        = 2u
+};
+/* clang-format on */
+
+static uint32 Bench_RoundTrips( void );
+static uint32 Bench_Sustained( void );
+static void Bench_Report( const char *Name, const Bench_Summary *Summary );
+
+/**
+ * @brief    **Benchmark entry point**
+ *
+ * Enable the clocks, bring up the driver with the loopback controller and run both scenarios, the
+ * results are printed once and the image stays in an endless loop.
+ */
+int main( void )
+{
+    Bench_Summary LatencySummary;
+    Bench_Summary DriverSummary;
+    uint32 Rounds;
+    uint32 FramesPerSecond;
+
+    Det_Init( &DetConfig );
+    Det_Start( );
+
+    /* FDCAN takes PCLK as kernel clock out of reset, TIM6 counts every clock cycle */
+    RCC->APBENR1 |= ( 1u << BENCH_RCC_FDCANEN ) | ( 1u << BENCH_RCC_TIM6EN );
+    TIM6->PSC = 0u;
+    TIM6->ARR = BENCH_TIMER_MASK;
+    TIM6->EGR = 1u;
+    TIM6->CR1 = 1u;
+
+    Can_Init( &BenchConfig );
+    (void)Can_SetControllerMode( CAN_CONTROLLER_0, CAN_CS_STARTED );
+    Can_EnableControllerInterrupts( CAN_CONTROLLER_0 );
+    CDD_Nvic_EnableIrq( TIM16_FDCAN_IT0_IRQn );
+
+    Rounds = Bench_RoundTrips( );
+    Bench_Summarize( Latency, Rounds, &LatencySummary );
+    Bench_Summarize( DriverTime, Rounds, &DriverSummary );
+    FramesPerSecond = Bench_Rate( BENCH_FRAMES, Bench_Sustained( ), BENCH_TIMER_HZ );
+
+    (void)printf( "can loopback 500k: %lu round trips, %lu out of sequence, %lu confirmations\n", (unsigned long)Rounds,
+                  (unsigned long)RxOutOfSequence, (unsigned long)TxConfirmations );
+    Bench_Report( "latency", &LatencySummary );
+    Bench_Report( "driver time", &DriverSummary );
+    (void)printf( "sustained: %lu frames/s\n", (unsigned long)FramesPerSecond );
+
+    for( ;; )
+    {
+    }
+
+    return 0;
+}
+
+/**
+ * @brief    **FDCAN interrupt line 0**
+ *
+ * Serve the driver and account the time it takes.
+ */
+void TIM16_FDCAN_IT0_IRQHandler( void )
+{
+    uint32 Start = TIM6->CNT;
+
+    Can_IsrLine0( );
+    IsrTicks += ( TIM6->CNT - Start ) & BENCH_TIMER_MASK;
+}
+
+/**
+ * @brief    **Measure the round trip of frames sent one at a time**
+ *
+ * Each frame is written once the previous one came back, the payload length goes from zero to
+ * eight bytes to spread the samples and the first byte carries a sequence number.
+ *
+ * @retval  Round trips completed
+ */
+static uint32 Bench_RoundTrips( void )
+{
+    uint8 Payload[ 8u ] = { 0 };
+    Can_PduType Pdu     = { .id = BENCH_ID, .sdu = Payload };
+    uint32 Sample       = 0u;
+
+    for( ; Sample < BENCH_SAMPLES; Sample++ )
+    {
+        uint32 Received = RxIndications;
+        uint32 Start;
+        uint32 WriteTicks;
+
+        Pdu.swPduHandle = (PduIdType)Sample;
+        Pdu.length      = (uint8)( Sample % 9u );
+        Payload[ 0u ]   = (uint8)Sample;
+        IsrTicks        = 0u;
+
+        Start = TIM6->CNT;
+        if( Can_Write( BENCH_HTH, &Pdu ) != E_OK )
+        {
+            break;
+        }
+        WriteTicks = ( TIM6->CNT - Start ) & BENCH_TIMER_MASK;
+
+        while( ( RxIndications == Received ) && ( ( ( TIM6->CNT - Start ) & BENCH_TIMER_MASK ) < BENCH_TIMEOUT ) )
+        {
+        }
+
+        if( RxIndications == Received )
+        {
+            break;
+        }
+
+        /* Let the Tx confirmation come in before the next frame */
+        while( TxConfirmations <= Sample )
+        {
+        }
+
+        Latency[ Sample ]    = BENCH_TICKS_TO_NS( ( RxTick - Start ) & BENCH_TIMER_MASK );
+        DriverTime[ Sample ] = BENCH_TICKS_TO_NS( WriteTicks + IsrTicks );
+    }
+
+    return Sample;
+}
+
+/**
+ * @brief    **Keep the Tx FIFO full and count the frames coming back**
+ *
+ * The 16 bits timer wraps every 4ms, so the elapsed time is accumulated on each poll.
+ *
+ * @retval  Ticks it took to receive BENCH_FRAMES frames
+ */
+static uint32 Bench_Sustained( void )
+{
+    uint8 Payload[ 8u ] = { 0 };
+    Can_PduType Pdu     = { .id = BENCH_ID, .length = 8u, .sdu = Payload };
+    uint32 Target       = RxIndications + BENCH_FRAMES;
+    uint32 Last         = TIM6->CNT;
+    uint32 Elapsed      = 0u;
+    uint8 Sequence      = RxSequence;
+
+    while( RxIndications < Target )
+    {
+        uint32 Now = TIM6->CNT;
+
+        /* Refill the Tx FIFO, the payload carries the sequence number */
+        Payload[ 0u ] = (uint8)( Sequence + 1u );
+        while( Can_Write( BENCH_HTH, &Pdu ) == E_OK )
+        {
+            Sequence++;
+            Payload[ 0u ] = (uint8)( Sequence + 1u );
+        }
+
+        Elapsed += ( Now - Last ) & BENCH_TIMER_MASK;
+        Last = Now;
+    }
+
+    return Elapsed;
+}
+
+/**
+ * @brief    **Print a distribution**
+ *
+ * @param    Name Figure name
+ * @param    Summary Distribution to print
+ */
+static void Bench_Report( const char *Name, const Bench_Summary *Summary )
+{
+    (void)printf( "%s min/p50/p99/max: %lu/%lu/%lu/%lu ns\n", Name, (unsigned long)Summary->Min, (unsigned long)Summary->P50,
+                  (unsigned long)Summary->P99, (unsigned long)Summary->Max );
+}
+
+/**
+ * @brief   CanIf reception indication, timestamps the frame and checks the sequence
+ */
+void CanIf_RxIndication( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr )
+{
+    /* Empty frames can not carry the sequence number, they are taken as the expected one */
+    uint8 Sequence = ( PduInfoPtr->SduLength > 0u ) ? PduInfoPtr->SduDataPtr[ 0u ] : (uint8)( RxSequence + 1u );
+
+    (void)Mailbox;
+    RxTick = TIM6->CNT;
+
+    if( Sequence != (uint8)( RxSequence + 1u ) )
+    {
+        RxOutOfSequence++;
+    }
+
+    RxSequence = Sequence;
+    RxIndications++;
+}
+
+/**
+ * @brief   CanIf transmission confirmation
+ */
+void CanIf_TxConfirmation( PduIdType CanTxPduId )
+{
+    (void)CanTxPduId;
+    TxConfirmations++;
+}
+
+/**
+ * @brief   CanIf transmission cancellation, hardware cancellation is not used by the loopback
+ */
+void CanIf_CancelTxConfirmation( PduIdType CanTxPduId, const PduInfoType *PduInfoPtr )
+{
+    (void)CanTxPduId;
+    (void)PduInfoPtr;
+}
+
+/**
+ * @brief   CanIf bus off notification
+ */
+void CanIf_ControllerBusOff( uint8 ControllerId )
+{
+    (void)ControllerId;
+}
+
+/**
+ * @brief   CanIf mode indication
+ */
+void CanIf_ControllerModeIndication( uint8 ControllerId, Can_ControllerStateType ControllerMode )
+{
+    (void)ControllerId;
+    (void)ControllerMode;
+}
+
+/**
+ * @brief   CanIf error passive notification
+ */
+void CanIf_ControllerErrorStatePassive( uint8 ControllerId, uint16 RxErrorCounter, uint16 TxErrorCounter )
+{
+    (void)ControllerId;
+    (void)RxErrorCounter;
+    (void)TxErrorCounter;
+}
+
+/**
+ * @brief   CanIf error notification
+ */
+void CanIf_ErrorNotification( uint8 ControllerId, Can_ErrorType CanError )
+{
+    (void)ControllerId;
+    (void)CanError;
+}
+
+/**
+ * @brief   CanIf trigger transmit, every PDU is written with its data
+ */
+Std_ReturnType CanIf_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr )
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_NOT_OK;
+}
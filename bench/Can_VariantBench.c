@@ -0,0 +1,264 @@
+/**
+ * @file    Can_VariantBench.c
+ * @brief   **Can configuration variants benchmark, host image**
+ * @author  Diego Perez
+ *
+ * Application built on the host by make bench-host, once per configuration variant out of the same
+ * driver sources and the configuration in cfg, with optimizations on so the compiler can fold what
+ * it knows. The registers and the message RAM are plain variables from test/support/Registers.h.
+ * The image reports the instructions per call of Can_Write and of the Rx FIFO 0 interrupt, counted
+ * by single stepping a copy of the image, comparing the figures printed by both images shows what
+ * the pre-compile variant saves on each call. Started with a scenario and a number of calls the
+ * image only runs that scenario, that is the copy being counted.
+ */
+#include "Std_Types.h"
+#include "Registers.h"
+#include "Can.h"
+#include "Can_Arch.h"
+#include "CanIf_Can.h"
+#include "Det.h"
+#include "BenchSteps.h"
+#include <stdio.h>  /* cppcheck-suppress misra-c2012-21.6 ; Necessary for printing the results */
+#include <stdlib.h> /* cppcheck-suppress misra-c2012-21.6 ; Necessary for the number of calls */
+#include <string.h>
+
+/**
+ * @defgroup    variant_defines benchmark parameters
+ *
+ * @{ */
+#define VARIANT_CALLS   200u /*!< Calls counted per scenario */
+#define VARIANT_ID      0x123 /*!< CAN id used by the benchmark */
+#define VARIANT_RF0N    0x01u /*!< Rx FIFO 0 new message flag into IR and IE */
+/**
+ * @} */
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_CONFIGURATION_VARIANT == CAN_VARIANT_PRE_COMPILE
+#define VARIANT_NAME "pre-compile" /*!< Variant the image was built with */
+#else
+#define VARIANT_NAME "post-build" /*!< Variant the image was built with */
+#endif
+
+/**
+ * @brief   Registers of CAN1
+ */
+Can_RegisterType CAN1_BASE;
+
+/**
+ * @brief   Registers of CAN2
+ */
+Can_RegisterType CAN2_BASE;
+
+/**
+ * @brief   Message RAM of CAN1
+ */
+SramCan_RegisterType SRAMCAN1_BASE;
+
+/**
+ * @brief   Message RAM of CAN2
+ */
+SramCan_RegisterType SRAMCAN2_BASE;
+
+/**
+ * @brief   Frames indicated to CanIf
+ */
+static volatile uint32 RxIndications;
+
+static void Variant_Write( uint32 Calls );
+static void Variant_RxIsr( uint32 Calls );
+static void Variant_Report( const char *Image, const char *Scenario );
+
+/**
+ * @brief    **Benchmark entry point**
+ *
+ * Without arguments the image counts both scenarios on copies of itself and prints the figures.
+ * With a scenario and a number of calls the driver is initialized with the default configuration
+ * set, the controller 0 is started and the scenario runs that many times.
+ */
+int main( int argc, char *argv[] )
+{
+    int RetVal = 0;
+
+    if( argc < 3 )
+    {
+        (void)printf( "can %s variant, instructions per call\n", VARIANT_NAME );
+        Variant_Report( argv[ 0 ], "can_write" );
+        Variant_Report( argv[ 0 ], "rx_fifo0_isr" );
+    }
+    else
+    {
+        uint32 Calls = (uint32)strtoul( argv[ 2 ], NULL, 10 );
+
+        Can_Init( &CanConfig );
+        (void)Can_SetControllerMode( CAN_CONTROLLER_0, CAN_CS_STARTED );
+        Can_EnableControllerInterrupts( CAN_CONTROLLER_0 );
+
+        if( strcmp( argv[ 1 ], "can_write" ) == 0 )
+        {
+            Variant_Write( Calls );
+        }
+        else
+        {
+            Variant_RxIsr( Calls );
+            RetVal = ( RxIndications == Calls ) ? 0 : 1;
+        }
+    }
+
+    return RetVal;
+}
+
+/**
+ * @brief    **Run Can_Write**
+ *
+ * A classic frame with eight bytes is written over and over, the Tx FIFO never fills since the
+ * registers are not updated by any hardware.
+ *
+ * @param    Calls Number of writes
+ */
+static void Variant_Write( uint32 Calls )
+{
+    uint8 Payload[ 8u ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    Can_PduType Pdu     = { .id = VARIANT_ID, .length = 8u, .sdu = Payload, .swPduHandle = 0u };
+
+    for( uint32 Call = 0u; Call < Calls; Call++ )
+    {
+        (void)Can_Write( CAN_HTH_0_CTRL_0, &Pdu );
+    }
+}
+
+/**
+ * @brief    **Run the Rx FIFO 0 interrupt**
+ *
+ * The new message flag and one element in the Rx FIFO 0 stay set, every call to the line 0
+ * interrupt reads the element and indicates it to CanIf.
+ *
+ * @param    Calls Number of interrupts
+ */
+static void Variant_RxIsr( uint32 Calls )
+{
+    SRAMCAN1->F0SA[ 0u ] = (uint32)VARIANT_ID << 18u;
+    SRAMCAN1->F0SA[ 1u ] = 8u << 16u;
+    CAN1->RXF0S          = 1u;
+    CAN1->IE |= VARIANT_RF0N;
+    CAN1->IR = VARIANT_RF0N;
+
+    for( uint32 Call = 0u; Call < Calls; Call++ )
+    {
+        Can_IsrLine0( );
+    }
+}
+
+/**
+ * @brief    **Print the instructions per call of a scenario**
+ *
+ * The scenario is counted once without calls and once with VARIANT_CALLS calls, the difference
+ * leaves out the start up and the driver initialization.
+ *
+ * @param    Image Path of this image
+ * @param    Scenario Scenario to count
+ */
+static void Variant_Report( const char *Image, const char *Scenario )
+{
+    uint64 Base  = Bench_CountSteps( Image, Scenario, 0u );
+    uint64 Total = Bench_CountSteps( Image, Scenario, VARIANT_CALLS );
+
+    (void)printf( "%s: %lu.%02lu\n", Scenario, (unsigned long)( ( Total - Base ) / VARIANT_CALLS ),
+                  (unsigned long)( ( ( ( Total - Base ) % VARIANT_CALLS ) * 100u ) / VARIANT_CALLS ) );
+}
+
+/**
+ * @brief   Det development error, the benchmark keeps the parameters right
+ */
+Std_ReturnType Det_ReportError( uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId )
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    (void)ApiId;
+    (void)ErrorId;
+    return E_OK;
+}
+
+/**
+ * @brief   Det runtime error
+ */
+Std_ReturnType Det_ReportRuntimeError( uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId )
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    (void)ApiId;
+    (void)ErrorId;
+    return E_OK;
+}
+
+/**
+ * @brief   CanIf reception indication
+ */
+void CanIf_RxIndication( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr )
+{
+    (void)Mailbox;
+    (void)PduInfoPtr;
+    RxIndications++;
+}
+
+/**
+ * @brief   CanIf transmission confirmation
+ */
+void CanIf_TxConfirmation( PduIdType CanTxPduId )
+{
+    (void)CanTxPduId;
+}
+
+/**
+ * @brief   CanIf transmission cancellation
+ */
+void CanIf_CancelTxConfirmation( PduIdType CanTxPduId, const PduInfoType *PduInfoPtr )
+{
+    (void)CanTxPduId;
+    (void)PduInfoPtr;
+}
+
+/**
+ * @brief   CanIf bus off notification
+ */
+void CanIf_ControllerBusOff( uint8 ControllerId )
+{
+    (void)ControllerId;
+}
+
+/**
+ * @brief   CanIf mode indication
+ */
+void CanIf_ControllerModeIndication( uint8 ControllerId, Can_ControllerStateType ControllerMode )
+{
+    (void)ControllerId;
+    (void)ControllerMode;
+}
+
+/**
+ * @brief   CanIf error passive notification
+ */
+void CanIf_ControllerErrorStatePassive( uint8 ControllerId, uint16 RxErrorCounter, uint16 TxErrorCounter )
+{
+    (void)ControllerId;
+    (void)RxErrorCounter;
+    (void)TxErrorCounter;
+}
+
+/**
+ * @brief   CanIf error notification
+ */
+void CanIf_ErrorNotification( uint8 ControllerId, Can_ErrorType CanError )
+{
+    (void)ControllerId;
+    (void)CanError;
+}
+
+/**
+ * @brief   CanIf trigger transmit, every PDU is written with its data
+ */
+Std_ReturnType CanIf_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr )
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_NOT_OK;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file CanIf_Cfg.h
+ * @brief Configuration file for the CAN interface.
+ * @author Diego Perez
+ *
+ * Configuration of the CAN-IF used by the host benchmark of the receive lookup, the same as the one
+ * in cfg but with room for 250 receive PDUs, close to all a PduIdType can address. The benchmark
+ * builds its receive PDUs at runtime, so no PDU ids are listed here.
+ */
+#ifndef CANIF_CFG_H__
+#define CANIF_CFG_H__
+
+#include "CanIf_Types.h"
+
+/**
+ * @defgroup CANIF_SWC_Ids CanIf software version and Ids
+ *
+ * {@ */
+#define CANIF_MODULE_ID                        0u /*!< CanIf Module ID */
+#define CANIF_INSTANCE_ID                      0u /*!< CanIf Instance ID */
+#define CANIF_VENDOR_ID                        0u /*!< CanIf Module Vendor ID */
+/**
+ * @} */
+
+/**
+ * @defgroup CANIF_SWC_Ids CanIf software version and Ids
+ *
+ * {@ */
+#define CANIF_SW_MAJOR_VERSION                 0u /*!< CanIf Module Major Version */
+#define CANIF_SW_MINOR_VERSION                 0u /*!< CanIf Module Minor Version */
+#define CANIF_SW_PATCH_VERSION                 0u /*!< CanIf Module Patch Version */
+/**
+ * @} */
+
+#define CANIF_NUMBER_OF_TX_PDUS                1u   /*!< Number of transmit PDUs */
+#define CANIF_NUMBER_OF_RX_PDUS                250u /*!< Number of receive PDUs */
+
+/**
+ * @brief Enable support for Bus Mirroring.
+ * * @typedef EcucBooleanParamDef
+ */
+#define CANIF_BUS_MIRRORING_SUPPORT            STD_ON
+
+/**
+ * @defgroup CANIF_Mirror_ring CanIf bus mirroring capture
+ *
+ * Frames captured per controller while bus mirroring is enabled, the ring size shall be a power
+ * of two
+ *
+ * @{ */
+#define CANIF_MIRROR_CONTROLLERS               1u  /*!< Controllers with a capture ring */
+#define CANIF_MIRROR_RING_SIZE                 32u /*!< Frames held by each capture ring */
+#define CANIF_MIRROR_MAX_LENGTH                8u  /*!< Largest payload captured per frame */
+#define CANIF_MIRROR_TIMESTAMP( )              CanIf_Bench_TimeStamp /*!< Free running counter of the bench */
+/**
+ * @} */
+
+/**
+ * @brief Counter standing for the timer register read by the bus mirroring, defined by the bench.
+ */
+extern volatile uint32 CanIf_Bench_TimeStamp;
+
+/**
+ * @brief Switches the development error detection and notification on or off.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_DEV_ERROR_DETECT                 STD_ON
+
+/**
+ * @brief Enables / Disables the API CanIf_ReadRxPduData() for reading received L-SDU data.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PUBLIC_READ_RX_PDU_DATA          STD_ON
+
+#define CANIF_RX_BUFFER_MAX_LENGTH             8u  /*!< Largest payload kept for CanIf_ReadRxPduData */
+
+/**
+ * @brief Enables and disables the API for reading the notification status of receive L-PDUs.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PUBLIC_READ_RX_PDU_NOTIFY_STATUS STD_ON
+
+/**
+ * @brief Enables and disables the API for reading the notification status of transmit L-PDUs.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS STD_ON
+
+/**
+ * @brief Enables and disables the buffering of transmit L-PDUs rejected by the CAN driver.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PUBLIC_TX_BUFFERING              STD_OFF
+
+/**
+ * @brief Enables the trigger transmit, transmit PDUs requested without data get it from the upper
+ * layer straight into the CAN driver Tx buffer element.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_TRIGGER_TRANSMIT_SUPPORT         STD_OFF
+
+/**
+ * @brief Enables the data length check, a received L-PDU shorter than the DataLength of its receive
+ * PDU is not indicated.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PRIVATE_DATA_LENGTH_CHECK        STD_ON
+
+/**
+ * @brief Enables the software filter of the HRHs, frames with an id no receive PDU of the HRH
+ * accepts are dropped before the lookup.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PRIVATE_SOFTWARE_FILTER          STD_ON
+
+/**
+ * @defgroup CANIF_Tx_Buffers CanIf transmit buffers size
+ *
+ * Room reserved at compile time for the Tx buffers of any configuration
+ *
+ * @{ */
+#define CANIF_NUMBER_OF_TX_BUFFERS             1u  /*!< Maximum number of Tx buffers */
+#define CANIF_TX_BUFFER_ENTRIES                4u  /*!< L-PDUs held by all the Tx buffers together */
+#define CANIF_TX_BUFFER_MAX_LENGTH             8u  /*!< Largest payload a Tx buffer entry holds */
+/**
+ * @} */
+
+/**
+ * @brief Enables/Disables the Global Time APIs used when hardware timestamping is supported.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_GLOBAL_TIME_SUPPORT              STD_ON
+
+/**
+ * @brief Specifies if the CanIf_SetBaudrate API shall be supported.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_SET_BAUDRATE_API                 STD_ON
+
+/**
+ * @brief Specifies if the CanIf_TransmitMultiple API shall be supported.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_TRANSMIT_MULTIPLE_API            STD_ON
+
+/**
+ * @brief Specifies if the CanIf_GetVersionInfo API shall be supported.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_VERSION_INFO_API                 STD_ON
+
+extern const CanIf_ConfigType CanIfConfig;
+
+#endif /* CANIF_CFG_H__ */
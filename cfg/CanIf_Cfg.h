@@ -12,6 +12,7 @@
 #define CANIF_CFG_H__
 
 #include "CanIf_Types.h"
+#include "Registers.h"
 
 /**
  * @defgroup CANIF_SWC_Ids CanIf software version and Ids
@@ -33,12 +34,52 @@
 /**
  * @} */
 
+/**
+ * @defgroup CANIF_Tx_Pdus CanIf transmit PDUs
+ *
+ * Transmit L-PDU Ids, indexes of the CanIf_ConfigType TxPduCfgs array
+ *
+ * @{ */
+#define CANIF_TX_PDU_0                         0u /*!< Classic frame with standard id */
+#define CANIF_TX_PDU_1                         1u /*!< Classic frame with extended id */
+/**
+ * @} */
+
+#define CANIF_NUMBER_OF_TX_PDUS                2u /*!< Number of transmit PDUs */
+
+/**
+ * @defgroup CANIF_Rx_Pdus CanIf receive PDUs
+ *
+ * Receive L-PDU Ids, indexes of the CanIf_ConfigType RxPduCfgs array
+ *
+ * @{ */
+#define CANIF_RX_PDU_0                         0u /*!< Standard id 0x321 */
+#define CANIF_RX_PDU_1                         1u /*!< Standard ids 0x700 to 0x77F */
+/**
+ * @} */
+
+#define CANIF_NUMBER_OF_RX_PDUS                2u /*!< Number of receive PDUs */
+
 /**
  * @brief Enable support for Bus Mirroring.
  * * @typedef EcucBooleanParamDef
  */
 #define CANIF_BUS_MIRRORING_SUPPORT            STD_ON
 
+/**
+ * @defgroup CANIF_Mirror_ring CanIf bus mirroring capture
+ *
+ * Frames captured per controller while bus mirroring is enabled, the ring size shall be a power
+ * of two
+ *
+ * @{ */
+#define CANIF_MIRROR_CONTROLLERS               1u  /*!< Controllers with a capture ring */
+#define CANIF_MIRROR_RING_SIZE                 32u /*!< Frames held by each capture ring */
+#define CANIF_MIRROR_MAX_LENGTH                8u  /*!< Largest payload captured per frame */
+#define CANIF_MIRROR_TIMESTAMP( )              ( TIM6->CNT ) /*!< Gpt channel 0 counter, free running */
+/**
+ * @} */
+
 /**
  * @brief Switches the development error detection and notification on or off.
  * @typedef EcucBooleanParamDef
@@ -51,6 +92,8 @@
  */
 #define CANIF_PUBLIC_READ_RX_PDU_DATA          STD_ON
 
+#define CANIF_RX_BUFFER_MAX_LENGTH             8u  /*!< Largest payload kept for CanIf_ReadRxPduData */
+
 /**
  * @brief Enables and disables the API for reading the notification status of receive L-PDUs.
  * @typedef EcucBooleanParamDef
@@ -63,6 +106,45 @@
  */
 #define CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS STD_ON
 
+/**
+ * @brief Enables and disables the buffering of transmit L-PDUs rejected by the CAN driver.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PUBLIC_TX_BUFFERING              STD_ON
+
+/**
+ * @brief Enables the trigger transmit, transmit PDUs requested without data get it from the upper
+ * layer straight into the CAN driver Tx buffer element.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_TRIGGER_TRANSMIT_SUPPORT         STD_ON
+
+/**
+ * @brief Enables the data length check, a received L-PDU shorter than the DataLength of its receive
+ * PDU is not indicated.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PRIVATE_DATA_LENGTH_CHECK        STD_ON
+
+/**
+ * @brief Enables the software filter of the HRHs, frames with an id no receive PDU of the HRH
+ * accepts are dropped before the lookup.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PRIVATE_SOFTWARE_FILTER          STD_ON
+
+/**
+ * @defgroup CANIF_Tx_Buffers CanIf transmit buffers size
+ *
+ * Room reserved at compile time for the Tx buffers of any configuration
+ *
+ * @{ */
+#define CANIF_NUMBER_OF_TX_BUFFERS             1u  /*!< Maximum number of Tx buffers */
+#define CANIF_TX_BUFFER_ENTRIES                4u  /*!< L-PDUs held by all the Tx buffers together */
+#define CANIF_TX_BUFFER_MAX_LENGTH             8u  /*!< Largest payload a Tx buffer entry holds */
+/**
+ * @} */
+
 /**
  * @brief Enables/Disables the Global Time APIs used when hardware timestamping is supported.
  * @typedef EcucBooleanParamDef
@@ -75,6 +157,12 @@
  */
 #define CANIF_SET_BAUDRATE_API                 STD_ON
 
+/**
+ * @brief Specifies if the CanIf_TransmitMultiple API shall be supported.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_TRANSMIT_MULTIPLE_API            STD_ON
+
 /**
  * @brief Specifies if the CanIf_GetVersionInfo API shall be supported.
  * @typedef EcucBooleanParamDef
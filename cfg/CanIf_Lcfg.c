@@ -12,6 +12,78 @@
 #include "CanIf_Cfg.h"
 #include "Can.h"
 
+/**
+ * @brief Transmit PDUs configuration, indexed by TxPduId.
+ */
+/* clang-format off */
+static const CanIf_TxPduCfgType CanIfTxPduCfgs[ CANIF_NUMBER_OF_TX_PDUS ] =
+{
+    {
+        .CanId = 0x123u,
+        .Hth = CAN_HTH_0_CTRL_0,
+        .ControllerId = CAN_CONTROLLER_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .FdFlag = FALSE,
+        .MaxLength = 8u,
+        .TriggerTransmit = NULL_PTR,
+        .TxConfirmation = NULL_PTR
+    },
+    {
+        .CanId = 0x1234567u,
+        .Hth = CAN_HTH_0_CTRL_0,
+        .ControllerId = CAN_CONTROLLER_0,
+        .CanIdType = CANIF_CANID_EXTENDED,
+        .FdFlag = FALSE,
+        .MaxLength = 8u,
+        .TriggerTransmit = NULL_PTR,
+        .TxConfirmation = NULL_PTR
+    }
+};
+/* clang-format on */
+
+/**
+ * @brief Receive PDUs configuration, indexed by RxPduId.
+ */
+/* clang-format off */
+static const CanIf_RxPduCfgType CanIfRxPduCfgs[ CANIF_NUMBER_OF_RX_PDUS ] =
+{
+    {
+        .CanId = 0x321u,
+        .CanIdUpper = 0x321u,
+        .Hrh = CAN_HRH_0_CTRL_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .CanIdRange = FALSE,
+        .ReadData = TRUE,
+        .DataLength = 0u,
+        .RxIndication = NULL_PTR
+    },
+    {
+        .CanId = 0x700u,
+        .CanIdUpper = 0x77Fu,
+        .Hrh = CAN_HRH_0_CTRL_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .CanIdRange = TRUE,
+        .ReadData = FALSE,
+        .DataLength = 0u,
+        .RxIndication = NULL_PTR
+    }
+};
+/* clang-format on */
+
+/**
+ * @brief Transmit buffers configuration.
+ */
+/* clang-format off */
+static const CanIf_BufferCfgType CanIfBufferCfgs[ CANIF_NUMBER_OF_TX_BUFFERS ] =
+{
+    {
+        .Hth = CAN_HTH_0_CTRL_0,
+        .ControllerId = CAN_CONTROLLER_0,
+        .Size = 4u
+    }
+};
+/* clang-format on */
+
 /**
  * @brief Can driver configuration.
  */
@@ -19,8 +91,12 @@
 const CanIf_ConfigType CanIfConfig =
 {
     .CtrlCfgs = NULL_PTR,
-    .NumberOfCanControllers = 0,
-    .MaxRxPduCfg = 0,
-    .MaxTxPduCfg = 0    
+    .TxPduCfgs = CanIfTxPduCfgs,
+    .RxPduCfgs = CanIfRxPduCfgs,
+    .BufferCfgs = CanIfBufferCfgs,
+    .NumberOfCanControllers = 1,
+    .MaxRxPduCfg = CANIF_NUMBER_OF_RX_PDUS,
+    .MaxTxPduCfg = CANIF_NUMBER_OF_TX_PDUS,
+    .NumberOfBuffers = CANIF_NUMBER_OF_TX_BUFFERS
 };
 /* clang-format off */
@@ -115,6 +115,88 @@
  */
 #define CAN_VERSION_INFO_API                STD_ON
 
+/**
+ * @brief Specifies if Can_Write accepts PDUs without sdu, the payload is then requested with
+ * CanIf_TriggerTransmit and written straight into the Tx buffer element.
+ * @typedef EcucBooleanParamDef
+ */
+#define CAN_TRIGGER_TRANSMIT_ENABLE         STD_ON
+
+/**
+ * @brief Specifies if the runtime statistics and the Can_GetStatistics API shall be supported.
+ * @typedef EcucBooleanParamDef
+ */
+#define CAN_STATISTICS_API                  STD_OFF
+
+/**
+ * @brief Free running counter used to measure the execution times, Cortex-M0+ has no cycle
+ * counter so a timer already running at core clock can be used instead.
+ */
+#define CAN_STATISTICS_CYCLE_COUNTER( )     ( TIM6->CNT )
+
+/**
+ * @brief Mask with the width of the free running counter, used to handle its wrap around.
+ */
+#define CAN_STATISTICS_COUNTER_MASK         0xFFFFu
+
+/**
+ * @brief Specifies if the bus load and error rate monitor and the Can_GetBusMonitor API shall be
+ * supported, Can_MainFunction_BusMonitor shall then be called cyclically.
+ * @typedef EcucBooleanParamDef
+ */
+#define CAN_BUS_MONITOR_API                 STD_OFF
+
+/**
+ * @brief Can_MainFunction_BusMonitor cycles each monitor window lasts, the bus time is read from the
+ * 16 bits FDCAN timestamp counter so the main function period shall be shorter than 65536 bit times.
+ */
+#define CAN_BUS_MONITOR_WINDOW              100u
+
+/**
+ * @brief Smoothing of the average bus load, each new window weights 1 / 2^CAN_BUS_MONITOR_SMOOTHING.
+ */
+#define CAN_BUS_MONITOR_SMOOTHING           3u
+
+/**
+ * @brief Specifies the configuration variant, with CAN_VARIANT_PRE_COMPILE Can_Arch.c and the
+ * configuration in Can_Lcfg.c are compiled as part of Can.c and Can_Init ignores its parameter, with
+ * CAN_VARIANT_POST_BUILD any of the sets below can be passed to Can_Init. A build can select the
+ * variant from the command line.
+ * @typedef EcucEnumerationParamDef
+ */
+#ifndef CAN_CONFIGURATION_VARIANT
+#define CAN_CONFIGURATION_VARIANT           CAN_VARIANT_POST_BUILD
+#endif
+
+/**
+ * @defgroup Config_Sets Can post-build configuration sets
+ *
+ * Specifies the configuration sets available in the post-build flash area, any of them can be
+ * passed to Can_Init through CanConfigSets without re-linking the application.
+ *
+ * @typedef EcucIntegerParamDef
+ *
+ * @{ */
+#define CAN_NUMBER_OF_CONFIG_SETS           2
+#define CAN_CONFIG_SET_100K                 0 /*!< Controllers start at 100Kbps and 500Kbps */
+#define CAN_CONFIG_SET_500K                 1 /*!< Both controllers start at 500Kbps */
+/**
+ * @} */
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared above */
+#if CAN_CONFIGURATION_VARIANT == CAN_VARIANT_POST_BUILD
+/**
+ * @brief Places the post-build configuration into its own flash section, see linker.ld.
+ */
+#define CAN_POSTBUILD_SECTION               __attribute__( ( section( ".can_postbuild" ) ) )
+#else
+/**
+ * @brief The pre-compile configuration stays with the rest of the constants.
+ */
+#define CAN_POSTBUILD_SECTION
+#endif
+
 extern const Can_ConfigType CanConfig;
+extern const Can_ConfigType *const CanConfigSets[ CAN_NUMBER_OF_CONFIG_SETS ];
 
 #endif /* CAN_CFG_H__ */
@@ -12,40 +12,29 @@
 #include "Can_Cfg.h"
 #include "Can_Arch.h"
 
+/* With the pre-compile variant this file is compiled only as part of Can_Arch.c, itself part of Can.c */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if ( CAN_CONFIGURATION_VARIANT == CAN_VARIANT_POST_BUILD ) || defined( CAN_LCFG_PRE_COMPILE )
 
 /**
  * @brief Array with baudrate values for controller 0
  *
  */
 /* clang-format off */
-const Can_ControllerBaudrateConfig BaudratesCtrl0[ CAN_NUMBER_OF_BAUDRATES_CTRL0 ] =
+CAN_POSTBUILD_SECTION const Can_ControllerBaudrateConfig BaudratesCtrl0[ CAN_NUMBER_OF_BAUDRATES_CTRL0 ] =
 {
     {
-        .BaudRateConfigID = CAN_BAUDRATE_CTRL1_100K,
-        .Seg1 = 13,
-        .Seg2 = 2,
-        .SyncJumpWidth = 1,
-        .Prescaler = 6,
-        .FdSeg1 = 13,
-        .FdSeg2 = 2,
-        .FdPrescaler = 6,
-        .FdSspOffset = 0,
-        .FdSyncJumpWidth = 1,
+        .BaudRateConfigID  = CAN_BAUDRATE_CTRL1_100K,
+        .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 6u ),
+        .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 6u ),
         .FdTxBitRateSwitch = STD_OFF
     },
     {
-        .BaudRateConfigID = CAN_BAUDRATE_CTRL1_500K,
-        .Seg1 = 13,
-        .Seg2 = 2,
-        .SyncJumpWidth = 1,
-        .Prescaler = 6,
-        .FdSeg1 = 13,
-        .FdSeg2 = 2,
-        .FdPrescaler = 6,
-        .FdSspOffset = 0,
-        .FdSyncJumpWidth = 1,
+        .BaudRateConfigID  = CAN_BAUDRATE_CTRL1_500K,
+        .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 6u ),
+        .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 6u ),
         .FdTxBitRateSwitch = STD_OFF
-    } 
+    }
 };
 
 /**
@@ -53,34 +42,20 @@ const Can_ControllerBaudrateConfig BaudratesCtrl0[ CAN_NUMBER_OF_BAUDRATES_CTRL0
  * 
 */
 /* clang-format off */
-const Can_ControllerBaudrateConfig BaudratesCtrl1[ CAN_NUMBER_OF_BAUDRATES_CTRL1 ] =
+CAN_POSTBUILD_SECTION const Can_ControllerBaudrateConfig BaudratesCtrl1[ CAN_NUMBER_OF_BAUDRATES_CTRL1 ] =
 {
     {
-        .BaudRateConfigID = CAN_BAUDRATE_CTRL0_100K,
-        .Seg1 = 13,
-        .Seg2 = 2,
-        .SyncJumpWidth = 1,
-        .Prescaler = 6,
-        .FdSeg1 = 13,
-        .FdSeg2 = 2,
-        .FdPrescaler = 6,
-        .FdSspOffset = 0,
-        .FdSyncJumpWidth = 1,
+        .BaudRateConfigID  = CAN_BAUDRATE_CTRL0_100K,
+        .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 6u ),
+        .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 6u ),
         .FdTxBitRateSwitch = STD_OFF
     },
     {
-        .BaudRateConfigID = CAN_BAUDRATE_CTRL0_500K,
-        .Seg1 = 13,
-        .Seg2 = 2,
-        .SyncJumpWidth = 1,
-        .Prescaler = 6,
-        .FdSeg1 = 13,
-        .FdSeg2 = 2,
-        .FdPrescaler = 6,
-        .FdSspOffset = 0,
-        .FdSyncJumpWidth = 1,
+        .BaudRateConfigID  = CAN_BAUDRATE_CTRL0_500K,
+        .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 6u ),
+        .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 6u ),
         .FdTxBitRateSwitch = STD_OFF
-    } 
+    }
 };
 
 
@@ -88,7 +63,7 @@ const Can_ControllerBaudrateConfig BaudratesCtrl1[ CAN_NUMBER_OF_BAUDRATES_CTRL1
  * @brief Array with the configuration for each controller.
  */
 /* clang-format off */
-const Can_Controller Controllers[ CAN_NUMBER_OF_CONTROLLERS ] =
+CAN_POSTBUILD_SECTION const Can_Controller Controllers[ CAN_NUMBER_OF_CONTROLLERS ] =
 {
     {
         .ControllerId = CAN_CONTROLLER_0,
@@ -123,8 +98,47 @@ const Can_Controller Controllers[ CAN_NUMBER_OF_CONTROLLERS ] =
 };
 /* clang-format on */
 
+/**
+ * @brief Array with the configuration for each controller, both starting at 500Kbps.
+ */
+/* clang-format off */
+CAN_POSTBUILD_SECTION const Can_Controller Controllers500k[ CAN_NUMBER_OF_CONTROLLERS ] =
+{
+    {
+        .ControllerId = CAN_CONTROLLER_0,
+        .Mode = CAN_MODE_NORMAL,
+        .ClockDivider = CAN_CLOCK_DIV1,
+        .FrameFormat = CAN_FRAME_CLASSIC,
+        .TransmitPause = STD_OFF,
+        .ProtocolException = STD_OFF,
+        .AutoRetransmission = STD_ON,
+        .TxFifoQueueMode = CAN_TX_FIFO_OPERATION,
+        .ActiveITs = CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_RX_FIFO1_NEW_MESSAGE | CAN_IT_TX_COMPLETE,
+        .DefaultBaudrate = &BaudratesCtrl0[ CAN_BAUDRATE_CTRL0_500K ],
+        .BaudrateConfigs = BaudratesCtrl0,
+        .BaudrateConfigsCount = CAN_NUMBER_OF_BAUDRATES_CTRL0,
+        .CanReference = CAN_FDCAN1
+    },
+    {
+        .ControllerId = CAN_CONTROLLER_1,
+        .Mode = CAN_MODE_NORMAL,
+        .ClockDivider = CAN_CLOCK_DIV1,
+        .FrameFormat = CAN_FRAME_CLASSIC,
+        .TransmitPause = STD_OFF,
+        .ProtocolException = STD_OFF,
+        .AutoRetransmission = STD_ON,
+        .TxFifoQueueMode = CAN_TX_FIFO_OPERATION,
+        .ActiveITs = CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_RX_FIFO1_NEW_MESSAGE | CAN_IT_TX_COMPLETE,
+        .DefaultBaudrate = &BaudratesCtrl1[ CAN_BAUDRATE_CTRL1_500K ],
+        .BaudrateConfigs = BaudratesCtrl1,
+        .BaudrateConfigsCount = CAN_NUMBER_OF_BAUDRATES_CTRL1,
+        .CanReference = CAN_FDCAN2
+    }
+};
+/* clang-format on */
+
 /* clang-format off */
-const Can_HwFilter Fifo0Filters[ CAN_N_OF_FIFO0_FILTERS ] =
+CAN_POSTBUILD_SECTION const Can_HwFilter Fifo0Filters[ CAN_N_OF_FIFO0_FILTERS ] =
 {
     { 
         .HwFilterCode   = 0x00000000,
@@ -142,7 +156,7 @@ const Can_HwFilter Fifo0Filters[ CAN_N_OF_FIFO0_FILTERS ] =
 /* clang-format on */
 
 /* clang-format off */
-const Can_HwFilter Fifo1Filters[ CAN_N_OF_FIFO1_FILTERS ] =
+CAN_POSTBUILD_SECTION const Can_HwFilter Fifo1Filters[ CAN_N_OF_FIFO1_FILTERS ] =
 {
     { 
         .HwFilterCode   = 0x00000000,
@@ -163,7 +177,7 @@ const Can_HwFilter Fifo1Filters[ CAN_N_OF_FIFO1_FILTERS ] =
  * @brief Array with the configuration for each hardware object.
  */
 /* clang-format off */
-const Can_HardwareObject Hohs[ CAN_NUMBER_OF_HOHS ] =
+CAN_POSTBUILD_SECTION const Can_HardwareObject Hohs[ CAN_NUMBER_OF_HOHS ] =
 {
     {
         .CanObjectId = CAN_OBJ_HTH_TX00,
@@ -196,13 +210,78 @@ const Can_HardwareObject Hohs[ CAN_NUMBER_OF_HOHS ] =
 };
 /* clang-format on */
 
+/**
+ * @brief Array with the configuration for each hardware object of the 500Kbps set.
+ */
+/* clang-format off */
+CAN_POSTBUILD_SECTION const Can_HardwareObject Hohs500k[ CAN_NUMBER_OF_HOHS ] =
+{
+    {
+        .CanObjectId = CAN_OBJ_HTH_TX00,
+        .HandleType = CAN_FULL,
+        .IdType = CAN_ID_STANDARD,
+        .ObjectPayloadLength = 8,
+        .ObjectType = CAN_HOH_TYPE_TRANSMIT,
+        .ControllerRef = &Controllers500k[ CAN_CONTROLLER_0 ]
+    },
+    {
+        .CanObjectId = CAN_OBJ_HRH_RX00,
+        .HandleType = CAN_FULL,
+        .IdType = CAN_ID_STANDARD,
+        .ObjectPayloadLength = 8,
+        .ObjectType = CAN_HOH_TYPE_RECEIVE,
+        .ControllerRef = &Controllers500k[ CAN_CONTROLLER_0 ],
+        .HwFilter = Fifo0Filters,
+        .HwFilterCount = CAN_N_OF_FIFO0_FILTERS
+    },
+    {
+        .CanObjectId = CAN_OBJ_HRH_RX01,
+        .HandleType = CAN_FULL,
+        .IdType = CAN_ID_STANDARD,
+        .ObjectPayloadLength = 8,
+        .ObjectType = CAN_HOH_TYPE_RECEIVE,
+        .ControllerRef = &Controllers500k[ CAN_CONTROLLER_0 ],
+        .HwFilter = Fifo1Filters,
+        .HwFilterCount = CAN_N_OF_FIFO1_FILTERS
+    } 
+};
+/* clang-format on */
+
 /**
  * @brief Can driver configuration.
  */
 /* clang-format off */
-const Can_ConfigType CanConfig =
+CAN_POSTBUILD_SECTION const Can_ConfigType CanConfig =
 {
-    .Controllers = Controllers,
-    .Hohs         = Hohs 
+    .Controllers      = Controllers,
+    .ControllersCount = CAN_NUMBER_OF_CONTROLLERS,
+    .Hohs             = Hohs,
+    .HohsCount        = CAN_NUMBER_OF_HOHS
 };
 /* clang-format on */
+
+/**
+ * @brief Can driver configuration with both controllers starting at 500Kbps.
+ */
+/* clang-format off */
+CAN_POSTBUILD_SECTION const Can_ConfigType CanConfig500k =
+{
+    .Controllers      = Controllers500k,
+    .ControllersCount = CAN_NUMBER_OF_CONTROLLERS,
+    .Hohs             = Hohs500k,
+    .HohsCount        = CAN_NUMBER_OF_HOHS
+};
+/* clang-format on */
+
+/**
+ * @brief Post-build configuration sets, the one to use is selected by passing it to Can_Init.
+ */
+/* clang-format off */
+CAN_POSTBUILD_SECTION const Can_ConfigType *const CanConfigSets[ CAN_NUMBER_OF_CONFIG_SETS ] =
+{
+    &CanConfig,
+    &CanConfig500k
+};
+/* clang-format on */
+
+#endif
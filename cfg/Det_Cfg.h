@@ -39,4 +39,6 @@
  */
 #define DET_VERSION_INFO_API STD_ON
 
+extern const Det_ConfigType DetConfig;
+
 #endif /* DET_CFG_H__ */
\ No newline at end of file
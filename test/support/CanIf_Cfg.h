@@ -34,9 +34,25 @@
  * @} */
 
 #define CANIF_CONTROLLER_0                     0u /*!< Controller 0 */
+#define CANIF_CONTROLLER_1                     1u /*!< Controller 1 */
 
-#define CANIF_NUMBER_OF_TX_PDUS                5u /*!< Controller 1 */
-#define CANIF_NUMBER_OF_RX_PDUS                5u /*!< Controller 1 */
+#define CANIF_NUMBER_OF_TX_PDUS                6u /*!< Number of transmit PDUs */
+#define CANIF_NUMBER_OF_RX_PDUS                6u /*!< Number of receive PDUs */
+
+/**
+ * @brief Upper layer reception indication of the receive PDUs, defined by the test cases.
+ */
+void CanIf_Test_RxIndication( PduIdType RxPduId, const PduInfoType *PduInfoPtr );
+
+/**
+ * @brief Upper layer trigger transmit of the transmit PDUs, defined by the test cases.
+ */
+Std_ReturnType CanIf_Test_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr );
+
+/**
+ * @brief Upper layer transmit confirmation of the transmit PDUs, defined by the test cases.
+ */
+void CanIf_Test_TxConfirmation( PduIdType TxPduId, Std_ReturnType Result );
 
 /**
  * @brief Enable support for Bus Mirroring.
@@ -44,6 +60,25 @@
  */
 #define CANIF_BUS_MIRRORING_SUPPORT            STD_ON
 
+/**
+ * @defgroup CANIF_Mirror_ring CanIf bus mirroring capture
+ *
+ * Frames captured per controller while bus mirroring is enabled, the ring size shall be a power
+ * of two
+ *
+ * @{ */
+#define CANIF_MIRROR_CONTROLLERS               2u  /*!< Controllers with a capture ring */
+#define CANIF_MIRROR_RING_SIZE                 4u  /*!< Frames held by each capture ring */
+#define CANIF_MIRROR_MAX_LENGTH                64u /*!< Largest payload captured per frame */
+#define CANIF_MIRROR_TIMESTAMP( )              CanIf_Test_TimeStamp /*!< Time set by the test */
+/**
+ * @} */
+
+/**
+ * @brief Timestamp of the frames captured by the bus mirroring, defined by the test.
+ */
+extern volatile uint32 CanIf_Test_TimeStamp;
+
 /**
  * @brief Switches the development error detection and notification on or off.
  * @typedef EcucBooleanParamDef
@@ -56,6 +91,8 @@
  */
 #define CANIF_PUBLIC_READ_RX_PDU_DATA          STD_ON
 
+#define CANIF_RX_BUFFER_MAX_LENGTH             64u /*!< Largest payload kept for CanIf_ReadRxPduData */
+
 /**
  * @brief Enables and disables the API for reading the notification status of receive L-PDUs.
  * @typedef EcucBooleanParamDef
@@ -68,6 +105,45 @@
  */
 #define CANIF_PUBLIC_READ_TX_PDU_NOTIFY_STATUS STD_ON
 
+/**
+ * @brief Enables and disables the buffering of transmit L-PDUs rejected by the CAN driver.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PUBLIC_TX_BUFFERING              STD_ON
+
+/**
+ * @brief Enables the trigger transmit, transmit PDUs requested without data get it from the upper
+ * layer straight into the CAN driver Tx buffer element.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_TRIGGER_TRANSMIT_SUPPORT         STD_ON
+
+/**
+ * @brief Enables the data length check, a received L-PDU shorter than the DataLength of its receive
+ * PDU is not indicated.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PRIVATE_DATA_LENGTH_CHECK        STD_ON
+
+/**
+ * @brief Enables the software filter of the HRHs, frames with an id no receive PDU of the HRH
+ * accepts are dropped before the lookup.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_PRIVATE_SOFTWARE_FILTER          STD_ON
+
+/**
+ * @defgroup CANIF_Tx_Buffers CanIf transmit buffers size
+ *
+ * Room reserved at compile time for the Tx buffers of any configuration
+ *
+ * @{ */
+#define CANIF_NUMBER_OF_TX_BUFFERS             2u  /*!< Maximum number of Tx buffers */
+#define CANIF_TX_BUFFER_ENTRIES                4u  /*!< L-PDUs held by all the Tx buffers together */
+#define CANIF_TX_BUFFER_MAX_LENGTH             64u /*!< Largest payload a Tx buffer entry holds */
+/**
+ * @} */
+
 /**
  * @brief Enables/Disables the Global Time APIs used when hardware timestamping is supported.
  * @typedef EcucBooleanParamDef
@@ -80,6 +156,12 @@
  */
 #define CANIF_SET_BAUDRATE_API                 STD_ON
 
+/**
+ * @brief Specifies if the CanIf_TransmitMultiple API shall be supported.
+ * @typedef EcucBooleanParamDef
+ */
+#define CANIF_TRANSMIT_MULTIPLE_API            STD_ON
+
 /**
  * @brief Specifies if the CanIf_GetVersionInfo API shall be supported.
  * @typedef EcucBooleanParamDef
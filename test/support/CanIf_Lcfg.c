@@ -12,6 +12,163 @@
 #include "CanIf_Cfg.h"
 #include "Can.h"
 
+/**
+ * @brief Transmit PDUs configuration, indexed by TxPduId.
+ */
+/* clang-format off */
+static const CanIf_TxPduCfgType CanIfTxPduCfgs[ CANIF_NUMBER_OF_TX_PDUS ] =
+{
+    {
+        .CanId = 0x100u,
+        .Hth = CAN_HTH_0_CTRL_0,
+        .ControllerId = CAN_CONTROLLER_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .FdFlag = FALSE,
+        .MaxLength = 8u,
+        .TriggerTransmit = NULL_PTR,
+        .TxConfirmation = NULL_PTR
+    },
+    {
+        .CanId = 0x101u,
+        .Hth = CAN_HTH_0_CTRL_0,
+        .ControllerId = CAN_CONTROLLER_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .FdFlag = FALSE,
+        .MaxLength = 8u,
+        .TriggerTransmit = NULL_PTR,
+        .TxConfirmation = CanIf_Test_TxConfirmation
+    },
+    {
+        .CanId = 0x18DAF110u,
+        .Hth = CAN_HTH_0_CTRL_0,
+        .ControllerId = CAN_CONTROLLER_0,
+        .CanIdType = CANIF_CANID_EXTENDED,
+        .FdFlag = FALSE,
+        .MaxLength = 8u,
+        .TriggerTransmit = NULL_PTR,
+        .TxConfirmation = NULL_PTR
+    },
+    {
+        .CanId = 0x200u,
+        .Hth = CAN_HTH_0_CTRL_1,
+        .ControllerId = CAN_CONTROLLER_1,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .FdFlag = TRUE,
+        .MaxLength = 64u,
+        .TriggerTransmit = NULL_PTR,
+        .TxConfirmation = NULL_PTR
+    },
+    {
+        .CanId = 0x1ABCDEu,
+        .Hth = CAN_HTH_0_CTRL_1,
+        .ControllerId = CAN_CONTROLLER_1,
+        .CanIdType = CANIF_CANID_EXTENDED,
+        .FdFlag = TRUE,
+        .MaxLength = 12u,
+        .TriggerTransmit = NULL_PTR,
+        .TxConfirmation = NULL_PTR
+    },
+    {
+        .CanId = 0x102u,
+        .Hth = CAN_HTH_0_CTRL_0,
+        .ControllerId = CAN_CONTROLLER_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .FdFlag = FALSE,
+        .MaxLength = 8u,
+        .TriggerTransmit = CanIf_Test_TriggerTransmit,
+        .TxConfirmation = NULL_PTR
+    }
+};
+/* clang-format on */
+
+/**
+ * @brief Receive PDUs configuration, indexed by RxPduId.
+ */
+/* clang-format off */
+static const CanIf_RxPduCfgType CanIfRxPduCfgs[ CANIF_NUMBER_OF_RX_PDUS ] =
+{
+    {
+        .CanId = 0x300u,
+        .CanIdUpper = 0x300u,
+        .Hrh = CAN_HRH_0_CTRL_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .CanIdRange = FALSE,
+        .ReadData = TRUE,
+        .DataLength = 0u,
+        .RxIndication = CanIf_Test_RxIndication
+    },
+    {
+        .CanId = 0x18DAF1F1u,
+        .CanIdUpper = 0x18DAF1F1u,
+        .Hrh = CAN_HRH_0_CTRL_0,
+        .CanIdType = CANIF_CANID_EXTENDED,
+        .CanIdRange = FALSE,
+        .ReadData = TRUE,
+        .DataLength = 0u,
+        .RxIndication = CanIf_Test_RxIndication
+    },
+    {
+        .CanId = 0x120u,
+        .CanIdUpper = 0x120u,
+        .Hrh = CAN_HRH_0_CTRL_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .CanIdRange = FALSE,
+        .ReadData = FALSE,
+        .DataLength = 0u,
+        .RxIndication = CanIf_Test_RxIndication
+    },
+    {
+        .CanId = 0x7E0u,
+        .CanIdUpper = 0x7EFu,
+        .Hrh = CAN_HRH_0_CTRL_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .CanIdRange = TRUE,
+        .ReadData = TRUE,
+        .DataLength = 0u,
+        .RxIndication = CanIf_Test_RxIndication
+    },
+    {
+        .CanId = 0x400u,
+        .CanIdUpper = 0x400u,
+        .Hrh = CAN_HRH_0_CTRL_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .CanIdRange = FALSE,
+        .ReadData = TRUE,
+        .DataLength = 0u,
+        .RxIndication = NULL_PTR
+    },
+    {
+        .CanId = 0x500u,
+        .CanIdUpper = 0x500u,
+        .Hrh = CAN_HRH_0_CTRL_0,
+        .CanIdType = CANIF_CANID_STANDARD,
+        .CanIdRange = FALSE,
+        .ReadData = FALSE,
+        .DataLength = 4u,
+        .RxIndication = CanIf_Test_RxIndication
+    }
+};
+/* clang-format on */
+
+/**
+ * @brief Transmit buffers configuration.
+ */
+/* clang-format off */
+static const CanIf_BufferCfgType CanIfBufferCfgs[ CANIF_NUMBER_OF_TX_BUFFERS ] =
+{
+    {
+        .Hth = CAN_HTH_0_CTRL_0,
+        .ControllerId = CAN_CONTROLLER_0,
+        .Size = 2u
+    },
+    {
+        .Hth = CAN_HTH_0_CTRL_1,
+        .ControllerId = CAN_CONTROLLER_1,
+        .Size = 1u
+    }
+};
+/* clang-format on */
+
 /**
  * @brief Can driver configuration.
  */
@@ -19,8 +176,12 @@
 const CanIf_ConfigType CanIfConfig =
 {
     .CtrlCfgs = NULL_PTR,
+    .TxPduCfgs = CanIfTxPduCfgs,
+    .RxPduCfgs = CanIfRxPduCfgs,
+    .BufferCfgs = CanIfBufferCfgs,
     .NumberOfCanControllers = 2,
-    .MaxRxPduCfg = CANIF_NUMBER_OF_TX_PDUS,
-    .MaxTxPduCfg = CANIF_NUMBER_OF_RX_PDUS    
+    .MaxRxPduCfg = CANIF_NUMBER_OF_RX_PDUS,
+    .MaxTxPduCfg = CANIF_NUMBER_OF_TX_PDUS,
+    .NumberOfBuffers = CANIF_NUMBER_OF_TX_BUFFERS
 };
 /* clang-format off */
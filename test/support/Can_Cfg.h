@@ -175,8 +175,59 @@
  */
 #define CAN_VERSION_INFO_API                STD_ON
 
+/**
+ * @brief Specifies if Can_Write accepts PDUs without sdu, the payload is then requested with
+ * CanIf_TriggerTransmit and written straight into the Tx buffer element.
+ * @typedef EcucBooleanParamDef
+ */
+#define CAN_TRIGGER_TRANSMIT_ENABLE         STD_ON
+
+/**
+ * @brief Specifies if the runtime statistics and the Can_GetStatistics API shall be supported.
+ * @typedef EcucBooleanParamDef
+ */
+#define CAN_STATISTICS_API                  STD_ON
+
+/**
+ * @brief Free running counter used to measure the execution times, the tests use a software
+ * counter that advances a fixed step on every read.
+ */
+#define CAN_STATISTICS_CYCLE_COUNTER( )     Can_TestCycleCounter( )
+
+/**
+ * @brief Mask with the width of the free running counter, used to handle its wrap around.
+ */
+#define CAN_STATISTICS_COUNTER_MASK         0xFFFFFFFFu
+
+/**
+ * @brief Specifies if the bus load and error rate monitor and the Can_GetBusMonitor API shall be
+ * supported, Can_MainFunction_BusMonitor shall then be called cyclically.
+ * @typedef EcucBooleanParamDef
+ */
+#define CAN_BUS_MONITOR_API                 STD_ON
+
+/**
+ * @brief Can_MainFunction_BusMonitor cycles each monitor window lasts, the bus time is read from the
+ * 16 bits FDCAN timestamp counter so the main function period shall be shorter than 65536 bit times.
+ */
+#define CAN_BUS_MONITOR_WINDOW              2u
+
+/**
+ * @brief Smoothing of the average bus load, each new window weights 1 / 2^CAN_BUS_MONITOR_SMOOTHING.
+ */
+#define CAN_BUS_MONITOR_SMOOTHING           1u
+
+/**
+ * @brief Specifies the configuration variant, the tests pass the configuration to each call.
+ * @typedef EcucEnumerationParamDef
+ */
+#define CAN_CONFIGURATION_VARIANT           CAN_VARIANT_POST_BUILD
+
 extern const Can_ConfigType CanConfig;
 extern const Can_ConfigType ArchCanConfig;
 extern const Can_ConfigType ArchCanInitConfig;
+extern uint32 CanTestCycleStep;
+
+uint32 Can_TestCycleCounter( void );
 
 #endif /* CAN_CFG_H__ */
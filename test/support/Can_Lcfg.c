@@ -66,32 +66,20 @@ const Can_ConfigType CanConfig =
 const Can_ControllerBaudrateConfig ArchBaudrates[ CANARCH_NUMBER_OF_BAUDRATES ] =
 {
     {
-        .BaudRateConfigID = CANARCH_BAUDRATE_100k_CLASSIC,
-        .Seg1             = 13,
-        .Seg2             = 2,
-        .SyncJumpWidth    = 1,
-        .Prescaler        = 4,
-        .FdTxBitRateSwitch = STD_OFF,
+        .BaudRateConfigID  = CANARCH_BAUDRATE_100k_CLASSIC,
+        .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 4u ),
+        .FdTxBitRateSwitch = STD_OFF
     },
     {
-        .BaudRateConfigID = CANARCH_BAUDRATE_100k_FD,
-        .Seg1             = 13,
-        .Seg2             = 2,
-        .SyncJumpWidth    = 1,
-        .Prescaler        = 4,
-        .FdSeg1         = 13,
-        .FdSeg2         = 2,
-        .FdSyncJumpWidth = 1,
-        .FdPrescaler     = 4,
-        .FdTxBitRateSwitch = STD_ON,
+        .BaudRateConfigID  = CANARCH_BAUDRATE_100k_FD,
+        .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 4u ),
+        .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 4u ),
+        .FdTxBitRateSwitch = STD_ON
     },
     {
-        .BaudRateConfigID = CANARCH_BAUDRATE_500k_CLASSIC,
-        .Seg1             = 15,
-        .Seg2             = 4,
-        .SyncJumpWidth    = 2,
-        .Prescaler        = 10,
-        .FdTxBitRateSwitch = STD_OFF,
+        .BaudRateConfigID  = CANARCH_BAUDRATE_500k_CLASSIC,
+        .Nbtp              = CAN_NBTP_VALUE( 15u, 4u, 2u, 10u ),
+        .FdTxBitRateSwitch = STD_OFF
     }
 
 };
@@ -285,4 +273,19 @@ const Can_ConfigType ArchCanConfig =
     .Hohs         = ArchHohs,
     .HohsCount = CANARCH_NUMBER_OF_HOHS 
 };
-/* clang-format on */
\ No newline at end of file
+/* clang-format on */
+/**
+ * @brief Step the test cycle counter advances on every read.
+ */
+uint32 CanTestCycleStep = 10u;
+
+/**
+ * @brief Software free running counter used to measure the driver execution times.
+ */
+uint32 Can_TestCycleCounter( void )
+{
+    static uint32 Counter = 0u;
+
+    Counter += CanTestCycleStep;
+    return Counter;
+}
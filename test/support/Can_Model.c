@@ -0,0 +1,1057 @@
+/**
+ * @file    Can_Model.c
+ * @brief   **FDCAN behavioural model**
+ * @author  Diego Perez
+ *
+ * Host side model of the STM32G0 FDCAN peripheral, frames from other nodes are taken from a trace
+ * and frames from the driver are taken from the Tx FIFO/queue, both go through the same bus with
+ * arbitration and a frame time calculated from the configured bit rates. Received frames pass the
+ * acceptance filters written by the driver into message RAM and are stored into the Rx FIFOs,
+ * transmitted frames generate Tx events, and every event raises its interrupt flag in IR register.
+ * Register bit positions are taken from the reference manual, not from the driver.
+ */
+#define _POSIX_C_SOURCE 199309L /* clock_gettime */
+
+#include <time.h>
+#include "Can_Model.h"
+
+/**
+ * @defgroup CAN_Model_IR IR register bits
+ *
+ * @{ */
+#define MODEL_IR_RF0N        0u  /*!< Rx FIFO 0 new message */
+#define MODEL_IR_RF0F        1u  /*!< Rx FIFO 0 full */
+#define MODEL_IR_RF0L        2u  /*!< Rx FIFO 0 message lost */
+#define MODEL_IR_RF1N        3u  /*!< Rx FIFO 1 new message */
+#define MODEL_IR_RF1F        4u  /*!< Rx FIFO 1 full */
+#define MODEL_IR_RF1L        5u  /*!< Rx FIFO 1 message lost */
+#define MODEL_IR_TC          7u  /*!< Transmission completed */
+#define MODEL_IR_TCF         8u  /*!< Transmission cancellation finished */
+#define MODEL_IR_TFE         9u  /*!< Tx FIFO empty */
+#define MODEL_IR_TEFN        10u /*!< Tx event FIFO new entry */
+#define MODEL_IR_TEFF        11u /*!< Tx event FIFO full */
+#define MODEL_IR_TEFL        12u /*!< Tx event FIFO element lost */
+#define MODEL_IR_PED         22u /*!< Protocol error in data phase */
+/**
+ * @} */
+
+/**
+ * @defgroup CAN_Model_Regs Status and configuration register bits
+ *
+ * @{ */
+#define MODEL_CCCR_INIT      0u  /*!< Initialization */
+#define MODEL_CCCR_MON       5u  /*!< Bus monitoring mode, internal loop back along with TEST.LBCK */
+#define MODEL_CCCR_DAR       6u  /*!< Disable automatic retransmission */
+#define MODEL_CCCR_TEST      7u  /*!< Test mode enable */
+#define MODEL_DBTP_DTSEG2    4u  /*!< Data time segment 2 */
+#define MODEL_DBTP_DTSEG1    8u  /*!< Data time segment 1 */
+#define MODEL_DBTP_DBRP      16u /*!< Data bit rate prescaler */
+#define MODEL_DBTP_TDC       23u /*!< Transmitter delay compensation */
+#define MODEL_TDCR_TDCO      8u  /*!< Transmitter delay compensation offset */
+#define MODEL_PSR_DLEC       8u  /*!< Data phase last error code */
+#define MODEL_LEC_BIT1       4u  /*!< Bit1 error, the transmitter did not see its recessive bit */
+#define MODEL_TEST_LBCK      4u  /*!< Loop back mode */
+#define MODEL_TXBC_TFQM      24u /*!< Tx queue mode */
+#define MODEL_RXGFC_ANFE     2u  /*!< Accept non-matching frames extended */
+#define MODEL_RXGFC_ANFS     4u  /*!< Accept non-matching frames standard */
+#define MODEL_RXGFC_F1OM     8u  /*!< Rx FIFO 1 overwrite mode */
+#define MODEL_RXGFC_F0OM     9u  /*!< Rx FIFO 0 overwrite mode */
+#define MODEL_RXGFC_LSS      16u /*!< List size standard */
+#define MODEL_RXGFC_LSE      24u /*!< List size extended */
+#define MODEL_FIFO_GI        8u  /*!< Get index, Rx FIFOs, Tx FIFO and Tx event FIFO */
+#define MODEL_FIFO_PI        16u /*!< Put index, Rx FIFOs, Tx FIFO and Tx event FIFO */
+#define MODEL_FIFO_FULL      24u /*!< Full flag, Rx FIFOs and Tx event FIFO */
+#define MODEL_FIFO_LOST      25u /*!< Message lost flag, Rx FIFOs and Tx event FIFO */
+#define MODEL_TXFQS_TFQF     21u /*!< Tx FIFO/queue full */
+/**
+ * @} */
+
+/**
+ * @defgroup CAN_Model_Elements Message RAM element bits
+ *
+ * @{ */
+#define MODEL_ELEMENT_WORDS  18u /*!< Words per Rx FIFO and Tx buffer element */
+#define MODEL_ELEMENTS       3u  /*!< Elements per Rx FIFO, Tx FIFO and Tx event FIFO */
+#define MODEL_XTD_BIT        30u /*!< Extended identifier */
+#define MODEL_STD_ID_BIT     18u /*!< Standard identifier position */
+#define MODEL_FIDX_BIT       24u /*!< Filter index */
+#define MODEL_ANMF_BIT       31u /*!< Accepted non-matching frame */
+#define MODEL_MM_BIT         24u /*!< Message marker */
+#define MODEL_EFC_BIT        23u /*!< Store Tx events */
+#define MODEL_ET_TX          ( 1u << 22u ) /*!< Event type, Tx event */
+#define MODEL_FDF_BIT        21u /*!< FD format */
+#define MODEL_BRS_BIT        20u /*!< Bit rate switch */
+#define MODEL_DLC_BIT        16u /*!< Data length code */
+#define MODEL_STD_ID_MASK    0x7FFu      /*!< Standard identifier */
+#define MODEL_EXT_ID_MASK    0x1FFFFFFFu /*!< Extended identifier */
+#define MODEL_FILTER_RANGE   0u /*!< Range filter */
+#define MODEL_FILTER_DUAL    1u /*!< Dual ID filter */
+#define MODEL_FILTER_CLASSIC 2u /*!< Classic filter */
+#define MODEL_EC_FIFO0       1u /*!< Store into Rx FIFO 0 */
+#define MODEL_EC_FIFO1       2u /*!< Store into Rx FIFO 1 */
+#define MODEL_NO_FIFO        0xFFu /*!< Frame rejected */
+/**
+ * @} */
+
+/**
+ * @brief   Data bytes indexed by DLC
+ */
+static const uint8 ModelDlcToBytes[ 16u ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+
+static uint8 Can_Model_LengthToDlc( uint8 Length );
+static uint32 Can_Model_Field( uint32 Reg, uint8 Bit, uint32 Mask );
+static uint8 Can_Model_Filter( const Can_Model *Model, uint32 Id, uint8 *FilterIndex );
+static void Can_Model_Receive( Can_Model *Model, uint32 Id, uint8 Length, const uint8 *Data, boolean Brs );
+static void Can_Model_Transmit( Can_Model *Model, uint8 Buffer );
+static void Can_Model_TxRemove( Can_Model *Model, uint8 Buffer );
+static void Can_Model_TxError( Can_Model *Model, uint8 Buffer );
+static void Can_Model_TxCancel( Can_Model *Model, uint8 Buffer );
+static boolean Can_Model_DataPhaseError( const Can_Model *Model, boolean Brs );
+static boolean Can_Model_NextTx( const Can_Model *Model, uint8 *Buffer );
+static uint32 Can_Model_TxId( const Can_Model *Model, uint8 Buffer );
+static uint32 Can_Model_Arbitration( uint32 Id );
+static void Can_Model_Raise( Can_Model *Model, uint32 Flags );
+static void Can_Model_Publish( Can_Model *Model );
+static void Can_Model_CallIsr( Can_Model *Model );
+
+/**
+ * @brief    **Model initialization**
+ *
+ * Reset the model state and the status registers it owns, configuration registers and message
+ * RAM are left untouched, they belong to the driver.
+ *
+ * @param    Model Model to initialize
+ * @param    Can Peripheral registers the driver uses
+ * @param    SramCan Peripheral message RAM the driver uses
+ * @param    NominalBitrate Nominal bit rate in bits per second
+ * @param    DataBitrate Data bit rate in bits per second, zero to send FD frames at nominal rate
+ */
+void Can_Model_Init( Can_Model *Model, Can_RegisterType *Can, SramCan_RegisterType *SramCan, uint32 NominalBitrate, uint32 DataBitrate )
+{
+    static const Can_Model ModelReset = { 0 };
+
+    *Model                = ModelReset;
+    Model->Can            = Can;
+    Model->SramCan        = SramCan;
+    Model->NominalBitrate = NominalBitrate;
+    Model->DataBitrate    = DataBitrate;
+
+    Can->IR    = 0u;
+    Can->TXBAR = 0u;
+    Can->TXBCR = 0u;
+    Can->TXBTO = 0u;
+    Can->TXBCF = 0u;
+    Can_Model_Publish( Model );
+}
+
+/**
+ * @brief    **Set the frames to inject**
+ *
+ * @param    Model Model to use
+ * @param    Trace Frames sorted by time, the array shall live while the model runs
+ * @param    Count Number of frames into the trace
+ */
+void Can_Model_SetTrace( Can_Model *Model, const Can_ModelFrame *Trace, uint32 Count )
+{
+    Model->Trace      = Trace;
+    Model->TraceCount = Count;
+    Model->TraceIndex = 0u;
+}
+
+/**
+ * @brief    **Apply the driver register writes**
+ *
+ * Take the Tx requests written into TXBAR and the cancellations written into TXBCR since the last
+ * call and refresh the status registers, shall be called after any driver call that could write
+ * the registers, Can_Model_Run does it on its own after each interrupt routine. A cancellation of
+ * the frame on the bus waits for the end of the frame.
+ *
+ * @param    Model Model to use
+ */
+void Can_Model_Sync( Can_Model *Model )
+{
+    uint32 Requests;
+    uint8 Put;
+
+    /* Cancellations go first, a request can only be written into a buffer already free */
+    for( uint8 Buffer = 0u; Buffer < MODEL_ELEMENTS; Buffer++ )
+    {
+        uint8 Mask = (uint8)( 1u << Buffer );
+
+        if( ( Model->Can->TXBCR & Mask ) == 0u )
+        {
+            /* Nothing to cancel */
+        }
+        else if( ( Model->TxPending & Mask ) == 0u )
+        {
+            /* Nothing pending, the cancellation finishes right away */
+            Model->Can->TXBCF |= Mask;
+            Model->Can->TXBCR &= ~(uint32)Mask;
+        }
+        else if( ( Model->TxSending & Mask ) == 0u )
+        {
+            Can_Model_TxRemove( Model, Buffer );
+            Can_Model_TxCancel( Model, Buffer );
+        }
+        else
+        {
+            /* On the bus, the cancellation waits for the end of the frame */
+        }
+    }
+
+    Requests = Model->Can->TXBAR & ~(uint32)Model->TxPending;
+    Put      = (uint8)Can_Model_Field( Model->Can->TXFQS, MODEL_FIFO_PI, 0x3u );
+
+    /* Requests are queued in the order the put index gave the buffers away */
+    for( uint8 Buffer = 0u; Buffer < MODEL_ELEMENTS; Buffer++ )
+    {
+        uint8 Index = ( Put + Buffer ) % MODEL_ELEMENTS;
+
+        if( ( Requests & ( 1u << Index ) ) != 0u )
+        {
+            Model->TxOrder[ Model->TxCount ] = Index;
+            Model->TxCount++;
+            Model->TxPending |= (uint8)( 1u << Index );
+            /* A new request clears the result of the previous one */
+            Model->Can->TXBTO &= ~( 1u << Index );
+            Model->Can->TXBCF &= ~( 1u << Index );
+        }
+    }
+
+    Model->Can->TXBAR = 0u;
+    Can_Model_Publish( Model );
+}
+
+/**
+ * @brief    **Run the bus**
+ *
+ * Advance the simulated time, frames are sent one after the other as soon as the bus is free,
+ * a frame started before the end is completed even if it takes the time a bit further,
+ * the ones from the trace once their time arrived and the ones in the Tx FIFO/queue right away,
+ * when both are ready the lowest identifier wins the arbitration. The driver interrupt routine
+ * is called the configured latency after an enabled interrupt flag is raised, frames keep
+ * arriving while the interrupt is waiting to be served.
+ *
+ * @param    Model Model to use
+ * @param    Duration Simulated time to run, in nanoseconds
+ */
+void Can_Model_Run( Can_Model *Model, uint64 Duration )
+{
+    uint64 End                  = Model->Time + Duration;
+    boolean InFlight            = FALSE;
+    boolean FrameIsTx           = FALSE;
+    boolean TxError             = FALSE;
+    uint64 FrameEnd             = 0u;
+    uint8 TxBuffer              = 0u;
+    const Can_ModelFrame *Frame = NULL_PTR;
+
+    for( ;; )
+    {
+        /* Nothing goes out or comes in while the controller is in initialization */
+        boolean Online = ( ( Model->Can->CCCR & ( 1u << MODEL_CCCR_INIT ) ) == 0u );
+
+        if( InFlight == FALSE )
+        {
+            const Can_ModelFrame *Next = ( Model->TraceIndex < Model->TraceCount ) ? &Model->Trace[ Model->TraceIndex ] : NULL_PTR;
+            boolean TxReady            = ( Online == TRUE ) && ( Can_Model_NextTx( Model, &TxBuffer ) == TRUE );
+            uint64 Start               = End;
+
+            if( TxReady == TRUE )
+            {
+                Start = Model->Time;
+            }
+            else if( Next != NULL_PTR )
+            {
+                Start = ( (uint64)Next->Time * 1000u > Model->Time ) ? ( (uint64)Next->Time * 1000u ) : Model->Time;
+            }
+
+            /* A frame starts only if nothing else happens before */
+            if( ( Start < End ) && ( ( Model->IsrPending == FALSE ) || ( Start <= Model->IsrDue ) ) )
+            {
+                boolean TraceReady = ( Next != NULL_PTR ) && ( ( (uint64)Next->Time * 1000u ) <= Start );
+
+                FrameIsTx = ( TxReady == TRUE ) &&
+                            ( ( TraceReady == FALSE ) || ( Can_Model_Arbitration( Can_Model_TxId( Model, TxBuffer ) ) <= Can_Model_Arbitration( Next->Id ) ) );
+
+                if( FrameIsTx == TRUE )
+                {
+                    const uint32 *Element = (const uint32 *)&Model->SramCan->TBSA[ TxBuffer * MODEL_ELEMENT_WORDS ];
+                    uint8 Dlc             = (uint8)Can_Model_Field( Element[ 1u ], MODEL_DLC_BIT, 0xFu );
+                    boolean Brs           = (boolean)Can_Model_Field( Element[ 1u ], MODEL_BRS_BIT, 1u );
+
+                    FrameEnd = Start + Can_Model_FrameTime( Model, Can_Model_TxId( Model, TxBuffer ), ModelDlcToBytes[ Dlc ], Brs );
+                    TxError  = Can_Model_DataPhaseError( Model, Brs );
+                }
+                else
+                {
+                    Frame = Next;
+                    Model->TraceIndex++;
+                    FrameEnd = Start + Can_Model_FrameTime( Model, Frame->Id, Frame->Length, TRUE );
+                }
+
+                Model->Counters.BusTime += FrameEnd - Start;
+                Model->Time      = Start;
+                Model->TxSending = ( FrameIsTx == TRUE ) ? (uint8)( 1u << TxBuffer ) : 0u;
+                InFlight         = TRUE;
+            }
+        }
+
+        if( ( InFlight == TRUE ) && ( ( Model->IsrPending == FALSE ) || ( FrameEnd <= Model->IsrDue ) ) )
+        {
+            /* The frame is complete */
+            Model->Time      = FrameEnd;
+            Model->TxSending = 0u;
+            InFlight         = FALSE;
+
+            if( ( FrameIsTx == TRUE ) && ( TxError == TRUE ) )
+            {
+                Can_Model_TxError( Model, TxBuffer );
+            }
+            else if( FrameIsTx == TRUE )
+            {
+                Can_Model_Transmit( Model, TxBuffer );
+            }
+            else if( Online == TRUE )
+            {
+                Can_Model_Receive( Model, Frame->Id, Frame->Length, Frame->Data, TRUE );
+            }
+            else
+            {
+                /* Frame on the bus nobody here listens to */
+            }
+        }
+        else if( ( Model->IsrPending == TRUE ) && ( ( InFlight == TRUE ) || ( Model->IsrDue <= End ) ) )
+        {
+            Model->Time = Model->IsrDue;
+            Can_Model_CallIsr( Model );
+        }
+        else
+        {
+            /* Nothing else happens before the end, a frame started before is always completed */
+            Model->Time = ( Model->Time > End ) ? Model->Time : End;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief    **Driver read an Rx FIFO element**
+ *
+ * Shall be called from CanIf_RxIndication, the payload pointer tells the Rx FIFO the driver is
+ * reading, the oldest element of that FIFO is released the same as the hardware does when the
+ * driver writes RXFnA right after the indication, so the fill level the driver reads next is
+ * already updated.
+ *
+ * @param    Model Model to use
+ * @param    PduInfoPtr Pdu passed to CanIf_RxIndication
+ */
+void Can_Model_RxIndication( Can_Model *Model, const PduInfoType *PduInfoPtr )
+{
+    const volatile uint32 *Data = (const volatile uint32 *)PduInfoPtr->SduDataPtr;
+    uint8 Fifo                  = ( ( Data >= Model->SramCan->F1SA ) && ( Data < &Model->SramCan->F1SA[ 54u ] ) ) ? 1u : 0u;
+
+    Can_Model_RxAcknowledge( Model, Fifo );
+}
+
+/**
+ * @brief    **Driver acknowledged an Rx FIFO element**
+ *
+ * Shall be called right after the driver writes RXFnA outside of an indication, like when the
+ * payload indicated does not point into message RAM. The oldest element of the FIFO is released.
+ * For an element held by the upper layer it shall be called right before Can_Arch_ReleaseRxMessage,
+ * the driver reads the fill level again after the acknowledge to indicate the elements pending.
+ *
+ * @param    Model Model to use
+ * @param    Fifo Rx FIFO acknowledged, 0 or 1
+ */
+void Can_Model_RxAcknowledge( Can_Model *Model, uint8 Fifo )
+{
+    if( Model->RxFill[ Fifo ] > 0u )
+    {
+        Model->RxGet[ Fifo ] = ( Model->RxGet[ Fifo ] + 1u ) % MODEL_ELEMENTS;
+        Model->RxFill[ Fifo ]--;
+        Model->Counters.RxRead++;
+    }
+
+    Can_Model_Publish( Model );
+}
+
+/**
+ * @brief    **Driver read a Tx event**
+ *
+ * Shall be called from CanIf_TxConfirmation, the oldest Tx event is released. The driver reads
+ * the fill level right after it writes TXEFA and before the confirmation, that is why TXEFS fill
+ * level is published already decremented by the element the driver is about to read.
+ *
+ * @param    Model Model to use
+ */
+void Can_Model_TxConfirmation( Can_Model *Model )
+{
+    if( Model->TefFill > 0u )
+    {
+        Model->TefGet = ( Model->TefGet + 1u ) % MODEL_ELEMENTS;
+        Model->TefFill--;
+        Model->Counters.TxEvents++;
+    }
+
+    Can_Model_Publish( Model );
+}
+
+/**
+ * @brief    **Frame time**
+ *
+ * Calculate the time a frame takes on the bus including the interframe space, the arbitration and
+ * the acknowledge fields go at nominal rate and the data phase of FD frames at data rate when the
+ * bit rate is switched.
+ *
+ * @param    Model Model to use
+ * @param    Id CAN id plus @ref CAN_Model_Id bits
+ * @param    Length Payload length in bytes
+ * @param    Brs FD frame sent with bit rate switch
+ *
+ * @retval  Frame time in nanoseconds
+ */
+uint64 Can_Model_FrameTime( const Can_Model *Model, uint32 Id, uint8 Length, boolean Brs )
+{
+    boolean Extended = ( ( Id & CAN_MODEL_ID_EXTENDED ) != 0u );
+    uint32 Bytes     = ModelDlcToBytes[ Can_Model_LengthToDlc( Length ) ];
+    uint32 Nominal;
+    uint32 Data = 0u;
+    uint64 Time;
+
+    if( ( Id & CAN_MODEL_ID_FD ) == 0u )
+    {
+        /* SOF to CRC delimiter, ACK, EOF and interframe space */
+        Nominal = ( ( Extended == TRUE ) ? 67u : 47u ) + ( 8u * Bytes );
+
+        if( Model->StuffBits == TRUE )
+        {
+            Nominal += ( ( ( Extended == TRUE ) ? 54u : 34u ) + ( 8u * Bytes ) - 1u ) / 4u;
+        }
+    }
+    else
+    {
+        uint32 Crc = ( Bytes > 16u ) ? 21u : 17u;
+
+        /* SOF up to BRS, then CRC delimiter, ACK, EOF and interframe space */
+        Nominal = ( ( Extended == TRUE ) ? 36u : 17u ) + 12u;
+        /* ESI, DLC, payload, stuff count, CRC with its fixed stuff bits and CRC delimiter */
+        Data = 5u + ( 8u * Bytes ) + 4u + Crc + ( ( ( 4u + Crc ) / 4u ) + 1u ) + 1u;
+
+        if( Model->StuffBits == TRUE )
+        {
+            Nominal += ( ( Extended == TRUE ) ? 36u : 17u ) / 4u;
+            Data += ( 5u + ( 8u * Bytes ) ) / 4u;
+        }
+
+        if( ( Brs == FALSE ) || ( Model->DataBitrate == 0u ) )
+        {
+            Nominal += Data;
+            Data = 0u;
+        }
+    }
+
+    Time = ( (uint64)Nominal * 1000000000u ) / Model->NominalBitrate;
+
+    if( Data > 0u )
+    {
+        Time += ( (uint64)Data * 1000000000u ) / Model->DataBitrate;
+    }
+
+    return Time;
+}
+
+/**
+ * @brief    **Host time**
+ *
+ * Monotonic host clock used to measure how long the driver routines take to run on the host.
+ *
+ * @retval  Host time in nanoseconds
+ */
+uint64 Can_Model_HostTime( void )
+{
+    struct timespec Now;
+
+    (void)clock_gettime( CLOCK_MONOTONIC, &Now );
+
+    return ( (uint64)Now.tv_sec * 1000000000u ) + (uint64)Now.tv_nsec;
+}
+
+/**
+ * @brief    **Length to DLC**
+ *
+ * @param    Length Payload length in bytes
+ *
+ * @retval  Smallest DLC able to hold the payload
+ */
+static uint8 Can_Model_LengthToDlc( uint8 Length )
+{
+    uint8 Dlc = 0u;
+
+    while( ( Dlc < 15u ) && ( ModelDlcToBytes[ Dlc ] < Length ) )
+    {
+        Dlc++;
+    }
+
+    return Dlc;
+}
+
+/**
+ * @brief    **Read a register field**
+ *
+ * @param    Reg Register value
+ * @param    Bit Field position
+ * @param    Mask Field mask once shifted to bit zero
+ *
+ * @retval  Field value
+ */
+static uint32 Can_Model_Field( uint32 Reg, uint8 Bit, uint32 Mask )
+{
+    return ( Reg >> Bit ) & Mask;
+}
+
+/**
+ * @brief    **Acceptance filtering**
+ *
+ * Go through the standard or extended filter list written by the driver, the first element
+ * matching decides, frames not matching any element follow the global filter configuration.
+ *
+ * @param    Model Model to use
+ * @param    Id CAN id plus @ref CAN_Model_Id bits
+ * @param    FilterIndex Filter element matched, 0xFF for non-matching frames
+ *
+ * @retval  Rx FIFO where to store the frame or MODEL_NO_FIFO when rejected
+ */
+static uint8 Can_Model_Filter( const Can_Model *Model, uint32 Id, uint8 *FilterIndex )
+{
+    uint32 Rxgfc     = Model->Can->RXGFC;
+    boolean Extended = ( ( Id & CAN_MODEL_ID_EXTENDED ) != 0u );
+    uint32 Count     = ( Extended == TRUE ) ? Can_Model_Field( Rxgfc, MODEL_RXGFC_LSE, 0xFu ) : Can_Model_Field( Rxgfc, MODEL_RXGFC_LSS, 0x1Fu );
+    uint8 Fifo       = MODEL_NO_FIFO;
+    boolean Match    = FALSE;
+
+    for( uint8 Index = 0u; ( Index < Count ) && ( Match == FALSE ); Index++ )
+    {
+        uint32 Type;
+        uint32 Config;
+        uint32 Id1;
+        uint32 Id2;
+        uint32 FrameId;
+
+        if( Extended == TRUE )
+        {
+            uint32 Word1 = Model->SramCan->FLESA[ Index * 2u ];
+            uint32 Word2 = Model->SramCan->FLESA[ ( Index * 2u ) + 1u ];
+
+            Type    = Can_Model_Field( Word2, 30u, 0x3u );
+            Config  = Can_Model_Field( Word1, 29u, 0x7u );
+            Id1     = Word1 & MODEL_EXT_ID_MASK;
+            Id2     = Word2 & MODEL_EXT_ID_MASK;
+            FrameId = Id & MODEL_EXT_ID_MASK;
+        }
+        else
+        {
+            uint32 Word = Model->SramCan->FLSSA[ Index ];
+
+            Type    = Can_Model_Field( Word, 30u, 0x3u );
+            Config  = Can_Model_Field( Word, 27u, 0x7u );
+            Id1     = Can_Model_Field( Word, 16u, MODEL_STD_ID_MASK );
+            Id2     = Word & MODEL_STD_ID_MASK;
+            FrameId = Id & MODEL_STD_ID_MASK;
+        }
+
+        if( Config != 0u )
+        {
+            if( Type == MODEL_FILTER_RANGE )
+            {
+                Match = ( FrameId >= Id1 ) && ( FrameId <= Id2 );
+            }
+            else if( Type == MODEL_FILTER_DUAL )
+            {
+                Match = ( FrameId == Id1 ) || ( FrameId == Id2 );
+            }
+            else if( Type == MODEL_FILTER_CLASSIC )
+            {
+                Match = ( ( FrameId & Id2 ) == ( Id1 & Id2 ) );
+            }
+            else
+            {
+                /* Filter element disabled */
+            }
+        }
+
+        if( Match == TRUE )
+        {
+            /* The priority flag does not change where the frame is stored */
+            Config &= 0x3u;
+            Fifo         = ( Config == MODEL_EC_FIFO0 ) ? 0u : ( ( Config == MODEL_EC_FIFO1 ) ? 1u : MODEL_NO_FIFO );
+            *FilterIndex = Index;
+        }
+    }
+
+    if( Match == FALSE )
+    {
+        uint32 Anf = ( Extended == TRUE ) ? Can_Model_Field( Rxgfc, MODEL_RXGFC_ANFE, 0x3u ) : Can_Model_Field( Rxgfc, MODEL_RXGFC_ANFS, 0x3u );
+
+        Fifo         = ( Anf < 2u ) ? (uint8)Anf : MODEL_NO_FIFO;
+        *FilterIndex = 0xFFu;
+    }
+
+    return Fifo;
+}
+
+/**
+ * @brief    **Frame received**
+ *
+ * Filter the frame and store it into its Rx FIFO, in blocking mode a full FIFO loses the new
+ * frame, in overwrite mode the oldest element is replaced.
+ *
+ * @param    Model Model to use
+ * @param    Id CAN id plus @ref CAN_Model_Id bits
+ * @param    Length Payload length in bytes
+ * @param    Data Payload, could be NULL
+ * @param    Brs FD frame sent with bit rate switch
+ */
+static void Can_Model_Receive( Can_Model *Model, uint32 Id, uint8 Length, const uint8 *Data, boolean Brs )
+{
+    uint8 FilterIndex = 0u;
+    uint8 Fifo        = Can_Model_Filter( Model, Id, &FilterIndex );
+
+    if( Fifo == MODEL_NO_FIFO )
+    {
+        Model->Counters.RxRejected++;
+    }
+    else
+    {
+        boolean Overwrite = ( Can_Model_Field( Model->Can->RXGFC, ( Fifo == 0u ) ? MODEL_RXGFC_F0OM : MODEL_RXGFC_F1OM, 1u ) == 1u );
+        uint8 Shift       = ( Fifo == 0u ) ? MODEL_IR_RF0N : MODEL_IR_RF1N;
+
+        if( ( Model->RxFill[ Fifo ] == MODEL_ELEMENTS ) && ( Overwrite == FALSE ) )
+        {
+            Model->Counters.RxLost++;
+            Can_Model_Raise( Model, 1u << ( Shift + 2u ) );
+        }
+        else
+        {
+            volatile uint32 *Fifos = ( Fifo == 0u ) ? Model->SramCan->F0SA : Model->SramCan->F1SA;
+            uint8 Put;
+            uint8 Dlc            = Can_Model_LengthToDlc( Length );
+            uint8 Payload[ 64u ] = { 0 };
+
+            if( Model->RxFill[ Fifo ] == MODEL_ELEMENTS )
+            {
+                /* Overwrite mode, the oldest element is gone */
+                Model->RxGet[ Fifo ] = ( Model->RxGet[ Fifo ] + 1u ) % MODEL_ELEMENTS;
+                Model->RxFill[ Fifo ]--;
+                Model->Counters.RxLost++;
+            }
+
+            Put = ( Model->RxGet[ Fifo ] + Model->RxFill[ Fifo ] ) % MODEL_ELEMENTS;
+            volatile uint32 *Element = &Fifos[ Put * MODEL_ELEMENT_WORDS ];
+
+            if( ( Id & CAN_MODEL_ID_EXTENDED ) != 0u )
+            {
+                Element[ 0u ] = ( 1u << MODEL_XTD_BIT ) | ( Id & MODEL_EXT_ID_MASK );
+            }
+            else
+            {
+                Element[ 0u ] = ( Id & MODEL_STD_ID_MASK ) << MODEL_STD_ID_BIT;
+            }
+
+            Element[ 1u ] = ( (uint32)Dlc << MODEL_DLC_BIT ) | ( ( FilterIndex == 0xFFu ) ? ( 1u << MODEL_ANMF_BIT ) : ( (uint32)FilterIndex << MODEL_FIDX_BIT ) );
+
+            if( ( Id & CAN_MODEL_ID_FD ) != 0u )
+            {
+                Element[ 1u ] |= ( 1u << MODEL_FDF_BIT ) | ( ( Brs == TRUE ) ? ( 1u << MODEL_BRS_BIT ) : 0u );
+            }
+
+            for( uint8 Byte = 0u; ( Data != NULL_PTR ) && ( Byte < Length ); Byte++ )
+            {
+                Payload[ Byte ] = Data[ Byte ];
+            }
+
+            for( uint8 Word = 0u; Word < ( ( ModelDlcToBytes[ Dlc ] + 3u ) / 4u ); Word++ )
+            {
+                Element[ 2u + Word ] = (uint32)Payload[ Word * 4u ] | ( (uint32)Payload[ ( Word * 4u ) + 1u ] << 8u ) |
+                                       ( (uint32)Payload[ ( Word * 4u ) + 2u ] << 16u ) | ( (uint32)Payload[ ( Word * 4u ) + 3u ] << 24u );
+            }
+
+            Model->RxFill[ Fifo ]++;
+            Model->Counters.RxFrames++;
+            Can_Model_Raise( Model, ( 1u << Shift ) | ( ( Model->RxFill[ Fifo ] == MODEL_ELEMENTS ) ? ( 1u << ( Shift + 1u ) ) : 0u ) );
+        }
+    }
+}
+
+/**
+ * @brief    **Frame transmitted**
+ *
+ * Release the Tx buffer, store its Tx event when requested by the element and in loop back mode
+ * receive the frame back.
+ *
+ * @param    Model Model to use
+ * @param    Buffer Tx buffer just sent
+ */
+static void Can_Model_Transmit( Can_Model *Model, uint8 Buffer )
+{
+    const volatile uint32 *Element = &Model->SramCan->TBSA[ Buffer * MODEL_ELEMENT_WORDS ];
+    uint32 Flags                   = 0u;
+
+    Can_Model_TxRemove( Model, Buffer );
+    Model->Can->TXBTO |= ( 1u << Buffer );
+    Model->Counters.TxFrames++;
+
+    if( ( Model->Can->TXBTIE & ( 1u << Buffer ) ) != 0u )
+    {
+        Flags |= ( 1u << MODEL_IR_TC );
+    }
+
+    if( Model->TxCount == 0u )
+    {
+        Flags |= ( 1u << MODEL_IR_TFE );
+    }
+
+    /* Cancelled while on the bus, the frame went out anyway but the cancellation finishes too */
+    if( ( Model->Can->TXBCR & ( 1u << Buffer ) ) != 0u )
+    {
+        Can_Model_TxCancel( Model, Buffer );
+    }
+
+    if( Can_Model_Field( Element[ 1u ], MODEL_EFC_BIT, 1u ) == 1u )
+    {
+        if( Model->TefFill == MODEL_ELEMENTS )
+        {
+            Model->Counters.TxEventLost++;
+            Flags |= ( 1u << MODEL_IR_TEFL );
+        }
+        else
+        {
+            uint8 Put = ( Model->TefGet + Model->TefFill ) % MODEL_ELEMENTS;
+
+            Model->SramCan->EFSA[ Put * 2u ]          = Element[ 0u ];
+            Model->SramCan->EFSA[ ( Put * 2u ) + 1u ] = ( Element[ 1u ] & ( ( 0xFFu << MODEL_MM_BIT ) | ( 3u << MODEL_BRS_BIT ) | ( 0xFu << MODEL_DLC_BIT ) ) ) | MODEL_ET_TX;
+            Model->TefFill++;
+            Flags |= ( 1u << MODEL_IR_TEFN ) | ( ( Model->TefFill == MODEL_ELEMENTS ) ? ( 1u << MODEL_IR_TEFF ) : 0u );
+        }
+    }
+
+    Can_Model_Raise( Model, Flags );
+
+    if( ( ( Model->Can->CCCR & ( 1u << MODEL_CCCR_TEST ) ) != 0u ) && ( ( Model->Can->TEST & ( 1u << MODEL_TEST_LBCK ) ) != 0u ) )
+    {
+        uint8 Bytes = ModelDlcToBytes[ Can_Model_Field( Element[ 1u ], MODEL_DLC_BIT, 0xFu ) ];
+        uint8 Data[ 64u ];
+
+        for( uint8 Byte = 0u; Byte < Bytes; Byte++ )
+        {
+            Data[ Byte ] = (uint8)( Element[ 2u + ( Byte / 4u ) ] >> ( ( Byte % 4u ) * 8u ) );
+        }
+
+        Can_Model_Receive( Model, Can_Model_TxId( Model, Buffer ), Bytes, Data, (boolean)Can_Model_Field( Element[ 1u ], MODEL_BRS_BIT, 1u ) );
+    }
+}
+
+/**
+ * @brief    **Remove a buffer from the pending ones**
+ *
+ * @param    Model Model to use
+ * @param    Buffer Tx buffer to remove, the order of the rest is kept
+ */
+static void Can_Model_TxRemove( Can_Model *Model, uint8 Buffer )
+{
+    uint8 Position = 0u;
+
+    while( Model->TxOrder[ Position ] != Buffer )
+    {
+        Position++;
+    }
+    for( ; ( Position + 1u ) < Model->TxCount; Position++ )
+    {
+        Model->TxOrder[ Position ] = Model->TxOrder[ Position + 1u ];
+    }
+    Model->TxCount--;
+    Model->TxPending &= (uint8)~( 1u << Buffer );
+}
+
+/**
+ * @brief    **Transmission failed in the data phase**
+ *
+ * The transmitter saw a bit error, the error is flagged into the protocol status and with the
+ * automatic retransmission disabled the request is dropped, otherwise it stays pending and goes
+ * again on the next arbitration unless its cancellation was requested meanwhile.
+ *
+ * @param    Model Model to use
+ * @param    Buffer Tx buffer being sent
+ */
+static void Can_Model_TxError( Can_Model *Model, uint8 Buffer )
+{
+    Model->Counters.TxErrors++;
+    Model->Can->PSR = ( Model->Can->PSR & ~( 7u << MODEL_PSR_DLEC ) ) | ( MODEL_LEC_BIT1 << MODEL_PSR_DLEC );
+
+    if( ( Model->Can->CCCR & ( 1u << MODEL_CCCR_DAR ) ) != 0u )
+    {
+        Can_Model_TxRemove( Model, Buffer );
+        Model->Can->TXBCF |= ( 1u << Buffer );
+    }
+    else if( ( Model->Can->TXBCR & ( 1u << Buffer ) ) != 0u )
+    {
+        /* The cancellation requested while on the bus takes place instead of the retransmission */
+        Can_Model_TxRemove( Model, Buffer );
+        Can_Model_TxCancel( Model, Buffer );
+    }
+    else
+    {
+        /* Stays pending for the next arbitration */
+    }
+
+    Can_Model_Raise( Model, 1u << MODEL_IR_PED );
+}
+
+/**
+ * @brief    **Transmission cancellation finished**
+ *
+ * Flag the cancellation of a buffer already removed from the pending ones, or just sent.
+ *
+ * @param    Model Model to use
+ * @param    Buffer Tx buffer cancelled
+ */
+static void Can_Model_TxCancel( Can_Model *Model, uint8 Buffer )
+{
+    Model->Can->TXBCF |= ( 1u << Buffer );
+    Model->Counters.TxCancelled++;
+
+    if( ( Model->Can->TXBCIE & ( 1u << Buffer ) ) != 0u )
+    {
+        Can_Model_Raise( Model, 1u << MODEL_IR_TCF );
+    }
+}
+
+/**
+ * @brief    **Check the data phase against the transceiver loop delay**
+ *
+ * The transmitter compares each bit it sends with the one it reads back. Without compensation it
+ * samples at the data sample point, so the bit has to come back from the transceiver before that.
+ * With DBTP.TDC set it samples at the secondary sample point, the measured loop delay plus the
+ * TDCR offset, which works at any delay as long as the offset falls within the bit. The FDCAN
+ * only compensates with a data prescaler of 1 or 2. Internal loop back does not go through the
+ * transceiver.
+ *
+ * @param    Model Model to use
+ * @param    Brs Frame sent with bit rate switch
+ *
+ * @retval  TRUE if the frame fails with a bit error
+ */
+static boolean Can_Model_DataPhaseError( const Can_Model *Model, boolean Brs )
+{
+    uint32 Internal = ( 1u << MODEL_CCCR_TEST ) | ( 1u << MODEL_CCCR_MON );
+    boolean Error   = FALSE;
+
+    if( ( Brs == TRUE ) && ( Model->DataBitrate > 0u ) && ( Model->LoopDelay > 0u ) && ( ( Model->Can->CCCR & Internal ) != Internal ) )
+    {
+        uint32 Dbtp      = Model->Can->DBTP;
+        uint32 Seg1      = Can_Model_Field( Dbtp, MODEL_DBTP_DTSEG1, 0x1Fu ) + 1u;
+        uint32 Quanta    = 1u + Seg1 + Can_Model_Field( Dbtp, MODEL_DBTP_DTSEG2, 0xFu ) + 1u;
+        uint32 Prescaler = Can_Model_Field( Dbtp, MODEL_DBTP_DBRP, 0x1Fu ) + 1u;
+        uint64 Bit       = 1000000000u / Model->DataBitrate;
+
+        if( ( Can_Model_Field( Dbtp, MODEL_DBTP_TDC, 1u ) == 1u ) && ( Prescaler <= 2u ) )
+        {
+            uint32 Offset = Can_Model_Field( Model->Can->TDCR, MODEL_TDCR_TDCO, 0x7Fu );
+
+            Error = ( Offset == 0u ) || ( Offset >= ( Quanta * Prescaler ) );
+        }
+        else
+        {
+            Error = ( Model->LoopDelay >= ( ( Bit * ( 1u + Seg1 ) ) / Quanta ) );
+        }
+    }
+
+    return Error;
+}
+
+/**
+ * @brief    **Next Tx buffer to send**
+ *
+ * In FIFO mode the oldest request goes first, in queue mode the one with the lowest identifier.
+ *
+ * @param    Model Model to use
+ * @param    Buffer Tx buffer to send
+ *
+ * @retval  TRUE when there is a request pending
+ */
+static boolean Can_Model_NextTx( const Can_Model *Model, uint8 *Buffer )
+{
+    if( Model->TxCount > 0u )
+    {
+        *Buffer = Model->TxOrder[ 0u ];
+
+        if( ( Model->Can->TXBC & ( 1u << MODEL_TXBC_TFQM ) ) != 0u )
+        {
+            for( uint8 Position = 1u; Position < Model->TxCount; Position++ )
+            {
+                uint8 Candidate = Model->TxOrder[ Position ];
+
+                if( Can_Model_Arbitration( Can_Model_TxId( Model, Candidate ) ) < Can_Model_Arbitration( Can_Model_TxId( Model, *Buffer ) ) )
+                {
+                    *Buffer = Candidate;
+                }
+            }
+        }
+    }
+
+    return ( Model->TxCount > 0u );
+}
+
+/**
+ * @brief    **Identifier of a Tx buffer**
+ *
+ * @param    Model Model to use
+ * @param    Buffer Tx buffer
+ *
+ * @retval  CAN id plus @ref CAN_Model_Id bits
+ */
+static uint32 Can_Model_TxId( const Can_Model *Model, uint8 Buffer )
+{
+    const volatile uint32 *Element = &Model->SramCan->TBSA[ Buffer * MODEL_ELEMENT_WORDS ];
+    uint32 Id;
+
+    if( Can_Model_Field( Element[ 0u ], MODEL_XTD_BIT, 1u ) == 1u )
+    {
+        Id = CAN_MODEL_ID_EXTENDED | ( Element[ 0u ] & MODEL_EXT_ID_MASK );
+    }
+    else
+    {
+        Id = Can_Model_Field( Element[ 0u ], MODEL_STD_ID_BIT, MODEL_STD_ID_MASK );
+    }
+
+    if( Can_Model_Field( Element[ 1u ], MODEL_FDF_BIT, 1u ) == 1u )
+    {
+        Id |= CAN_MODEL_ID_FD;
+    }
+
+    return Id;
+}
+
+/**
+ * @brief    **Arbitration value**
+ *
+ * Bits in the same order they go on the bus, the base identifier first, then the standard frames
+ * win against the extended ones with the same base identifier, the lowest value wins.
+ *
+ * @param    Id CAN id plus @ref CAN_Model_Id bits
+ *
+ * @retval  Value to compare
+ */
+static uint32 Can_Model_Arbitration( uint32 Id )
+{
+    uint32 Value;
+
+    if( ( Id & CAN_MODEL_ID_EXTENDED ) != 0u )
+    {
+        Value = ( ( ( Id & MODEL_EXT_ID_MASK ) >> 18u ) << 19u ) | ( 1u << 18u ) | ( Id & 0x3FFFFu );
+    }
+    else
+    {
+        Value = ( Id & MODEL_STD_ID_MASK ) << 19u;
+    }
+
+    return Value;
+}
+
+/**
+ * @brief    **Raise interrupt flags**
+ *
+ * Set the flags into IR register and schedule the interrupt routine when one of them is enabled
+ * and its group is assigned to an enabled interrupt line.
+ *
+ * @param    Model Model to use
+ * @param    Flags IR register bits to raise
+ */
+static void Can_Model_Raise( Can_Model *Model, uint32 Flags )
+{
+    /* ILS group of each IR register bit */
+    static const uint8 Groups[ 23u ] = { 0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 6, 6, 6, 6, 6 };
+    uint32 Enabled                   = Flags & Model->Can->IE;
+
+    Model->Can->IR |= Flags;
+    Can_Model_Publish( Model );
+
+    for( uint8 Bit = 0u; Bit < sizeof( Groups ); Bit++ )
+    {
+        uint8 Line = (uint8)Can_Model_Field( Model->Can->ILS, Groups[ Bit ], 1u );
+
+        if( ( ( Enabled & ( 1u << Bit ) ) != 0u ) && ( ( Model->Can->ILE & ( 1u << Line ) ) != 0u ) && ( Model->IsrPending == FALSE ) &&
+            ( Model->Isr != NULL_PTR ) )
+        {
+            Model->IsrPending = TRUE;
+            Model->IsrDue     = Model->Time + Model->IsrLatency;
+        }
+    }
+}
+
+/**
+ * @brief    **Publish the status registers**
+ *
+ * @param    Model Model to use
+ */
+static void Can_Model_Publish( Can_Model *Model )
+{
+    Can_RegisterType *Can         = Model->Can;
+    volatile uint32 *Status[ 2u ] = { &Can->RXF0S, &Can->RXF1S };
+    uint8 Put;
+
+    for( uint8 Fifo = 0u; Fifo < 2u; Fifo++ )
+    {
+        Put = ( Model->RxGet[ Fifo ] + Model->RxFill[ Fifo ] ) % MODEL_ELEMENTS;
+        *Status[ Fifo ] = Model->RxFill[ Fifo ] | ( (uint32)Model->RxGet[ Fifo ] << MODEL_FIFO_GI ) | ( (uint32)Put << MODEL_FIFO_PI ) |
+                          ( ( Model->RxFill[ Fifo ] == MODEL_ELEMENTS ) ? ( 1u << MODEL_FIFO_FULL ) : 0u ) |
+                          ( ( ( Can->IR & ( 1u << ( ( Fifo * 3u ) + MODEL_IR_RF0L ) ) ) != 0u ) ? ( 1u << MODEL_FIFO_LOST ) : 0u );
+    }
+
+    /* Next free buffer, in FIFO mode the one after the last request */
+    Put = 0u;
+    if( Model->TxCount > 0u )
+    {
+        Put = ( Model->TxOrder[ Model->TxCount - 1u ] + 1u ) % MODEL_ELEMENTS;
+    }
+    while( ( Model->TxCount < MODEL_ELEMENTS ) && ( ( Model->TxPending & ( 1u << Put ) ) != 0u ) )
+    {
+        Put = ( Put + 1u ) % MODEL_ELEMENTS;
+    }
+
+    /* Cancellation requests are gone along with the pending request */
+    Can->TXBCR &= Model->TxPending;
+    Can->TXBRP = Model->TxPending;
+    Can->TXFQS = (uint32)( MODEL_ELEMENTS - Model->TxCount ) | ( (uint32)( ( Model->TxCount > 0u ) ? Model->TxOrder[ 0u ] : Put ) << MODEL_FIFO_GI ) |
+                 ( (uint32)Put << MODEL_FIFO_PI ) | ( ( Model->TxCount == MODEL_ELEMENTS ) ? ( 1u << MODEL_TXFQS_TFQF ) : 0u );
+
+    /* Fill level as the driver reads it after the acknowledge, see Can_Model_TxConfirmation */
+    Put = ( Model->TefGet + Model->TefFill ) % MODEL_ELEMENTS;
+    Can->TXEFS = (uint32)( ( Model->TefFill > 0u ) ? ( Model->TefFill - 1u ) : 0u ) | ( (uint32)Model->TefGet << MODEL_FIFO_GI ) |
+                 ( (uint32)Put << MODEL_FIFO_PI ) | ( ( Model->TefFill == MODEL_ELEMENTS ) ? ( 1u << MODEL_FIFO_FULL ) : 0u );
+}
+
+/**
+ * @brief    **Call the driver interrupt routine**
+ *
+ * The interrupt dispatcher clears every flag it finds set, so all the flags are gone once the
+ * routine returns, the time spent on the host is added to the counters.
+ *
+ * @param    Model Model to use
+ */
+static void Can_Model_CallIsr( Can_Model *Model )
+{
+    uint64 Start;
+
+    Model->IsrPending = FALSE;
+    Can_Model_Publish( Model );
+
+    Start = Can_Model_HostTime( );
+    Model->Isr( );
+
+    Model->Counters.IsrCalls++;
+    Model->Counters.IsrTime += Can_Model_HostTime( ) - Start;
+
+    Model->Can->IR = 0u;
+    Can_Model_Sync( Model );
+}
@@ -0,0 +1,104 @@
+/**
+ * @file    Can_Model.h
+ * @brief   **FDCAN behavioural model**
+ * @author  Diego Perez
+ *
+ * Host side model of the STM32G0 FDCAN peripheral used to run the Can driver against realistic
+ * traffic without hardware. The model works over the same register and message RAM structures the
+ * unit tests already use, it emulates the Rx FIFO fill/get indexes, the Tx FIFO/queue put index,
+ * the Tx event FIFO and the interrupt flags, and replays a trace of frames coming from other nodes
+ * at the configured nominal and data bit rates.
+ *
+ * The driver writes plain memory on the host, so the model can not react in the same instant a
+ * register is written like the real peripheral does. Instead, Can_Model_Sync applies the writes
+ * done since its last call (Tx requests and acknowledges) and the test CanIf callbacks shall call
+ * Can_Model_RxIndication and Can_Model_TxConfirmation, which release the element the driver is
+ * reading at that moment.
+ */
+#ifndef CAN_MODEL_H__
+#define CAN_MODEL_H__
+
+#include "Std_Types.h"
+#include "ComStack_Types.h"
+#include "Registers.h"
+
+/**
+ * @defgroup CAN_Model_Id CAN model frame id bits, same as the ones used by Can_PduType id
+ *
+ * @{ */
+#define CAN_MODEL_ID_EXTENDED  0x80000000u /*!< Extended identifier frame */
+#define CAN_MODEL_ID_FD        0x40000000u /*!< FD frame, sent with bit rate switch */
+/**
+ * @} */
+
+/**
+ * @brief   Frame to inject into the bus
+ */
+typedef struct _Can_ModelFrame
+{
+    uint32 Time;       /*!< Time the frame is ready to be sent, in microseconds since the trace start */
+    uint32 Id;         /*!< CAN id plus @ref CAN_Model_Id bits */
+    uint8 Length;      /*!< Payload length in bytes, rounded up to the next valid DLC size */
+    const uint8 *Data; /*!< Payload, could be NULL for a zero filled payload */
+} Can_ModelFrame;
+
+/**
+ * @brief   Counters collected by the model
+ */
+typedef struct _Can_ModelCounters
+{
+    uint32 RxFrames;    /*!< Frames stored into one of the Rx FIFOs */
+    uint32 RxRejected;  /*!< Frames rejected by the acceptance filters */
+    uint32 RxLost;      /*!< Frames lost because the destination Rx FIFO was full */
+    uint32 RxRead;      /*!< Frames released by the driver */
+    uint32 TxFrames;    /*!< Frames transmitted from the Tx FIFO/queue */
+    uint32 TxEvents;    /*!< Tx events read by the driver */
+    uint32 TxEventLost; /*!< Tx events lost because the Tx event FIFO was full */
+    uint32 TxErrors;    /*!< Transmissions failed with a bit error in the data phase */
+    uint32 TxCancelled; /*!< Tx buffer cancellations finished */
+    uint32 IsrCalls;    /*!< Times the interrupt routine was called */
+    uint64 IsrTime;     /*!< Host time spent into the interrupt routine, in nanoseconds */
+    uint64 BusTime;     /*!< Simulated time the bus was busy, in nanoseconds */
+} Can_ModelCounters;
+
+/**
+ * @brief   FDCAN model state
+ */
+typedef struct _Can_Model
+{
+    Can_RegisterType *Can;          /*!< Peripheral registers the driver uses */
+    SramCan_RegisterType *SramCan;  /*!< Peripheral message RAM the driver uses */
+    uint32 NominalBitrate;          /*!< Nominal bit rate in bits per second */
+    uint32 DataBitrate;             /*!< Data bit rate in bits per second, used by FD frames */
+    boolean StuffBits;              /*!< Add the worst case stuff bits to each frame */
+    uint64 IsrLatency;              /*!< Simulated time from an interrupt flag to the driver ISR, in nanoseconds */
+    uint64 LoopDelay;               /*!< Transceiver loop delay from the Tx pin back to the Rx pin, in nanoseconds */
+    void ( *Isr )( void );          /*!< Interrupt routine to call, usually wraps Can_Arch_IsrMainHandler */
+    uint64 Time;                    /*!< Simulated time, in nanoseconds */
+    const Can_ModelFrame *Trace;    /*!< Frames to inject */
+    uint32 TraceCount;              /*!< Number of frames to inject */
+    uint32 TraceIndex;              /*!< Next frame to inject */
+    uint8 RxGet[ 2 ];               /*!< Get index for each Rx FIFO */
+    uint8 RxFill[ 2 ];              /*!< Fill level for each Rx FIFO */
+    uint8 TxPending;                /*!< Tx buffers with a pending request, same as TXBRP */
+    uint8 TxOrder[ 3 ];             /*!< Tx buffers in the order they were requested */
+    uint8 TxCount;                  /*!< Tx buffers pending into TxOrder */
+    uint8 TxSending;                /*!< Tx buffer on the bus, a cancellation waits for the end of the frame */
+    uint8 TefGet;                   /*!< Tx event FIFO get index */
+    uint8 TefFill;                  /*!< Tx event FIFO fill level */
+    boolean IsrPending;             /*!< An interrupt is waiting to be served */
+    uint64 IsrDue;                  /*!< Simulated time the pending interrupt is served */
+    Can_ModelCounters Counters;     /*!< Collected counters */
+} Can_Model;
+
+void Can_Model_Init( Can_Model *Model, Can_RegisterType *Can, SramCan_RegisterType *SramCan, uint32 NominalBitrate, uint32 DataBitrate );
+void Can_Model_SetTrace( Can_Model *Model, const Can_ModelFrame *Trace, uint32 Count );
+void Can_Model_Sync( Can_Model *Model );
+void Can_Model_Run( Can_Model *Model, uint64 Duration );
+void Can_Model_RxIndication( Can_Model *Model, const PduInfoType *PduInfoPtr );
+void Can_Model_RxAcknowledge( Can_Model *Model, uint8 Fifo );
+void Can_Model_TxConfirmation( Can_Model *Model );
+uint64 Can_Model_FrameTime( const Can_Model *Model, uint32 Id, uint8 Length, boolean Brs );
+uint64 Can_Model_HostTime( void );
+
+#endif
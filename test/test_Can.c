@@ -33,7 +33,7 @@ void setUp( void )
     HwUnit.ControllerState[ CAN_CONTROLLER_1 ] = CAN_CS_UNINIT;
     HwUnit.Config                              = NULL_PTR;
 
-    Can_Arch_Init_Ignore( );
+    Can_Arch_Init_IgnoreAndReturn( E_OK );
 
     Can_Init( &CanConfig );
 }
@@ -121,7 +121,7 @@ void test__Can_Init__when_all_values_are_correct( void )
     HwUnit.ControllerState[ CAN_CONTROLLER_1 ] = CAN_CS_UNINIT;
     HwUnit.Config                              = NULL_PTR;
 
-    Can_Arch_Init_Ignore( );
+    Can_Arch_Init_IgnoreAndReturn( E_OK );
 
     Can_Init( &CanConfig );
 
@@ -131,6 +131,29 @@ void test__Can_Init__when_all_values_are_correct( void )
     TEST_ASSERT_EQUAL_MESSAGE( CAN_CS_STOPPED, HwUnit.ControllerState[ CAN_CONTROLLER_1 ], "Controller state should change" );
 }
 
+/**
+ * @brief   **Test Init when the filters of a controller do not fit**
+ *
+ * The test checks that the controller whose Can_Arch_Init fails is left in CAN_CS_UNINIT state
+ * while the other one is set to CAN_CS_STOPPED.
+ */
+void test__Can_Init__controller_init_failed( void )
+{
+    HwUnit.HwUnitState                         = CAN_CS_UNINIT;
+    HwUnit.ControllerState[ CAN_CONTROLLER_0 ] = CAN_CS_UNINIT;
+    HwUnit.ControllerState[ CAN_CONTROLLER_1 ] = CAN_CS_UNINIT;
+    HwUnit.Config                              = NULL_PTR;
+
+    Can_Arch_Init_ExpectAndReturn( &HwUnit, &CanConfig, CAN_CONTROLLER_0, E_OK );
+    Can_Arch_Init_ExpectAndReturn( &HwUnit, &CanConfig, CAN_CONTROLLER_1, E_NOT_OK );
+
+    Can_Init( &CanConfig );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_CS_READY, HwUnit.HwUnitState, "Unit state should change" );
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_CS_STOPPED, HwUnit.ControllerState[ CAN_CONTROLLER_0 ], "Controller state should change" );
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_CS_UNINIT, HwUnit.ControllerState[ CAN_CONTROLLER_1 ], "Controller state should not change" );
+}
+
 /**
  * @brief   **Test DeInit when not CAN_CS_UNINIT**
  *
@@ -1160,6 +1183,292 @@ void test__Can_Write__when_all_paramters_are_right_and_CAN_mode_is_FD( void )
     TEST_ASSERT_EQUAL_MESSAGE( Return, E_OK, "Return value should be E_OK" );
 }
 
+/**
+ * @brief   **Test Can_IsrLine0 when not CAN_CS_READY**
+ *
+ * The test checks that the function does not call the Can_Arch_IsrLineHandler function when CAN module
+ * is not intialized (when HwUnitState is not CAN_CS_READY).
+ */
+void test__Can_IsrLine0__when_not_ready_value_in_HwUnitState( void )
+{
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Can_IsrLine0( );
+
+    /* test is testing if Can_Arch_IsrLineHandler was not called */
+}
+
+/**
+ * @brief   **Test Can_IsrLine0 when all values are correct**
+ *
+ * The test checks that the function calls the Can_Arch_IsrLineHandler function for each controller
+ * with interrupt line 0.
+ */
+void test__Can_IsrLine0__when_all_values_are_correct( void )
+{
+    Can_Arch_IsrLineHandler_Expect( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE0 );
+    Can_Arch_IsrLineHandler_Expect( &HwUnit, CAN_CONTROLLER_1, CAN_INTERRUPT_LINE0 );
+
+    Can_IsrLine0( );
+
+    /* test is testing if Can_Arch_IsrLineHandler was called */
+}
+
+/**
+ * @brief   **Test Can_IsrLine1 when not CAN_CS_READY**
+ *
+ * The test checks that the function does not call the Can_Arch_IsrLineHandler function when CAN module
+ * is not intialized (when HwUnitState is not CAN_CS_READY).
+ */
+void test__Can_IsrLine1__when_not_ready_value_in_HwUnitState( void )
+{
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Can_IsrLine1( );
+
+    /* test is testing if Can_Arch_IsrLineHandler was not called */
+}
+
+/**
+ * @brief   **Test Can_IsrLine1 when all values are correct**
+ *
+ * The test checks that the function calls the Can_Arch_IsrLineHandler function for each controller
+ * with interrupt line 1.
+ */
+void test__Can_IsrLine1__when_all_values_are_correct( void )
+{
+    Can_Arch_IsrLineHandler_Expect( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE1 );
+    Can_Arch_IsrLineHandler_Expect( &HwUnit, CAN_CONTROLLER_1, CAN_INTERRUPT_LINE1 );
+
+    Can_IsrLine1( );
+
+    /* test is testing if Can_Arch_IsrLineHandler was called */
+}
+
+/**
+ * @brief   **Test GetStatistics when not CAN_CS_READY**
+ *
+ * The test checks that the function does not call the Can_Arch_GetStatistics function when CAN module
+ * is not intialized (when HwUnitState is not CAN_CS_READY).
+ */
+void test__Can_GetStatistics__when_not_ready_value_in_HwUnitState( void )
+{
+    Can_StatisticsType Statistics;
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_GetStatistics( CAN_CONTROLLER_0, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test GetStatistics when Controller is unkown**
+ *
+ * The test checks that the function does not call the Can_Arch_GetStatistics function when the Controller
+ * is out of range.
+ */
+void test__Can_GetStatistics__when_Controller_is_unkown( void )
+{
+    Can_StatisticsType Statistics;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_GetStatistics( CAN_CONTROLLER_2, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test GetStatistics when Statistics is NULL**
+ *
+ * The test checks that the function does not call the Can_Arch_GetStatistics function when the Statistics
+ * pointer is NULL.
+ */
+void test__Can_GetStatistics__when_Statistics_is_NULL( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_GetStatistics( CAN_CONTROLLER_0, NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test GetStatistics when all values are correct**
+ *
+ * The test checks that the function calls the Can_Arch_GetStatistics function when all values are correct.
+ */
+void test__Can_GetStatistics__when_all_values_are_correct( void )
+{
+    Can_StatisticsType Statistics;
+
+    Can_Arch_GetStatistics_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_GetStatistics( CAN_CONTROLLER_0, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_OK, "Return value should be E_OK" );
+}
+
+/**
+ * @brief   **Test MainFunction_BusMonitor when not CAN_CS_READY**
+ *
+ * The test checks that the function does not call the Can_Arch_MainFunctionBusMonitor function when
+ * CAN module is not intialized (when HwUnitState is not CAN_CS_READY).
+ */
+void test__Can_MainFunction_BusMonitor__when_not_ready_value_in_HwUnitState( void )
+{
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Can_MainFunction_BusMonitor( );
+
+    /* test passes if Can_Arch_MainFunctionBusMonitor is not called */
+}
+
+/**
+ * @brief   **Test MainFunction_BusMonitor when CAN_CS_READY**
+ *
+ * The test checks that the function calls the Can_Arch_MainFunctionBusMonitor function once per
+ * controller.
+ */
+void test__Can_MainFunction_BusMonitor__when_ready( void )
+{
+    Can_Arch_MainFunctionBusMonitor_Expect( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_MainFunctionBusMonitor_Expect( &HwUnit, CAN_CONTROLLER_1 );
+
+    Can_MainFunction_BusMonitor( );
+}
+
+/**
+ * @brief   **Test GetBusMonitor when not CAN_CS_READY**
+ *
+ * The test checks that the function does not call the Can_Arch_GetBusMonitor function when CAN
+ * module is not intialized (when HwUnitState is not CAN_CS_READY).
+ */
+void test__Can_GetBusMonitor__when_not_ready_value_in_HwUnitState( void )
+{
+    Can_BusMonitorType Monitor;
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_GetBusMonitor( CAN_CONTROLLER_0, &Monitor );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test GetBusMonitor when Controller is unkown**
+ *
+ * The test checks that the function does not call the Can_Arch_GetBusMonitor function when the
+ * Controller is out of range.
+ */
+void test__Can_GetBusMonitor__when_Controller_is_unkown( void )
+{
+    Can_BusMonitorType Monitor;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_GetBusMonitor( CAN_CONTROLLER_2, &Monitor );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test GetBusMonitor when Monitor is NULL**
+ *
+ * The test checks that the function does not call the Can_Arch_GetBusMonitor function when the
+ * Monitor pointer is NULL.
+ */
+void test__Can_GetBusMonitor__when_Monitor_is_NULL( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_GetBusMonitor( CAN_CONTROLLER_0, NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test GetBusMonitor when all values are correct**
+ *
+ * The test checks that the function calls the Can_Arch_GetBusMonitor function when all values are
+ * correct.
+ */
+void test__Can_GetBusMonitor__when_all_values_are_correct( void )
+{
+    Can_BusMonitorType Monitor;
+
+    Can_Arch_GetBusMonitor_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_GetBusMonitor( CAN_CONTROLLER_0, &Monitor );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_OK, "Return value should be E_OK" );
+}
+
+/**
+ * @brief   **Test ReleaseRxMessage when not CAN_CS_READY**
+ *
+ * The test checks that the function does not call the Can_Arch_ReleaseRxMessage function when CAN
+ * module is not intialized (when HwUnitState is not CAN_CS_READY).
+ */
+void test__Can_ReleaseRxMessage__when_not_ready_value_in_HwUnitState( void )
+{
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_ReleaseRxMessage( CAN_HRH_0_CTRL_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test ReleaseRxMessage when Hrh is a transmit object**
+ *
+ * The test checks that the function does not call the Can_Arch_ReleaseRxMessage function when the
+ * hardware object is not a receive one.
+ */
+void test__Can_ReleaseRxMessage__when_Hrh_is_transmit( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_ReleaseRxMessage( CAN_HTH_0_CTRL_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test ReleaseRxMessage when Hrh is unkown**
+ *
+ * The test checks that the function does not call the Can_Arch_ReleaseRxMessage function when the
+ * hardware object is out of range.
+ */
+void test__Can_ReleaseRxMessage__when_Hrh_is_unkown( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_ReleaseRxMessage( CAN_NUMBER_OF_HOHS );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_NOT_OK, "Return value should be E_NOT_OK" );
+}
+
+/**
+ * @brief   **Test ReleaseRxMessage when all values are correct**
+ *
+ * The test checks that the function calls the Can_Arch_ReleaseRxMessage function when all values
+ * are correct.
+ */
+void test__Can_ReleaseRxMessage__when_all_values_are_correct( void )
+{
+    Can_Arch_ReleaseRxMessage_IgnoreAndReturn( E_OK );
+
+    Std_ReturnType Return = Can_ReleaseRxMessage( CAN_HRH_0_CTRL_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( Return, E_OK, "Return value should be E_OK" );
+}
+
 /**
  * @brief   **Test Can_GetVersionInfo when null**
  *
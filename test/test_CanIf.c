@@ -10,16 +10,60 @@
 #include "CanIf.h"
 #include "CanIf_Can.h"
 #include "mock_Det.h"
+#include "mock_Can.h"
 
 #define CANIF_CONTROLLER_INVALID 0xffu /*!< Controller Invalid */
 #define CANIF_VALID_TX_PDU       1u    /*!< Controller 1 */
 
 extern const CanIf_ConfigType *LocalConfigPtr;
 
+static PduIdType RxIndicationPduId;           /*!< RxPduId of the last upper layer indication */
+static const PduInfoType *RxIndicationPduPtr; /*!< PDU of the last upper layer indication */
+static uint32 RxIndicationCount;              /*!< Upper layer indications since setUp */
+
+static Std_ReturnType WriteRetVal;  /*!< Value returned by the Can_Write callback */
+static uint32 WriteCount;           /*!< Can_Write calls since setUp */
+static Can_PduType WritePdus[ 8 ];  /*!< PDUs passed to Can_Write, the sdu is not kept */
+static uint8 WriteData[ 8 ][ 64 ];  /*!< Payloads passed to Can_Write */
+static uint8 WriteIntsLevel[ 8 ];   /*!< Controller interrupts disable level on each Can_Write */
+static uint8 IntsLevel;             /*!< Controller interrupts disable level */
+static uint32 IntsDisableCount;     /*!< Can_DisableControllerInterrupts calls since setUp */
+
+static Std_ReturnType TriggerRetVal; /*!< Value returned by the upper layer trigger transmit */
+static uint32 TriggerCount;          /*!< Upper layer trigger transmit calls since setUp */
+static PduIdType TriggerPduId;       /*!< TxPduId of the last upper layer trigger transmit */
+static uint32 TxConfirmationCount;   /*!< Upper layer transmit confirmations since setUp */
+static Std_ReturnType TxResult;      /*!< Result the upper layer transmit confirmation expects */
+
+volatile uint32 CanIf_Test_TimeStamp; /*!< Timestamp of the frames captured by the bus mirroring */
+
+static Std_ReturnType Can_Write_Callback( Can_HwHandleType Hth, const Can_PduType *PduInfo, int cmock_num_calls );
+static void Can_DisableControllerInterrupts_Callback( uint8 Controller, int cmock_num_calls );
+static void Can_EnableControllerInterrupts_Callback( uint8 Controller, int cmock_num_calls );
+
 /*this function is required by Ceedling to run any code before the test cases*/
 void setUp( void )
 {
     CanIf_Init( &CanIfConfig );
+    RxIndicationPduId   = 0xFFu;
+    RxIndicationPduPtr  = NULL_PTR;
+    RxIndicationCount   = 0u;
+    WriteRetVal         = E_OK;
+    WriteCount          = 0u;
+    IntsLevel           = 0u;
+    IntsDisableCount    = 0u;
+    TriggerRetVal       = E_OK;
+    TriggerCount        = 0u;
+    TriggerPduId        = 0xFFu;
+    TxConfirmationCount = 0u;
+    TxResult            = E_OK;
+    Can_DisableControllerInterrupts_Ignore( );
+    Can_EnableControllerInterrupts_Ignore( );
+    /* both channels start and go online, as the state manager would bring them up */
+    CanIf_ControllerModeIndication( CANIF_CONTROLLER_0, CAN_CS_STARTED );
+    CanIf_ControllerModeIndication( CANIF_CONTROLLER_1, CAN_CS_STARTED );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_1, CANIF_ONLINE );
 }
 
 /*this function is required by Ceedling to run any code after the test cases*/
@@ -139,11 +183,76 @@ void test__CanIf_SetControllerMode__valid_parameters( void )
 {
     Std_ReturnType ret;
 
+    Can_SetControllerMode_ExpectAndReturn( CANIF_CONTROLLER_0, CAN_CS_STARTED, E_OK );
+
     ret = CanIf_SetControllerMode( CANIF_CONTROLLER_0, CAN_CS_STARTED );
 
     TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_SetControllerMode() should return E_OK" );
 }
 
+/**
+ * @brief   Test case for CanIf_SetControllerMode function rejected by the driver
+ *
+ * This test case check the function return E_NOT_OK and the PDU mode is kept when the driver
+ * does not accept the transition
+ */
+void test__CanIf_SetControllerMode__driver_rejects( void )
+{
+    Std_ReturnType ret;
+    CanIf_PduModeType mode;
+
+    Can_SetControllerMode_ExpectAndReturn( CANIF_CONTROLLER_0, CAN_CS_STOPPED, E_NOT_OK );
+
+    ret = CanIf_SetControllerMode( CANIF_CONTROLLER_0, CAN_CS_STOPPED );
+    (void)CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetControllerMode() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( CANIF_ONLINE, mode );
+}
+
+/**
+ * @brief   Test case for CanIf_SetControllerMode function stopping the controller
+ *
+ * This test case check the channel goes to CANIF_TX_OFFLINE and no further PDU mode request is
+ * accepted until the controller is started again
+ */
+void test__CanIf_SetControllerMode__stopped_tx_offline( void )
+{
+    Std_ReturnType ret;
+    CanIf_PduModeType mode;
+
+    Can_SetControllerMode_ExpectAndReturn( CANIF_CONTROLLER_0, CAN_CS_STOPPED, E_OK );
+    Can_SetControllerMode_ExpectAndReturn( CANIF_CONTROLLER_0, CAN_CS_STARTED, E_OK );
+
+    (void)CanIf_SetControllerMode( CANIF_CONTROLLER_0, CAN_CS_STOPPED );
+    (void)CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+    TEST_ASSERT_EQUAL( CANIF_TX_OFFLINE, mode );
+
+    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+
+    (void)CanIf_SetControllerMode( CANIF_CONTROLLER_0, CAN_CS_STARTED );
+    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_SetPduMode() should return E_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetControllerMode function putting the controller to sleep
+ *
+ * This test case check the channel goes to CANIF_OFFLINE when the controller sleeps
+ */
+void test__CanIf_SetControllerMode__sleep_offline( void )
+{
+    CanIf_PduModeType mode;
+
+    Can_SetControllerMode_ExpectAndReturn( CANIF_CONTROLLER_1, CAN_CS_SLEEP, E_OK );
+
+    (void)CanIf_SetControllerMode( CANIF_CONTROLLER_1, CAN_CS_SLEEP );
+    (void)CanIf_GetPduMode( CANIF_CONTROLLER_1, &mode );
+
+    TEST_ASSERT_EQUAL( CANIF_OFFLINE, mode );
+}
+
 /**
  * @brief   Test case for CanIf_GetControllerMode function with null pointer
  *
@@ -338,7 +447,8 @@ void test__CanIf_Transmit__invalid_PduId( void )
 void test__CanIf_Transmit__invalid_PduId_2( void )
 {
     Std_ReturnType ret;
-    PduInfoType pduInfo = { .SduLength = 9 };
+    uint8 data[ 9 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 9, .SduDataPtr = data };
 
     Det_ReportRuntimeError_IgnoreAndReturn( E_OK );
 
@@ -355,7 +465,10 @@ void test__CanIf_Transmit__invalid_PduId_2( void )
 void test__CanIf_Transmit__valid_parameters( void )
 {
     Std_ReturnType ret;
-    PduInfoType pduInfo = { .SduLength = 8 };
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
+
+    Can_Write_IgnoreAndReturn( E_OK );
 
     ret = CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
 
@@ -363,394 +476,1357 @@ void test__CanIf_Transmit__valid_parameters( void )
 }
 
 /**
- * @brief   Test case for CanIf_ReadRxPduData function with null pointer
+ * @brief   Test case for CanIf_Transmit function without data
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check a PDU with no trigger transmit requested without data is reported as
+ * CANIF_E_PARAM_POINTER and not passed to Can_Write
  */
-void test__CanIf_ReadRxPduData__null_ptr( void )
+void test__CanIf_Transmit__null_data( void )
 {
     Std_ReturnType ret;
-    PduInfoType pduInfo;
-    LocalConfigPtr = NULL_PTR;
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = NULL_PTR };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT, CANIF_E_PARAM_POINTER, E_OK );
 
-    ret = CanIf_ReadRxPduData( CANIF_VALID_TX_PDU, &pduInfo );
+    ret = CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_Transmit() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 0u, WriteCount );
 }
 
 /**
- * @brief   Test case for CanIf_ReadRxPduData function with invalid PduInfoPtr
+ * @brief   Test case for CanIf_Transmit function with a classic PDU
  *
- * This test case only check if Det_ReportError is called when the PduInfoPtr is invalid
+ * This test case check the PDU handed to Can_Write is built out of the TxPdu configuration, the
+ * standard CAN id without format bits, the Hth and the TxPduId as software handle
  */
-void test__CanIf_ReadRxPduData__invalid_PduInfoPtr( void )
+void test__CanIf_Transmit__classic_pdu_to_can_write( void )
 {
     Std_ReturnType ret;
+    uint8 data[ 8 ]        = { 0 };
+    PduInfoType pduInfo    = { .SduLength = 8, .SduDataPtr = data };
+    Can_PduType expected   = { 0 };
+    expected.swPduHandle   = CANIF_VALID_TX_PDU;
+    expected.length        = 8u;
+    expected.id            = 0x101u;
+    expected.sdu           = data;
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_ExpectAndReturn( CAN_HTH_0_CTRL_0, &expected, E_OK );
 
-    ret = CanIf_ReadRxPduData( CANIF_VALID_TX_PDU, NULL_PTR );
+    ret = CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_Transmit() should return E_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_ReadRxPduData function with invalid PduId
+ * @brief   Test case for CanIf_Transmit function with an extended CAN FD PDU
  *
- * This test case only check if Det_ReportError is called when the PduId is invalid
+ * This test case check the extended identifier and CAN FD bits are set on the CAN id handed to
+ * Can_Write and the PDU goes through the Hth it is configured with
  */
-void test__CanIf_ReadRxPduData__invalid_PduId( void )
+void test__CanIf_Transmit__extended_fd_pdu_to_can_write( void )
 {
     Std_ReturnType ret;
-    PduInfoType pduInfo = { .SduLength = 9 };
+    uint8 data[ 12 ]       = { 0 };
+    PduInfoType pduInfo    = { .SduLength = 12, .SduDataPtr = data };
+    Can_PduType expected   = { 0 };
+    expected.swPduHandle   = 4u;
+    expected.length        = 12u;
+    expected.id            = 0xC01ABCDEu;
+    expected.sdu           = data;
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_ExpectAndReturn( CAN_HTH_0_CTRL_1, &expected, E_OK );
 
-    ret = CanIf_ReadRxPduData( CANIF_NUMBER_OF_RX_PDUS, &pduInfo );
+    ret = CanIf_Transmit( 4u, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_Transmit() should return E_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_ReadRxPduData function with valid parameters
+ * @brief   Test case for CanIf_Transmit function with the driver busy
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check the PDU is buffered when Can_Write returns CAN_BUSY, with the controller
+ * interrupts held around Can_Write and the buffer update, and sent on the next confirmation
  */
-void test__CanIf_ReadRxPduData__valid_parameters( void )
+void test__CanIf_Transmit__can_busy_buffered( void )
 {
     Std_ReturnType ret;
-    PduInfoType pduInfo = { .SduLength = 8 };
+    uint8 data[ 8 ]     = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    ret = CanIf_ReadRxPduData( CANIF_VALID_TX_PDU, &pduInfo );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    Can_DisableControllerInterrupts_StubWithCallback( Can_DisableControllerInterrupts_Callback );
+    Can_EnableControllerInterrupts_StubWithCallback( Can_EnableControllerInterrupts_Callback );
+    WriteRetVal = CAN_BUSY;
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_ReadRxPduData() should return E_OK" );
+    ret = CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_Transmit() should return E_OK" );
+    TEST_ASSERT_EQUAL( 1u, WriteIntsLevel[ 0 ] );
+    TEST_ASSERT_EQUAL( 0u, IntsLevel );
+
+    data[ 0 ]   = 0xFFu;
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 0u );
+
+    TEST_ASSERT_EQUAL( 2u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x101u, WritePdus[ 1 ].id );
+    TEST_ASSERT_EQUAL( CANIF_VALID_TX_PDU, WritePdus[ 1 ].swPduHandle );
+    TEST_ASSERT_EQUAL( 8u, WritePdus[ 1 ].length );
+    TEST_ASSERT_EQUAL( 1u, WriteData[ 1 ][ 0 ] );
+    TEST_ASSERT_EQUAL( 8u, WriteData[ 1 ][ 7 ] );
 }
 
 /**
- * @brief   Test case for CanIf_ReadTxNotifStatus function with null pointer
+ * @brief   Test case for CanIf_Transmit function on a controller with another HTH buffered
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check a PDU whose HTH has no Tx buffer is still written with the controller
+ * interrupts held when another HTH of its controller is buffered, the transmit confirmation of
+ * that HTH calls Can_Write as well
  */
-void test__CanIf_ReadTxNotifStatus__null_ptr( void )
+void test__CanIf_Transmit__controller_buffered( void )
 {
     Std_ReturnType ret;
-    LocalConfigPtr = NULL_PTR;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
+    CanIf_BufferCfgType buffers[ CANIF_NUMBER_OF_TX_BUFFERS ];
+    CanIf_ConfigType config = CanIfConfig;
+
+    /* the buffer of controller 0 moves to a second HTH not used by any PDU */
+    buffers[ 0 ]      = CanIfConfig.BufferCfgs[ 0 ];
+    buffers[ 1 ]      = CanIfConfig.BufferCfgs[ 1 ];
+    buffers[ 0 ].Hth  = 3u;
+    config.BufferCfgs = buffers;
+    CanIf_Init( &config );
+    CanIf_ControllerModeIndication( CANIF_CONTROLLER_0, CAN_CS_STARTED );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    Can_DisableControllerInterrupts_StubWithCallback( Can_DisableControllerInterrupts_Callback );
+    Can_EnableControllerInterrupts_StubWithCallback( Can_EnableControllerInterrupts_Callback );
 
-    ret = CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU );
+    ret = CanIf_Transmit( 0u, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadTxNotifStatus() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_Transmit() should return E_OK" );
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
+    TEST_ASSERT_EQUAL( 1u, WriteIntsLevel[ 0 ] );
+    TEST_ASSERT_EQUAL( 0u, IntsLevel );
 }
 
 /**
- * @brief   Test case for CanIf_ReadTxNotifStatus function with invalid PduId
+ * @brief   Test case for CanIf_Transmit function with the channel transmit path offline
  *
- * This test case only check if Det_ReportError is called when the PduId is invalid
+ * This test case check the function return E_NOT_OK without calling the driver when the channel
+ * of the PDU is in CANIF_TX_OFFLINE
  */
-void test__CanIf_ReadTxNotifStatus__invalid_PduId( void )
+void test__CanIf_Transmit__tx_offline( void )
 {
     Std_ReturnType ret;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_TX_OFFLINE );
 
-    ret = CanIf_ReadTxNotifStatus( CANIF_NUMBER_OF_TX_PDUS );
+    ret = CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadTxNotifStatus() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_Transmit() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 0u, TxConfirmationCount );
 }
 
 /**
- * @brief   Test case for CanIf_ReadTxNotifStatus function with valid parameters
+ * @brief   Test case for CanIf_Transmit function with the channel in offline active mode
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check the PDU is confirmed to the upper layer and flagged as notified without
+ * calling the driver when the channel of the PDU is in CANIF_TX_OFFLINE_ACTIVE
  */
-void test__CanIf_ReadTxNotifStatus__valid_parameters( void )
+void test__CanIf_Transmit__tx_offline_active( void )
 {
     Std_ReturnType ret;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    ret = CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_TX_OFFLINE_ACTIVE );
+
+    ret = CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_TX_RX_NOTIFICATION, ret, "CanIf_ReadTxNotifStatus() should return E_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_Transmit() should return E_OK" );
+    TEST_ASSERT_EQUAL( 1u, TxConfirmationCount );
+    TEST_ASSERT_EQUAL( CANIF_TX_RX_NOTIFICATION, CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU ) );
 }
 
 /**
- * @brief   Test case for CanIf_ReadRxNotifStatus function with null pointer
+ * @brief   Test case for CanIf_Transmit function with the channel in offline active mode
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check the notification is flagged from task level without holding the controllers
+ * interrupts, the flag of the PDU is a single store a transmit confirmation cannot interleave with
  */
-void test__CanIf_ReadRxNotifStatus__null_ptr( void )
+void test__CanIf_Transmit__tx_offline_active_lock_free( void )
 {
     Std_ReturnType ret;
-    LocalConfigPtr = NULL_PTR;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_DisableControllerInterrupts_StubWithCallback( Can_DisableControllerInterrupts_Callback );
+    Can_EnableControllerInterrupts_StubWithCallback( Can_EnableControllerInterrupts_Callback );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_TX_OFFLINE_ACTIVE );
+    IntsDisableCount = 0u;
 
-    ret = CanIf_ReadRxNotifStatus( CANIF_VALID_TX_PDU );
+    ret = CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadRxNotifStatus() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_Transmit() should return E_OK" );
+    TEST_ASSERT_EQUAL( 0u, IntsDisableCount );
+    TEST_ASSERT_EQUAL( 0u, IntsLevel );
+    TEST_ASSERT_EQUAL( CANIF_TX_RX_NOTIFICATION, CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU ) );
 }
 
 /**
- * @brief   Test case for CanIf_ReadRxNotifStatus function with invalid PduId
+ * @brief   Test case for CanIf_Transmit function with the other channel offline
  *
- * This test case only check if Det_ReportError is called when the PduId is invalid
+ * This test case check a PDU is still sent when only the channel of another controller is offline
  */
-void test__CanIf_ReadRxNotifStatus__invalid_PduId( void )
+void test__CanIf_Transmit__other_channel_offline( void )
 {
     Std_ReturnType ret;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_1, CANIF_OFFLINE );
 
-    ret = CanIf_ReadRxNotifStatus( CANIF_NUMBER_OF_RX_PDUS );
+    ret = CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadRxNotifStatus() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_Transmit() should return E_OK" );
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
 }
 
 /**
- * @brief   Test case for CanIf_ReadRxNotifStatus function with valid parameters
+ * @brief   Test case for CanIf_Transmit function with the driver busy and the buffer full
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check the function return E_NOT_OK when Can_Write returns CAN_BUSY and the
+ * buffer of the HTH has no free entry
  */
-void test__CanIf_ReadRxNotifStatus__valid_parameters( void )
+void test__CanIf_Transmit__can_busy_buffer_full( void )
 {
     Std_ReturnType ret;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    ret = CanIf_ReadRxNotifStatus( CANIF_VALID_TX_PDU );
+    Can_Write_IgnoreAndReturn( CAN_BUSY );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_TX_RX_NOTIFICATION, ret, "CanIf_ReadRxNotifStatus() should return E_OK" );
+    TEST_ASSERT_EQUAL( E_OK, CanIf_Transmit( 0u, &pduInfo ) );
+    TEST_ASSERT_EQUAL( E_OK, CanIf_Transmit( 1u, &pduInfo ) );
+    ret = CanIf_Transmit( 2u, &pduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_Transmit() should return E_NOT_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_SetPduMode function with null pointer
+ * @brief   Test case for CanIf_Transmit function with the PDU already buffered
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check the new data overwrites the buffered one without calling Can_Write, and
+ * only the newer data is sent
  */
-void test__CanIf_SetPduMode__null_ptr( void )
+void test__CanIf_Transmit__overwrite_buffered( void )
 {
-    Std_ReturnType ret;
-    LocalConfigPtr = NULL_PTR;
+    uint8 data[ 8 ]     = { 0x11 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
 
-    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_OFFLINE );
+    TEST_ASSERT_EQUAL( E_OK, CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo ) );
+    data[ 0 ]         = 0x22;
+    pduInfo.SduLength = 4;
+    TEST_ASSERT_EQUAL( E_OK, CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo ) );
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 0u );
+    CanIf_TxConfirmation( 0u );
+
+    TEST_ASSERT_EQUAL( 2u, WriteCount );
+    TEST_ASSERT_EQUAL( 4u, WritePdus[ 1 ].length );
+    TEST_ASSERT_EQUAL_HEX8( 0x22, WriteData[ 1 ][ 0 ] );
 }
 
 /**
- * @brief   Test case for CanIf_SetPduMode function with invalid controller
+ * @brief   Test case for CanIf_Transmit function with a CAN FD PDU over its configured length
  *
- * This test case only check if Det_ReportError is called when the controller is invalid
+ * This test case check a length accepted by CAN FD frames but longer than the one configured for
+ * the PDU is reported as CANIF_E_TXPDU_LENGTH_EXCEEDED and not passed to Can_Write
  */
-void test__CanIf_SetPduMode__invalid_controller( void )
+void test__CanIf_Transmit__length_exceeded( void )
 {
     Std_ReturnType ret;
+    uint8 data[ 16 ]    = { 0 };
+    PduInfoType pduInfo = { .SduLength = 16, .SduDataPtr = data };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Det_ReportRuntimeError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT, CANIF_E_TXPDU_LENGTH_EXCEEDED, E_OK );
 
-    ret = CanIf_SetPduMode( CANIF_CONTROLLER_INVALID, CANIF_OFFLINE );
+    ret = CanIf_Transmit( 4u, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_Transmit() should return E_NOT_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_SetPduMode function with invalid PduModeRequest
+ * @brief   Test case for CanIf_TransmitMultiple function with null pointer
  *
- * This test case only check if Det_ReportError is called when the PduModeRequest is invalid
+ * This test case only check if Det_ReportError is called when the CanIf is not intialized
  */
-void test__CanIf_SetPduMode__invalid_PduModeRequest( void )
+void test__CanIf_TransmitMultiple__null_ptr( void )
 {
     Std_ReturnType ret;
+    Std_ReturnType results[ 1 ];
+    PduInfoType pduInfo               = { .SduLength = 8 };
+    const CanIf_TxRequestType request = { .TxPduId = CANIF_VALID_TX_PDU, .PduInfoPtr = &pduInfo };
+    LocalConfigPtr                    = NULL_PTR;
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_UNINIT, E_OK );
 
-    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE + 1 );
+    ret = CanIf_TransmitMultiple( &request, results, 1u );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_TransmitMultiple() should return E_NOT_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_SetPduMode function with valid parameters
+ * @brief   Test case for CanIf_TransmitMultiple function with invalid pointers
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check Det_ReportError is called when the requests or the results are missing
  */
-void test__CanIf_SetPduMode__valid_parameters( void )
+void test__CanIf_TransmitMultiple__invalid_pointer( void )
 {
     Std_ReturnType ret;
+    Std_ReturnType results[ 1 ];
+    PduInfoType pduInfo               = { .SduLength = 8 };
+    const CanIf_TxRequestType request = { .TxPduId = CANIF_VALID_TX_PDU, .PduInfoPtr = &pduInfo };
 
-    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_OFFLINE );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_PARAM_POINTER, E_OK );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_PARAM_POINTER, E_OK );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_SetPduMode() should return E_OK" );
+    ret = CanIf_TransmitMultiple( NULL_PTR, results, 1u );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_TransmitMultiple() should return E_NOT_OK" );
+    ret = CanIf_TransmitMultiple( &request, NULL_PTR, 1u );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_TransmitMultiple() should return E_NOT_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_GetPduMode function with null pointer
+ * @brief   Test case for CanIf_TransmitMultiple function with invalid requests in the burst
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check each invalid request is reported and not accepted while the valid ones
+ * around it are still handed to Can_Write
  */
-void test__CanIf_GetPduMode__null_ptr( void )
+void test__CanIf_TransmitMultiple__per_request_results( void )
 {
     Std_ReturnType ret;
-    CanIf_PduModeType mode;
-    LocalConfigPtr = NULL_PTR;
+    Std_ReturnType results[ 5 ];
+    uint8 data[ 16 ]                      = { 0 };
+    PduInfoType pduInfo                   = { .SduLength = 8, .SduDataPtr = data };
+    PduInfoType longInfo                  = { .SduLength = 16, .SduDataPtr = data };
+    const CanIf_TxRequestType requests[ ] = {
+        { .TxPduId = CANIF_VALID_TX_PDU, .PduInfoPtr = &pduInfo },
+        { .TxPduId = CANIF_NUMBER_OF_TX_PDUS, .PduInfoPtr = &pduInfo },
+        { .TxPduId = 3u, .PduInfoPtr = NULL_PTR },
+        { .TxPduId = 4u, .PduInfoPtr = &longInfo },
+        { .TxPduId = 3u, .PduInfoPtr = &pduInfo } };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_INVALID_TXPDUID, E_OK );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_PARAM_POINTER, E_OK );
+    Det_ReportRuntimeError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_TXPDU_LENGTH_EXCEEDED, E_OK );
 
-    ret = CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+    ret = CanIf_TransmitMultiple( requests, results, 5u );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_GetPduMode() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_TransmitMultiple() should return E_OK" );
+    TEST_ASSERT_EQUAL( E_OK, results[ 0 ] );
+    TEST_ASSERT_EQUAL( E_NOT_OK, results[ 1 ] );
+    TEST_ASSERT_EQUAL( E_NOT_OK, results[ 2 ] );
+    TEST_ASSERT_EQUAL( E_NOT_OK, results[ 3 ] );
+    TEST_ASSERT_EQUAL( E_OK, results[ 4 ] );
+    TEST_ASSERT_EQUAL( 2u, WriteCount );
 }
 
 /**
- * @brief   Test case for CanIf_GetPduMode function with invalid controller
+ * @brief   Test case for CanIf_TransmitMultiple function with requests of two HTHs interleaved
  *
- * This test case only check if Det_ReportError is called when the controller is invalid
+ * This test case check the requests are handed to Can_Write grouped per HTH, in the order of the
+ * requests within each HTH, with the controller interrupts held once per HTH
  */
-void test__CanIf_GetPduMode__invalid_controller( void )
+void test__CanIf_TransmitMultiple__grouped_per_hth( void )
 {
     Std_ReturnType ret;
-    CanIf_PduModeType mode;
+    Std_ReturnType results[ 3 ];
+    uint8 data[ 8 ]                       = { 0 };
+    PduInfoType pduInfo                   = { .SduLength = 8, .SduDataPtr = data };
+    const CanIf_TxRequestType requests[ ] = {
+        { .TxPduId = 0u, .PduInfoPtr = &pduInfo },
+        { .TxPduId = 3u, .PduInfoPtr = &pduInfo },
+        { .TxPduId = 1u, .PduInfoPtr = &pduInfo } };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    Can_DisableControllerInterrupts_StubWithCallback( Can_DisableControllerInterrupts_Callback );
+    Can_EnableControllerInterrupts_StubWithCallback( Can_EnableControllerInterrupts_Callback );
 
-    ret = CanIf_GetPduMode( CANIF_CONTROLLER_INVALID, &mode );
+    ret = CanIf_TransmitMultiple( requests, results, 3u );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_GetPduMode() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_TransmitMultiple() should return E_OK" );
+    TEST_ASSERT_EQUAL( E_OK, results[ 0 ] );
+    TEST_ASSERT_EQUAL( E_OK, results[ 1 ] );
+    TEST_ASSERT_EQUAL( E_OK, results[ 2 ] );
+    TEST_ASSERT_EQUAL( 3u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x100u, WritePdus[ 0 ].id );
+    TEST_ASSERT_EQUAL_HEX32( 0x101u, WritePdus[ 1 ].id );
+    TEST_ASSERT_EQUAL_HEX32( 0x40000200u, WritePdus[ 2 ].id );
+    TEST_ASSERT_EQUAL( 1u, WriteIntsLevel[ 0 ] );
+    TEST_ASSERT_EQUAL( 1u, WriteIntsLevel[ 1 ] );
+    TEST_ASSERT_EQUAL( 1u, WriteIntsLevel[ 2 ] );
+    TEST_ASSERT_EQUAL( 2u, IntsDisableCount );
+    TEST_ASSERT_EQUAL( 0u, IntsLevel );
 }
 
 /**
- * @brief   Test case for CanIf_GetPduMode function with invalid PduModePtr
+ * @brief   Test case for CanIf_TransmitMultiple function with the HTH groups interleaved
  *
- * This test case only check if Det_ReportError is called when the mode pointer is invalid
+ * This test case check every request gets E_OK or E_NOT_OK whatever the results held before,
+ * and the controller interrupts are held once per HTH group even with an invalid request and
+ * the requests of the other HTH in between
  */
-void test__CanIf_GetPduMode__invalid_PduModePtr( void )
+void test__CanIf_TransmitMultiple__results_per_hth_group( void )
 {
     Std_ReturnType ret;
+    Std_ReturnType results[ 5 ]           = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    uint8 data[ 8 ]                       = { 0 };
+    PduInfoType pduInfo                   = { .SduLength = 8, .SduDataPtr = data };
+    const CanIf_TxRequestType requests[ ] = {
+        { .TxPduId = 0u, .PduInfoPtr = &pduInfo },
+        { .TxPduId = 3u, .PduInfoPtr = &pduInfo },
+        { .TxPduId = CANIF_NUMBER_OF_TX_PDUS, .PduInfoPtr = &pduInfo },
+        { .TxPduId = 1u, .PduInfoPtr = &pduInfo },
+        { .TxPduId = 4u, .PduInfoPtr = &pduInfo } };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    Can_DisableControllerInterrupts_StubWithCallback( Can_DisableControllerInterrupts_Callback );
+    Can_EnableControllerInterrupts_StubWithCallback( Can_EnableControllerInterrupts_Callback );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRANSMIT_MULTIPLE, CANIF_E_INVALID_TXPDUID, E_OK );
 
-    ret = CanIf_GetPduMode( CANIF_CONTROLLER_0, NULL_PTR );
+    ret = CanIf_TransmitMultiple( requests, results, 5u );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_GetPduMode() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_TransmitMultiple() should return E_OK" );
+    TEST_ASSERT_EQUAL( E_OK, results[ 0 ] );
+    TEST_ASSERT_EQUAL( E_OK, results[ 1 ] );
+    TEST_ASSERT_EQUAL( E_NOT_OK, results[ 2 ] );
+    TEST_ASSERT_EQUAL( E_OK, results[ 3 ] );
+    TEST_ASSERT_EQUAL( E_OK, results[ 4 ] );
+    TEST_ASSERT_EQUAL( 4u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x100u, WritePdus[ 0 ].id );
+    TEST_ASSERT_EQUAL_HEX32( 0x101u, WritePdus[ 1 ].id );
+    TEST_ASSERT_EQUAL( 2u, IntsDisableCount );
+    TEST_ASSERT_EQUAL( 0u, IntsLevel );
 }
 
 /**
- * @brief   Test case for CanIf_GetPduMode function with valid parameters
+ * @brief   Test case for CanIf_TransmitMultiple function with the driver busy
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check Can_Write is only called once for the HTH once it returns CAN_BUSY, the
+ * next requests go to the Tx buffer until it is full, and the buffered ones are sent on the next
+ * confirmations
  */
-void test__CanIf_GetPduMode__valid_parameters( void )
+void test__CanIf_TransmitMultiple__can_busy_buffered( void )
 {
     Std_ReturnType ret;
-    CanIf_PduModeType mode;
+    Std_ReturnType results[ 3 ];
+    uint8 data[ 8 ]                       = { 0x11 };
+    PduInfoType pduInfo                   = { .SduLength = 8, .SduDataPtr = data };
+    const CanIf_TxRequestType requests[ ] = {
+        { .TxPduId = 1u, .PduInfoPtr = &pduInfo },
+        { .TxPduId = 0u, .PduInfoPtr = &pduInfo },
+        { .TxPduId = 2u, .PduInfoPtr = &pduInfo } };
 
-    ret = CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_GetPduMode() should return E_OK" );
+    ret = CanIf_TransmitMultiple( requests, results, 3u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_TransmitMultiple() should return E_OK" );
+    TEST_ASSERT_EQUAL( E_OK, results[ 0 ] );
+    TEST_ASSERT_EQUAL( E_OK, results[ 1 ] );
+    TEST_ASSERT_EQUAL( E_NOT_OK, results[ 2 ] );
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
+
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 0u );
+    CanIf_TxConfirmation( 0u );
+
+    TEST_ASSERT_EQUAL( 3u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x100u, WritePdus[ 1 ].id );
+    TEST_ASSERT_EQUAL_HEX32( 0x101u, WritePdus[ 2 ].id );
+    TEST_ASSERT_EQUAL_HEX8( 0x11, WriteData[ 2 ][ 0 ] );
 }
 
 /**
- * @brief   Test case for CanIf_GetVersionInfo function with null pointer
+ * @brief   Test case for CanIf_Init function with too many Tx PDUs
  *
- * This test case only check if Det_ReportError is called when the versioninfo pointer is invalid
+ * This test case check the module stays uninitialized when the configuration has more Tx PDUs
+ * than the runtime table reserved for them
  */
-void test__CanIf_GetVersionInfo__null_ptr( void )
+void test__CanIf_Init__too_many_tx_pdus( void )
 {
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    CanIf_ConfigType config = CanIfConfig;
+    config.MaxTxPduCfg      = CANIF_NUMBER_OF_TX_PDUS + 1u;
+    LocalConfigPtr          = NULL_PTR;
 
-    CanIf_GetVersionInfo( NULL_PTR );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_INIT, CANIF_E_INIT_FAILED, E_OK );
+
+    CanIf_Init( &config );
+
+    TEST_ASSERT_EQUAL( NULL_PTR, LocalConfigPtr );
 }
 
 /**
- * @brief   Test case for CanIf_GetVersionInfo function with valid parameters
+ * @brief   Test case for CanIf_Init function with too many Tx buffers
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check the module stays uninitialized when the configuration has more Tx buffers
+ * than the room reserved for them
  */
-void test__CanIf_GetVersionInfo__valid_parameters( void )
+void test__CanIf_Init__too_many_tx_buffers( void )
 {
-    Std_VersionInfoType versioninfo;
+    CanIf_ConfigType config = CanIfConfig;
+    config.NumberOfBuffers  = CANIF_NUMBER_OF_TX_BUFFERS + 1u;
+    LocalConfigPtr          = NULL_PTR;
 
-    CanIf_GetVersionInfo( &versioninfo );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_INIT, CANIF_E_INIT_FAILED, E_OK );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_VENDOR_ID, versioninfo.vendorID, "CanIf_GetVersionInfo() should return CANIF_VENDOR_ID" );
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_MODULE_ID, versioninfo.moduleID, "CanIf_GetVersionInfo() should return CANIF_MODULE_ID" );
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_SW_MAJOR_VERSION, versioninfo.sw_major_version, "CanIf_GetVersionInfo() should return CANIF_SW_MAJOR_VERSION" );
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_SW_MINOR_VERSION, versioninfo.sw_minor_version, "CanIf_GetVersionInfo() should return CANIF_SW_MINOR_VERSION" );
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_SW_PATCH_VERSION, versioninfo.sw_patch_version, "CanIf_GetVersionInfo() should return CANIF_SW_PATCH_VERSION" );
+    CanIf_Init( &config );
+
+    TEST_ASSERT_EQUAL( NULL_PTR, LocalConfigPtr );
 }
 
 /**
- * @brief   Test case for CanIf_SetDynamicTxId function with null pointer
+ * @brief   Test case for CanIf_Init function with too many Tx buffer entries
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check the module stays uninitialized when the Tx buffers of the configuration
+ * hold more entries than the room reserved for them
  */
-void test__CanIf_SetDynamicTxId__null_ptr( void )
+void test__CanIf_Init__too_many_tx_buffer_entries( void )
 {
-    LocalConfigPtr = NULL_PTR;
+    CanIf_BufferCfgType buffers[ CANIF_NUMBER_OF_TX_BUFFERS ];
+    CanIf_ConfigType config = CanIfConfig;
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    buffers[ 0 ]      = CanIfConfig.BufferCfgs[ 0 ];
+    buffers[ 1 ]      = CanIfConfig.BufferCfgs[ 1 ];
+    buffers[ 1 ].Size = CANIF_TX_BUFFER_ENTRIES;
+    config.BufferCfgs = buffers;
+    LocalConfigPtr    = NULL_PTR;
 
-    CanIf_SetDynamicTxId( CANIF_VALID_TX_PDU, 0x12345678 );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_INIT, CANIF_E_INIT_FAILED, E_OK );
+
+    CanIf_Init( &config );
+
+    TEST_ASSERT_EQUAL( NULL_PTR, LocalConfigPtr );
 }
 
 /**
- * @brief   Test case for CanIf_SetDynamicTxId function with invalid PduId
+ * @brief   Test case for CanIf_Init function with too many Rx PDUs
  *
- * This test case only check if Det_ReportError is called when the PduId is invalid
+ * This test case check the module stays uninitialized when the configuration has more Rx PDUs
+ * than the lookup array reserved for them
  */
-void test__CanIf_SetDynamicTxId__invalid_PduId( void )
+void test__CanIf_Init__too_many_rx_pdus( void )
 {
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    CanIf_ConfigType config = CanIfConfig;
+    config.MaxRxPduCfg      = CANIF_NUMBER_OF_RX_PDUS + 1u;
+    LocalConfigPtr          = NULL_PTR;
 
-    CanIf_SetDynamicTxId( CANIF_NUMBER_OF_TX_PDUS, 0x12345678 );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_INIT, CANIF_E_INIT_FAILED, E_OK );
+
+    CanIf_Init( &config );
+
+    TEST_ASSERT_EQUAL( NULL_PTR, LocalConfigPtr );
 }
 
 /**
- * @brief   Test case for CanIf_SetDynamicTxId function with invalid canId
+ * @brief   Test case for CanIf_Init function with a Rx PDU on an HRH out of range
  *
- * This test case only check if Det_ReportError is called when the canId is invalid
+ * This test case check the module stays uninitialized when a Rx PDU references an HRH beyond the
+ * ones the receive lookup reserved room for
  */
-void test__CanIf_SetDynamicTxId__invalid_canId( void )
+void test__CanIf_Init__rx_pdu_hrh_out_of_range( void )
 {
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    CanIf_RxPduCfgType rxPdus[ CANIF_NUMBER_OF_RX_PDUS ];
+    CanIf_ConfigType config = CanIfConfig;
 
-    CanIf_SetDynamicTxId( CANIF_VALID_TX_PDU, 0x00 );
+    for( uint8 i = 0u; i < CanIfConfig.MaxRxPduCfg; i++ )
+    {
+        rxPdus[ i ] = CanIfConfig.RxPduCfgs[ i ];
+    }
+    rxPdus[ 1 ].Hrh  = CAN_NUMBER_OF_HOHS;
+    config.RxPduCfgs = rxPdus;
+    LocalConfigPtr   = NULL_PTR;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_INIT, CANIF_E_INIT_FAILED, E_OK );
+
+    CanIf_Init( &config );
+
+    TEST_ASSERT_EQUAL( NULL_PTR, LocalConfigPtr );
 }
 
 /**
- * @brief   Test case for CanIf_SetDynamicTxId function with valid parameters
+ * @brief   Test case for CanIf_Init function with a Tx PDU on a controller out of range
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check the module stays uninitialized when a Tx PDU references a controller that
+ * is not configured, its bit would land outside the PDU mode bitmasks
  */
-void test__CanIf_SetDynamicTxId__valid_parameters( void )
+void test__CanIf_Init__tx_pdu_controller_out_of_range( void )
 {
-    CanIf_SetDynamicTxId( CANIF_VALID_TX_PDU, 0x12345678 );
+    CanIf_TxPduCfgType txPdus[ CANIF_NUMBER_OF_TX_PDUS ];
+    CanIf_ConfigType config = CanIfConfig;
+
+    for( uint8 i = 0u; i < CanIfConfig.MaxTxPduCfg; i++ )
+    {
+        txPdus[ i ] = CanIfConfig.TxPduCfgs[ i ];
+    }
+    txPdus[ 2 ].ControllerId = CanIfConfig.NumberOfCanControllers;
+    config.TxPduCfgs         = txPdus;
+    LocalConfigPtr           = NULL_PTR;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_INIT, CANIF_E_INIT_FAILED, E_OK );
+
+    CanIf_Init( &config );
+
+    TEST_ASSERT_EQUAL( NULL_PTR, LocalConfigPtr );
 }
 
 /**
- * @brief   Test case for CanIf_GetTxConfirmationState function with null pointer
+ * @brief   Test case for CanIf_Init function with a Tx buffer on a controller out of range
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check the module stays uninitialized when a Tx buffer references a controller
+ * that is not configured
  */
-void test__CanIf_GetTxConfirmationState__null_ptr( void )
+void test__CanIf_Init__tx_buffer_controller_out_of_range( void )
 {
-    CanIf_NotifStatusType ret;
-    LocalConfigPtr = NULL_PTR;
+    CanIf_BufferCfgType buffers[ CANIF_NUMBER_OF_TX_BUFFERS ];
+    CanIf_ConfigType config = CanIfConfig;
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    buffers[ 0 ]              = CanIfConfig.BufferCfgs[ 0 ];
+    buffers[ 1 ]              = CanIfConfig.BufferCfgs[ 1 ];
+    buffers[ 1 ].ControllerId = CanIfConfig.NumberOfCanControllers;
+    config.BufferCfgs         = buffers;
+    LocalConfigPtr            = NULL_PTR;
 
-    ret = CanIf_GetTxConfirmationState( CANIF_CONTROLLER_0 );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_INIT, CANIF_E_INIT_FAILED, E_OK );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_GetTxConfirmationState() should return E_NOT_OK" );
+    CanIf_Init( &config );
+
+    TEST_ASSERT_EQUAL( NULL_PTR, LocalConfigPtr );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_ReadRxPduData__null_ptr( void )
+{
+    Std_ReturnType ret;
+    PduInfoType pduInfo;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_ReadRxPduData( CANIF_VALID_TX_PDU, &pduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData function with invalid PduInfoPtr
+ *
+ * This test case only check if Det_ReportError is called when the PduInfoPtr is invalid
+ */
+void test__CanIf_ReadRxPduData__invalid_PduInfoPtr( void )
+{
+    Std_ReturnType ret;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_ReadRxPduData( CANIF_VALID_TX_PDU, NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData function with invalid PduId
+ *
+ * This test case only check if Det_ReportError is called when the PduId is invalid
+ */
+void test__CanIf_ReadRxPduData__invalid_PduId( void )
+{
+    Std_ReturnType ret;
+    PduInfoType pduInfo = { .SduLength = 9 };
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_ReadRxPduData( CANIF_NUMBER_OF_RX_PDUS, &pduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData function with nothing received
+ *
+ * This test case check if the function return E_NOT_OK when the parameters are valid but no
+ * L-PDU has been received yet for the PDU
+ */
+void test__CanIf_ReadRxPduData__no_data_received( void )
+{
+    Std_ReturnType ret;
+    PduInfoType pduInfo = { .SduLength = 8 };
+
+    ret = CanIf_ReadRxPduData( CANIF_VALID_TX_PDU, &pduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData function after a reception
+ *
+ * This test case check the function returns the payload and length of the L-PDU received
+ */
+void test__CanIf_ReadRxPduData__data_received( void )
+{
+    Std_ReturnType ret;
+    uint8 rxData[ 3 ]           = { 0x11, 0x22, 0x33 };
+    uint8 readData[ 8 ]         = { 0 };
+    PduInfoType pduInfo         = { .SduDataPtr = readData, .SduLength = 8 };
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x300, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 3 };
+
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    ret = CanIf_ReadRxPduData( 0u, &pduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_ReadRxPduData() should return E_OK" );
+    TEST_ASSERT_EQUAL( 3u, pduInfo.SduLength );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( rxData, readData, 3 );
+    TEST_ASSERT_EQUAL_HEX8( 0x00, readData[ 3 ] );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData function with several receptions
+ *
+ * This test case check the function returns the last L-PDU received, no matter which of the two
+ * copies kept it
+ */
+void test__CanIf_ReadRxPduData__last_data_received( void )
+{
+    Std_ReturnType ret;
+    uint8 readData[ 8 ]      = { 0 };
+    PduInfoType pduInfo      = { .SduDataPtr = readData, .SduLength = 8 };
+    const Can_HwType Mailbox = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x300, .ControllerId = 0 };
+
+    for( uint8 Reception = 1u; Reception <= 3u; Reception++ )
+    {
+        uint8 rxData[ 8 ]           = { Reception, Reception, Reception, Reception, Reception, Reception, Reception, Reception };
+        const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = Reception };
+
+        CanIf_RxIndication( &Mailbox, &PduInfoPt );
+        pduInfo.SduLength = 8;
+        ret               = CanIf_ReadRxPduData( 0u, &pduInfo );
+
+        TEST_ASSERT_EQUAL( E_OK, ret );
+        TEST_ASSERT_EQUAL( Reception, pduInfo.SduLength );
+        TEST_ASSERT_EQUAL_HEX8_ARRAY( rxData, readData, Reception );
+    }
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData function with a small buffer
+ *
+ * This test case check the function return E_NOT_OK and leaves the caller buffer untouched when
+ * the last L-PDU received does not fit on it
+ */
+void test__CanIf_ReadRxPduData__buffer_too_small( void )
+{
+    Std_ReturnType ret;
+    uint8 rxData[ 4 ]           = { 0x11, 0x22, 0x33, 0x44 };
+    uint8 readData[ 4 ]         = { 0 };
+    PduInfoType pduInfo         = { .SduDataPtr = readData, .SduLength = 3 };
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x300, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 4 };
+
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    ret = CanIf_ReadRxPduData( 0u, &pduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 3u, pduInfo.SduLength );
+    TEST_ASSERT_EQUAL_HEX8( 0x00, readData[ 0 ] );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData function with a PDU not kept
+ *
+ * This test case check if Det_ReportError is called when the PDU is not configured to keep the
+ * last L-PDU received
+ */
+void test__CanIf_ReadRxPduData__not_readable_PduId( void )
+{
+    Std_ReturnType ret;
+    uint8 readData[ 8 ];
+    PduInfoType pduInfo = { .SduDataPtr = readData, .SduLength = 8 };
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_PDU_DATA, CANIF_E_INVALID_RXPDUID, E_OK );
+
+    ret = CanIf_ReadRxPduData( 2u, &pduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxPduData() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadTxNotifStatus function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_ReadTxNotifStatus__null_ptr( void )
+{
+    Std_ReturnType ret;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadTxNotifStatus() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadTxNotifStatus function with invalid PduId
+ *
+ * This test case only check if Det_ReportError is called when the PduId is invalid
+ */
+void test__CanIf_ReadTxNotifStatus__invalid_PduId( void )
+{
+    Std_ReturnType ret;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_ReadTxNotifStatus( CANIF_NUMBER_OF_TX_PDUS );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadTxNotifStatus() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadTxNotifStatus function with valid parameters
+ *
+ * This test case check if the function return CANIF_NO_NOTIFICATION when the PDU has not been
+ * transmitted yet
+ */
+void test__CanIf_ReadTxNotifStatus__valid_parameters( void )
+{
+    Std_ReturnType ret;
+
+    ret = CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadTxNotifStatus() should return CANIF_NO_NOTIFICATION" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadTxNotifStatus function after a transmit confirmation
+ *
+ * This test case check the confirmation is returned once, the read resets it
+ */
+void test__CanIf_ReadTxNotifStatus__confirmed( void )
+{
+    CanIf_TxConfirmation( CANIF_VALID_TX_PDU );
+    CanIf_TxConfirmation( CANIF_VALID_TX_PDU );
+
+    TEST_ASSERT_EQUAL( CANIF_NO_NOTIFICATION, CanIf_ReadTxNotifStatus( 0u ) );
+    TEST_ASSERT_EQUAL( CANIF_TX_RX_NOTIFICATION, CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU ) );
+    TEST_ASSERT_EQUAL( CANIF_NO_NOTIFICATION, CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU ) );
+
+    CanIf_TxConfirmation( CANIF_VALID_TX_PDU );
+
+    TEST_ASSERT_EQUAL( CANIF_TX_RX_NOTIFICATION, CanIf_ReadTxNotifStatus( CANIF_VALID_TX_PDU ) );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadTxNotifStatusBits function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_ReadTxNotifStatusBits__null_ptr( void )
+{
+    Std_ReturnType ret;
+    uint32 bits[ CANIF_TX_NOTIF_WORDS ];
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_TX_NOTIF_BITS, CANIF_E_UNINIT, E_OK );
+
+    ret = CanIf_ReadTxNotifStatusBits( bits );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadTxNotifStatusBits() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadTxNotifStatusBits function with invalid pointer
+ *
+ * This test case only check if Det_ReportError is called when the bitmap pointer is invalid
+ */
+void test__CanIf_ReadTxNotifStatusBits__invalid_pointer( void )
+{
+    Std_ReturnType ret;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_TX_NOTIF_BITS, CANIF_E_PARAM_POINTER, E_OK );
+
+    ret = CanIf_ReadTxNotifStatusBits( NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadTxNotifStatusBits() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadTxNotifStatusBits function after several confirmations
+ *
+ * This test case check every PDU confirmed has its bit set, the read resets all of them and a
+ * notification already read by CanIf_ReadTxNotifStatus is not returned again
+ */
+void test__CanIf_ReadTxNotifStatusBits__confirmed( void )
+{
+    Std_ReturnType ret;
+    uint32 bits[ CANIF_TX_NOTIF_WORDS ];
+
+    CanIf_TxConfirmation( 0u );
+    CanIf_TxConfirmation( 3u );
+    CanIf_TxConfirmation( 4u );
+    (void)CanIf_ReadTxNotifStatus( 3u );
+
+    ret = CanIf_ReadTxNotifStatusBits( bits );
+
+    TEST_ASSERT_EQUAL( E_OK, ret );
+    TEST_ASSERT_EQUAL_HEX32( 0x00000011, bits[ 0 ] );
+
+    ret = CanIf_ReadTxNotifStatusBits( bits );
+
+    TEST_ASSERT_EQUAL( E_OK, ret );
+    TEST_ASSERT_EQUAL_HEX32( 0x00000000, bits[ 0 ] );
+    TEST_ASSERT_EQUAL( CANIF_NO_NOTIFICATION, CanIf_ReadTxNotifStatus( 4u ) );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxNotifStatus function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_ReadRxNotifStatus__null_ptr( void )
+{
+    Std_ReturnType ret;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_ReadRxNotifStatus( CANIF_VALID_TX_PDU );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadRxNotifStatus() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxNotifStatus function with invalid PduId
+ *
+ * This test case only check if Det_ReportError is called when the PduId is invalid
+ */
+void test__CanIf_ReadRxNotifStatus__invalid_PduId( void )
+{
+    Std_ReturnType ret;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_ReadRxNotifStatus( CANIF_NUMBER_OF_RX_PDUS );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadRxNotifStatus() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxNotifStatus function with valid parameters
+ *
+ * This test case check if the function return CANIF_NO_NOTIFICATION when the PDU has not been
+ * received yet
+ */
+void test__CanIf_ReadRxNotifStatus__valid_parameters( void )
+{
+    Std_ReturnType ret;
+
+    ret = CanIf_ReadRxNotifStatus( CANIF_VALID_TX_PDU );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_ReadRxNotifStatus() should return CANIF_NO_NOTIFICATION" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxNotifStatus function after a reception
+ *
+ * This test case check the indication is returned once, the read resets it
+ */
+void test__CanIf_ReadRxNotifStatus__indicated( void )
+{
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x120, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
+
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+
+    TEST_ASSERT_EQUAL( CANIF_NO_NOTIFICATION, CanIf_ReadRxNotifStatus( 0u ) );
+    TEST_ASSERT_EQUAL( CANIF_TX_RX_NOTIFICATION, CanIf_ReadRxNotifStatus( 2u ) );
+    TEST_ASSERT_EQUAL( CANIF_NO_NOTIFICATION, CanIf_ReadRxNotifStatus( 2u ) );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxNotifStatusBits function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_ReadRxNotifStatusBits__null_ptr( void )
+{
+    Std_ReturnType ret;
+    uint32 bits[ CANIF_RX_NOTIF_WORDS ];
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_NOTIF_BITS, CANIF_E_UNINIT, E_OK );
+
+    ret = CanIf_ReadRxNotifStatusBits( bits );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxNotifStatusBits() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxNotifStatusBits function with invalid pointer
+ *
+ * This test case only check if Det_ReportError is called when the bitmap pointer is invalid
+ */
+void test__CanIf_ReadRxNotifStatusBits__invalid_pointer( void )
+{
+    Std_ReturnType ret;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_RX_NOTIF_BITS, CANIF_E_PARAM_POINTER, E_OK );
+
+    ret = CanIf_ReadRxNotifStatusBits( NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_ReadRxNotifStatusBits() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxNotifStatusBits function after several receptions
+ *
+ * This test case check every PDU received has its bit set and the read resets all of them, a
+ * PDU received again after the read is flagged again
+ */
+void test__CanIf_ReadRxNotifStatusBits__indicated( void )
+{
+    uint32 bits[ CANIF_RX_NOTIF_WORDS ];
+    Can_HwType Mailbox          = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x300, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
+
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    Mailbox.CanId = 0x7E5;
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+
+    TEST_ASSERT_EQUAL( E_OK, CanIf_ReadRxNotifStatusBits( bits ) );
+    TEST_ASSERT_EQUAL_HEX32( 0x00000009, bits[ 0 ] );
+
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+
+    TEST_ASSERT_EQUAL( E_OK, CanIf_ReadRxNotifStatusBits( bits ) );
+    TEST_ASSERT_EQUAL_HEX32( 0x00000008, bits[ 0 ] );
+}
+
+/**
+ * @brief   Test case for CanIf_SetPduMode function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_SetPduMode__null_ptr( void )
+{
+    Std_ReturnType ret;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_OFFLINE );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetPduMode function with invalid controller
+ *
+ * This test case only check if Det_ReportError is called when the controller is invalid
+ */
+void test__CanIf_SetPduMode__invalid_controller( void )
+{
+    Std_ReturnType ret;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_SetPduMode( CANIF_CONTROLLER_INVALID, CANIF_OFFLINE );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetPduMode function with invalid PduModeRequest
+ *
+ * This test case only check if Det_ReportError is called when the PduModeRequest is invalid
+ */
+void test__CanIf_SetPduMode__invalid_PduModeRequest( void )
+{
+    Std_ReturnType ret;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE + 1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetPduMode function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_SetPduMode__valid_parameters( void )
+{
+    Std_ReturnType ret;
+
+    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_OFFLINE );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_SetPduMode() should return E_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetPduMode function with the controller not started
+ *
+ * This test case check the request is not accepted when the controller is not in CAN_CS_STARTED
+ */
+void test__CanIf_SetPduMode__controller_not_started( void )
+{
+    Std_ReturnType ret;
+    CanIf_PduModeType mode;
+
+    CanIf_ControllerModeIndication( CANIF_CONTROLLER_0, CAN_CS_STOPPED );
+
+    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_OFFLINE );
+    (void)CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( CANIF_ONLINE, mode );
+}
+
+/**
+ * @brief   Test case for CanIf_SetPduMode function leaving the online mode
+ *
+ * This test case check the L-PDUs waiting in the transmit buffer of the channel are dropped when
+ * it leaves CANIF_ONLINE, they are not sent once the channel is back online
+ */
+void test__CanIf_SetPduMode__tx_offline_drops_buffered( void )
+{
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
+
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+    (void)CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
+
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_TX_OFFLINE );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 0u );
+
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
+}
+
+/**
+ * @brief   Test case for CanIf_GetPduMode function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_GetPduMode__null_ptr( void )
+{
+    Std_ReturnType ret;
+    CanIf_PduModeType mode;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_GetPduMode() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetPduMode function with invalid controller
+ *
+ * This test case only check if Det_ReportError is called when the controller is invalid
+ */
+void test__CanIf_GetPduMode__invalid_controller( void )
+{
+    Std_ReturnType ret;
+    CanIf_PduModeType mode;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_GetPduMode( CANIF_CONTROLLER_INVALID, &mode );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_GetPduMode() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetPduMode function with invalid PduModePtr
+ *
+ * This test case only check if Det_ReportError is called when the mode pointer is invalid
+ */
+void test__CanIf_GetPduMode__invalid_PduModePtr( void )
+{
+    Std_ReturnType ret;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_GetPduMode( CANIF_CONTROLLER_0, NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_GetPduMode() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetPduMode function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_GetPduMode__valid_parameters( void )
+{
+    Std_ReturnType ret;
+    CanIf_PduModeType mode;
+
+    ret = CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ret, "CanIf_GetPduMode() should return E_OK" );
+    TEST_ASSERT_EQUAL( CANIF_ONLINE, mode );
+}
+
+/**
+ * @brief   Test case for CanIf_GetPduMode function after every mode
+ *
+ * This test case check each mode set is read back, and the other channel keeps its own mode
+ */
+void test__CanIf_GetPduMode__every_mode( void )
+{
+    static const CanIf_PduModeType Modes[ ] = { CANIF_OFFLINE, CANIF_TX_OFFLINE, CANIF_TX_OFFLINE_ACTIVE, CANIF_ONLINE };
+    CanIf_PduModeType mode;
+
+    for( uint8 i = 0u; i < ( sizeof( Modes ) / sizeof( Modes[ 0 ] ) ); i++ )
+    {
+        (void)CanIf_SetPduMode( CANIF_CONTROLLER_1, Modes[ i ] );
+        (void)CanIf_GetPduMode( CANIF_CONTROLLER_1, &mode );
+        TEST_ASSERT_EQUAL( Modes[ i ], mode );
+
+        (void)CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+        TEST_ASSERT_EQUAL( CANIF_ONLINE, mode );
+    }
+}
+
+/**
+ * @brief   Test case for CanIf_GetVersionInfo function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the versioninfo pointer is invalid
+ */
+void test__CanIf_GetVersionInfo__null_ptr( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CanIf_GetVersionInfo( NULL_PTR );
+}
+
+/**
+ * @brief   Test case for CanIf_GetVersionInfo function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_GetVersionInfo__valid_parameters( void )
+{
+    Std_VersionInfoType versioninfo;
+
+    CanIf_GetVersionInfo( &versioninfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_VENDOR_ID, versioninfo.vendorID, "CanIf_GetVersionInfo() should return CANIF_VENDOR_ID" );
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_MODULE_ID, versioninfo.moduleID, "CanIf_GetVersionInfo() should return CANIF_MODULE_ID" );
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_SW_MAJOR_VERSION, versioninfo.sw_major_version, "CanIf_GetVersionInfo() should return CANIF_SW_MAJOR_VERSION" );
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_SW_MINOR_VERSION, versioninfo.sw_minor_version, "CanIf_GetVersionInfo() should return CANIF_SW_MINOR_VERSION" );
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_SW_PATCH_VERSION, versioninfo.sw_patch_version, "CanIf_GetVersionInfo() should return CANIF_SW_PATCH_VERSION" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetDynamicTxId function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_SetDynamicTxId__null_ptr( void )
+{
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CanIf_SetDynamicTxId( CANIF_VALID_TX_PDU, 0x12345678 );
+}
+
+/**
+ * @brief   Test case for CanIf_SetDynamicTxId function with invalid PduId
+ *
+ * This test case only check if Det_ReportError is called when the PduId is invalid
+ */
+void test__CanIf_SetDynamicTxId__invalid_PduId( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CanIf_SetDynamicTxId( CANIF_NUMBER_OF_TX_PDUS, 0x12345678 );
+}
+
+/**
+ * @brief   Test case for CanIf_SetDynamicTxId function with invalid canId
+ *
+ * This test case only check if Det_ReportError is called when the canId is invalid
+ */
+void test__CanIf_SetDynamicTxId__invalid_canId( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CanIf_SetDynamicTxId( CANIF_VALID_TX_PDU, 0x00 );
+}
+
+/**
+ * @brief   Test case for CanIf_SetDynamicTxId function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_SetDynamicTxId__valid_parameters( void )
+{
+    CanIf_SetDynamicTxId( CANIF_VALID_TX_PDU, 0x12345678 );
+}
+
+/**
+ * @brief   Test case for CanIf_GetTxConfirmationState function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_GetTxConfirmationState__null_ptr( void )
+{
+    CanIf_NotifStatusType ret;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_GetTxConfirmationState( CANIF_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_GetTxConfirmationState() should return E_NOT_OK" );
 }
 
 /**
@@ -758,622 +1834,1595 @@ void test__CanIf_GetTxConfirmationState__null_ptr( void )
  *
  * This test case only check if Det_ReportError is called when the controller is invalid
  */
-void test__CanIf_GetTxConfirmationState__invalid_controller( void )
+void test__CanIf_GetTxConfirmationState__invalid_controller( void )
+{
+    CanIf_NotifStatusType ret;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    ret = CanIf_GetTxConfirmationState( CANIF_CONTROLLER_INVALID );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_GetTxConfirmationState() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetTxConfirmationState function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_GetTxConfirmationState__valid_parameters( void )
+{
+    CanIf_NotifStatusType ret;
+
+    ret = CanIf_GetTxConfirmationState( CANIF_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CANIF_TX_RX_NOTIFICATION, ret, "CanIf_GetTxConfirmationState() should return E_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetBaudrate function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_SetBaudrate__null_ptr( void )
+{
+    Std_ReturnType RetVal;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_SetBaudrate( CANIF_CONTROLLER_0, 0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_SetBaudrate() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetBaudrate function with invalid controller
+ *
+ * This test case only check if Det_ReportError is called when the controller is invalid
+ */
+void test__CanIf_SetBaudrate__invalid_controller( void )
+{
+    Std_ReturnType RetVal;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_SetBaudrate( CANIF_CONTROLLER_INVALID, 0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_SetBaudrate() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_SetBaudrate function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_SetBaudrate__valid_parameters( void )
+{
+    Std_ReturnType RetVal;
+
+    RetVal = CanIf_SetBaudrate( CANIF_CONTROLLER_0, 0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_SetBaudrate() should return E_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetControllerRxErrorCounter function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_GetControllerRxErrorCounter__null_ptr( void )
+{
+    Std_ReturnType RetVal;
+    uint8 ErrorCounter;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetControllerRxErrorCounter( CANIF_CONTROLLER_0, &ErrorCounter );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerRxErrorCounter() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetControllerRxErrorCounter function with invalid controller
+ *
+ * This test case only check if Det_ReportError is called when the controller is invalid
+ */
+void test__CanIf_GetControllerRxErrorCounter__invalid_controller( void )
+{
+    Std_ReturnType RetVal;
+    uint8 ErrorCounter;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetControllerRxErrorCounter( CANIF_CONTROLLER_INVALID, &ErrorCounter );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerRxErrorCounter() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetControllerRxErrorCounter function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the ErrorCounter pointer is invalid
+ */
+void test__CanIf_GetControllerRxErrorCounter__null_pointer2( void )
+{
+    Std_ReturnType RetVal;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetControllerRxErrorCounter( CANIF_CONTROLLER_0, NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerRxErrorCounter() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetControllerRxErrorCounter function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_GetControllerRxErrorCounter__valid_parameters( void )
+{
+    Std_ReturnType RetVal;
+    uint8 ErrorCounter;
+
+    RetVal = CanIf_GetControllerRxErrorCounter( CANIF_CONTROLLER_0, &ErrorCounter );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetControllerRxErrorCounter() should return E_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetControllerTxErrorCounter function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_GetControllerTxErrorCounter__null_ptr( void )
+{
+    Std_ReturnType RetVal;
+    uint8 ErrorCounter;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetControllerTxErrorCounter( CANIF_CONTROLLER_0, &ErrorCounter );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerTxErrorCounter() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetControllerTxErrorCounter function with invalid controller
+ *
+ * This test case only check if Det_ReportError is called when the controller is invalid
+ */
+void test__CanIf_GetControllerTxErrorCounter__invalid_controller( void )
+{
+    Std_ReturnType RetVal;
+    uint8 ErrorCounter;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetControllerTxErrorCounter( CANIF_CONTROLLER_INVALID, &ErrorCounter );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerTxErrorCounter() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetControllerTxErrorCounter function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the ErrorCounter pointer is invalid
+ */
+void test__CanIf_GetControllerTxErrorCounter__null_pointer2( void )
+{
+    Std_ReturnType RetVal;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetControllerTxErrorCounter( CANIF_CONTROLLER_0, NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerTxErrorCounter() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetControllerTxErrorCounter function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_GetControllerTxErrorCounter__valid_parameters( void )
+{
+    Std_ReturnType RetVal;
+    uint8 ErrorCounter;
+
+    RetVal = CanIf_GetControllerTxErrorCounter( CANIF_CONTROLLER_0, &ErrorCounter );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetControllerTxErrorCounter() should return E_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_DisableBusMirroring function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_EnableBusMirroring__null_ptr( void )
+{
+    Std_ReturnType RetVal;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, STD_ON );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_EnableBusMirroring() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_DisableBusMirroring function with invalid controller
+ *
+ * This test case only check if Det_ReportError is called when the controller is invalid
+ */
+void test__CanIf_EnableBusMirroring__invalid_controller( void )
+{
+    Std_ReturnType RetVal;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_EnableBusMirroring( CANIF_CONTROLLER_INVALID, STD_ON );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_EnableBusMirroring() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_DisableBusMirroring function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_EnableBusMirroring__valid_parameters( void )
+{
+    Std_ReturnType RetVal;
+
+    RetVal = CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, STD_ON );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_EnableBusMirroring() should return E_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_ReadMirrorFrames__null_ptr( void )
+{
+    CanIf_MirrorFrameType Frames[ 1 ];
+    uint16 Count = 1u;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_MIRROR_FRAMES, CANIF_E_UNINIT, E_OK );
+
+    Std_ReturnType RetVal = CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_ReadMirrorFrames() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with invalid controller
+ *
+ * This test case only check if Det_ReportError is called when the controller is invalid
+ */
+void test__CanIf_ReadMirrorFrames__invalid_controller( void )
 {
-    CanIf_NotifStatusType ret;
+    CanIf_MirrorFrameType Frames[ 1 ];
+    uint16 Count = 1u;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_MIRROR_FRAMES, CANIF_E_PARAM_CONTROLLERID, E_OK );
+
+    Std_ReturnType RetVal = CanIf_ReadMirrorFrames( CANIF_CONTROLLER_INVALID, Frames, &Count );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_ReadMirrorFrames() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with invalid pointers
+ *
+ * This test case only check if Det_ReportError is called when there is no buffer for the frames
+ */
+void test__CanIf_ReadMirrorFrames__invalid_pointer( void )
+{
+    uint16 Count = 1u;
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_READ_MIRROR_FRAMES, CANIF_E_PARAM_POINTER, E_OK );
+
+    Std_ReturnType RetVal = CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, NULL_PTR, &Count );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_ReadMirrorFrames() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with mirroring disabled
+ *
+ * This test case check no frame is captured on a controller without mirroring, before it is
+ * enabled or after it is disabled again
+ */
+void test__CanIf_ReadMirrorFrames__mirroring_disabled( void )
+{
+    uint8 rxData[ 2 ]           = { 0x11, 0x22 };
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x120, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 2u };
+    CanIf_MirrorFrameType Frames[ 2 ];
+    uint16 Count = 2u;
+
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_1, TRUE );
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, TRUE );
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, FALSE );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+
+    Std_ReturnType RetVal = CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+
+    TEST_ASSERT_EQUAL( E_OK, RetVal );
+    TEST_ASSERT_EQUAL( 0u, Count );
+    TEST_ASSERT_EQUAL( 2u, RxIndicationCount );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with received and transmitted frames
+ *
+ * This test case check both directions are captured in order with their timestamp, CAN id and
+ * payload, the received frame even when no PDU matches it
+ */
+void test__CanIf_ReadMirrorFrames__rx_and_tx_captured( void )
+{
+    uint8 rxData[ 3 ]           = { 0x11, 0x22, 0x33 };
+    uint8 txData[ 2 ]           = { 0xAA, 0xBB };
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x555, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 3u };
+    PduInfoType TxInfo          = { .SduDataPtr = txData, .SduLength = 2u };
+    CanIf_MirrorFrameType Frames[ 4 ];
+    uint16 Count = 4u;
+
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, TRUE );
+
+    CanIf_Test_TimeStamp = 100u;
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    CanIf_Test_TimeStamp = 200u;
+    (void)CanIf_Transmit( CANIF_VALID_TX_PDU, &TxInfo );
+
+    Std_ReturnType RetVal = CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+
+    TEST_ASSERT_EQUAL( E_OK, RetVal );
+    TEST_ASSERT_EQUAL( 2u, Count );
+    TEST_ASSERT_EQUAL( 0u, RxIndicationCount );
+    TEST_ASSERT_EQUAL( CANIF_MIRROR_RX, Frames[ 0 ].Direction );
+    TEST_ASSERT_EQUAL( 100u, Frames[ 0 ].TimeStamp );
+    TEST_ASSERT_EQUAL( 0u, Frames[ 0 ].Sequence );
+    TEST_ASSERT_EQUAL_HEX32( 0x555u, Frames[ 0 ].CanId );
+    TEST_ASSERT_EQUAL( 3u, Frames[ 0 ].Length );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( rxData, Frames[ 0 ].Data, 3u );
+    TEST_ASSERT_EQUAL( CANIF_MIRROR_TX, Frames[ 1 ].Direction );
+    TEST_ASSERT_EQUAL( 200u, Frames[ 1 ].TimeStamp );
+    TEST_ASSERT_EQUAL( 1u, Frames[ 1 ].Sequence );
+    TEST_ASSERT_EQUAL_HEX32( 0x101u, Frames[ 1 ].CanId );
+    TEST_ASSERT_EQUAL( 2u, Frames[ 1 ].Length );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( txData, Frames[ 1 ].Data, 2u );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with a transmitted frame
+ *
+ * This test case check the frame is captured with the interrupts of its controller held, so the
+ * reception interrupt does not write the capture ring meanwhile
+ */
+void test__CanIf_ReadMirrorFrames__tx_captured_locked( void )
+{
+    uint8 txData[ 1 ]  = { 0xAA };
+    PduInfoType TxInfo = { .SduDataPtr = txData, .SduLength = 1u };
+    CanIf_MirrorFrameType Frames[ 1 ];
+    uint16 Count = 1u;
+
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    Can_DisableControllerInterrupts_StubWithCallback( Can_DisableControllerInterrupts_Callback );
+    Can_EnableControllerInterrupts_StubWithCallback( Can_EnableControllerInterrupts_Callback );
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, TRUE );
+
+    (void)CanIf_Transmit( CANIF_VALID_TX_PDU, &TxInfo );
+    (void)CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+
+    TEST_ASSERT_EQUAL( 1u, Count );
+    TEST_ASSERT_EQUAL( 1u, WriteIntsLevel[ 0 ] );
+    TEST_ASSERT_EQUAL( 0u, IntsLevel );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with a received frame
+ *
+ * This test case check the reception interrupt captures the frame with the interrupts of its
+ * controller held, so the interrupt of its other line does not write the capture ring meanwhile
+ */
+void test__CanIf_ReadMirrorFrames__rx_captured_locked( void )
+{
+    uint8 rxData[ 1 ]           = { 0x11 };
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x555, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 1u };
+    CanIf_MirrorFrameType Frames[ 1 ];
+    uint16 Count = 1u;
+
+    Can_DisableControllerInterrupts_StubWithCallback( Can_DisableControllerInterrupts_Callback );
+    Can_EnableControllerInterrupts_StubWithCallback( Can_EnableControllerInterrupts_Callback );
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, TRUE );
+    IntsDisableCount = 0u;
+
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    (void)CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+
+    TEST_ASSERT_EQUAL( 1u, Count );
+    TEST_ASSERT_EQUAL( 1u, IntsDisableCount );
+    TEST_ASSERT_EQUAL( 0u, IntsLevel );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with a trigger transmit PDU
+ *
+ * This test case check a PDU requested without data is captured once the upper layer gives its
+ * data on the trigger transmit, and not when it is handed to the driver without data
+ */
+void test__CanIf_ReadMirrorFrames__trigger_transmit_captured( void )
+{
+    PduInfoType PduInfo = { .SduDataPtr = NULL_PTR, .SduLength = 8u };
+    uint8 Element[ 8 ]  = { 0 };
+    PduInfoType Trigger = { .SduDataPtr = Element, .SduLength = 8u };
+    CanIf_MirrorFrameType Frames[ 2 ];
+    uint16 Count = 2u;
+
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, TRUE );
+
+    (void)CanIf_Transmit( 5u, &PduInfo );
+    (void)CanIf_TriggerTransmit( 5u, &Trigger );
+    (void)CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+
+    TEST_ASSERT_EQUAL( 1u, Count );
+    TEST_ASSERT_EQUAL( CANIF_MIRROR_TX, Frames[ 0 ].Direction );
+    TEST_ASSERT_EQUAL_HEX32( 0x102u, Frames[ 0 ].CanId );
+    TEST_ASSERT_EQUAL( 2u, Frames[ 0 ].Length );
+    TEST_ASSERT_EQUAL_HEX8( 0xA5u, Frames[ 0 ].Data[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x5Au, Frames[ 0 ].Data[ 1 ] );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function reading in parts
+ *
+ * This test case check a buffer smaller than the frames captured gets the oldest ones, and the
+ * next call continues with the rest
+ */
+void test__CanIf_ReadMirrorFrames__bulk_in_parts( void )
+{
+    uint8 rxData[ 1 ]     = { 0 };
+    Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x120, .ControllerId = 0 };
+    PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 1u };
+    CanIf_MirrorFrameType Frames[ 2 ];
+    uint16 Count = 2u;
+
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, TRUE );
+    for( uint8 Frame = 0u; Frame < 3u; Frame++ )
+    {
+        rxData[ 0 ] = Frame;
+        CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    }
+
+    (void)CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+    TEST_ASSERT_EQUAL( 2u, Count );
+    TEST_ASSERT_EQUAL( 0u, Frames[ 0 ].Sequence );
+    TEST_ASSERT_EQUAL( 1u, Frames[ 1 ].Data[ 0 ] );
+
+    Count = 2u;
+    (void)CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+    TEST_ASSERT_EQUAL( 1u, Count );
+    TEST_ASSERT_EQUAL( 2u, Frames[ 0 ].Sequence );
+    TEST_ASSERT_EQUAL( 2u, Frames[ 0 ].Data[ 0 ] );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadMirrorFrames function with the ring overflowed
+ *
+ * This test case check the capture overwrites the oldest frames when the reader falls behind, the
+ * newest frames but the one the writer fills next are read and the sequence shows the frames lost
+ */
+void test__CanIf_ReadMirrorFrames__overflow_oldest_lost( void )
+{
+    uint8 rxData[ 1 ]     = { 0 };
+    Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x120, .ControllerId = 0 };
+    PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 1u };
+    CanIf_MirrorFrameType Frames[ CANIF_MIRROR_RING_SIZE + 2u ];
+    uint16 Count = CANIF_MIRROR_RING_SIZE + 2u;
+
+    (void)CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, TRUE );
+    for( uint8 Frame = 0u; Frame < ( CANIF_MIRROR_RING_SIZE + 2u ); Frame++ )
+    {
+        rxData[ 0 ] = Frame;
+        CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    }
+
+    (void)CanIf_ReadMirrorFrames( CANIF_CONTROLLER_0, Frames, &Count );
+
+    TEST_ASSERT_EQUAL( CANIF_MIRROR_RING_SIZE - 1u, Count );
+    TEST_ASSERT_EQUAL( 3u, Frames[ 0 ].Sequence );
+    TEST_ASSERT_EQUAL( 3u, Frames[ 0 ].Data[ 0 ] );
+    TEST_ASSERT_EQUAL( CANIF_MIRROR_RING_SIZE + 1u, Frames[ CANIF_MIRROR_RING_SIZE - 2u ].Sequence );
+}
+
+/**
+ * @brief   Test case for CanIf_GetCurrentTime function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_GetCurrentTime__null_ptr( void )
+{
+    Std_ReturnType RetVal;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetCurrentTime( CANIF_CONTROLLER_0, NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetCurrentTime() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetCurrentTime function with invalid controller
+ *
+ * This test case only check if Det_ReportError is called when the controller is invalid
+ */
+void test__CanIf_GetCurrentTime__invalid_controller( void )
+{
+    Std_ReturnType RetVal;
+    Can_TimeStampType CurrentTime;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetCurrentTime( CANIF_CONTROLLER_INVALID, &CurrentTime );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetCurrentTime() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetCurrentTime function with NULL parameters
+ *
+ * This test case check if the function return E_NOT_OK when the parameter timeStampPtr
+ * is invalid
+ */
+void test__CanIf_GetCurrentTime__null_pointer( void )
+{
+    Std_ReturnType RetVal;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetCurrentTime( CANIF_CONTROLLER_0, NULL_PTR );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetCurrentTime() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetCurrentTime function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_GetCurrentTime__valid_parameters( void )
+{
+    Std_ReturnType RetVal;
+    Can_TimeStampType CurrentTime;
+
+    RetVal = CanIf_GetCurrentTime( CANIF_CONTROLLER_0, &CurrentTime );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetCurrentTime() should return E_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_EnableEgressTimeStamp function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_EnableEgressTimeStamp__null_ptr( void )
+{
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CanIf_EnableEgressTimeStamp( CANIF_VALID_TX_PDU );
+}
+
+/**
+ * @brief   Test case for CanIf_EnableEgressTimeStamp function with invalid PduId
+ *
+ * This test case only check if Det_ReportError is called when the PduId is invalid
+ */
+void test__CanIf_EnableEgressTimeStamp__invalid_PduId( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CanIf_EnableEgressTimeStamp( CANIF_NUMBER_OF_TX_PDUS );
+}
+
+/**
+ * @brief   Test case for CanIf_EnableEgressTimeStamp function with valid parameters
+ *
+ * This test case check if the function return E_OK when the parameters are valid
+ */
+void test__CanIf_EnableEgressTimeStamp__valid_parameters( void )
+{
+    CanIf_EnableEgressTimeStamp( CANIF_VALID_TX_PDU );
+}
+
+/**
+ * @brief   Test case for CanIf_GetEgressTimeStamp function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the CanbIf is not intialized
+ * the global pointer LocalConfigPtr is set to NULL_PTR
+ */
+void test__CanIf_GetEgressTimeStamp__null_ptr( void )
+{
+    Std_ReturnType RetVal;
+    Can_TimeStampType EgressTimeStamp;
+    LocalConfigPtr = NULL_PTR;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetEgressTimeStamp( CANIF_VALID_TX_PDU, &EgressTimeStamp );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetEgressTimeStamp() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetEgressTimeStamp function with invalid PduId
+ *
+ * This test case only check if Det_ReportError is called when the PduId is invalid
+ */
+void test__CanIf_GetEgressTimeStamp__invalid_PduId( void )
+{
+    Std_ReturnType RetVal;
+    Can_TimeStampType EgressTimeStamp;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetEgressTimeStamp( CANIF_NUMBER_OF_TX_PDUS, &EgressTimeStamp );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetEgressTimeStamp() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetEgressTimeStamp function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the EgressTimeStamp pointer is invalid
+ */
+void test__CanIf_GetEgressTimeStamp__null_pointer2( void )
+{
+    Std_ReturnType RetVal;
 
     Det_ReportError_IgnoreAndReturn( E_OK );
 
-    ret = CanIf_GetTxConfirmationState( CANIF_CONTROLLER_INVALID );
+    RetVal = CanIf_GetEgressTimeStamp( CANIF_VALID_TX_PDU, NULL_PTR );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_NO_NOTIFICATION, ret, "CanIf_GetTxConfirmationState() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetEgressTimeStamp() should return E_NOT_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_GetTxConfirmationState function with valid parameters
+ * @brief   Test case for CanIf_GetEgressTimeStamp function with valid parameters
  *
  * This test case check if the function return E_OK when the parameters are valid
  */
-void test__CanIf_GetTxConfirmationState__valid_parameters( void )
+void test__CanIf_GetEgressTimeStamp__valid_parameters( void )
 {
-    CanIf_NotifStatusType ret;
+    Std_ReturnType RetVal;
+    Can_TimeStampType EgressTimeStamp;
 
-    ret = CanIf_GetTxConfirmationState( CANIF_CONTROLLER_0 );
+    RetVal = CanIf_GetEgressTimeStamp( CANIF_VALID_TX_PDU, &EgressTimeStamp );
 
-    TEST_ASSERT_EQUAL_MESSAGE( CANIF_TX_RX_NOTIFICATION, ret, "CanIf_GetTxConfirmationState() should return E_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetEgressTimeStamp() should return E_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_SetBaudrate function with null pointer
+ * @brief   Test case for CanIf_SetEgressTimeStamp function with null pointer
  *
  * This test case only check if Det_ReportError is called when the CanbIf is not intialized
  * the global pointer LocalConfigPtr is set to NULL_PTR
  */
-void test__CanIf_SetBaudrate__null_ptr( void )
+void test__CanIf_GetIngressTimeStamp__null_ptr( void )
 {
     Std_ReturnType RetVal;
+    Can_TimeStampType IngressTimeStamp;
     LocalConfigPtr = NULL_PTR;
 
     Det_ReportError_IgnoreAndReturn( E_OK );
 
-    RetVal = CanIf_SetBaudrate( CANIF_CONTROLLER_0, 0 );
+    RetVal = CanIf_GetIngressTimeStamp( CANIF_VALID_TX_PDU, &IngressTimeStamp );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_SetBaudrate() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetIngressTimeStamp() should return E_NOT_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_SetBaudrate function with invalid controller
+ * @brief   Test case for CanIf_GetIngressTimeStamp function with invalid PduId
  *
- * This test case only check if Det_ReportError is called when the controller is invalid
+ * This test case only check if Det_ReportError is called when the PduId is invalid
  */
-void test__CanIf_SetBaudrate__invalid_controller( void )
+void test__CanIf_GetIngressTimeStamp__invalid_PduId( void )
+{
+    Std_ReturnType RetVal;
+    Can_TimeStampType IngressTimeStamp;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    RetVal = CanIf_GetIngressTimeStamp( CANIF_NUMBER_OF_TX_PDUS, &IngressTimeStamp );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetIngressTimeStamp() should return E_NOT_OK" );
+}
+
+/**
+ * @brief   Test case for CanIf_GetIngressTimeStamp function with null pointer
+ *
+ * This test case only check if Det_ReportError is called when the IngressTimeStamp pointer is invalid
+ */
+void test__CanIf_GetIngressTimeStamp__null_pointer2( void )
 {
     Std_ReturnType RetVal;
 
     Det_ReportError_IgnoreAndReturn( E_OK );
 
-    RetVal = CanIf_SetBaudrate( CANIF_CONTROLLER_INVALID, 0 );
+    RetVal = CanIf_GetIngressTimeStamp( CANIF_VALID_TX_PDU, NULL_PTR );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_SetBaudrate() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetIngressTimeStamp() should return E_NOT_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_SetBaudrate function with valid parameters
+ * @brief   Test case for CanIf_GetIngressTimeStamp function with valid parameters
  *
  * This test case check if the function return E_OK when the parameters are valid
  */
-void test__CanIf_SetBaudrate__valid_parameters( void )
+void test__CanIf_GetIngressTimeStamp__valid_parameters( void )
 {
     Std_ReturnType RetVal;
+    Can_TimeStampType IngressTimeStamp;
 
-    RetVal = CanIf_SetBaudrate( CANIF_CONTROLLER_0, 0 );
+    RetVal = CanIf_GetIngressTimeStamp( CANIF_VALID_TX_PDU, &IngressTimeStamp );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_SetBaudrate() should return E_OK" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetIngressTimeStamp() should return E_OK" );
 }
 
 /**
- * @brief   Test case for CanIf_GetControllerRxErrorCounter function with null pointer
+ * @brief   Test case for CanIf_TxConfirmation function with null pointer
  *
  * This test case only check if Det_ReportError is called when the CanbIf is not intialized
  * the global pointer LocalConfigPtr is set to NULL_PTR
  */
-void test__CanIf_GetControllerRxErrorCounter__null_ptr( void )
+void test__CanIf_TxConfirmation__null_ptr( void )
 {
-    Std_ReturnType RetVal;
-    uint8 ErrorCounter;
     LocalConfigPtr = NULL_PTR;
 
     Det_ReportError_IgnoreAndReturn( E_OK );
 
-    RetVal = CanIf_GetControllerRxErrorCounter( CANIF_CONTROLLER_0, &ErrorCounter );
+    CanIf_TxConfirmation( CANIF_VALID_TX_PDU );
+}
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerRxErrorCounter() should return E_NOT_OK" );
+/**
+ * @brief   Test case for CanIf_TxConfirmation function with invalid PduId
+ *
+ * This test case only check if Det_ReportError is called when the PduId is invalid
+ */
+void test__CanIf_TxConfirmation__invalid_PduId( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CanIf_TxConfirmation( CANIF_NUMBER_OF_TX_PDUS );
 }
 
 /**
- * @brief   Test case for CanIf_GetControllerRxErrorCounter function with invalid controller
+ * @brief   Test case for CanIf_TxConfirmation function with valid parameters
  *
- * This test case only check if Det_ReportError is called when the controller is invalid
+ * This test case check if the function return E_OK when the parameters are valid
  */
-void test__CanIf_GetControllerRxErrorCounter__invalid_controller( void )
+void test__CanIf_TxConfirmation__valid_parameters( void )
 {
-    Std_ReturnType RetVal;
-    uint8 ErrorCounter;
+    CanIf_TxConfirmation( CANIF_VALID_TX_PDU );
+}
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+/**
+ * @brief   Test case for CanIf_TxConfirmation function with buffered PDUs
+ *
+ * This test case check the buffered PDUs are sent one per confirmation highest priority first,
+ * whatever the order they were buffered in
+ */
+void test__CanIf_TxConfirmation__highest_priority_first( void )
+{
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    RetVal = CanIf_GetControllerRxErrorCounter( CANIF_CONTROLLER_INVALID, &ErrorCounter );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+    (void)CanIf_Transmit( 2u, &pduInfo );
+    (void)CanIf_Transmit( 0u, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerRxErrorCounter() should return E_NOT_OK" );
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 1u );
+    CanIf_TxConfirmation( 1u );
+    CanIf_TxConfirmation( 1u );
+
+    TEST_ASSERT_EQUAL( 4u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x100u, WritePdus[ 2 ].id );
+    TEST_ASSERT_EQUAL_HEX32( 0x98DAF110u, WritePdus[ 3 ].id );
 }
 
 /**
- * @brief   Test case for CanIf_GetControllerRxErrorCounter function with null pointer
+ * @brief   Test case for CanIf_TxConfirmation function with the driver still busy
  *
- * This test case only check if Det_ReportError is called when the ErrorCounter pointer is invalid
+ * This test case check the buffered PDU stays in the buffer when Can_Write returns CAN_BUSY from
+ * the confirmation and is sent on the next one
  */
-void test__CanIf_GetControllerRxErrorCounter__null_pointer2( void )
+void test__CanIf_TxConfirmation__driver_still_busy( void )
 {
-    Std_ReturnType RetVal;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+    (void)CanIf_Transmit( 0u, &pduInfo );
+    CanIf_TxConfirmation( 0u );
 
-    RetVal = CanIf_GetControllerRxErrorCounter( CANIF_CONTROLLER_0, NULL_PTR );
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 0u );
+    CanIf_TxConfirmation( 0u );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerRxErrorCounter() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 3u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x100u, WritePdus[ 2 ].id );
 }
 
 /**
- * @brief   Test case for CanIf_GetControllerRxErrorCounter function with valid parameters
+ * @brief   Test case for CanIf_TxConfirmation function with the buffered PDU rejected
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check the buffered PDU Can_Write rejects from the confirmation is dropped and
+ * reported as not transmitted to the upper layer
  */
-void test__CanIf_GetControllerRxErrorCounter__valid_parameters( void )
+void test__CanIf_TxConfirmation__buffered_rejected( void )
 {
-    Std_ReturnType RetVal;
-    uint8 ErrorCounter;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    RetVal = CanIf_GetControllerRxErrorCounter( CANIF_CONTROLLER_0, &ErrorCounter );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+    (void)CanIf_Transmit( CANIF_VALID_TX_PDU, &pduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetControllerRxErrorCounter() should return E_OK" );
+    WriteRetVal = E_NOT_OK;
+    TxResult    = E_NOT_OK;
+    CanIf_TxConfirmation( 0u );
+
+    TEST_ASSERT_EQUAL( 1u, TxConfirmationCount );
+
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 0u );
+
+    TEST_ASSERT_EQUAL( 2u, WriteCount );
 }
 
 /**
- * @brief   Test case for CanIf_GetControllerTxErrorCounter function with null pointer
+ * @brief   Test case for CanIf_TxConfirmation function on an HTH without buffered PDUs
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check the PDUs buffered for an HTH are not sent on the confirmations of another
  */
-void test__CanIf_GetControllerTxErrorCounter__null_ptr( void )
+void test__CanIf_TxConfirmation__other_hth( void )
 {
-    Std_ReturnType RetVal;
-    uint8 ErrorCounter;
-    LocalConfigPtr = NULL_PTR;
+    uint8 data[ 8 ]     = { 0 };
+    PduInfoType pduInfo = { .SduLength = 8, .SduDataPtr = data };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+    (void)CanIf_Transmit( 0u, &pduInfo );
 
-    RetVal = CanIf_GetControllerTxErrorCounter( CANIF_CONTROLLER_0, &ErrorCounter );
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 3u );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerTxErrorCounter() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
 }
 
 /**
- * @brief   Test case for CanIf_GetControllerTxErrorCounter function with invalid controller
+ * @brief   Test case for CanIf_CancelTxConfirmation function with a cancelled PDU
  *
- * This test case only check if Det_ReportError is called when the controller is invalid
+ * This test case check the cancelled PDU is stored back into the buffer and sent again on the
+ * hardware object the cancellation freed
  */
-void test__CanIf_GetControllerTxErrorCounter__invalid_controller( void )
+void test__CanIf_CancelTxConfirmation__store_back( void )
 {
-    Std_ReturnType RetVal;
-    uint8 ErrorCounter;
+    uint8 Data[ 8u ]    = { 0x5A };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    CanIf_CancelTxConfirmation( 0u, &PduInfo );
+    CanIf_TxConfirmation( 1u );
 
-    RetVal = CanIf_GetControllerTxErrorCounter( CANIF_CONTROLLER_INVALID, &ErrorCounter );
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x100u, WritePdus[ 0 ].id );
+    TEST_ASSERT_EQUAL_HEX8( 0x5A, WriteData[ 0 ][ 0 ] );
+}
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerTxErrorCounter() should return E_NOT_OK" );
+/**
+ * @brief   Test case for CanIf_CancelTxConfirmation function with a newer request buffered
+ *
+ * This test case check the cancelled PDU is dropped when a newer request of the same PDU is
+ * already waiting in the buffer
+ */
+void test__CanIf_CancelTxConfirmation__newer_request_buffered( void )
+{
+    uint8 Data[ 8u ]    = { 0x22 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
+
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+    (void)CanIf_Transmit( 0u, &PduInfo );
+    Data[ 0 ]   = 0x11;
+    WriteRetVal = E_OK;
+    CanIf_CancelTxConfirmation( 0u, &PduInfo );
+
+    CanIf_TxConfirmation( 1u );
+    CanIf_TxConfirmation( 1u );
+
+    TEST_ASSERT_EQUAL( 2u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX8( 0x22, WriteData[ 1 ][ 0 ] );
 }
 
 /**
- * @brief   Test case for CanIf_GetControllerTxErrorCounter function with null pointer
+ * @brief   Test case for CanIf_CancelTxConfirmation function with a higher priority PDU buffered
  *
- * This test case only check if Det_ReportError is called when the ErrorCounter pointer is invalid
+ * This test case check the higher priority PDU the driver cancelled a lower priority one for is
+ * written within the cancellation callback, on the hardware object just freed, and the cancelled
+ * PDU waits in the buffer
  */
-void test__CanIf_GetControllerTxErrorCounter__null_pointer2( void )
+void test__CanIf_CancelTxConfirmation__higher_priority_sent( void )
 {
-    Std_ReturnType RetVal;
+    uint8 Data[ 8u ]    = { 0x77 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+    (void)CanIf_Transmit( 0u, &PduInfo );
 
-    RetVal = CanIf_GetControllerTxErrorCounter( CANIF_CONTROLLER_0, NULL_PTR );
+    WriteRetVal = E_OK;
+    CanIf_CancelTxConfirmation( 2u, &PduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetControllerTxErrorCounter() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 2u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x100u, WritePdus[ 1 ].id );
+
+    CanIf_TxConfirmation( 0u );
+
+    TEST_ASSERT_EQUAL( 3u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x98DAF110u, WritePdus[ 2 ].id );
 }
 
 /**
- * @brief   Test case for CanIf_GetControllerTxErrorCounter function with valid parameters
+ * @brief   Test case for CanIf_CancelTxConfirmation function with the buffer full
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check the cancelled PDU is reported as not transmitted to the upper layer when
+ * the buffer of its HTH has no room to take it back
  */
-void test__CanIf_GetControllerTxErrorCounter__valid_parameters( void )
+void test__CanIf_CancelTxConfirmation__buffer_full( void )
 {
-    Std_ReturnType RetVal;
-    uint8 ErrorCounter;
+    uint8 Data[ 8u ]    = { 0x33 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
 
-    RetVal = CanIf_GetControllerTxErrorCounter( CANIF_CONTROLLER_0, &ErrorCounter );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+    (void)CanIf_Transmit( 0u, &PduInfo );
+    (void)CanIf_Transmit( 2u, &PduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetControllerTxErrorCounter() should return E_OK" );
+    TxResult = E_NOT_OK;
+    CanIf_CancelTxConfirmation( CANIF_VALID_TX_PDU, &PduInfo );
+
+    TEST_ASSERT_EQUAL( 1u, TxConfirmationCount );
 }
 
 /**
- * @brief   Test case for CanIf_DisableBusMirroring function with null pointer
+ * @brief   Test case for CanIf_CancelTxConfirmation function without buffer
+ *
+ * This test case check the cancelled PDU is reported as not transmitted to the upper layer when
+ * its HTH has no buffer to take it back
+ */
+void test__CanIf_CancelTxConfirmation__no_buffer( void )
+{
+    uint8 Data[ 8u ]    = { 0x44 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
+    CanIf_BufferCfgType buffers[ CANIF_NUMBER_OF_TX_BUFFERS ];
+    CanIf_ConfigType config = CanIfConfig;
+
+    buffers[ 0 ]      = CanIfConfig.BufferCfgs[ 0 ];
+    buffers[ 1 ]      = CanIfConfig.BufferCfgs[ 1 ];
+    buffers[ 0 ].Size = 0u;
+    config.BufferCfgs = buffers;
+    CanIf_Init( &config );
+
+    TxResult = E_NOT_OK;
+    CanIf_CancelTxConfirmation( CANIF_VALID_TX_PDU, &PduInfo );
+
+    TEST_ASSERT_EQUAL( 1u, TxConfirmationCount );
+}
+
+/**
+ * @brief   Test case for CanIf_CancelTxConfirmation function with null pointer
  *
  * This test case only check if Det_ReportError is called when the CanbIf is not intialized
  * the global pointer LocalConfigPtr is set to NULL_PTR
  */
-void test__CanIf_EnableBusMirroring__null_ptr( void )
+void test__CanIf_CancelTxConfirmation__null_ptr( void )
 {
-    Std_ReturnType RetVal;
+    uint8 Data[ 8u ]    = { 0 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
+
     LocalConfigPtr = NULL_PTR;
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_CANCEL_TX_CONFIRM, CANIF_E_UNINIT, E_OK );
 
-    RetVal = CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, STD_ON );
+    CanIf_CancelTxConfirmation( CANIF_VALID_TX_PDU, &PduInfo );
+}
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_EnableBusMirroring() should return E_NOT_OK" );
+/**
+ * @brief   Test case for CanIf_CancelTxConfirmation function with invalid PduId
+ *
+ * This test case only check if Det_ReportError is called when the PduId is invalid
+ */
+void test__CanIf_CancelTxConfirmation__invalid_PduId( void )
+{
+    uint8 Data[ 8u ]    = { 0 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
+
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_CANCEL_TX_CONFIRM, CANIF_E_PARAM_LPDU, E_OK );
+
+    CanIf_CancelTxConfirmation( CANIF_NUMBER_OF_TX_PDUS, &PduInfo );
 }
 
 /**
- * @brief   Test case for CanIf_DisableBusMirroring function with invalid controller
+ * @brief   Test case for CanIf_CancelTxConfirmation function with invalid pointer
  *
- * This test case only check if Det_ReportError is called when the controller is invalid
+ * This test case only check if Det_ReportError is called when PduInfoPtr is NULL
  */
-void test__CanIf_EnableBusMirroring__invalid_controller( void )
+void test__CanIf_CancelTxConfirmation__invalid_pointer( void )
 {
-    Std_ReturnType RetVal;
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_CANCEL_TX_CONFIRM, CANIF_E_PARAM_POINTER, E_OK );
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    CanIf_CancelTxConfirmation( CANIF_VALID_TX_PDU, NULL_PTR );
+}
 
-    RetVal = CanIf_EnableBusMirroring( CANIF_CONTROLLER_INVALID, STD_ON );
+/**
+ * @brief   Test case for CanIf_CancelTxConfirmation function with a trigger transmit PDU
+ *
+ * This test case check the cancelled PDU is stored back without its data, so the upper layer is
+ * asked again for the latest data when the PDU is resent
+ */
+void test__CanIf_CancelTxConfirmation__trigger_transmit_pdu( void )
+{
+    uint8 Data[ 8u ]    = { 0x5A };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = 2u };
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_EnableBusMirroring() should return E_NOT_OK" );
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    CanIf_CancelTxConfirmation( 5u, &PduInfo );
+    CanIf_TxConfirmation( 1u );
+
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x102u, WritePdus[ 0 ].id );
+    TEST_ASSERT_EQUAL_PTR( NULL_PTR, WritePdus[ 0 ].sdu );
 }
 
 /**
- * @brief   Test case for CanIf_DisableBusMirroring function with valid parameters
+ * @brief   Test case for CanIf_Transmit function with a trigger transmit PDU
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check a PDU requested without data is passed to the driver with a null sdu, so
+ * the data is requested once the driver is about to send it
  */
-void test__CanIf_EnableBusMirroring__valid_parameters( void )
+void test__CanIf_Transmit__trigger_transmit_pdu( void )
 {
-    Std_ReturnType RetVal;
+    PduInfoType PduInfo = { .SduDataPtr = NULL_PTR, .SduLength = 8u };
 
-    RetVal = CanIf_EnableBusMirroring( CANIF_CONTROLLER_0, STD_ON );
+    Can_Write_StubWithCallback( Can_Write_Callback );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_EnableBusMirroring() should return E_OK" );
+    Std_ReturnType RetVal = CanIf_Transmit( 5u, &PduInfo );
+
+    TEST_ASSERT_EQUAL( E_OK, RetVal );
+    TEST_ASSERT_EQUAL( 1u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x102u, WritePdus[ 0 ].id );
+    TEST_ASSERT_EQUAL( 8u, WritePdus[ 0 ].length );
+    TEST_ASSERT_EQUAL_PTR( NULL_PTR, WritePdus[ 0 ].sdu );
 }
 
 /**
- * @brief   Test case for CanIf_GetCurrentTime function with null pointer
+ * @brief   Test case for CanIf_Transmit function with a trigger transmit PDU and driver busy
+ *
+ * This test case check a PDU requested without data is buffered when the driver is busy and is
+ * passed again without data on the next transmit confirmation
+ */
+void test__CanIf_Transmit__trigger_transmit_pdu_buffered( void )
+{
+    PduInfoType PduInfo = { .SduDataPtr = NULL_PTR, .SduLength = 8u };
+
+    Can_Write_StubWithCallback( Can_Write_Callback );
+    WriteRetVal = CAN_BUSY;
+
+    Std_ReturnType RetVal = CanIf_Transmit( 5u, &PduInfo );
+
+    WriteRetVal = E_OK;
+    CanIf_TxConfirmation( 1u );
+
+    TEST_ASSERT_EQUAL( E_OK, RetVal );
+    TEST_ASSERT_EQUAL( 2u, WriteCount );
+    TEST_ASSERT_EQUAL_HEX32( 0x102u, WritePdus[ 1 ].id );
+    TEST_ASSERT_EQUAL( 8u, WritePdus[ 1 ].length );
+    TEST_ASSERT_EQUAL_PTR( NULL_PTR, WritePdus[ 1 ].sdu );
+}
+
+/**
+ * @brief   Test case for CanIf_TriggerTransmit function with null pointer
  *
  * This test case only check if Det_ReportError is called when the CanbIf is not intialized
  * the global pointer LocalConfigPtr is set to NULL_PTR
  */
-void test__CanIf_GetCurrentTime__null_ptr( void )
+void test__CanIf_TriggerTransmit__null_ptr( void )
 {
-    Std_ReturnType RetVal;
+    uint8 Data[ 8u ]    = { 0 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
+
     LocalConfigPtr = NULL_PTR;
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRIGGER_TRANSMIT, CANIF_E_UNINIT, E_OK );
 
-    RetVal = CanIf_GetCurrentTime( CANIF_CONTROLLER_0, NULL_PTR );
+    Std_ReturnType RetVal = CanIf_TriggerTransmit( 5u, &PduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetCurrentTime() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( E_NOT_OK, RetVal );
 }
 
 /**
- * @brief   Test case for CanIf_GetCurrentTime function with invalid controller
+ * @brief   Test case for CanIf_TriggerTransmit function with invalid PduId
  *
- * This test case only check if Det_ReportError is called when the controller is invalid
+ * This test case only check if Det_ReportError is called when the PduId is invalid
  */
-void test__CanIf_GetCurrentTime__invalid_controller( void )
+void test__CanIf_TriggerTransmit__invalid_PduId( void )
 {
-    Std_ReturnType RetVal;
-    Can_TimeStampType CurrentTime;
+    uint8 Data[ 8u ]    = { 0 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRIGGER_TRANSMIT, CANIF_E_INVALID_TXPDUID, E_OK );
 
-    RetVal = CanIf_GetCurrentTime( CANIF_CONTROLLER_INVALID, &CurrentTime );
+    Std_ReturnType RetVal = CanIf_TriggerTransmit( CANIF_NUMBER_OF_TX_PDUS, &PduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetCurrentTime() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( E_NOT_OK, RetVal );
 }
 
 /**
- * @brief   Test case for CanIf_GetCurrentTime function with NULL parameters
+ * @brief   Test case for CanIf_TriggerTransmit function with invalid pointer
  *
- * This test case check if the function return E_NOT_OK when the parameter timeStampPtr
- * is invalid
+ * This test case only check if Det_ReportError is called when PduInfoPtr or its data are NULL
  */
-void test__CanIf_GetCurrentTime__null_pointer( void )
+void test__CanIf_TriggerTransmit__invalid_pointer( void )
 {
-    Std_ReturnType RetVal;
+    PduInfoType PduInfo = { .SduDataPtr = NULL_PTR, .SduLength = 8u };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRIGGER_TRANSMIT, CANIF_E_PARAM_POINTER, E_OK );
+    Det_ReportError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_TRIGGER_TRANSMIT, CANIF_E_PARAM_POINTER, E_OK );
 
-    RetVal = CanIf_GetCurrentTime( CANIF_CONTROLLER_0, NULL_PTR );
+    Std_ReturnType RetVal = CanIf_TriggerTransmit( 5u, NULL_PTR );
+    TEST_ASSERT_EQUAL( E_NOT_OK, RetVal );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetCurrentTime() should return E_NOT_OK" );
+    RetVal = CanIf_TriggerTransmit( 5u, &PduInfo );
+    TEST_ASSERT_EQUAL( E_NOT_OK, RetVal );
 }
 
 /**
- * @brief   Test case for CanIf_GetCurrentTime function with valid parameters
+ * @brief   Test case for CanIf_TriggerTransmit function with the upper layer data
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check the upper layer trigger transmit of the PDU copies its data into the
+ * buffer given by the driver and updates the length
+ */
+void test__CanIf_TriggerTransmit__data_copied( void )
+{
+    uint8 Data[ 8u ]    = { 0 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
+
+    Std_ReturnType RetVal = CanIf_TriggerTransmit( 5u, &PduInfo );
+
+    TEST_ASSERT_EQUAL( E_OK, RetVal );
+    TEST_ASSERT_EQUAL( 1u, TriggerCount );
+    TEST_ASSERT_EQUAL( 5u, TriggerPduId );
+    TEST_ASSERT_EQUAL( 2u, PduInfo.SduLength );
+    TEST_ASSERT_EQUAL_HEX8( 0xA5u, Data[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x5Au, Data[ 1 ] );
+}
+
+/**
+ * @brief   Test case for CanIf_TriggerTransmit function with no data from the upper layer
+ *
+ * This test case check E_NOT_OK is returned when the upper layer has no data for the PDU
+ */
+void test__CanIf_TriggerTransmit__upper_layer_no_data( void )
+{
+    uint8 Data[ 8u ]    = { 0 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
+
+    TriggerRetVal = E_NOT_OK;
+
+    Std_ReturnType RetVal = CanIf_TriggerTransmit( 5u, &PduInfo );
+
+    TEST_ASSERT_EQUAL( E_NOT_OK, RetVal );
+    TEST_ASSERT_EQUAL( 1u, TriggerCount );
+}
+
+/**
+ * @brief   Test case for CanIf_TriggerTransmit function with a PDU without trigger transmit
+ *
+ * This test case check E_NOT_OK is returned when the PDU has no upper layer trigger transmit
  */
-void test__CanIf_GetCurrentTime__valid_parameters( void )
+void test__CanIf_TriggerTransmit__not_configured_pdu( void )
 {
-    Std_ReturnType RetVal;
-    Can_TimeStampType CurrentTime;
+    uint8 Data[ 8u ]    = { 0 };
+    PduInfoType PduInfo = { .SduDataPtr = Data, .SduLength = sizeof( Data ) };
 
-    RetVal = CanIf_GetCurrentTime( CANIF_CONTROLLER_0, &CurrentTime );
+    Std_ReturnType RetVal = CanIf_TriggerTransmit( CANIF_VALID_TX_PDU, &PduInfo );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetCurrentTime() should return E_OK" );
+    TEST_ASSERT_EQUAL( E_NOT_OK, RetVal );
+    TEST_ASSERT_EQUAL( 0u, TriggerCount );
 }
 
 /**
- * @brief   Test case for CanIf_EnableEgressTimeStamp function with null pointer
+ * @brief   Test case for CanIf_RxIndication function with null pointer
  *
  * This test case only check if Det_ReportError is called when the CanbIf is not intialized
  * the global pointer LocalConfigPtr is set to NULL_PTR
  */
-void test__CanIf_EnableEgressTimeStamp__null_ptr( void )
+void test__CanIf_RxIndication__null_ptr( void )
 {
+    const Can_HwType Mailbox;
+    const PduInfoType PduInfoPt;
     LocalConfigPtr = NULL_PTR;
 
     Det_ReportError_IgnoreAndReturn( E_OK );
 
-    CanIf_EnableEgressTimeStamp( CANIF_VALID_TX_PDU );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 }
 
 /**
- * @brief   Test case for CanIf_EnableEgressTimeStamp function with invalid PduId
+ * @brief   Test case for CanIf_RxIndication function with invalid Mailbox
  *
- * This test case only check if Det_ReportError is called when the PduId is invalid
+ * This test case only check if Det_ReportError is called when the Mailbox is invalid
  */
-void test__CanIf_EnableEgressTimeStamp__invalid_PduId( void )
+void test__CanIf_RxIndication__invalid_Mailbox( void )
 {
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    const PduInfoType PduInfoPt;
 
-    CanIf_EnableEgressTimeStamp( CANIF_NUMBER_OF_TX_PDUS );
-}
+    Det_ReportError_IgnoreAndReturn( E_OK );
 
-/**
- * @brief   Test case for CanIf_EnableEgressTimeStamp function with valid parameters
- *
- * This test case check if the function return E_OK when the parameters are valid
- */
-void test__CanIf_EnableEgressTimeStamp__valid_parameters( void )
-{
-    CanIf_EnableEgressTimeStamp( CANIF_VALID_TX_PDU );
+    CanIf_RxIndication( NULL_PTR, &PduInfoPt );
 }
 
 /**
- * @brief   Test case for CanIf_GetEgressTimeStamp function with null pointer
+ * @brief   Test case for CanIf_RxIndication function with invalid PduInfoPt
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case only check if Det_ReportError is called when the PduInfoPt is invalid
  */
-void test__CanIf_GetEgressTimeStamp__null_ptr( void )
+void test__CanIf_RxIndication__invalid_PduInfoPt( void )
 {
-    Std_ReturnType RetVal;
-    Can_TimeStampType EgressTimeStamp;
-    LocalConfigPtr = NULL_PTR;
+    const Can_HwType Mailbox;
 
     Det_ReportError_IgnoreAndReturn( E_OK );
 
-    RetVal = CanIf_GetEgressTimeStamp( CANIF_VALID_TX_PDU, &EgressTimeStamp );
-
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetEgressTimeStamp() should return E_NOT_OK" );
+    CanIf_RxIndication( &Mailbox, NULL_PTR );
 }
 
 /**
- * @brief   Test case for CanIf_GetEgressTimeStamp function with invalid PduId
+ * @brief   Test case for CanIf_RxIndication function with invalid Hoh
  *
- * This test case only check if Det_ReportError is called when the PduId is invalid
+ * This test case only check if Det_ReportError is called when the Hoh is invalid
  */
-void test__CanIf_GetEgressTimeStamp__invalid_PduId( void )
+void test__CanIf_RxIndication__invalid_Hoh( void )
 {
-    Std_ReturnType RetVal;
-    Can_TimeStampType EgressTimeStamp;
+    const Can_HwType Mailbox = { .Hoh = 0xFFu, .CanId = 0x10, .ControllerId = 0 };
+    const PduInfoType PduInfoPt;
 
     Det_ReportError_IgnoreAndReturn( E_OK );
 
-    RetVal = CanIf_GetEgressTimeStamp( CANIF_NUMBER_OF_TX_PDUS, &EgressTimeStamp );
-
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetEgressTimeStamp() should return E_NOT_OK" );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 }
 
 /**
- * @brief   Test case for CanIf_GetEgressTimeStamp function with null pointer
+ * @brief   Test case for CanIf_RxIndication function with invalid CanId
  *
- * This test case only check if Det_ReportError is called when the EgressTimeStamp pointer is invalid
+ * This test case only check if Det_ReportError is called when the CanId is invalid
  */
-void test__CanIf_GetEgressTimeStamp__null_pointer2( void )
+void test__CanIf_RxIndication__invalid_CanId( void )
 {
-    Std_ReturnType RetVal;
+    const Can_HwType Mailbox = { .Hoh = 0, .CanId = 0x00, .ControllerId = 0 };
+    const PduInfoType PduInfoPt;
 
     Det_ReportError_IgnoreAndReturn( E_OK );
 
-    RetVal = CanIf_GetEgressTimeStamp( CANIF_VALID_TX_PDU, NULL_PTR );
-
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetEgressTimeStamp() should return E_NOT_OK" );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 }
 
 /**
- * @brief   Test case for CanIf_GetEgressTimeStamp function with valid parameters
+ * @brief   Test case for CanIf_RxIndication function with valid parameters
  *
  * This test case check if the function return E_OK when the parameters are valid
  */
-void test__CanIf_GetEgressTimeStamp__valid_parameters( void )
+void test__CanIf_RxIndication__valid_parameters( void )
 {
-    Std_ReturnType RetVal;
-    Can_TimeStampType EgressTimeStamp;
-
-    RetVal = CanIf_GetEgressTimeStamp( CANIF_VALID_TX_PDU, &EgressTimeStamp );
+    const Can_HwType Mailbox    = { .Hoh = 0, .CanId = 0x10, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetEgressTimeStamp() should return E_OK" );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 }
 
 /**
- * @brief   Test case for CanIf_SetEgressTimeStamp function with null pointer
+ * @brief   Test case for CanIf_RxIndication function with a standard id
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check the frame is indicated to the upper layer of the PDU configured with its
+ * id and HRH, along with the same PDU info
  */
-void test__CanIf_GetIngressTimeStamp__null_ptr( void )
+void test__CanIf_RxIndication__standard_id_dispatch( void )
 {
-    Std_ReturnType RetVal;
-    Can_TimeStampType IngressTimeStamp;
-    LocalConfigPtr = NULL_PTR;
-
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x120, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    RetVal = CanIf_GetIngressTimeStamp( CANIF_VALID_TX_PDU, &IngressTimeStamp );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetIngressTimeStamp() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 1u, RxIndicationCount );
+    TEST_ASSERT_EQUAL( 2u, RxIndicationPduId );
+    TEST_ASSERT_EQUAL_PTR( &PduInfoPt, RxIndicationPduPtr );
 }
 
 /**
- * @brief   Test case for CanIf_GetIngressTimeStamp function with invalid PduId
+ * @brief   Test case for CanIf_RxIndication function with an extended id
  *
- * This test case only check if Det_ReportError is called when the PduId is invalid
+ * This test case check an extended id frame is indicated to the PDU configured with it
  */
-void test__CanIf_GetIngressTimeStamp__invalid_PduId( void )
+void test__CanIf_RxIndication__extended_id_dispatch( void )
 {
-    Std_ReturnType RetVal;
-    Can_TimeStampType IngressTimeStamp;
-
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x98DAF1F1, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    RetVal = CanIf_GetIngressTimeStamp( CANIF_NUMBER_OF_TX_PDUS, &IngressTimeStamp );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetIngressTimeStamp() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 1u, RxIndicationCount );
+    TEST_ASSERT_EQUAL( 1u, RxIndicationPduId );
 }
 
 /**
- * @brief   Test case for CanIf_GetIngressTimeStamp function with null pointer
+ * @brief   Test case for CanIf_RxIndication function with a CAN FD frame
  *
- * This test case only check if Det_ReportError is called when the IngressTimeStamp pointer is invalid
+ * This test case check the FD bit of the id does not take part in the match
  */
-void test__CanIf_GetIngressTimeStamp__null_pointer2( void )
+void test__CanIf_RxIndication__fd_frame_dispatch( void )
 {
-    Std_ReturnType RetVal;
-
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x40000300, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    RetVal = CanIf_GetIngressTimeStamp( CANIF_VALID_TX_PDU, NULL_PTR );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "CanIf_GetIngressTimeStamp() should return E_NOT_OK" );
+    TEST_ASSERT_EQUAL( 1u, RxIndicationCount );
+    TEST_ASSERT_EQUAL( 0u, RxIndicationPduId );
 }
 
 /**
- * @brief   Test case for CanIf_GetIngressTimeStamp function with valid parameters
+ * @brief   Test case for CanIf_RxIndication function with the id of another type
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check an extended id with the same value as a standard PDU is not accepted
  */
-void test__CanIf_GetIngressTimeStamp__valid_parameters( void )
+void test__CanIf_RxIndication__id_type_mismatch( void )
 {
-    Std_ReturnType RetVal;
-    Can_TimeStampType IngressTimeStamp;
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x80000300, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    RetVal = CanIf_GetIngressTimeStamp( CANIF_VALID_TX_PDU, &IngressTimeStamp );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 
-    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "CanIf_GetIngressTimeStamp() should return E_OK" );
+    TEST_ASSERT_EQUAL( 0u, RxIndicationCount );
 }
 
 /**
- * @brief   Test case for CanIf_TxConfirmation function with null pointer
+ * @brief   Test case for CanIf_RxIndication function with ids of a range PDU
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check both limits of the range are accepted and the ids right out of it are not
  */
-void test__CanIf_TxConfirmation__null_ptr( void )
+void test__CanIf_RxIndication__range_dispatch( void )
 {
-    LocalConfigPtr = NULL_PTR;
+    Can_HwType Mailbox          = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x7E0, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    Mailbox.CanId = 0x7EF;
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    TEST_ASSERT_EQUAL( 2u, RxIndicationCount );
+    TEST_ASSERT_EQUAL( 3u, RxIndicationPduId );
 
-    CanIf_TxConfirmation( CANIF_VALID_TX_PDU );
+    Mailbox.CanId = 0x7DF;
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    Mailbox.CanId = 0x7F0;
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    TEST_ASSERT_EQUAL( 2u, RxIndicationCount );
 }
 
 /**
- * @brief   Test case for CanIf_TxConfirmation function with invalid PduId
+ * @brief   Test case for CanIf_RxIndication function with a configured id on another HRH
  *
- * This test case only check if Det_ReportError is called when the PduId is invalid
+ * This test case check the PDUs are only matched against the frames of their own HRH
  */
-void test__CanIf_TxConfirmation__invalid_PduId( void )
+void test__CanIf_RxIndication__other_hrh( void )
 {
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    const Can_HwType Mailbox    = { .Hoh = CAN_HTH_0_CTRL_1, .CanId = 0x120, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    CanIf_TxConfirmation( CANIF_NUMBER_OF_TX_PDUS );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+
+    TEST_ASSERT_EQUAL( 0u, RxIndicationCount );
 }
 
 /**
- * @brief   Test case for CanIf_TxConfirmation function with valid parameters
+ * @brief   Test case for CanIf_RxIndication function with a PDU without upper layer
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check nothing is called for a PDU without reception indication
  */
-void test__CanIf_TxConfirmation__valid_parameters( void )
+void test__CanIf_RxIndication__no_upper_layer( void )
 {
-    CanIf_TxConfirmation( CANIF_VALID_TX_PDU );
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x400, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
+
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+
+    TEST_ASSERT_EQUAL( 0u, RxIndicationCount );
 }
 
 /**
- * @brief   Test case for CanIf_RxIndication function with null pointer
+ * @brief   Test case for CanIf_RxIndication function with the channel offline
  *
- * This test case only check if Det_ReportError is called when the CanbIf is not intialized
- * the global pointer LocalConfigPtr is set to NULL_PTR
+ * This test case check a frame is dropped when the channel is in CANIF_OFFLINE and indicated
+ * again once the receive path is back in CANIF_TX_OFFLINE
  */
-void test__CanIf_RxIndication__null_ptr( void )
+void test__CanIf_RxIndication__channel_offline( void )
 {
-    const Can_HwType Mailbox;
-    const PduInfoType PduInfoPt;
-    LocalConfigPtr = NULL_PTR;
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x120, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_OFFLINE );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    TEST_ASSERT_EQUAL( 0u, RxIndicationCount );
 
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_TX_OFFLINE );
     CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    TEST_ASSERT_EQUAL( 1u, RxIndicationCount );
 }
 
 /**
- * @brief   Test case for CanIf_RxIndication function with invalid Mailbox
+ * @brief   Test case for CanIf_RxIndication function with a payload shorter than configured
  *
- * This test case only check if Det_ReportError is called when the Mailbox is invalid
+ * This test case check the data length check reports CANIF_E_INVALID_DATA_LENGTH and the L-PDU
+ * is not indicated to the upper layer
  */
-void test__CanIf_RxIndication__invalid_Mailbox( void )
+void test__CanIf_RxIndication__data_length_too_short( void )
 {
-    const PduInfoType PduInfoPt;
+    uint8 rxData[ 3 ]           = { 0x11, 0x22, 0x33 };
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x500, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 3u };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    Det_ReportRuntimeError_ExpectAndReturn( CANIF_MODULE_ID, CANIF_INSTANCE_ID, CANIF_ID_RX_INDICATION, CANIF_E_INVALID_DATA_LENGTH, E_OK );
 
-    CanIf_RxIndication( NULL_PTR, &PduInfoPt );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+
+    TEST_ASSERT_EQUAL( 0u, RxIndicationCount );
 }
 
 /**
- * @brief   Test case for CanIf_RxIndication function with invalid PduInfoPt
+ * @brief   Test case for CanIf_RxIndication function with the payload length configured
  *
- * This test case only check if Det_ReportError is called when the PduInfoPt is invalid
+ * This test case check an L-PDU as long as the data length of its PDU passes the check
  */
-void test__CanIf_RxIndication__invalid_PduInfoPt( void )
+void test__CanIf_RxIndication__data_length_accepted( void )
 {
-    const Can_HwType Mailbox;
+    uint8 rxData[ 4 ]           = { 0x11, 0x22, 0x33, 0x44 };
+    const Can_HwType Mailbox    = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x500, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 4u };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
 
-    CanIf_RxIndication( &Mailbox, NULL_PTR );
+    TEST_ASSERT_EQUAL( 1u, RxIndicationCount );
+    TEST_ASSERT_EQUAL( 5u, RxIndicationPduId );
 }
 
 /**
- * @brief   Test case for CanIf_RxIndication function with invalid Hoh
+ * @brief   Test case for CanIf_RxIndication function with a 29 bits range PDU
  *
- * This test case only check if Det_ReportError is called when the Hoh is invalid
+ * This test case check a range of 29 bits ids, which the hashed set can not hold, lets any 29 bits
+ * id of its HRH reach the lookup, so every id of the range is indicated
  */
-void test__CanIf_RxIndication__invalid_Hoh( void )
+void test__CanIf_RxIndication__rx_filter_extended_range( void )
 {
-    const Can_HwType Mailbox = { .Hoh = 0xFFu, .CanId = 0x10, .ControllerId = 0 };
-    const PduInfoType PduInfoPt;
+    CanIf_RxPduCfgType rxPdu    = { .CanId = 0x18DA0000u, .CanIdUpper = 0x18DAFFFFu, .Hrh = CAN_HRH_0_CTRL_0,
+                                    .CanIdType = CANIF_CANID_EXTENDED, .CanIdRange = TRUE, .ReadData = FALSE,
+                                    .DataLength = 0u, .RxIndication = CanIf_Test_RxIndication };
+    CanIf_ConfigType config     = CanIfConfig;
+    Can_HwType Mailbox          = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x98DA1234u, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    config.RxPduCfgs   = &rxPdu;
+    config.MaxRxPduCfg = 1u;
+    CanIf_Init( &config );
+    CanIf_ControllerModeIndication( CANIF_CONTROLLER_0, CAN_CS_STARTED );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
 
     CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    Mailbox.CanId = 0x98DAFFFFu;
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    Mailbox.CanId = 0x98DB0000u;
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+
+    TEST_ASSERT_EQUAL( 2u, RxIndicationCount );
 }
 
 /**
- * @brief   Test case for CanIf_RxIndication function with invalid CanId
+ * @brief   Test case for CanIf_RxIndication function with ids out of the HRH filter
  *
- * This test case only check if Det_ReportError is called when the CanId is invalid
+ * This test case check an 11 bits id and a 29 bits id no PDU of the HRH accepts are dropped
+ * without any indication, while the configured 29 bits id passes the hashed set
  */
-void test__CanIf_RxIndication__invalid_CanId( void )
+void test__CanIf_RxIndication__rx_filter_drops( void )
 {
-    const Can_HwType Mailbox = { .Hoh = 0, .CanId = 0x00, .ControllerId = 0 };
-    const PduInfoType PduInfoPt;
+    Can_HwType Mailbox          = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0x121, .ControllerId = 0 };
+    const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
-    Det_ReportError_IgnoreAndReturn( E_OK );
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    Mailbox.CanId = 0x98DAF1F2u;
+    CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    TEST_ASSERT_EQUAL( 0u, RxIndicationCount );
 
+    Mailbox.CanId = 0x98DAF1F1u;
     CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    TEST_ASSERT_EQUAL( 1u, RxIndicationCount );
+    TEST_ASSERT_EQUAL( 1u, RxIndicationPduId );
 }
 
 /**
- * @brief   Test case for CanIf_RxIndication function with valid parameters
+ * @brief   Test case for CanIf_RxIndication function with a binary searched HRH
  *
- * This test case check if the function return E_OK when the parameters are valid
+ * This test case check every id of an HRH with too many ids to be compared one by one is found,
+ * whatever the order they were configured in, and an id between them is not
  */
-void test__CanIf_RxIndication__valid_parameters( void )
+void test__CanIf_RxIndication__binary_search( void )
 {
-    const Can_HwType Mailbox    = { .Hoh = 0, .CanId = 0x10, .ControllerId = 0 };
+    static const Can_IdType Ids[ CANIF_NUMBER_OF_RX_PDUS ] = { 0x500, 0x080, 0x6FF, 0x081, 0x80000010, 0x082 };
+    CanIf_RxPduCfgType rxPdus[ CANIF_NUMBER_OF_RX_PDUS ];
+    CanIf_ConfigType config     = CanIfConfig;
+    Can_HwType Mailbox          = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = 0, .ControllerId = 0 };
     const PduInfoType PduInfoPt = { .SduDataPtr = NULL_PTR, .SduLength = 0 };
 
+    for( PduIdType RxPduId = 0u; RxPduId < CANIF_NUMBER_OF_RX_PDUS; RxPduId++ )
+    {
+        rxPdus[ RxPduId ].CanId        = Ids[ RxPduId ] & 0x1FFFFFFFu;
+        rxPdus[ RxPduId ].CanIdUpper   = rxPdus[ RxPduId ].CanId;
+        rxPdus[ RxPduId ].Hrh          = CAN_HRH_0_CTRL_0;
+        rxPdus[ RxPduId ].CanIdType    = ( Ids[ RxPduId ] > 0x7FFu ) ? CANIF_CANID_EXTENDED : CANIF_CANID_STANDARD;
+        rxPdus[ RxPduId ].CanIdRange   = FALSE;
+        rxPdus[ RxPduId ].ReadData     = FALSE;
+        rxPdus[ RxPduId ].DataLength   = 0u;
+        rxPdus[ RxPduId ].RxIndication = CanIf_Test_RxIndication;
+    }
+    config.RxPduCfgs = rxPdus;
+    CanIf_Init( &config );
+    CanIf_ControllerModeIndication( CANIF_CONTROLLER_0, CAN_CS_STARTED );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
+
+    for( PduIdType RxPduId = 0u; RxPduId < CANIF_NUMBER_OF_RX_PDUS; RxPduId++ )
+    {
+        Mailbox.CanId = Ids[ RxPduId ];
+        CanIf_RxIndication( &Mailbox, &PduInfoPt );
+        TEST_ASSERT_EQUAL( RxPduId, RxIndicationPduId );
+    }
+
+    Mailbox.CanId = 0x010;
     CanIf_RxIndication( &Mailbox, &PduInfoPt );
+    TEST_ASSERT_EQUAL( CANIF_NUMBER_OF_RX_PDUS, RxIndicationCount );
 }
 
 /**
@@ -1413,6 +3462,25 @@ void test__CanIf_ControllerBusOff__valid_parameters( void )
     CanIf_ControllerBusOff( CANIF_CONTROLLER_0 );
 }
 
+/**
+ * @brief   Test case for CanIf_ControllerBusOff function setting the channel offline
+ *
+ * This test case check the channel goes to CANIF_TX_OFFLINE and the controller is no longer
+ * taken as started after a bus-off
+ */
+void test__CanIf_ControllerBusOff__tx_offline( void )
+{
+    Std_ReturnType ret;
+    CanIf_PduModeType mode;
+
+    CanIf_ControllerBusOff( CANIF_CONTROLLER_0 );
+    (void)CanIf_GetPduMode( CANIF_CONTROLLER_0, &mode );
+    ret = CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
+
+    TEST_ASSERT_EQUAL( CANIF_TX_OFFLINE, mode );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, ret, "CanIf_SetPduMode() should return E_NOT_OK" );
+}
+
 /**
  * @brief   Test case for CanIf_ControllerModeIndication function with null pointer
  *
@@ -1558,4 +3626,84 @@ void test__CanIf_ErrorNotification__invalid_error( void )
 void test__CanIf_ErrorNotification__valid_parameters( void )
 {
     CanIf_ErrorNotification( CANIF_CONTROLLER_0, CAN_ERROR_BIT );
-}
\ No newline at end of file
+}
+/**
+ * @brief   Upper layer reception indication of the test configuration
+ */
+void CanIf_Test_RxIndication( PduIdType RxPduId, const PduInfoType *PduInfoPtr )
+{
+    RxIndicationPduId  = RxPduId;
+    RxIndicationPduPtr = PduInfoPtr;
+    RxIndicationCount++;
+}
+
+/**
+ * @brief   Upper layer trigger transmit of the test configuration, copies two bytes
+ */
+Std_ReturnType CanIf_Test_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr )
+{
+    TriggerPduId = TxPduId;
+    TriggerCount++;
+
+    if( TriggerRetVal == E_OK )
+    {
+        PduInfoPtr->SduDataPtr[ 0 ] = 0xA5u;
+        PduInfoPtr->SduDataPtr[ 1 ] = 0x5Au;
+        PduInfoPtr->SduLength       = 2u;
+    }
+
+    return TriggerRetVal;
+}
+
+/**
+ * @brief   Upper layer transmit confirmation of the test configuration
+ */
+void CanIf_Test_TxConfirmation( PduIdType TxPduId, Std_ReturnType Result )
+{
+    TEST_ASSERT_EQUAL( CANIF_VALID_TX_PDU, TxPduId );
+    TEST_ASSERT_EQUAL( TxResult, Result );
+    TxConfirmationCount++;
+}
+
+/**
+ * @brief   Can_Write replacement, keeps a copy of the PDUs and returns WriteRetVal
+ */
+static Std_ReturnType Can_Write_Callback( Can_HwHandleType Hth, const Can_PduType *PduInfo, int cmock_num_calls )
+{
+    (void)Hth;
+    (void)cmock_num_calls;
+
+    if( WriteCount < 8u )
+    {
+        WritePdus[ WriteCount ]      = *PduInfo;
+        WriteIntsLevel[ WriteCount ] = IntsLevel;
+        for( uint8 i = 0u; ( PduInfo->sdu != NULL_PTR ) && ( i < PduInfo->length ); i++ )
+        {
+            WriteData[ WriteCount ][ i ] = PduInfo->sdu[ i ];
+        }
+    }
+    WriteCount++;
+
+    return WriteRetVal;
+}
+
+/**
+ * @brief   Can_DisableControllerInterrupts replacement, tracks the disable level
+ */
+static void Can_DisableControllerInterrupts_Callback( uint8 Controller, int cmock_num_calls )
+{
+    (void)Controller;
+    (void)cmock_num_calls;
+    IntsLevel++;
+    IntsDisableCount++;
+}
+
+/**
+ * @brief   Can_EnableControllerInterrupts replacement, tracks the disable level
+ */
+static void Can_EnableControllerInterrupts_Callback( uint8 Controller, int cmock_num_calls )
+{
+    (void)Controller;
+    (void)cmock_num_calls;
+    IntsLevel--;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file    test_CanIf_RxData.c
+ * @brief   **Stress test for the CanIf Rx PDU data storage**
+ * @author  Diego Perez
+ *
+ * group of test cases reading a receive PDU with CanIf_ReadRxPduData while a host interval timer
+ * plays the reception interrupt, its signal handler preempts the reader at any instruction and
+ * calls CanIf_RxIndication to completion, just like the Rx interrupt does over the task level.
+ * Each interrupt drains two frames, as the Rx FIFO does when it holds more than one, so a single
+ * preemption overwrites the copy being read.
+ * Every L-PDU indicated has all its bytes equal to its sequence number and a length derived from
+ * it, so a copy mixing two receptions is detected on the reader side.
+ */
+#define _XOPEN_SOURCE 700
+#include "unity.h"
+#include "CanIf_Cfg.h"
+#include "CanIf.h"
+#include "CanIf_Can.h"
+#include "mock_Det.h"
+#include "mock_Can.h"
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+
+/**
+ * @defgroup    rxdata_defines defines for internal use
+ *
+ * @{ */
+#define RXDATA_PDU        0u       /*!< Receive PDU read by the test */
+#define RXDATA_CANID      0x300u   /*!< CAN id of the receive PDU */
+#define RXDATA_PERIOD     20       /*!< Interval of the simulated interrupt in microseconds */
+#define RXDATA_BURST      2u       /*!< L-PDUs indicated per simulated interrupt */
+#define RXDATA_RECEPTIONS 4000u    /*!< L-PDUs the stress test waits for */
+#define RXDATA_MAX_READS  50000000u /*!< Reads to give up waiting for the interrupts */
+/**
+ * @} */
+
+static volatile sig_atomic_t Receptions; /*!< L-PDUs indicated by the simulated interrupt */
+
+volatile uint32 CanIf_Test_TimeStamp; /*!< Timestamp of the frames captured by the bus mirroring */
+
+static void RxData_Isr( int Signal );
+static void RxData_StartIsr( void );
+static void RxData_StopIsr( void );
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    CanIf_Init( &CanIfConfig );
+    Can_DisableControllerInterrupts_Ignore( );
+    Can_EnableControllerInterrupts_Ignore( );
+    CanIf_ControllerModeIndication( CANIF_CONTROLLER_0, CAN_CS_STARTED );
+    (void)CanIf_SetPduMode( CANIF_CONTROLLER_0, CANIF_ONLINE );
+    Receptions = 0;
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+    RxData_StopIsr( );
+}
+
+/**
+ * @brief   Test case for CanIf_ReadRxPduData preempted by the reception interrupt
+ *
+ * The reader keeps reading the PDU while the simulated interrupt indicates new L-PDUs, every copy
+ * returned must belong to a single reception and no reception may go back in time. Some of the
+ * reads must have been preempted, otherwise the test proved nothing.
+ */
+void test__CanIf_ReadRxPduData__preempted_by_rx_isr( void )
+{
+    uint8 readData[ 8 ];
+    PduInfoType pduInfo = { .SduDataPtr = readData, .SduLength = 0 };
+    uint32 Preempted    = 0u;
+    uint32 Reads        = 0u;
+    uint8 Last          = 0u;
+
+    RxData_StartIsr( );
+
+    while( ( Receptions < (sig_atomic_t)RXDATA_RECEPTIONS ) && ( Reads < RXDATA_MAX_READS ) )
+    {
+        sig_atomic_t Before = Receptions;
+
+        pduInfo.SduLength     = sizeof( readData );
+        Std_ReturnType RetVal = CanIf_ReadRxPduData( RXDATA_PDU, &pduInfo );
+
+        /* once something was received every read shall succeed, the buffer fits any L-PDU */
+        if( Before > 0 )
+        {
+            TEST_ASSERT_EQUAL( E_OK, RetVal );
+        }
+        if( RetVal == E_OK )
+        {
+            TEST_ASSERT_EQUAL( 1u + ( readData[ 0 ] % 8u ), pduInfo.SduLength );
+            for( uint8 Byte = 1u; Byte < pduInfo.SduLength; Byte++ )
+            {
+                TEST_ASSERT_EQUAL_HEX8( readData[ 0 ], readData[ Byte ] );
+            }
+            /* the sequence number wraps at 256, only a small step backwards is an error */
+            TEST_ASSERT_TRUE( (uint8)( readData[ 0 ] - Last ) < 128u );
+            Last = readData[ 0 ];
+        }
+        Preempted += ( Receptions != Before ) ? 1u : 0u;
+        Reads++;
+    }
+
+    RxData_StopIsr( );
+
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32( RXDATA_RECEPTIONS, (uint32)Receptions );
+    TEST_ASSERT_GREATER_THAN_UINT32( 0u, Preempted );
+}
+
+/**
+ * @brief   **Simulated reception interrupt**
+ *
+ * Indicates the next L-PDUs of the sequence to CanIf, the signal is blocked while the handler runs
+ * so it never preempts itself.
+ *
+ * @param    Signal Signal number, not used
+ */
+static void RxData_Isr( int Signal )
+{
+    const Can_HwType Mailbox = { .Hoh = CAN_HRH_0_CTRL_0, .CanId = RXDATA_CANID, .ControllerId = 0 };
+
+    (void)Signal;
+    for( uint8 Frame = 0u; Frame < RXDATA_BURST; Frame++ )
+    {
+        uint8 rxData[ 8 ];
+        uint8 Sequence              = (uint8)( Receptions + 1 );
+        const PduInfoType PduInfoPt = { .SduDataPtr = rxData, .SduLength = 1u + ( Sequence % 8u ) };
+
+        (void)memset( rxData, Sequence, sizeof( rxData ) );
+        CanIf_RxIndication( &Mailbox, &PduInfoPt );
+        Receptions++;
+    }
+}
+
+/**
+ * @brief   **Start the simulated reception interrupt**
+ */
+static void RxData_StartIsr( void )
+{
+    struct sigaction Action;
+    struct itimerval Timer;
+
+    (void)memset( &Action, 0, sizeof( Action ) );
+    Action.sa_handler = RxData_Isr;
+    (void)sigemptyset( &Action.sa_mask );
+    (void)sigaction( SIGALRM, &Action, NULL );
+
+    Timer.it_interval.tv_sec  = 0;
+    Timer.it_interval.tv_usec = RXDATA_PERIOD;
+    Timer.it_value            = Timer.it_interval;
+    (void)setitimer( ITIMER_REAL, &Timer, NULL );
+}
+
+/**
+ * @brief   **Stop the simulated reception interrupt**
+ */
+static void RxData_StopIsr( void )
+{
+    struct itimerval Timer;
+
+    (void)memset( &Timer, 0, sizeof( Timer ) );
+    (void)setitimer( ITIMER_REAL, &Timer, NULL );
+}
+
+/**
+ * @brief   Upper layer indication configured at test/support/CanIf_Lcfg.c
+ */
+void CanIf_Test_RxIndication( PduIdType RxPduId, const PduInfoType *PduInfoPtr )
+{
+    (void)RxPduId;
+    (void)PduInfoPtr;
+}
+
+/**
+ * @brief   Upper layer trigger transmit configured at test/support/CanIf_Lcfg.c
+ */
+Std_ReturnType CanIf_Test_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr )
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_NOT_OK;
+}
+
+/**
+ * @brief   Upper layer transmit confirmation configured at test/support/CanIf_Lcfg.c
+ */
+void CanIf_Test_TxConfirmation( PduIdType TxPduId, Std_ReturnType Result )
+{
+    (void)TxPduId;
+    (void)Result;
+}
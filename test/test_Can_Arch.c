@@ -59,10 +59,78 @@ SramCan_RegisterType SRAMCAN2_BASE;
 
 extern Can_HwUnit HwUnit;
 
+/**
+ * @brief   Buffer handed by the reception buffer callback
+ */
+static uint8 RxCopyBuffer[ 64u ];
+
+/**
+ * @brief   Length requested to the reception buffer callback
+ */
+static PduLengthType RxCopyLength;
+
+/**
+ * @brief   Reception buffer callback used by the test cases
+ */
+static uint8 *RxBufferCallback( const Can_HwType *Mailbox, PduLengthType Length )
+{
+    (void)Mailbox;
+    RxCopyLength = Length;
+    return RxCopyBuffer;
+}
+
+/**
+ * @brief   Number of times the high priority callback was called
+ */
+static uint8 HighPriorityCalls;
+
+/**
+ * @brief   Can id received by the high priority callback
+ */
+static Can_IdType HighPriorityCanId;
+
+/**
+ * @brief   High priority callback used by the test cases
+ */
+static void HighPriorityRxCallback( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr )
+{
+    (void)PduInfoPtr;
+    HighPriorityCalls++;
+    HighPriorityCanId = Mailbox->CanId;
+}
+
+/**
+ * @brief   Payload copied by the trigger transmit callback
+ */
+static uint8 TriggerPayload[ 64u ];
+
+/**
+ * @brief   Number of bytes copied by the trigger transmit callback
+ */
+static PduLengthType TriggerLength;
+
+/**
+ * @brief   Trigger transmit callback used by the test cases, copies TriggerLength bytes in place
+ */
+static Std_ReturnType TriggerTransmitCallback( PduIdType TxPduId, PduInfoType *PduInfoPtr, int cmock_num_calls )
+{
+    (void)TxPduId;
+    (void)cmock_num_calls;
+    for( PduLengthType Byte = 0u; Byte < TriggerLength; Byte++ )
+    {
+        PduInfoPtr->SduDataPtr[ Byte ] = TriggerPayload[ Byte ];
+    }
+    PduInfoPtr->SduLength = TriggerLength;
+    return E_OK;
+}
+
 void Can_SetupBaudrateConfig( const Can_ControllerBaudrateConfig *Baudrate, Can_RegisterType *Can );
-void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8 Controller );
+Std_ReturnType Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8 Controller );
 void Can_SetupConfiguredInterrupts( const Can_Controller *Controller, Can_RegisterType *Can );
+void Can_SetupHthTable( const Can_ConfigType *Config, uint8 Controller );
+void Can_IsrDispatch( Can_HwUnit *HwUnit, uint8 Controller, uint8 Lines );
 uint8 Can_GetClosestDlcWithPadding( uint8 Dlc, uint32 *RamBuffer, uint8 PaddingValue );
+uint8 Can_GetFilterElementConfig( const Can_HardwareObject *Hoh, const Can_HwFilter *HwFilter );
 uint8 Can_GetTxPduId( const Can_Controller *Controller, PduIdType *CanPduId );
 void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uint32 *CanId );
 void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller );
@@ -107,12 +175,15 @@ void setUp( void )
     CAN1->TXBCIE = 0x00000000,
     CAN1->TXEFS  = 0x00000000,
     CAN1->TXFQS  = 0x00000003,
+    CAN1->HPMS   = 0x00000000,
 
     /*se inti values for control structure*/
     HwUnit.HwUnitState                         = CAN_CS_UNINIT;
     HwUnit.ControllerState[ CAN_CONTROLLER_0 ] = CAN_CS_UNINIT;
     HwUnit.ControllerState[ CAN_CONTROLLER_1 ] = CAN_CS_UNINIT;
     HwUnit.Config                              = &ArchCanConfig;
+    HighPriorityCalls                          = 0u;
+    HighPriorityCanId                          = 0u;
 
     Can_Arch_Init( &HwUnit, HwUnit.Config, CANARCH_CONTROLLER_0 );
 
@@ -440,6 +511,26 @@ void test__Can_Arch_EnableControllerInterrupts__enable_all_interrupts( void )
     TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000003, CAN1->ILE, "Wrong IE value" );
 }
 
+/**
+ * @brief   Test case for enable after a matching disable
+ *
+ * This test case will check that the interrupt lines are enabled back when the enable call
+ * matches the last disable one.
+ */
+void test__Can_Arch_EnableControllerInterrupts__matching_disable( void )
+{
+    HwUnit.DisableIntsLvl[ CAN_CONTROLLER_0 ] = 0;
+    CAN1->ILE                                 = 0x00000003;
+    Can_Arch_DisableControllerInterrupts( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_DisableControllerInterrupts( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_EnableControllerInterrupts( &HwUnit, CAN_CONTROLLER_0 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->ILE, "Wrong IE value" );
+
+    Can_Arch_EnableControllerInterrupts( &HwUnit, CAN_CONTROLLER_0 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000003, CAN1->ILE, "Wrong IE value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0, HwUnit.DisableIntsLvl[ CAN_CONTROLLER_0 ], "Wrong disable int level" );
+}
+
 /**
  * @brief   Test case for decrease int level
  *
@@ -599,7 +690,7 @@ void test__Can_Arch_GetControllerTxErrorCounter__get_tx_error_counter( void )
  */
 void test__Can_Arch_Write__tx_fifo_full( void )
 {
-    CAN1->TXFQS = 0x00100000;
+    CAN1->TXFQS = 0x00200000;
 
     Std_ReturnType Retval = Can_Arch_Write( &HwUnit, 0, NULL_PTR );
 
@@ -636,6 +727,38 @@ void test__Can_Arch_write__transmit_standard_id_classic_frame( void )
     TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x08070605, *Data1, "Wrong Data1 value" );
 }
 
+/**
+ * @brief   Test case Write funtion std id and classic frame not multiple of four bytes
+ *
+ * This test case will to transmit a message with three bytes and then with five bytes, the last
+ * partial word of the payload shall be written into the message RAM as well
+ */
+void test__Can_Arch_write__transmit_partial_word_classic_frame( void )
+{
+    uint8 message[ 8 ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+    Can_PduType PduInfo = {
+    .id          = 0x123,
+    .length      = 3,
+    .sdu         = message,
+    .swPduHandle = 0x55 };
+
+    volatile uint32 *Data0 = &SRAMCAN1->TBSA[ 2u ];
+    volatile uint32 *Data1 = &SRAMCAN1->TBSA[ 3u ];
+
+    Std_ReturnType Retval = Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030201, *Data0 & 0x00FFFFFFu, "Wrong Data0 value" );
+
+    PduInfo.length = 5;
+    Retval         = Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04030201, *Data0, "Wrong Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x05, *Data1 & 0x000000FFu, "Wrong Data1 value" );
+}
+
 /**
  * @brief   Test case Write funtion ext id and fd frame with padding
  *
@@ -709,6 +832,177 @@ void test__Can_Arch_write__transmit_extended_id_fd_frame_with_brs( void )
     TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x55550E0D, *Data3, "Wrong Data3 value" );
 }
 
+/**
+ * @brief   Test case Write funtion through the configuration set in use
+ *
+ * Two configuration sets place the transmit object zero on a different controller with a
+ * different padding value, once the runtime table is built from the second set the same Hth
+ * shall write into the message RAM of FDCAN2 with its padding value.
+ */
+void test__Can_Arch_write__transmit_with_selected_config_set( void )
+{
+    uint8 message[ 64 ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+                            0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E };
+
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1
+        },
+        {
+            .ControllerId = 1u,
+            .CanReference = CAN_FDCAN2
+        }
+    };
+
+    const Can_HardwareObject Set0Hohs[ ] = {
+        {
+            .FdPaddingValue = 0x55u,
+            .ObjectType     = CAN_HOH_TYPE_TRANSMIT,
+            .ControllerRef  = &Controllers[ 0u ]
+        },
+        {
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .ControllerRef = &Controllers[ 1u ]
+        }
+    };
+
+    const Can_HardwareObject Set1Hohs[ ] = {
+        {
+            .FdPaddingValue = 0xAAu,
+            .ObjectType     = CAN_HOH_TYPE_TRANSMIT,
+            .ControllerRef  = &Controllers[ 1u ]
+        },
+        {
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .ControllerRef = &Controllers[ 0u ]
+        }
+    };
+
+    const Can_ConfigType ConfigSets[ ] = {
+        {
+            .Controllers      = Controllers,
+            .ControllersCount = 2u,
+            .Hohs             = Set0Hohs,
+            .HohsCount        = 2u
+        },
+        {
+            .Controllers      = Controllers,
+            .ControllersCount = 2u,
+            .Hohs             = Set1Hohs,
+            .HohsCount        = 2u
+        }
+    };
+    /* clang-format on */
+
+    Can_PduType PduInfo = {
+    .id          = 0xC1234567,
+    .length      = 14,
+    .sdu         = message,
+    .swPduHandle = 0x34 };
+
+    CAN2->TXFQS = 0x00010000;
+    CAN2->TXBAR = 0x00000000;
+    CAN1->TXBAR = 0x00000000;
+
+    Can_SetupHthTable( &ConfigSets[ 0u ], 0u );
+    Can_SetupHthTable( &ConfigSets[ 0u ], 1u );
+    Can_SetupHthTable( &ConfigSets[ 1u ], 0u );
+    Can_SetupHthTable( &ConfigSets[ 1u ], 1u );
+    HwUnit.Config = &ConfigSets[ 1u ];
+
+    Std_ReturnType Retval = Can_Arch_Write( &HwUnit, 0u, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x41234567, SRAMCAN2->TBSA[ 18u ], "Wrong Header1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x34AA0000, SRAMCAN2->TBSA[ 19u ], "Wrong Header2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xAAAA0E0D, SRAMCAN2->TBSA[ 23u ], "Wrong padding value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000002, CAN2->TXBAR, "Wrong transmission request" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBAR, "FDCAN1 shall not transmit" );
+}
+
+/**
+ * @brief   Test case Write funtion with trigger transmit and classic frame
+ *
+ * This test case will transmit a message without sdu, the upper layer writes three bytes straight
+ * into the Tx buffer element and the DLC is taken from the length it returns
+ */
+void test__Can_Arch_write__trigger_transmit_classic_frame( void )
+{
+    Can_PduType PduInfo = {
+    .id          = 0x123,
+    .length      = 8,
+    .sdu         = NULL_PTR,
+    .swPduHandle = 0x55 };
+
+    TriggerPayload[ 0 ] = 0x01;
+    TriggerPayload[ 1 ] = 0x02;
+    TriggerPayload[ 2 ] = 0x03;
+    TriggerLength       = 3u;
+    CAN1->TXBAR         = 0x00000000;
+    CanIf_TriggerTransmit_StubWithCallback( TriggerTransmitCallback );
+
+    Std_ReturnType Retval = Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x55830000, SRAMCAN1->TBSA[ 1u ], "Wrong Header2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030201, SRAMCAN1->TBSA[ 2u ] & 0x00FFFFFFu, "Wrong Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000001, CAN1->TXBAR, "Wrong transmission request" );
+}
+
+/**
+ * @brief   Test case Write funtion with trigger transmit and fd frame with padding
+ *
+ * This test case will transmit a message without sdu on a fd frame, the fourteen bytes written by
+ * the upper layer are padded in place up to the closest DLC
+ */
+void test__Can_Arch_write__trigger_transmit_fd_frame( void )
+{
+    Can_PduType PduInfo = {
+    .id          = 0xC1234567,
+    .length      = 14,
+    .sdu         = NULL_PTR,
+    .swPduHandle = 0x34 };
+
+    for( uint8 Byte = 0u; Byte < 14u; Byte++ )
+    {
+        TriggerPayload[ Byte ] = Byte + 1u;
+    }
+    TriggerLength = 14u;
+    CanIf_TriggerTransmit_StubWithCallback( TriggerTransmitCallback );
+
+    Std_ReturnType Retval = Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x34AA0000, SRAMCAN1->TBSA[ 1u ], "Wrong Header2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04030201, SRAMCAN1->TBSA[ 2u ], "Wrong Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x55550E0D, SRAMCAN1->TBSA[ 5u ], "Wrong Data3 value" );
+}
+
+/**
+ * @brief   Test case Write funtion with trigger transmit and no data from the upper layer
+ *
+ * This test case will transmit a message without sdu, the upper layer has no data so the function
+ * shall return E_NOT_OK without requesting the transmission
+ */
+void test__Can_Arch_write__trigger_transmit_no_data( void )
+{
+    Can_PduType PduInfo = {
+    .id          = 0x123,
+    .length      = 8,
+    .sdu         = NULL_PTR,
+    .swPduHandle = 0x55 };
+
+    CAN1->TXBAR = 0x00000000;
+    CanIf_TriggerTransmit_ExpectAnyArgsAndReturn( E_NOT_OK );
+
+    Std_ReturnType Retval = Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBAR, "No transmission shall be requested" );
+}
+
 /**
  * @brief   Void Test case for getting current time
  *
@@ -1258,75 +1552,500 @@ void test__Can_SetupConfiguredFilters__setup_with_wrong_filter_id( void )
 }
 
 /**
- * @brief   set baud rate in classic mode
+ * @brief   Test filter with one single high priority std filter
  *
- * This test case will check that the NBTP and DBTP registers are set to the correct values when
- * config structure is set with .ControllerId = CAN_CONTROLLER_0, and the Can_Init function is called.
+ * This test case will setup one single standard filter flagged as high priority, the element
+ * configuration shall be set to priority and store in FIFO 0
  */
-void test__Can_SetupBaudrateConfig__classic_mode( void )
+void test__Can_SetupConfiguredFilters__setup_std_filter_high_priority( void )
 {
     /* clang-format off */
-    const Can_ControllerBaudrateConfig BaudrateConfig[] =
-    {
+    const Can_Controller Controllers[ ] = {
         {
-            .BaudRateConfigID  = 0,
-            .Seg1              = 13,
-            .Seg2              = 2,
-            .SyncJumpWidth     = 1,
-            .Prescaler         = 4,
-            .FdTxBitRateSwitch = STD_OFF,
-        },
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+        }
+    };
+
+    const Can_HwFilter HwFilter[] = {
+        {
+            .HwFilterCode     = 0x010,
+            .HwFilterMask     = 0x7FF,
+            .HwFilterType     = CAN_FILTER_TYPE_CLASSIC,
+            .HwFilterIdType   = CAN_ID_STANDARD,
+            .HwFilterPriority = CAN_FILTER_PRIORITY_HIGH
+        } 
+    };
+    
+    const Can_HardwareObject Hohs[ ] = {
+        { 
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_STANDARD,
+            .RxFifo        = CAN_RX_FIFO0,
+            .HwFilter = HwFilter,
+            .HwFilterCount = 1u
+        } 
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 1u 
     };
     /* clang-format on */
 
     /**init register for the test*/
-    CAN1_BASE.CCCR = 0x00000001;
-    CAN1_BASE.DBTP = 0x00000A33;
-    CAN1_BASE.NBTP = 0x06000A03;
+    memset( &SRAMCAN1_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    CAN1_BASE.RXGFC = 0x00000000;
 
-    Can_SetupBaudrateConfig( &BaudrateConfig[ 0 ], CAN1 );
+    Can_SetupConfiguredFilters( &Config, 0u );
+    Std_Filter *Filter = (Std_Filter *)&SRAMCAN1->FLSSA[ 0u ];
 
-    TEST_ASSERT_EQUAL_MESSAGE( 0x00000001, CAN1->CCCR, "Wrong clock stop value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030C01, CAN1->NBTP, "Wrong NBTP value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000A33, CAN1->DBTP, "Wrong DBTP value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 5u, Filter->Sfec, "Wrong element configuration value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( HwFilter[ 0 ].HwFilterCode, Filter->Sfid1, "Wrong Sfid1 value" );
 }
 
 /**
- * @brief   set baud rate in FD mode
+ * @brief   Test filter with one single high priority ext filter
  *
- * This test case will check that the NBTP and DBTP registers are set to the correct values when
- * config structure is set with .ControllerId = CAN_CONTROLLER_0, and the Can_Init function is called.
+ * This test case will setup one single extended filter flagged as high priority, the element
+ * configuration shall be set to priority and store in FIFO 1
  */
-void test__Can_SetupBaudrateConfig__fd_mode( void )
+void test__Can_SetupConfiguredFilters__setup_ext_filter_high_priority( void )
 {
     /* clang-format off */
-    const Can_ControllerBaudrateConfig BaudrateConfig[] =
-    {
+    const Can_Controller Controllers[ ] = {
         {
-            .BaudRateConfigID  = 0,
-            .Seg1              = 13,
-            .Seg2              = 2,
-            .SyncJumpWidth     = 1,
-            .Prescaler         = 4,
-            .FdSeg1            = 13,
-            .FdSeg2            = 2,
-            .FdSyncJumpWidth   = 1,
-            .FdPrescaler       = 4,
-            .FdTxBitRateSwitch = STD_ON,
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
         }
     };
+
+    const Can_HwFilter HwFilter[] = {
+        {
+            .HwFilterCode     = 0x1277,
+            .HwFilterMask     = 0x7FF7,
+            .HwFilterType     = CAN_FILTER_TYPE_DUAL,
+            .HwFilterIdType   = CAN_ID_EXTENDED,
+            .HwFilterPriority = CAN_FILTER_PRIORITY_HIGH
+        } 
+    };
+    
+    const Can_HardwareObject Hohs[ ] = {
+        { 
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_EXTENDED,
+            .RxFifo        = CAN_RX_FIFO1,
+            .HwFilter = HwFilter,
+            .HwFilterCount = 1u
+        } 
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 1u 
+    };
     /* clang-format on */
 
     /**init register for the test*/
-    CAN1_BASE.CCCR = 0x00000001;
-    CAN1_BASE.DBTP = 0x00000A33;
-    CAN1_BASE.NBTP = 0x06000A03;
+    memset( &SRAMCAN1_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    CAN1_BASE.RXGFC = 0x00000000;
 
-    Can_SetupBaudrateConfig( &BaudrateConfig[ 0 ], CAN1 );
+    Can_SetupConfiguredFilters( &Config, 0u );
+    Ext_Filter *Filter = (Ext_Filter *)&SRAMCAN1->FLESA[ 0u ];
 
-    TEST_ASSERT_EQUAL_MESSAGE( 0x00000201, CAN1->CCCR, "Wrong clock stop value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030C01, CAN1->NBTP, "Wrong NBTP value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030C10, CAN1->DBTP, "Wrong DBTP value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 6u, Filter->Efec, "Wrong element configuration value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( HwFilter[ 0 ].HwFilterCode, Filter->Efid1, "Wrong Efid1 value" );
+}
+
+/**
+ * @brief   Test filters merged into range and dual elements
+ *
+ * This test case will setup three single IDs and a range contiguous to them, plus a dual filter
+ * with two isolated IDs, all going to the same FIFO. The single IDs and the range shall be merged
+ * into one range element and the isolated IDs shall share one dual element.
+ */
+void test__Can_SetupConfiguredFilters__merge_range_and_dual( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+        }
+    };
+
+    const Can_HwFilter HwFilter[] = {
+        { .HwFilterCode = 0x102, .HwFilterMask = 0x7FF, .HwFilterType = CAN_FILTER_TYPE_CLASSIC },
+        { .HwFilterCode = 0x200, .HwFilterMask = 0x300, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x100, .HwFilterMask = 0x101, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x103, .HwFilterMask = 0x110, .HwFilterType = CAN_FILTER_TYPE_RANGE },
+        { .HwFilterCode = 0x105, .HwFilterMask = 0x7FF, .HwFilterType = CAN_FILTER_TYPE_CLASSIC }
+    };
+    
+    const Can_HardwareObject Hohs[ ] = {
+        { 
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_STANDARD,
+            .RxFifo        = CAN_RX_FIFO0,
+            .HwFilter = HwFilter,
+            .HwFilterCount = 5u
+        } 
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 1u 
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    memset( &SRAMCAN1_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    CAN1_BASE.RXGFC = 0x00000000;
+
+    Can_SetupConfiguredFilters( &Config, 0u );
+    Std_Filter *Filter = (Std_Filter *)&SRAMCAN1->FLSSA[ 0u ];
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_FILTER_TYPE_RANGE, Filter[ 0 ].Sft, "Wrong FILTER Type value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x100, Filter[ 0 ].Sfid1, "Wrong Sfid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x110, Filter[ 0 ].Sfid2, "Wrong Sfid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_FILTER_TYPE_DUAL, Filter[ 1 ].Sft, "Wrong FILTER Type value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x200, Filter[ 1 ].Sfid1, "Wrong Sfid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x300, Filter[ 1 ].Sfid2, "Wrong Sfid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00020030, CAN1_BASE.RXGFC, "Wrong RXGFC value" );
+}
+
+/**
+ * @brief   Test filters with different element configuration are not merged
+ *
+ * This test case will setup contiguous IDs going to different FIFOs and a classic filter with a
+ * partial mask, the IDs of each FIFO shall be written in separate elements, in the order of their
+ * first filter, and the classic filter shall be written as it is.
+ */
+void test__Can_SetupConfiguredFilters__keep_groups_apart( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+        }
+    };
+
+    const Can_HwFilter HwFilterFifo1[] = {
+        { .HwFilterCode = 0x10, .HwFilterMask = 0x11, .HwFilterType = CAN_FILTER_TYPE_DUAL }
+    };
+
+    const Can_HwFilter HwFilterFifo0[] = {
+        { .HwFilterCode = 0x12, .HwFilterMask = 0x7FF, .HwFilterType = CAN_FILTER_TYPE_CLASSIC },
+        { .HwFilterCode = 0x400, .HwFilterMask = 0x700, .HwFilterType = CAN_FILTER_TYPE_CLASSIC }
+    };
+    
+    const Can_HardwareObject Hohs[ ] = {
+        { 
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_STANDARD,
+            .RxFifo        = CAN_RX_FIFO1,
+            .HwFilter = HwFilterFifo1,
+            .HwFilterCount = 1u
+        },
+        { 
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_STANDARD,
+            .RxFifo        = CAN_RX_FIFO0,
+            .HwFilter = HwFilterFifo0,
+            .HwFilterCount = 2u
+        } 
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 2u 
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    memset( &SRAMCAN1_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    CAN1_BASE.RXGFC = 0x00000000;
+
+    Can_SetupConfiguredFilters( &Config, 0u );
+    Std_Filter *Filter = (Std_Filter *)&SRAMCAN1->FLSSA[ 0u ];
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_RX_FIFO1, Filter[ 0 ].Sfec, "Wrong FIFO value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x10, Filter[ 0 ].Sfid1, "Wrong Sfid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x11, Filter[ 0 ].Sfid2, "Wrong Sfid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_RX_FIFO0, Filter[ 1 ].Sfec, "Wrong FIFO value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_FILTER_TYPE_DUAL, Filter[ 1 ].Sft, "Wrong FILTER Type value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x12, Filter[ 1 ].Sfid1, "Wrong Sfid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x12, Filter[ 1 ].Sfid2, "Wrong Sfid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_FILTER_TYPE_CLASSIC, Filter[ 2 ].Sft, "Wrong FILTER Type value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x400, Filter[ 2 ].Sfid1, "Wrong Sfid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x700, Filter[ 2 ].Sfid2, "Wrong Sfid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030030, CAN1_BASE.RXGFC, "Wrong RXGFC value" );
+}
+
+/**
+ * @brief   Test filters keep the configured order across actions
+ *
+ * This test case will setup two single IDs going to FIFO 0, a range going to FIFO 1 that
+ * overlaps them and another single ID going to FIFO 0 contiguous to the first two. Only the
+ * adjacent filters with the same target shall be merged, so the last ID is written after the
+ * range and the frames with that ID still go to FIFO 1 as configured.
+ */
+void test__Can_SetupConfiguredFilters__keep_configured_order( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+        }
+    };
+
+    const Can_HwFilter HwFilterFirst[] = {
+        { .HwFilterCode = 0x100, .HwFilterMask = 0x101, .HwFilterType = CAN_FILTER_TYPE_DUAL }
+    };
+
+    const Can_HwFilter HwFilterRange[] = {
+        { .HwFilterCode = 0x100, .HwFilterMask = 0x1FF, .HwFilterType = CAN_FILTER_TYPE_RANGE }
+    };
+
+    const Can_HwFilter HwFilterLast[] = {
+        { .HwFilterCode = 0x102, .HwFilterMask = 0x7FF, .HwFilterType = CAN_FILTER_TYPE_CLASSIC }
+    };
+
+    const Can_HardwareObject Hohs[ ] = {
+        {
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_STANDARD,
+            .RxFifo        = CAN_RX_FIFO0,
+            .HwFilter = HwFilterFirst,
+            .HwFilterCount = 1u
+        },
+        {
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_STANDARD,
+            .RxFifo        = CAN_RX_FIFO1,
+            .HwFilter = HwFilterRange,
+            .HwFilterCount = 1u
+        },
+        {
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_STANDARD,
+            .RxFifo        = CAN_RX_FIFO0,
+            .HwFilter = HwFilterLast,
+            .HwFilterCount = 1u
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 3u
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    memset( &SRAMCAN1_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    CAN1_BASE.RXGFC = 0x00000000;
+
+    Std_ReturnType RetVal = Can_SetupConfiguredFilters( &Config, 0u );
+    Std_Filter *Filter    = (Std_Filter *)&SRAMCAN1->FLSSA[ 0u ];
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, RetVal, "Filters not set up" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_RX_FIFO0, Filter[ 0 ].Sfec, "Wrong FIFO value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_FILTER_TYPE_DUAL, Filter[ 0 ].Sft, "Wrong FILTER Type value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x100, Filter[ 0 ].Sfid1, "Wrong Sfid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x101, Filter[ 0 ].Sfid2, "Wrong Sfid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_RX_FIFO1, Filter[ 1 ].Sfec, "Wrong FIFO value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_FILTER_TYPE_RANGE, Filter[ 1 ].Sft, "Wrong FILTER Type value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x100, Filter[ 1 ].Sfid1, "Wrong Sfid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1FF, Filter[ 1 ].Sfid2, "Wrong Sfid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_RX_FIFO0, Filter[ 2 ].Sfec, "Wrong FIFO value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CAN_FILTER_TYPE_DUAL, Filter[ 2 ].Sft, "Wrong FILTER Type value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x102, Filter[ 2 ].Sfid1, "Wrong Sfid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x102, Filter[ 2 ].Sfid2, "Wrong Sfid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030030, CAN1_BASE.RXGFC, "Wrong RXGFC value" );
+}
+
+/**
+ * @brief   Test extended filters exceeding the message RAM capacity
+ *
+ * This test case will setup 18 isolated extended IDs requiring 9 dual elements, only the first
+ * 8 elements fit in message RAM, two words apart each. A runtime error shall be reported, E_NOT_OK
+ * returned and the filter lists left disabled.
+ */
+void test__Can_SetupConfiguredFilters__ext_filters_over_capacity( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+        }
+    };
+
+    const Can_HwFilter HwFilter[] = {
+        { .HwFilterCode = 0x10000, .HwFilterMask = 0x10010, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x10020, .HwFilterMask = 0x10030, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x10040, .HwFilterMask = 0x10050, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x10060, .HwFilterMask = 0x10070, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x10080, .HwFilterMask = 0x10090, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x100A0, .HwFilterMask = 0x100B0, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x100C0, .HwFilterMask = 0x100D0, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x100E0, .HwFilterMask = 0x100F0, .HwFilterType = CAN_FILTER_TYPE_DUAL },
+        { .HwFilterCode = 0x10100, .HwFilterMask = 0x10110, .HwFilterType = CAN_FILTER_TYPE_DUAL }
+    };
+    
+    const Can_HardwareObject Hohs[ ] = {
+        { 
+            .ControllerRef = &Controllers[ 0u ],
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .IdType        = CAN_ID_EXTENDED,
+            .RxFifo        = CAN_RX_FIFO0,
+            .HwFilter = HwFilter,
+            .HwFilterCount = 9u
+        } 
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 1u 
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    memset( &SRAMCAN1_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    CAN1_BASE.RXGFC = 0x00000000;
+
+    Det_ReportRuntimeError_ExpectAndReturn( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_INIT, CAN_E_INIT_FAILED, E_OK );
+
+    Std_ReturnType RetVal = Can_SetupConfiguredFilters( &Config, 0u );
+    Ext_Filter *Filter    = (Ext_Filter *)&SRAMCAN1->FLESA[ 0u ];
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, RetVal, "Filters over capacity accepted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x10020, Filter[ 1 ].Efid1, "Wrong Efid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x10030, Filter[ 1 ].Efid2, "Wrong Efid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x100E0, Filter[ 7 ].Efid1, "Wrong Efid1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x100F0, Filter[ 7 ].Efid2, "Wrong Efid2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1_BASE.RXGFC, "Filter lists shall stay disabled" );
+}
+
+/**
+ * @brief   set baud rate in classic mode
+ *
+ * This test case will check that the NBTP and DBTP registers are set to the correct values when
+ * config structure is set with .ControllerId = CAN_CONTROLLER_0, and the Can_Init function is called.
+ */
+void test__Can_SetupBaudrateConfig__classic_mode( void )
+{
+    /* clang-format off */
+    const Can_ControllerBaudrateConfig BaudrateConfig[] =
+    {
+        {
+            .BaudRateConfigID  = 0,
+            .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 4u ),
+            .FdTxBitRateSwitch = STD_OFF
+        },
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    CAN1_BASE.CCCR = 0x00000001;
+    CAN1_BASE.DBTP = 0x00000A33;
+    CAN1_BASE.NBTP = 0x06000A03;
+
+    Can_SetupBaudrateConfig( &BaudrateConfig[ 0 ], CAN1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0x00000001, CAN1->CCCR, "Wrong clock stop value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030C01, CAN1->NBTP, "Wrong NBTP value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000A33, CAN1->DBTP, "Wrong DBTP value" );
+}
+
+/**
+ * @brief   set baud rate in FD mode
+ *
+ * This test case will check that the NBTP and DBTP registers are set to the correct values when
+ * config structure is set with .ControllerId = CAN_CONTROLLER_0, and the Can_Init function is called.
+ */
+void test__Can_SetupBaudrateConfig__fd_mode( void )
+{
+    /* clang-format off */
+    const Can_ControllerBaudrateConfig BaudrateConfig[] =
+    {
+        {
+            .BaudRateConfigID  = 0,
+            .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 4u ),
+            .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 4u ),
+            .FdTxBitRateSwitch = STD_ON
+        }
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    CAN1_BASE.CCCR = 0x00000001;
+    CAN1_BASE.DBTP = 0x00000A33;
+    CAN1_BASE.NBTP = 0x06000A03;
+    CAN1_BASE.TDCR = 0x00000505;
+
+    Can_SetupBaudrateConfig( &BaudrateConfig[ 0 ], CAN1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0x00000201, CAN1->CCCR, "Wrong clock stop value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030C01, CAN1->NBTP, "Wrong NBTP value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030C10, CAN1->DBTP, "Wrong DBTP value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TDCR, "Wrong TDCR value" );
+}
+
+/**
+ * @brief   Setup baudrate config in FD mode with transmitter delay compensation
+ *
+ * This test case will check that the DBTP register gets the TDC bit and the TDCR register gets the
+ * secondary sample point offset and the filter window for a 5Mbit/s data phase with 12 time quanta
+ */
+void test__Can_SetupBaudrateConfig__fd_mode_with_tdc( void )
+{
+    /* clang-format off */
+    const Can_ControllerBaudrateConfig BaudrateConfig[] =
+    {
+        {
+            .BaudRateConfigID  = 0,
+            .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 4u ),
+            .Dbtp              = CAN_DBTP_TDC_VALUE( 8u, 3u, 3u, 1u ),
+            .Tdcr              = CAN_TDCR_VALUE( CAN_TDC_OFFSET( 8u, 1u ), 4u ),
+            .FdTxBitRateSwitch = STD_ON
+        }
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    CAN1_BASE.CCCR = 0x00000001;
+    CAN1_BASE.DBTP = 0x00000A33;
+    CAN1_BASE.NBTP = 0x06000A03;
+    CAN1_BASE.TDCR = 0x00000000;
+
+    Can_SetupBaudrateConfig( &BaudrateConfig[ 0 ], CAN1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0x00000201, CAN1->CCCR, "Wrong clock stop value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00800722, CAN1->DBTP, "Wrong DBTP value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000904, CAN1->TDCR, "Wrong TDCR value" );
 }
 
 /**
@@ -1353,70 +2072,282 @@ void test__Can_SetupConfiguredInterrupts__setup_interrupts( void )
     CAN1_BASE.TXBTIE = 0x00000000;
     CAN1_BASE.TXBCIE = 0x00000000;
 
-    Can_SetupConfiguredInterrupts( &Controllers[ 0 ], CAN1 );
+    Can_SetupConfiguredInterrupts( &Controllers[ 0 ], CAN1 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00621188, CAN1->IE, "Wrong ILE value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000060, CAN1->ILS, "Wrong IE value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007, CAN1->TXBTIE, "Wrong IE value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007, CAN1->TXBCIE, "Wrong IE value" );
+}
+
+/**
+ * @brief   Configure interrupts for one controller
+ *
+ * This test case will check that the IE, ILS, but not the TXBTIE and TXBCIE registers are
+ * set to the correct
+ */
+void test__Can_SetupConfiguredInterrupts__setup_interrupts_with_no_tx( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+            .ActiveITs    = CAN_IT_RX_FIFO1_FULL | CAN_IT_RX_FIFO0_NEW_MESSAGE,
+        } 
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    CAN1_BASE.IE     = 0x00000000;
+    CAN1_BASE.ILS    = 0x00000000;
+    CAN1_BASE.TXBTIE = 0x00000000;
+    CAN1_BASE.TXBCIE = 0x00000000;
+
+    Can_SetupConfiguredInterrupts( &Controllers[ 0 ], CAN1 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x0062101C, CAN1->IE, "Wrong ILE value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000060, CAN1->ILS, "Wrong IE value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBTIE, "Wrong IE value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBCIE, "Wrong IE value" );
+}
+
+/**
+ * @brief   Configure interrupts with groups assigned to line 1
+ *
+ * This test case will check that the groups of the interrupts set in Line1ITs are assigned to
+ * line 1 in ILS register together with the security ones.
+ */
+void test__Can_SetupConfiguredInterrupts__setup_line1_interrupts( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+            .ActiveITs    = CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_TIMEOUT_OCCURRED | CAN_IT_TX_EVT_FIFO_NEW_DATA,
+            .Line1ITs     = CAN_IT_TIMEOUT_OCCURRED | CAN_IT_TX_EVT_FIFO_NEW_DATA,
+        } 
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    CAN1_BASE.IE  = 0x00000000;
+    CAN1_BASE.ILS = 0x00000000;
+
+    Can_SetupConfiguredInterrupts( &Controllers[ 0 ], CAN1 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000078, CAN1->ILS, "Wrong ILS value" );
+}
+
+/**
+ * @brief   Configure interrupts with high priority message and an Rx FIFO group on line 1
+ *
+ * This test case will check that with the high priority message enabled, requesting the Rx FIFO 0
+ * group on line 1 also moves the Rx FIFO 1 and status message groups, so the high priority
+ * message callback never preempts the Rx FIFO callbacks acknowledging the same FIFOs.
+ */
+void test__Can_SetupConfiguredInterrupts__hpm_follows_rx_fifos( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+            .ActiveITs    = CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_RX_HIGH_PRIORITY_MSG,
+            .Line1ITs     = CAN_IT_RX_FIFO0_NEW_MESSAGE,
+        } 
+    };
+    /* clang-format on */
+
+    /**init register for the test*/
+    CAN1_BASE.IE  = 0x00000000;
+    CAN1_BASE.ILS = 0x00000000;
+
+    Can_SetupConfiguredInterrupts( &Controllers[ 0 ], CAN1 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007, CAN1->ILS & 0x00000007, "Rx groups shall share line 1" );
+}
+
+/**
+ * @brief   Line handler only serves the interrupts on its line
+ *
+ * High priority message group is assigned to line 0, then calling the handler for line 1 shall
+ * not serve the high priority message.
+ */
+void test__Can_Arch_IsrLineHandler__interrupt_in_other_line( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId           = 0u,
+            .CanReference           = CAN_FDCAN1,
+            .HighPriorityRxCallback = HighPriorityRxCallback
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+    };
+    /* clang-format on */
+
+    HwUnit.Config = &Config;
+    CAN1->HPMS    = 0x00000080;
+    CAN1->RXF0S   = 0x00000001;
+    CAN1->ILS     = 0x00000000;
+    CAN1->ILE     = 0x00000003;
+    CAN1->IR      = 0x00000040;
+    CAN1->IE      = 0x00000040;
+
+    Can_Arch_IsrLineHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, HighPriorityCalls, "Callback shall not be called" );
+}
+
+/**
+ * @brief   Line handler serves the interrupts on its line
+ *
+ * High priority message group is assigned to line 1, then calling the handler for line 1 shall
+ * serve the high priority message.
+ */
+void test__Can_Arch_IsrLineHandler__interrupt_in_line( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId           = 0u,
+            .CanReference           = CAN_FDCAN1,
+            .HighPriorityRxCallback = HighPriorityRxCallback
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+    };
+    /* clang-format on */
+
+    HwUnit.Config = &Config;
+    CAN1->HPMS    = 0x00000080;
+    CAN1->RXF0S   = 0x00000001;
+    CAN1->ILS     = 0x00000004;
+    CAN1->ILE     = 0x00000003;
+    CAN1->IR      = 0x00000040;
+    CAN1->IE      = 0x00000040;
+
+    Can_Arch_IsrLineHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, HighPriorityCalls, "Callback shall be called once" );
+}
+
+/**
+ * @brief   Line handler skips a controller with its line disabled
+ *
+ * High priority message group is assigned to line 1 but the line is disabled in ILE as
+ * Can_Arch_DisableControllerInterrupts does, the shared vector fired because of the other
+ * controller shall not serve the high priority message.
+ */
+void test__Can_Arch_IsrLineHandler__line_disabled( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId           = 0u,
+            .CanReference           = CAN_FDCAN1,
+            .HighPriorityRxCallback = HighPriorityRxCallback
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+    };
+    /* clang-format on */
+
+    HwUnit.Config = &Config;
+    CAN1->HPMS    = 0x00000080;
+    CAN1->RXF0S   = 0x00000001;
+    CAN1->ILS     = 0x00000004;
+    CAN1->ILE     = 0x00000001;
+    CAN1->IR      = 0x00000040;
+    CAN1->IE      = 0x00000040;
 
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00621188, CAN1->IE, "Wrong ILE value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000060, CAN1->ILS, "Wrong IE value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007, CAN1->TXBTIE, "Wrong IE value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007, CAN1->TXBCIE, "Wrong IE value" );
+    Can_Arch_IsrLineHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, HighPriorityCalls, "Callback shall not be called" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000040, CAN1->IR, "Interrupt flag shall remain pending" );
 }
 
 /**
- * @brief   Configure interrupts for one controller
+ * @brief   Line handler skip regular interrupts on other line
  *
- * This test case will check that the IE, ILS, but not the TXBTIE and TXBCIE registers are
- * set to the correct
+ * Rx FIFO 0 group is assigned to line 1, then calling the dispatcher for line 0 shall not serve
+ * the Rx FIFO 0 new message interrupt.
  */
-void test__Can_SetupConfiguredInterrupts__setup_interrupts_with_no_tx( void )
+void test__Can_IsrDispatch__skip_interrupt_in_other_line( void )
 {
-    /* clang-format off */
-    const Can_Controller Controllers[] = {
-        {
-            .ControllerId = 0u,
-            .CanReference = CAN_FDCAN1,
-            .ActiveITs    = CAN_IT_RX_FIFO1_FULL | CAN_IT_RX_FIFO0_NEW_MESSAGE,
-        } 
-    };
-    /* clang-format on */
-
-    /**init register for the test*/
-    CAN1_BASE.IE     = 0x00000000;
-    CAN1_BASE.ILS    = 0x00000000;
-    CAN1_BASE.TXBTIE = 0x00000000;
-    CAN1_BASE.TXBCIE = 0x00000000;
+    CAN1->ILS   = 0x00000001;
+    CAN1->IR    = 0x00000001;
+    CAN1->IE    = 0x00000001;
+    CAN1->RXF0S = 0x00000001;
 
-    Can_SetupConfiguredInterrupts( &Controllers[ 0 ], CAN1 );
+    Can_IsrDispatch( &HwUnit, CAN_CONTROLLER_0, 1u << CAN_INTERRUPT_LINE0 );
 
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x0062101C, CAN1->IE, "Wrong ILE value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000060, CAN1->ILS, "Wrong IE value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBTIE, "Wrong IE value" );
-    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBCIE, "Wrong IE value" );
+    /* test is testing if CanIf_RxIndication was not called */
 }
 
 /**
- * @brief   get close DLC with padding fo 8 bytes
+ * @brief   get close DLC without padding for 4 bytes
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that the function returns the length as DLC value for frames up to
+ * 8 bytes and the buffer is not padded
  */
 void test__Can_GetClosestDlcWithPadding__padding_4_bytes( void )
 {
     uint32 Buffer[ 2 ] = { 0 };
     uint8 Reference[ 8 ];
 
-    memset( Reference, 0xAA, 8 );
+    memset( Reference, 0x00, 8 );
 
     uint8 Dlc = Can_GetClosestDlcWithPadding( 4, Buffer, 0xAA );
 
-    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_8, Dlc, "Wrong DLC value" );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 4u, Dlc, "Wrong DLC value" );
     TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 8, "Wrong padding value" );
 }
 
+/**
+ * @brief   get close DLC for every length
+ *
+ * This test case will check that every length from 0 to 64 bytes goes to the smallest DLC able
+ * to hold it, and the padding value covers from the length up to the DLC bytes
+ */
+void test__Can_GetClosestDlcWithPadding__every_length( void )
+{
+    static const uint8 Bytes[ 16 ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+    uint32 Buffer[ 17 ];
+    uint8 Reference[ 68 ];
+
+    for( uint8 Length = 0u; Length <= 64u; Length++ )
+    {
+        memset( Buffer, 0x00, sizeof( Buffer ) );
+        memset( Reference, 0x00, sizeof( Reference ) );
+
+        uint8 Dlc = Can_GetClosestDlcWithPadding( Length, Buffer, 0xAA );
+
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE( CAN_OBJECT_PL_64, Dlc, "DLC out of range" );
+        TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE( Length, Bytes[ Dlc ], "DLC too small" );
+        TEST_ASSERT_TRUE_MESSAGE( ( Dlc == 0u ) || ( Bytes[ Dlc - 1u ] < Length ), "DLC not the closest" );
+        memset( &Reference[ Length ], 0xAA, Bytes[ Dlc ] - Length );
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, sizeof( Reference ), "Wrong padding value" );
+    }
+}
+
 /**
  * @brief   get close DLC with padding fo 12 bytes
  *
  * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * value is set to 0xAA only after the payload bytes
  */
 void test__Can_GetClosestDlcWithPadding__padding_12_bytes( void )
 {
@@ -1424,6 +2355,7 @@ void test__Can_GetClosestDlcWithPadding__padding_12_bytes( void )
     uint8 Reference[ 12 ];
 
     memset( Reference, 0xAA, 12 );
+    memset( Reference, 0x00, 10 );
 
     uint8 Dlc = Can_GetClosestDlcWithPadding( 10, Buffer, 0xAA );
 
@@ -1434,7 +2366,7 @@ void test__Can_GetClosestDlcWithPadding__padding_12_bytes( void )
  * @brief   get close DLC with padding fo 16 bytes
  *
  * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * value is set to 0xAA only after the payload bytes
  */
 void test__Can_GetClosestDlcWithPadding__padding_16_bytes( void )
 {
@@ -1442,6 +2374,7 @@ void test__Can_GetClosestDlcWithPadding__padding_16_bytes( void )
     uint8 Reference[ 16 ];
 
     memset( Reference, 0xAA, 16 );
+    memset( Reference, 0x00, 14 );
 
     uint8 Dlc = Can_GetClosestDlcWithPadding( 14, Buffer, 0xAA );
 
@@ -1453,7 +2386,7 @@ void test__Can_GetClosestDlcWithPadding__padding_16_bytes( void )
  * @brief   get close DLC with padding fo 20 bytes
  *
  * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * value is set to 0xAA only after the payload bytes
  */
 void test__Can_GetClosestDlcWithPadding__padding_20_bytes( void )
 {
@@ -1461,6 +2394,7 @@ void test__Can_GetClosestDlcWithPadding__padding_20_bytes( void )
     uint8 Reference[ 20 ];
 
     memset( Reference, 0xAA, 20 );
+    memset( Reference, 0x00, 18 );
 
     uint8 Dlc = Can_GetClosestDlcWithPadding( 18, Buffer, 0xAA );
 
@@ -1472,7 +2406,7 @@ void test__Can_GetClosestDlcWithPadding__padding_20_bytes( void )
  * @brief   get close DLC with padding fo 24 bytes
  *
  * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * value is set to 0xAA only after the payload bytes
  */
 void test__Can_GetClosestDlcWithPadding__padding_24_bytes( void )
 {
@@ -1480,6 +2414,7 @@ void test__Can_GetClosestDlcWithPadding__padding_24_bytes( void )
     uint8 Reference[ 24 ];
 
     memset( Reference, 0xAA, 24 );
+    memset( Reference, 0x00, 22 );
 
     uint8 Dlc = Can_GetClosestDlcWithPadding( 22, Buffer, 0xAA );
 
@@ -1491,7 +2426,7 @@ void test__Can_GetClosestDlcWithPadding__padding_24_bytes( void )
  * @brief   get close DLC with padding fo 32 bytes
  *
  * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * value is set to 0xAA only after the payload bytes
  */
 void test__Can_GetClosestDlcWithPadding__padding_32_bytes( void )
 {
@@ -1499,6 +2434,7 @@ void test__Can_GetClosestDlcWithPadding__padding_32_bytes( void )
     uint8 Reference[ 32 ];
 
     memset( Reference, 0xAA, 32 );
+    memset( Reference, 0x00, 30 );
 
     uint8 Dlc = Can_GetClosestDlcWithPadding( 30, Buffer, 0xAA );
 
@@ -1510,7 +2446,7 @@ void test__Can_GetClosestDlcWithPadding__padding_32_bytes( void )
  * @brief   get close DLC with padding fo 48 bytes
  *
  * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * value is set to 0xAA only after the payload bytes
  */
 void test__Can_GetClosestDlcWithPadding__padding_48_bytes( void )
 {
@@ -1518,6 +2454,7 @@ void test__Can_GetClosestDlcWithPadding__padding_48_bytes( void )
     uint8 Reference[ 48 ];
 
     memset( Reference, 0xAA, 48 );
+    memset( Reference, 0x00, 46 );
 
     uint8 Dlc = Can_GetClosestDlcWithPadding( 46, Buffer, 0xAA );
 
@@ -1529,7 +2466,7 @@ void test__Can_GetClosestDlcWithPadding__padding_48_bytes( void )
  * @brief   get close DLC with padding fo 64 bytes
  *
  * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * value is set to 0xAA only after the payload bytes
  */
 void test__Can_GetClosestDlcWithPadding__padding_64_bytes( void )
 {
@@ -1537,6 +2474,7 @@ void test__Can_GetClosestDlcWithPadding__padding_64_bytes( void )
     uint8 Reference[ 64 ];
 
     memset( Reference, 0xAA, 64 );
+    memset( Reference, 0x00, 51 );
 
     uint8 Dlc = Can_GetClosestDlcWithPadding( 51, Buffer, 0xAA );
 
@@ -1584,9 +2522,9 @@ void test__Can_GetTxPduId__get_the_oldes_pdu_id( void )
 
     /*simulate data in TXEFS register with 2 elements in FIFO buffer*/
     CAN1->TXEFS         = 0x00000202;
-    SRAMCAN1->EFSA[ 0 ] = 0xAA000000;
-    SRAMCAN1->EFSA[ 1 ] = 0xBB000000;
-    SRAMCAN1->EFSA[ 2 ] = 0xCC000000;
+    SRAMCAN1->EFSA[ 1 ] = 0xAA000000;
+    SRAMCAN1->EFSA[ 3 ] = 0xBB000000;
+    SRAMCAN1->EFSA[ 5 ] = 0xCC000000;
 
     uint8 Left = Can_GetTxPduId( Controller, &CanPduId );
 
@@ -1670,79 +2608,537 @@ void test__Can_Isr_RxFifo0MessageLost__call_can_if_error_notification( void )
     CanIf_ErrorNotification_Ignore( );
     Det_ReportRuntimeError_IgnoreAndReturn( E_OK );
 
-    Can_Isr_RxFifo0MessageLost( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_RxFifo0MessageLost( &HwUnit, CAN_CONTROLLER_0 );
+}
+
+/**
+ * @brief   Empty test to cover 100% code coverage
+ *
+ * There is only the case of none messgae in the FIFO 0 to test since there is a register decremented
+ * by hardware that can not be emulated
+ */
+void test__Can_Isr_RxFifo0Full__non_testable( void )
+{
+    CAN1->RXF0S = 0x00000000;
+    CanIf_RxIndication_Ignore( );
+    Can_Isr_RxFifo0Full( &HwUnit, CAN_CONTROLLER_0 );
+}
+
+/**
+ * @brief   test to check that the CanIf_TxConfirmation is called
+ *
+ * This test case will check that the CanIf_TxConfirmation is called when the TXEFS register is
+ * updated with the correct value
+ */
+void test__Can_Isr_RxFifo1NewMessage__call_rx_indication( void )
+{
+    CanIf_RxIndication_Ignore( );
+
+    Can_Isr_RxFifo1NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+}
+
+/**
+ * @brief   test to check that the CanIf_ErrorNotification is called
+ *
+ * This test case will check that the CanIf_ErrorNotification is called when the TXEFS register is
+ * updated with the correct value
+ */
+void test__Can_Isr_RxFifo1MessageLost__call_can_if_error_notification( void )
+{
+    CanIf_ErrorNotification_Ignore( );
+    Det_ReportRuntimeError_IgnoreAndReturn( E_OK );
+
+    Can_Isr_RxFifo1MessageLost( &HwUnit, CAN_CONTROLLER_0 );
+}
+
+/**
+ * @brief   Empty test to cover 100% code coverage
+ *
+ * There is only the case of none messgae in the FIFO 1 to test since there is a register decremented
+ * by hardware that can not be emulated
+ */
+void test__Can_Isr_RxFifo1Full__non_testable( void )
+{
+    CAN1->RXF1S = 0x00000000;
+    CanIf_RxIndication_Ignore( );
+    Can_Isr_RxFifo1Full( &HwUnit, CAN_CONTROLLER_0 );
+}
+
+/**
+ * @brief   void test for Can_Isr_HighPriorityMessageRx
+ *
+ * empty test case to complete 100% code coverage
+ */
+void test__Can_Isr_HighPriorityMessageRx__void_test( void )
+{
+    Can_Isr_HighPriorityMessageRx( &HwUnit, CAN_CONTROLLER_0 );
+}
+
+/**
+ * @brief   High priority message stored in FIFO 0 without callback configured
+ *
+ * The message pointed by HPMS is the oldest one in FIFO 0, since there is no callback configured
+ * the message shall be passed to CanIf_RxIndication and acknowledged
+ */
+void test__Can_Isr_HighPriorityMessageRx__fifo0_no_callback( void )
+{
+    CAN1->HPMS           = 0x00000081;
+    CAN1->RXF0S          = 0x00000101;
+    CAN1->RXF0A          = 0x00000000;
+    SRAMCAN1->F0SA[ 18u ] = 0x00400000;
+    SRAMCAN1->F0SA[ 19u ] = 0x00080000;
+
+    CanIf_RxIndication_ExpectAnyArgs( );
+
+    Can_Isr_HighPriorityMessageRx( &HwUnit, CAN_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000001, CAN1->RXF0A, "Wrong RXF0A value" );
+}
+
+/**
+ * @brief   High priority message stored in FIFO 1 with callback configured
+ *
+ * The message pointed by HPMS is the oldest one in FIFO 1, the message shall be delivered to the
+ * configured callback instead of CanIf_RxIndication
+ */
+void test__Can_Isr_HighPriorityMessageRx__fifo1_callback( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId           = 0u,
+            .CanReference           = CAN_FDCAN1,
+            .HighPriorityRxCallback = HighPriorityRxCallback
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+    };
+    /* clang-format on */
+
+    HwUnit.Config        = &Config;
+    CAN1->HPMS           = 0x000000C2;
+    CAN1->RXF1S          = 0x00000201;
+    CAN1->RXF1A          = 0x00000000;
+    SRAMCAN1->F1SA[ 36u ] = 0x00400000;
+    SRAMCAN1->F1SA[ 37u ] = 0x00080000;
+
+    Can_Isr_HighPriorityMessageRx( &HwUnit, CAN_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, HighPriorityCalls, "Callback not called" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000010, HighPriorityCanId, "Wrong CAN id" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000002, CAN1->RXF1A, "Wrong RXF1A value" );
+}
+
+/**
+ * @brief   High priority message behind older messages
+ *
+ * The message pointed by HPMS is not the oldest one, older messages shall be passed to
+ * CanIf_RxIndication first, since the get index can not be incremented by the mock registers the
+ * loop shall stop after reading the FIFO elements number.
+ */
+void test__Can_Isr_HighPriorityMessageRx__older_messages_pending( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId           = 0u,
+            .CanReference           = CAN_FDCAN1,
+            .HighPriorityRxCallback = HighPriorityRxCallback
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+    };
+    /* clang-format on */
+
+    HwUnit.Config = &Config;
+    CAN1->HPMS    = 0x00000082;
+    CAN1->RXF0S   = 0x00000003;
+
+    CanIf_RxIndication_ExpectAnyArgs( );
+    CanIf_RxIndication_ExpectAnyArgs( );
+    CanIf_RxIndication_ExpectAnyArgs( );
+
+    Can_Isr_HighPriorityMessageRx( &HwUnit, CAN_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, HighPriorityCalls, "Callback shall not be called" );
+}
+
+/**
+ * @brief   High priority message with the Rx FIFO already drained
+ *
+ * The message pointed by HPMS was already read by a previous callback and the FIFO fill level is
+ * zero, the stale element shall not be read, indicated nor acknowledged
+ */
+void test__Can_Isr_HighPriorityMessageRx__fifo_drained( void )
+{
+    CAN1->HPMS  = 0x00000081;
+    CAN1->RXF0S = 0x00000100;
+    CAN1->RXF0A = 0x0000000F;
+
+    Can_Isr_HighPriorityMessageRx( &HwUnit, CAN_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x0000000F, CAN1->RXF0A, "Stale element acknowledged" );
+}
+
+/**
+ * @brief   Rx FIFO elements held with the deferred delivery mode
+ *
+ * With two messages in Rx FIFO 0 both are indicated without being acknowledged, the second one
+ * is read from the element after the get index and a third call finds no message to indicate since
+ * both elements are still held by the upper layer.
+ */
+void test__Can_Isr_RxFifo0NewMessage__deferred_delivery_holds_elements( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+            .RxDelivery   = CAN_RX_DELIVERY_DEFERRED
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+    };
+    /* clang-format on */
+
+    HwUnit.Config = &Config;
+    CAN1->RXF0S   = 0x00000202;
+    CAN1->RXF0A   = 0x00000007;
+
+    CanIf_RxIndication_ExpectAnyArgs( );
+    CanIf_RxIndication_ExpectAnyArgs( );
+
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007, CAN1->RXF0A, "Held elements shall not be acknowledged" );
+}
+
+/**
+ * @brief   Release the Rx FIFO elements held
+ *
+ * Each release acknowledges the element at the get index while there are elements held, once all
+ * of them are released the function returns E_NOT_OK. The interrupt lines are restored along
+ * with the disable level.
+ */
+void test__Can_Arch_ReleaseRxMessage__deferred_delivery( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId = 0u,
+            .CanReference = CAN_FDCAN1,
+            .RxDelivery   = CAN_RX_DELIVERY_DEFERRED
+        }
+    };
+
+    const Can_HardwareObject Hohs[ ] = {
+        {
+            .ObjectType    = CAN_HOH_TYPE_RECEIVE,
+            .RxFifo        = CAN_RX_FIFO1,
+            .ControllerRef = &Controllers[ 0u ]
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 1u
+    };
+    /* clang-format on */
+
+    HwUnit.Config                             = &Config;
+    HwUnit.DisableIntsLvl[ CAN_CONTROLLER_0 ] = 0u;
+    CAN1->RXF1S                               = 0x00000101;
+    CAN1->RXF1A                               = 0x00000007;
+    CAN1->ILE                                 = 0x00000003;
+
+    CanIf_RxIndication_ExpectAnyArgs( );
+    Can_Isr_RxFifo1NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+
+    /* Fill level as the hardware shows it once the element is acknowledged, nothing else stored */
+    CAN1->RXF1S = 0x00000100;
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_ReleaseRxMessage( &HwUnit, 0u ), "Held element not released" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000001, CAN1->RXF1A, "Wrong RXF1A value" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Can_Arch_ReleaseRxMessage( &HwUnit, 0u ), "No element was held" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000003, CAN1->ILE, "Interrupt lines not restored" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, HwUnit.DisableIntsLvl[ CAN_CONTROLLER_0 ], "Interrupts disable level not restored" );
+}
+
+/**
+ * @brief   Rx payload copied once into the upper layer buffer
+ *
+ * With the copy delivery mode the payload of a 12 bytes FD frame is copied into the buffer given
+ * by the reception buffer callback, the bytes beyond the length are left untouched and the element
+ * is acknowledged right away.
+ */
+void test__Can_Isr_RxFifo0NewMessage__copy_delivery( void )
+{
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId     = 0u,
+            .CanReference     = CAN_FDCAN1,
+            .RxDelivery       = CAN_RX_DELIVERY_COPY,
+            .RxBufferCallback = RxBufferCallback
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+    };
+    /* clang-format on */
+    uint8 Expected[ 13u ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x55 };
+
+    memset( RxCopyBuffer, 0x55, sizeof( RxCopyBuffer ) );
+    HwUnit.Config         = &Config;
+    CAN1->RXF0S           = 0x00000001;
+    CAN1->RXF0A           = 0x00000007;
+    SRAMCAN1->F0SA[ 0u ]  = 0x00400000;
+    SRAMCAN1->F0SA[ 1u ]  = 0x00290000;
+    SRAMCAN1->F0SA[ 2u ]  = 0x04030201;
+    SRAMCAN1->F0SA[ 3u ]  = 0x08070605;
+    SRAMCAN1->F0SA[ 4u ]  = 0x0C0B0A09;
+    SRAMCAN1->F0SA[ 5u ]  = 0xFFFFFFFF;
+
+    CanIf_RxIndication_ExpectAnyArgs( );
+
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 12u, RxCopyLength, "Wrong length requested" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( Expected, RxCopyBuffer, sizeof( Expected ), "Wrong payload copied" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->RXF0A, "Element not acknowledged" );
 }
 
 /**
- * @brief   Empty test to cover 100% code coverage
+ * @brief   High priority interrupt served ahead of the rest
  *
- * There is only the case of none messgae in the FIFO 0 to test since there is a register decremented
- * by hardware that can not be emulated
+ * With the high priority and the Rx FIFO 0 new message flags active, the main handler shall serve
+ * the high priority message just once and the Rx FIFO 0 new message callback shall find the FIFO
+ * empty.
  */
-void test__Can_Isr_RxFifo0Full__non_testable( void )
+void test__Can_Arch_IsrMainHandler__high_priority_first( void )
 {
-    CAN1->RXF0S = 0x00000000;
-    CanIf_RxIndication_Ignore( );
-    Can_Isr_RxFifo0Full( &HwUnit, CAN_CONTROLLER_0 );
-}
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId           = 0u,
+            .CanReference           = CAN_FDCAN1,
+            .HighPriorityRxCallback = HighPriorityRxCallback
+        }
+    };
 
-/**
- * @brief   test to check that the CanIf_TxConfirmation is called
- *
- * This test case will check that the CanIf_TxConfirmation is called when the TXEFS register is
- * updated with the correct value
- */
-void test__Can_Isr_RxFifo1NewMessage__call_rx_indication( void )
-{
-    CanIf_RxIndication_Ignore( );
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+    };
+    /* clang-format on */
 
-    Can_Isr_RxFifo1NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+    HwUnit.Config = &Config;
+    CAN1->HPMS    = 0x00000080;
+    CAN1->RXF0S   = 0x00000001;
+    CAN1->IR      = 0x00000041;
+    CAN1->IE      = 0x00000040;
+
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, HighPriorityCalls, "Callback shall be called once" );
 }
 
 /**
- * @brief   test to check that the CanIf_ErrorNotification is called
+ * @brief   void test for Can_Isr_LowPriorityMessageRx
  *
- * This test case will check that the CanIf_ErrorNotification is called when the TXEFS register is
- * updated with the correct value
+ * empty test case to complete 100% code coverage
  */
-void test__Can_Isr_RxFifo1MessageLost__call_can_if_error_notification( void )
+void test__Can_Isr_TransmissionCancellationFinished__void_test( void )
 {
-    CanIf_ErrorNotification_Ignore( );
-    Det_ReportRuntimeError_IgnoreAndReturn( E_OK );
-
-    Can_Isr_RxFifo1MessageLost( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_TransmissionCancellationFinished( &HwUnit, CAN_CONTROLLER_0 );
 }
 
 /**
- * @brief   Empty test to cover 100% code coverage
+ * @brief   Lowest priority pending frame cancelled in favour of a higher priority one
  *
- * There is only the case of none messgae in the FIFO 1 to test since there is a register decremented
- * by hardware that can not be emulated
+ * With the Tx queue full of frames with standard id 0x122, extended id with base 0x123 and standard
+ * id 0x123, a write with standard id 0x010 shall return CAN_BUSY and request the cancellation of
+ * the extended frame, a standard frame wins the arbitration over an extended one with the same
+ * base id.
  */
-void test__Can_Isr_RxFifo1Full__non_testable( void )
+void test__Can_Arch_Write__cancel_lowest_priority_frame( void )
 {
-    CAN1->RXF1S = 0x00000000;
-    CanIf_RxIndication_Ignore( );
-    Can_Isr_RxFifo1Full( &HwUnit, CAN_CONTROLLER_0 );
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId         = 0u,
+            .CanReference         = CAN_FDCAN1,
+            .TxFifoQueueMode      = CAN_TX_QUEUE_OPERATION,
+            .HardwareCancellation = STD_ON
+        }
+    };
+
+    const Can_HardwareObject Hohs[ ] = {
+        {
+            .ObjectType    = CAN_HOH_TYPE_TRANSMIT,
+            .ControllerRef = &Controllers[ 0u ]
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 1u
+    };
+    /* clang-format on */
+    Can_PduType PduInfo = { .id = 0x010, .length = 0u, .sdu = NULL_PTR, .swPduHandle = 0x07 };
+
+    HwUnit.Config         = &Config;
+    Can_SetupHthTable( &Config, 0u );
+    CAN1->TXFQS           = 0x00200000;
+    CAN1->TXBRP           = 0x00000007;
+    CAN1->TXBCR           = 0x00000000;
+    SRAMCAN1->TBSA[ 0u ]  = 0x04880000;
+    SRAMCAN1->TBSA[ 18u ] = 0x448C0005;
+    SRAMCAN1->TBSA[ 36u ] = 0x048CFFFF;
+
+    Std_ReturnType Retval = Can_Arch_Write( &HwUnit, 0u, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_BUSY, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000002, CAN1->TXBCR, "Wrong buffer cancelled" );
 }
 
 /**
- * @brief   void test for Can_Isr_HighPriorityMessageRx
+ * @brief   No cancellation when the pending frames have a higher priority
  *
- * empty test case to complete 100% code coverage
+ * With the Tx queue full a write with a standard id equal to the lowest priority pending frame
+ * shall return CAN_BUSY without any cancellation request, the same happens with a higher priority
+ * id when a cancellation is already on going.
  */
-void test__Can_Isr_HighPriorityMessageRx__void_test( void )
+void test__Can_Arch_Write__no_cancellation( void )
 {
-    Can_Isr_HighPriorityMessageRx( &HwUnit, CAN_CONTROLLER_0 );
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId         = 0u,
+            .CanReference         = CAN_FDCAN1,
+            .TxFifoQueueMode      = CAN_TX_QUEUE_OPERATION,
+            .HardwareCancellation = STD_ON
+        }
+    };
+
+    const Can_HardwareObject Hohs[ ] = {
+        {
+            .ObjectType    = CAN_HOH_TYPE_TRANSMIT,
+            .ControllerRef = &Controllers[ 0u ]
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 1u
+    };
+    /* clang-format on */
+    Can_PduType PduInfo = { .id = 0x300, .length = 0u, .sdu = NULL_PTR, .swPduHandle = 0x07 };
+
+    HwUnit.Config         = &Config;
+    Can_SetupHthTable( &Config, 0u );
+    CAN1->TXFQS           = 0x00200000;
+    CAN1->TXBRP           = 0x00000007;
+    CAN1->TXBCR           = 0x00000000;
+    SRAMCAN1->TBSA[ 0u ]  = 0x04000000;
+    SRAMCAN1->TBSA[ 18u ] = 0x0C000000;
+    SRAMCAN1->TBSA[ 36u ] = 0x08000000;
+
+    Std_ReturnType Retval = Can_Arch_Write( &HwUnit, 0u, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_BUSY, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBCR, "No buffer shall be cancelled" );
+
+    PduInfo.id  = 0x010;
+    CAN1->TXBCR = 0x00000001;
+    Retval      = Can_Arch_Write( &HwUnit, 0u, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_BUSY, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000001, CAN1->TXBCR, "Only one cancellation at a time" );
 }
 
 /**
- * @brief   void test for Can_Isr_LowPriorityMessageRx
+ * @brief   Cancelled frame notified to CanIf
  *
- * empty test case to complete 100% code coverage
+ * Once the cancellation requested by the write is finished the PduId and the payload of the
+ * cancelled frame are passed to CanIf_CancelTxConfirmation, a second interrupt shall not notify
+ * it again. A frame sent before the cancellation took place is not notified.
  */
-void test__Can_Isr_TransmissionCancellationFinished__void_test( void )
+void test__Can_Isr_TransmissionCancellationFinished__notify_cancelled_frame( void )
 {
+    /* clang-format off */
+    const Can_Controller Controllers[ ] = {
+        {
+            .ControllerId         = 0u,
+            .CanReference         = CAN_FDCAN1,
+            .TxFifoQueueMode      = CAN_TX_QUEUE_OPERATION,
+            .HardwareCancellation = STD_ON
+        }
+    };
+
+    const Can_HardwareObject Hohs[ ] = {
+        {
+            .ObjectType    = CAN_HOH_TYPE_TRANSMIT,
+            .ControllerRef = &Controllers[ 0u ]
+        }
+    };
+
+    const Can_ConfigType Config = {
+        .Controllers      = Controllers,
+        .ControllersCount = 1u,
+        .Hohs             = Hohs,
+        .HohsCount        = 1u
+    };
+    /* clang-format on */
+    Can_PduType PduInfo = { .id = 0x010, .length = 0u, .sdu = NULL_PTR, .swPduHandle = 0x07 };
+
+    HwUnit.Config         = &Config;
+    Can_SetupHthTable( &Config, 0u );
+    CAN1->TXFQS           = 0x00200000;
+    CAN1->TXBRP           = 0x00000007;
+    CAN1->TXBCR           = 0x00000000;
+    SRAMCAN1->TBSA[ 0u ]  = 0x04000000;
+    SRAMCAN1->TBSA[ 18u ] = 0x0C000000;
+    SRAMCAN1->TBSA[ 19u ] = 0x33040000;
+    SRAMCAN1->TBSA[ 36u ] = 0x08000000;
+
+    (void)Can_Arch_Write( &HwUnit, 0u, &PduInfo );
+
+    CAN1->TXBRP = 0x00000005;
+    CAN1->TXBCF = 0x00000002;
+    CAN1->TXBTO = 0x00000000;
+
+    CanIf_CancelTxConfirmation_Expect( 0x33, NULL_PTR );
+    CanIf_CancelTxConfirmation_IgnoreArg_PduInfoPtr( );
+
+    Can_Isr_TransmissionCancellationFinished( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_TransmissionCancellationFinished( &HwUnit, CAN_CONTROLLER_0 );
+
+    CAN1->TXBRP = 0x00000007;
+    (void)Can_Arch_Write( &HwUnit, 0u, &PduInfo );
+
+    CAN1->TXBCF = 0x00000002;
+    CAN1->TXBTO = 0x00000002;
+
     Can_Isr_TransmissionCancellationFinished( &HwUnit, CAN_CONTROLLER_0 );
 }
 
@@ -1926,4 +3322,278 @@ void test__Can_Isr_ProtocolErrorInDataPhase__error( void )
 {
     CanIf_ErrorNotification_Ignore( );
     Can_Isr_ProtocolErrorInDataPhase( &HwUnit, CAN_CONTROLLER_0 );
-}
\ No newline at end of file
+}
+/**
+ * @brief   Test case for statistics reset on init
+ *
+ * This test case will check that all the statistics counters start from zero after the
+ * controller is initialized.
+ */
+void test__Can_Arch_GetStatistics__reset_on_init( void )
+{
+    Can_StatisticsType Statistics;
+
+    CAN1->TXFQS = 0x00200000;
+    (void)Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, NULL_PTR );
+    Can_Arch_Init( &HwUnit, HwUnit.Config, CANARCH_CONTROLLER_0 );
+
+    Std_ReturnType Retval = Can_Arch_GetStatistics( &HwUnit, CAN_CONTROLLER_0, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Statistics.TxBusy, "Wrong TxBusy value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Statistics.WriteDuration.Samples, "Wrong number of samples" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Statistics.WriteDuration.Avg, "Wrong average duration" );
+}
+
+/**
+ * @brief   Test case for CAN_BUSY statistics
+ *
+ * This test case will check that a write rejected by a full Tx FIFO is counted and its
+ * execution time measured using the test cycle counter.
+ */
+void test__Can_Arch_GetStatistics__tx_busy( void )
+{
+    Can_StatisticsType Statistics;
+
+    CAN1->TXFQS = 0x00200000;
+    (void)Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, NULL_PTR );
+
+    (void)Can_Arch_GetStatistics( &HwUnit, CAN_CONTROLLER_0, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Statistics.TxBusy, "Wrong TxBusy value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Statistics.WriteDuration.Samples, "Wrong number of samples" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Statistics.WriteDuration.Max, "Wrong max duration" );
+}
+
+/**
+ * @brief   Test case for execution time statistics
+ *
+ * This test case will check that the min, max and average durations are calculated from all
+ * the measurements taken.
+ */
+void test__Can_Arch_GetStatistics__min_max_avg_durations( void )
+{
+    Can_StatisticsType Statistics;
+
+    CAN1->TXFQS = 0x00200000;
+    (void)Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, NULL_PTR );
+    CanTestCycleStep = 30u;
+    (void)Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, NULL_PTR );
+    CanTestCycleStep = 20u;
+    (void)Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, NULL_PTR );
+    CanTestCycleStep = 10u;
+
+    (void)Can_Arch_GetStatistics( &HwUnit, CAN_CONTROLLER_0, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, Statistics.WriteDuration.Samples, "Wrong number of samples" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Statistics.WriteDuration.Min, "Wrong min duration" );
+    TEST_ASSERT_EQUAL_MESSAGE( 30u, Statistics.WriteDuration.Max, "Wrong max duration" );
+    TEST_ASSERT_EQUAL_MESSAGE( 20u, Statistics.WriteDuration.Avg, "Wrong average duration" );
+}
+
+/**
+ * @brief   Test case for interrupt statistics
+ *
+ * This test case will check that every call to the interrupt handler is counted and measured.
+ */
+void test__Can_Arch_GetStatistics__isr_calls( void )
+{
+    Can_StatisticsType Statistics;
+
+    CAN1->IR  = 0x00000000;
+    CAN1->ILE = 0x00000003;
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_IsrLineHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE1 );
+
+    (void)Can_Arch_GetStatistics( &HwUnit, CAN_CONTROLLER_0, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Statistics.IsrCalls, "Wrong IsrCalls value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Statistics.IsrDuration.Samples, "Wrong number of samples" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Statistics.IsrDuration.Avg, "Wrong average duration" );
+}
+
+/**
+ * @brief   Test case for Rx and Tx frame statistics
+ *
+ * This test case will check that the frames passed to the upper layer and the confirmed
+ * transmissions are counted.
+ */
+void test__Can_Arch_GetStatistics__rx_tx_frames( void )
+{
+    Can_StatisticsType Statistics;
+
+    CAN1->RXF0S = 0x00000001;
+    CanIf_RxIndication_Ignore( );
+    CanIf_TxConfirmation_Ignore( );
+
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_TransmissionCompleted( &HwUnit, CAN_CONTROLLER_0 );
+
+    (void)Can_Arch_GetStatistics( &HwUnit, CAN_CONTROLLER_0, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Statistics.RxFrames, "Wrong RxFrames value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Statistics.TxFrames, "Wrong TxFrames value" );
+}
+
+/**
+ * @brief   Test case for error statistics
+ *
+ * This test case will check that the Rx FIFO full, message lost and bus-off events are counted.
+ */
+void test__Can_Arch_GetStatistics__error_events( void )
+{
+    Can_StatisticsType Statistics;
+
+    CAN1->RXF0S = 0x00000000;
+    CAN1->PSR   = 0x00000080;
+    CanIf_ErrorNotification_Ignore( );
+    CanIf_ControllerBusOff_Ignore( );
+    Det_ReportRuntimeError_IgnoreAndReturn( E_OK );
+
+    Can_Isr_RxFifo0Full( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_RxFifo0MessageLost( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_BusOffStatus( &HwUnit, CAN_CONTROLLER_0 );
+
+    (void)Can_Arch_GetStatistics( &HwUnit, CAN_CONTROLLER_0, &Statistics );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Statistics.RxFifoFull, "Wrong RxFifoFull value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Statistics.RxFifoLost, "Wrong RxFifoLost value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Statistics.BusOff, "Wrong BusOff value" );
+}
+
+/**
+ * @brief   Test case for the bus load of classic frames
+ *
+ * This test case will check that ten classic frames with standard id and eight bytes, 111 bits
+ * each, received over a window of 2220 bit times give a bus load of 50%.
+ */
+void test__Can_Arch_GetBusMonitor__classic_bus_load( void )
+{
+    Can_BusMonitorType Monitor;
+
+    SRAMCAN1->F0SA[ 0 ] = 0x123u << 18u;
+    SRAMCAN1->F0SA[ 1 ] = 8u << 16u;
+    CAN1->RXF0S         = 0x00000001;
+    CanIf_RxIndication_Ignore( );
+
+    for( uint8 Frame = 0u; Frame < 10u; Frame++ )
+    {
+        Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+    }
+
+    CAN1->TSCV = 1110u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+    CAN1->TSCV = 2220u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+
+    Std_ReturnType Retval = Can_Arch_GetBusMonitor( &HwUnit, CAN_CONTROLLER_0, &Monitor );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Monitor.Windows, "Wrong number of windows" );
+    TEST_ASSERT_EQUAL_MESSAGE( 2220u, Monitor.BusTime, "Wrong bus time" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Monitor.RxFrames, "Wrong RxFrames value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 5000u, Monitor.BusLoad, "Wrong bus load" );
+    TEST_ASSERT_EQUAL_MESSAGE( 5000u, Monitor.BusLoadAvg, "Wrong average bus load" );
+}
+
+/**
+ * @brief   Test case for the bus load of FD frames with bit rate switching
+ *
+ * This test case will check that the 543 data phase bits of a 64 bytes FD frame are converted to
+ * nominal bit times with a data bit time of 4 clocks against a nominal one of 16, so the frame
+ * takes 29 + 135 nominal bit times.
+ */
+void test__Can_Arch_GetBusMonitor__fd_bit_rate_switch( void )
+{
+    Can_BusMonitorType Monitor;
+
+    CAN1->NBTP          = 0x06000A03;
+    CAN1->DBTP          = 0x00000100;
+    SRAMCAN1->EFSA[ 0 ] = 0x123u << 18u;
+    SRAMCAN1->EFSA[ 1 ] = ( 15u << 16u ) | ( 1u << 20u ) | ( 1u << 21u );
+    CanIf_TxConfirmation_Ignore( );
+
+    Can_Isr_TransmissionCompleted( &HwUnit, CAN_CONTROLLER_0 );
+
+    CAN1->TSCV = 820u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+    CAN1->TSCV = 1640u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+
+    (void)Can_Arch_GetBusMonitor( &HwUnit, CAN_CONTROLLER_0, &Monitor );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Monitor.TxFrames, "Wrong TxFrames value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1000u, Monitor.BusLoad, "Wrong bus load" );
+}
+
+/**
+ * @brief   Test case for the average bus load and the timestamp wrap around
+ *
+ * This test case will check that an idle window after a 50% one halves the average with a
+ * smoothing of one and keeps the maximum, the bus time of the idle window goes over the 16 bits
+ * timestamp counter.
+ */
+void test__Can_Arch_GetBusMonitor__average_and_wrap_around( void )
+{
+    Can_BusMonitorType Monitor;
+
+    SRAMCAN1->F0SA[ 0 ] = 0x123u << 18u;
+    SRAMCAN1->F0SA[ 1 ] = 8u << 16u;
+    CAN1->RXF0S         = 0x00000001;
+    CanIf_RxIndication_Ignore( );
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+
+    CAN1->TSCV = 111u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+    CAN1->TSCV = 222u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+    CAN1->TSCV = 65000u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+    CAN1->TSCV = 1222u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+
+    (void)Can_Arch_GetBusMonitor( &HwUnit, CAN_CONTROLLER_0, &Monitor );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Monitor.Windows, "Wrong number of windows" );
+    TEST_ASSERT_EQUAL_MESSAGE( 66536u, Monitor.BusTime, "Wrong bus time" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Monitor.BusLoad, "Wrong bus load" );
+    TEST_ASSERT_EQUAL_MESSAGE( 2500u, Monitor.BusLoadAvg, "Wrong average bus load" );
+    TEST_ASSERT_EQUAL_MESSAGE( 5000u, Monitor.BusLoadMax, "Wrong max bus load" );
+}
+
+/**
+ * @brief   Test case for the protocol error rates
+ *
+ * This test case will check that an acknowledge error in arbitration phase and a CRC error in
+ * data phase signaled on the same interrupt are both counted out of the same PSR read and
+ * weighted against the two frames received on the same window.
+ */
+void test__Can_Arch_GetBusMonitor__error_ratio( void )
+{
+    Can_BusMonitorType Monitor;
+
+    CAN1->PSR           = 0x00000603;
+    CAN1->IR            = CAN_IT_ARB_PROTOCOL_ERROR | CAN_IT_DATA_PROTOCOL_ERROR;
+    CAN1->IE            = CAN_IT_ARB_PROTOCOL_ERROR | CAN_IT_DATA_PROTOCOL_ERROR;
+    SRAMCAN1->F0SA[ 0 ] = 0x123u << 18u;
+    SRAMCAN1->F0SA[ 1 ] = 8u << 16u;
+    CAN1->RXF0S         = 0x00000001;
+    CanIf_RxIndication_Ignore( );
+    CanIf_ErrorNotification_Ignore( );
+
+    /* both phases pending on the same dispatch, the codes come out of a single PSR read */
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+
+    CAN1->TSCV = 1000u;
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_MainFunctionBusMonitor( &HwUnit, CAN_CONTROLLER_0 );
+
+    (void)Can_Arch_GetBusMonitor( &HwUnit, CAN_CONTROLLER_0, &Monitor );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Monitor.Errors[ CAN_BUS_ERROR_ACK ], "Wrong ACK errors" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Monitor.Errors[ CAN_BUS_ERROR_CRC ], "Wrong CRC errors" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Monitor.Errors[ CAN_BUS_ERROR_STUFF ], "Wrong stuff errors" );
+    TEST_ASSERT_EQUAL_MESSAGE( 5000u, Monitor.ErrorRatio, "Wrong error ratio" );
+}
@@ -0,0 +1,174 @@
+/**
+ * @file    test_Can_Dlc.c
+ * @brief   **Microbenchmark of the Can Driver DLC conversions**
+ * @author  Diego Perez
+ *
+ * group of test cases timing on the host the length to DLC conversion with padding the Tx path
+ * does on each Can_Write and the DLC to length conversion the Rx path does on each frame read from
+ * the Rx FIFOs, one scenario per each of the 16 DLC codes. Each one checks the conversion and
+ * reports the host time per call distribution.
+ */
+#include "unity.h"
+#include "Registers.h"
+#include "Bfx.h"
+#include "Can_Cfg.h"
+#include "Can_Arch.h"
+#include "Can_Model.h"
+#include "Bench.h"
+#include "mock_CanIf_Can.h"
+#include "mock_Det.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @defgroup    dlc_defines defines for internal use
+ *
+ * @{ */
+#define DLC_CODES   16u  /*!< DLC codes of a CAN FD frame */
+#define DLC_SAMPLES 201u /*!< Samples taken per DLC code */
+#define DLC_BATCH   256u /*!< Calls timed on each sample */
+/**
+ * @} */
+
+/**
+ * @brief   Mock register for CAN1
+ */
+Can_RegisterType CAN1_BASE;
+
+/**
+ * @brief   Mock register for CAN2
+ */
+Can_RegisterType CAN2_BASE;
+
+/**
+ * @brief   Mock register for SRAMCAN1
+ */
+SramCan_RegisterType SRAMCAN1_BASE;
+
+/**
+ * @brief   Mock register for SRAMCAN2
+ */
+SramCan_RegisterType SRAMCAN2_BASE;
+
+/**
+ * @brief   Bytes carried by each DLC code
+ */
+static const uint8 DlcBytes[ DLC_CODES ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+
+/**
+ * @brief   Host time per call of each sample, in picoseconds
+ */
+static uint32 Samples[ DLC_SAMPLES ];
+
+uint8 Can_GetClosestDlcWithPadding( uint8 Dlc, uint32 *RamBuffer, uint8 PaddingValue );
+void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uint32 *CanId );
+
+/**
+ * @brief   Print the host time per call of one DLC code
+ *
+ * @param    Path Tx or Rx
+ * @param    Dlc DLC code measured
+ * @param    Length Payload length used
+ * @param    Summary Host time per call distribution in picoseconds
+ */
+static void DlcReport( const char *Path, uint8 Dlc, uint8 Length, const Bench_Summary *Summary )
+{
+    char Message[ 120u ];
+
+    (void)snprintf( Message, sizeof( Message ), "%s dlc %2u (%2u bytes): min/p50/p99 %lu/%lu/%lu ps per call", Path,
+                    (unsigned)Dlc, (unsigned)Length, (unsigned long)Summary->Min, (unsigned long)Summary->P50,
+                    (unsigned long)Summary->P99 );
+    TEST_MESSAGE( Message );
+}
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Length to DLC with padding on each DLC code**
+ *
+ * For each DLC code the shortest length going into it is converted, it is the one with the
+ * longest tail to pad. The DLC shall be the code measured, the payload bytes shall be untouched
+ * and the tail up to the DLC bytes shall be padded.
+ */
+void test__Can_Dlc__tx_length_to_dlc( void )
+{
+    uint32 Buffer[ 16u ];
+    uint8 Reference[ 64u ];
+    Bench_Summary Summary;
+
+    for( uint8 Code = 0u; Code < DLC_CODES; Code++ )
+    {
+        uint8 Length = ( Code > 8u ) ? (uint8)( DlcBytes[ Code - 1u ] + 1u ) : Code;
+        uint8 Dlc    = 0u;
+
+        memset( Buffer, 0x00, sizeof( Buffer ) );
+        memset( Reference, 0x00, sizeof( Reference ) );
+        memset( &Reference[ Length ], 0xCC, DlcBytes[ Code ] - Length );
+
+        for( uint32 Sample = 0u; Sample < DLC_SAMPLES; Sample++ )
+        {
+            uint64 Start = Can_Model_HostTime( );
+
+            for( uint32 Call = 0u; Call < DLC_BATCH; Call++ )
+            {
+                Dlc = Can_GetClosestDlcWithPadding( Length, Buffer, 0xCC );
+            }
+
+            Samples[ Sample ] = (uint32)( ( ( Can_Model_HostTime( ) - Start ) * 1000u ) / DLC_BATCH );
+        }
+
+        TEST_ASSERT_EQUAL_MESSAGE( Code, Dlc, "Wrong DLC code" );
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, sizeof( Reference ), "Wrong padding" );
+
+        Bench_Summarize( Samples, DLC_SAMPLES, &Summary );
+        DlcReport( "tx", Code, Length, &Summary );
+    }
+}
+
+/**
+ * @brief   **DLC to length on each DLC code**
+ *
+ * For each DLC code a Rx FIFO element with a standard id is read, the length handed to CanIf shall
+ * be the bytes carried by the code and the payload shall point into the element.
+ */
+void test__Can_Dlc__rx_dlc_to_length( void )
+{
+    uint32 Element[ 18u ] = { 0 };
+    PduInfoType PduInfo;
+    uint32 CanId = 0u;
+    Bench_Summary Summary;
+
+    Element[ 0u ] = 0x123u << 18u;
+
+    for( uint8 Code = 0u; Code < DLC_CODES; Code++ )
+    {
+        Element[ 1u ] = (uint32)Code << 16u;
+
+        for( uint32 Sample = 0u; Sample < DLC_SAMPLES; Sample++ )
+        {
+            uint64 Start = Can_Model_HostTime( );
+
+            for( uint32 Call = 0u; Call < DLC_BATCH; Call++ )
+            {
+                Can_GetMessage( Element, &PduInfo, &CanId );
+            }
+
+            Samples[ Sample ] = (uint32)( ( ( Can_Model_HostTime( ) - Start ) * 1000u ) / DLC_BATCH );
+        }
+
+        TEST_ASSERT_EQUAL_MESSAGE( DlcBytes[ Code ], PduInfo.SduLength, "Wrong length" );
+        TEST_ASSERT_EQUAL_PTR_MESSAGE( &Element[ 2u ], PduInfo.SduDataPtr, "Wrong payload" );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x123u, CanId, "Wrong id" );
+
+        Bench_Summarize( Samples, DLC_SAMPLES, &Summary );
+        DlcReport( "rx", Code, DlcBytes[ Code ], &Summary );
+    }
+}
@@ -0,0 +1,505 @@
+/**
+ * @file    test_Can_Loopback.c
+ * @brief   **Loopback latency benchmark for the Can Driver over the FDCAN model**
+ * @author  Diego Perez
+ *
+ * group of test cases sending frames through Can_Write with the controller in internal loopback
+ * mode and receiving them back into CanIf_RxIndication, the FDCAN model from test/support plays
+ * the peripheral. Each scenario reports the round trip latency distribution in simulated bus time,
+ * the host time the driver spends per round trip and the sustained frames per second, the same
+ * figures bench/Can_LoopbackBench.c reports when it runs as a target image.
+ */
+#include "unity.h"
+#include "Registers.h"
+#include "Bfx.h"
+#include "Can_Cfg.h"
+#include "Can.h"
+#include "Can_Arch.h"
+#include "CanIf_Can.h"
+#include "Can_Model.h"
+#include "Bench.h"
+#include "mock_Det.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @defgroup    loopback_defines defines for internal use
+ *
+ * @{ */
+#define LOOPBACK_SAMPLES     1000u    /*!< Round trips measured per scenario */
+#define LOOPBACK_HTH         0u       /*!< Transmit object of the loopback controller */
+#define LOOPBACK_HRH         1u       /*!< Receive object of the loopback controller */
+#define LOOPBACK_ISR_LATENCY 2000u    /*!< Simulated interrupt latency in nanoseconds */
+#define LOOPBACK_STEP        10000u   /*!< Simulated time between two polls of the benchmark, in nanoseconds */
+#define LOOPBACK_TIMEOUT     10000000u /*!< Simulated time to give up waiting for a frame, in nanoseconds */
+#define LOOPBACK_WINDOW      100000000u /*!< Simulated time the sustained scenario runs, in nanoseconds */
+/**
+ * @} */
+
+extern Can_HwUnit HwUnit;
+
+/**
+ * @brief   Mock register for CAN1
+ */
+Can_RegisterType CAN1_BASE;
+
+/**
+ * @brief   Mock register for CAN2
+ */
+Can_RegisterType CAN2_BASE;
+
+/**
+ * @brief   Mock register for SRAMCAN1
+ */
+SramCan_RegisterType SRAMCAN1_BASE;
+
+/**
+ * @brief   Mock register for SRAMCAN2
+ */
+SramCan_RegisterType SRAMCAN2_BASE;
+
+/**
+ * @brief   FDCAN model the driver runs over
+ */
+static Can_Model Model;
+
+/**
+ * @brief   Round trip latency of each frame, in simulated nanoseconds
+ */
+static uint32 Latency[ LOOPBACK_SAMPLES ];
+
+/**
+ * @brief   Host time the driver takes on each round trip, in nanoseconds
+ */
+static uint32 HostTime[ LOOPBACK_SAMPLES ];
+
+/**
+ * @brief   Frames indicated to CanIf
+ */
+static uint32 RxIndications;
+
+/**
+ * @brief   Simulated time of the last indication, in nanoseconds
+ */
+static uint64 LastRxTime;
+
+/**
+ * @brief   Last frame id indicated to CanIf
+ */
+static Can_IdType LastRxId;
+
+/**
+ * @brief   Sequence number carried into the first payload byte of the last frame
+ */
+static uint8 LastRxSequence;
+
+/**
+ * @brief   Frames received out of sequence
+ */
+static uint32 RxOutOfSequence;
+
+/**
+ * @brief   Tx confirmations indicated to CanIf
+ */
+static uint32 TxConfirmations;
+
+/* clang-format off */
+static const Can_ControllerBaudrateConfig LoopbackBaudrate =
+{
+    .BaudRateConfigID  = 0u,
+    .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 4u ),
+    .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 1u ),
+    .FdTxBitRateSwitch = STD_ON
+};
+
+static const Can_Controller LoopbackControllers[ 2u ] =
+{
+    {
+        .ControllerId         = 0u,
+        .Mode                 = CAN_MODE_INTERNAL_LOOPBACK,
+        .FrameFormat          = CAN_FRAME_FD,
+        .ClockDivider         = CAN_CLOCK_DIV1,
+        .AutoRetransmission   = STD_OFF,
+        .TransmitPause        = STD_OFF,
+        .ProtocolException    = STD_OFF,
+        .TxFifoQueueMode      = CAN_TX_FIFO_OPERATION,
+        .BaudrateConfigsCount = 1u,
+        .CanReference         = CAN_FDCAN1,
+        .BaudrateConfigs      = &LoopbackBaudrate,
+        .DefaultBaudrate      = &LoopbackBaudrate,
+        .ActiveITs            = CAN_IT_LIST_RX_FIFO0 | CAN_IT_TX_COMPLETE
+    },
+    {
+        .ControllerId         = 1u,
+        .Mode                 = CAN_MODE_NORMAL,
+        .FrameFormat          = CAN_FRAME_CLASSIC,
+        .ClockDivider         = CAN_CLOCK_DIV1,
+        .AutoRetransmission   = STD_OFF,
+        .TransmitPause        = STD_OFF,
+        .ProtocolException    = STD_OFF,
+        .TxFifoQueueMode      = CAN_TX_FIFO_OPERATION,
+        .BaudrateConfigsCount = 1u,
+        .CanReference         = CAN_FDCAN2,
+        .BaudrateConfigs      = &LoopbackBaudrate,
+        .DefaultBaudrate      = &LoopbackBaudrate,
+        .ActiveITs            = 0u
+    }
+};
+
+static const Can_HwFilter LoopbackFilters[ 1u ] =
+{
+    {
+        .HwFilterCode   = 0x000u,
+        .HwFilterMask   = 0x7FFu,
+        .HwFilterType   = CAN_FILTER_TYPE_RANGE,
+        .HwFilterIdType = CAN_ID_STANDARD
+    }
+};
+
+static const Can_HardwareObject LoopbackHohs[ 2u ] =
+{
+    {
+        .CanObjectId         = LOOPBACK_HTH,
+        .HandleType          = CAN_FULL,
+        .IdType              = CAN_ID_STANDARD,
+        .ObjectPayloadLength = 64u,
+        .FdPaddingValue      = 0xCCu,
+        .ObjectType          = CAN_HOH_TYPE_TRANSMIT,
+        .ControllerRef       = &LoopbackControllers[ 0u ]
+    },
+    {
+        .CanObjectId         = LOOPBACK_HRH,
+        .HandleType          = CAN_FULL,
+        .IdType              = CAN_ID_STANDARD,
+        .ObjectPayloadLength = 64u,
+        .ObjectType          = CAN_HOH_TYPE_RECEIVE,
+        .RxFifo              = CAN_RX_FIFO0,
+        .HwFilter            = LoopbackFilters,
+        .HwFilterCount       = 1u,
+        .ControllerRef       = &LoopbackControllers[ 0u ]
+    }
+};
+
+static const Can_ConfigType LoopbackConfig =
+{
+    .Controllers      = LoopbackControllers,
+    .ControllersCount = 2u,
+    .Hohs             = LoopbackHohs,
+    .HohsCount        = 2u
+};
+/* clang-format on */
+
+/**
+ * @brief   CanIf reception indication, takes the sample and releases the Rx FIFO element
+ */
+void CanIf_RxIndication( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr )
+{
+    /* Empty frames can not carry the sequence number, they are taken as the expected one */
+    uint8 Sequence = ( PduInfoPtr->SduLength > 0u ) ? PduInfoPtr->SduDataPtr[ 0u ] : (uint8)( LastRxSequence + 1u );
+
+    if( Sequence != (uint8)( LastRxSequence + 1u ) )
+    {
+        RxOutOfSequence++;
+    }
+
+    RxIndications++;
+    LastRxTime     = Model.Time;
+    LastRxId       = Mailbox->CanId;
+    LastRxSequence = Sequence;
+    Can_Model_RxIndication( &Model, PduInfoPtr );
+}
+
+/**
+ * @brief   CanIf transmission confirmation, releases the Tx event into the model
+ */
+void CanIf_TxConfirmation( PduIdType CanTxPduId )
+{
+    (void)CanTxPduId;
+    TxConfirmations++;
+    Can_Model_TxConfirmation( &Model );
+}
+
+/**
+ * @brief   CanIf transmission cancellation, hardware cancellation is not used by the loopback
+ */
+void CanIf_CancelTxConfirmation( PduIdType CanTxPduId, const PduInfoType *PduInfoPtr )
+{
+    (void)CanTxPduId;
+    (void)PduInfoPtr;
+}
+
+/**
+ * @brief   CanIf bus off notification
+ */
+void CanIf_ControllerBusOff( uint8 ControllerId )
+{
+    (void)ControllerId;
+}
+
+/**
+ * @brief   CanIf mode indication
+ */
+void CanIf_ControllerModeIndication( uint8 ControllerId, Can_ControllerStateType ControllerMode )
+{
+    (void)ControllerId;
+    (void)ControllerMode;
+}
+
+/**
+ * @brief   CanIf error passive notification
+ */
+void CanIf_ControllerErrorStatePassive( uint8 ControllerId, uint16 RxErrorCounter, uint16 TxErrorCounter )
+{
+    (void)ControllerId;
+    (void)RxErrorCounter;
+    (void)TxErrorCounter;
+}
+
+/**
+ * @brief   CanIf error notification
+ */
+void CanIf_ErrorNotification( uint8 ControllerId, Can_ErrorType CanError )
+{
+    (void)ControllerId;
+    (void)CanError;
+}
+
+/**
+ * @brief   CanIf trigger transmit, every PDU is written with its data
+ */
+Std_ReturnType CanIf_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr )
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_NOT_OK;
+}
+
+/**
+ * @brief   Interrupt line routed to the driver
+ */
+static void LoopbackIsr( void )
+{
+    Can_IsrLine0( );
+    Can_IsrLine1( );
+}
+
+/**
+ * @brief   Measure the round trip of frames sent one at a time
+ *
+ * Each frame is written once the previous one came back, so the latency is not affected by frames
+ * waiting into the Tx FIFO. The payload length goes from MinLength to MaxLength to spread the
+ * samples.
+ *
+ * @param    Id CAN id plus the FD flag
+ * @param    MinLength Smallest payload to send
+ * @param    MaxLength Largest payload to send
+ * @param    LatencySummary Distribution of the simulated round trip
+ * @param    HostSummary Distribution of the host time the driver takes
+ *
+ * @retval  Round trips completed
+ */
+static uint32 LoopbackRoundTrips( Can_IdType Id, uint8 MinLength, uint8 MaxLength, Bench_Summary *LatencySummary, Bench_Summary *HostSummary )
+{
+    static const uint8 Data[ 64u ] = { 0 };
+    uint8 Payload[ 64u ];
+    Can_PduType Pdu = { .id = Id, .sdu = Payload };
+    uint32 Sample   = 0u;
+
+    memcpy( Payload, Data, sizeof( Payload ) );
+
+    for( ; Sample < LOOPBACK_SAMPLES; Sample++ )
+    {
+        uint32 Received = RxIndications;
+        uint64 Sent     = Model.Time;
+        uint64 IsrTime  = Model.Counters.IsrTime;
+        uint64 Start;
+        uint64 WriteTime;
+
+        Pdu.swPduHandle = (PduIdType)Sample;
+        Pdu.length      = (uint8)( MinLength + ( Sample % ( ( MaxLength - MinLength ) + 1u ) ) );
+        Payload[ 0u ]   = (uint8)Sample;
+
+        Start = Can_Model_HostTime( );
+        if( Can_Write( LOOPBACK_HTH, &Pdu ) != E_OK )
+        {
+            break;
+        }
+        WriteTime = Can_Model_HostTime( ) - Start;
+
+        Can_Model_Sync( &Model );
+        while( ( RxIndications == Received ) && ( ( Model.Time - Sent ) < LOOPBACK_TIMEOUT ) )
+        {
+            Can_Model_Run( &Model, LOOPBACK_STEP );
+        }
+
+        if( RxIndications == Received )
+        {
+            break;
+        }
+
+        Latency[ Sample ]  = (uint32)( LastRxTime - Sent );
+        HostTime[ Sample ] = (uint32)( WriteTime + ( Model.Counters.IsrTime - IsrTime ) );
+    }
+
+    Bench_Summarize( Latency, Sample, LatencySummary );
+    Bench_Summarize( HostTime, Sample, HostSummary );
+
+    return Sample;
+}
+
+/**
+ * @brief   Keep the Tx FIFO full for a while and count the frames coming back
+ *
+ * @param    Id CAN id plus the FD flag
+ * @param    Length Payload length
+ *
+ * @retval  Frames per second
+ */
+static uint32 LoopbackSustained( Can_IdType Id, uint8 Length )
+{
+    uint8 Payload[ 64u ] = { 0 };
+    Can_PduType Pdu      = { .id = Id, .length = Length, .sdu = Payload };
+    uint64 Start         = Model.Time;
+    uint32 Received      = RxIndications;
+    uint8 Sequence       = LastRxSequence;
+
+    while( ( Model.Time - Start ) < LOOPBACK_WINDOW )
+    {
+        /* Refill the Tx FIFO, the payload carries the sequence number and the model shall take
+        each request before the driver looks for the next free buffer */
+        Payload[ 0u ] = (uint8)( Sequence + 1u );
+        while( Can_Write( LOOPBACK_HTH, &Pdu ) == E_OK )
+        {
+            Can_Model_Sync( &Model );
+            Sequence++;
+            Payload[ 0u ] = (uint8)( Sequence + 1u );
+        }
+
+        Can_Model_Run( &Model, LOOPBACK_STEP );
+    }
+
+    return Bench_Rate( RxIndications - Received, Model.Time - Start, 1000000000u );
+}
+
+/**
+ * @brief   Print the figures of the last scenario
+ *
+ * @param    Name Scenario name
+ * @param    LatencySummary Distribution of the simulated round trip
+ * @param    HostSummary Distribution of the host time the driver takes
+ * @param    FramesPerSecond Sustained frames per second
+ */
+static void LoopbackReport( const char *Name, const Bench_Summary *LatencySummary, const Bench_Summary *HostSummary, uint32 FramesPerSecond )
+{
+    char Message[ 200u ];
+
+    (void)snprintf( Message, sizeof( Message ), "%s: latency min/p50/p99/max %lu/%lu/%lu/%lu ns, driver host time %lu/%lu/%lu/%lu ns, %lu frames/s", Name,
+                    (unsigned long)LatencySummary->Min, (unsigned long)LatencySummary->P50, (unsigned long)LatencySummary->P99,
+                    (unsigned long)LatencySummary->Max, (unsigned long)HostSummary->Min, (unsigned long)HostSummary->P50,
+                    (unsigned long)HostSummary->P99, (unsigned long)HostSummary->Max, (unsigned long)FramesPerSecond );
+    TEST_MESSAGE( Message );
+}
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    memset( &CAN1_BASE, 0x00, sizeof( Can_RegisterType ) );
+    memset( &CAN2_BASE, 0x00, sizeof( Can_RegisterType ) );
+    memset( &SRAMCAN1_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    memset( &SRAMCAN2_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    CAN1->CCCR = 0x00000001;
+    CAN2->CCCR = 0x00000001;
+
+    RxIndications   = 0u;
+    LastRxTime      = 0u;
+    LastRxId        = 0u;
+    LastRxSequence  = 0xFFu;
+    RxOutOfSequence = 0u;
+    TxConfirmations = 0u;
+
+    HwUnit.HwUnitState                         = CAN_CS_UNINIT;
+    HwUnit.ControllerState[ CAN_CONTROLLER_0 ] = CAN_CS_UNINIT;
+    HwUnit.ControllerState[ CAN_CONTROLLER_1 ] = CAN_CS_UNINIT;
+
+    Can_Init( &LoopbackConfig );
+    (void)Can_SetControllerMode( CAN_CONTROLLER_0, CAN_CS_STARTED );
+    Can_EnableControllerInterrupts( CAN_CONTROLLER_0 );
+
+    Can_Model_Init( &Model, CAN1, SRAMCAN1, 500000u, 2000000u );
+    Model.Isr        = LoopbackIsr;
+    Model.IsrLatency = LOOPBACK_ISR_LATENCY;
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test the controller goes into internal loopback**
+ *
+ * Can_Init shall set the test mode, the loopback and the bus monitoring bits, otherwise frames
+ * would go to the bus pins instead of coming back.
+ */
+void test__Can_Loopback__internal_loopback_mode( void )
+{
+    TEST_ASSERT_BITS_HIGH_MESSAGE( ( 1u << 7u ) | ( 1u << 5u ), CAN1->CCCR, "CCCR.TEST and CCCR.MON shall be set" );
+    TEST_ASSERT_BITS_HIGH_MESSAGE( 1u << 4u, CAN1->TEST, "TEST.LBCK shall be set" );
+}
+
+/**
+ * @brief   **Test round trip of classic frames at 500k**
+ *
+ * Every frame written with Can_Write shall come back to CanIf_RxIndication, no sooner than the
+ * time the longest frame takes on the bus plus the interrupt latency, and the bus shall be kept
+ * busy when the Tx FIFO is refilled as soon as it has room.
+ */
+void test__Can_Loopback__classic_500k( void )
+{
+    Bench_Summary LatencySummary;
+    Bench_Summary HostSummary;
+    uint64 Shortest = Can_Model_FrameTime( &Model, 0x123u, 0u, FALSE ) + LOOPBACK_ISR_LATENCY;
+    uint64 Longest  = Can_Model_FrameTime( &Model, 0x123u, 8u, FALSE ) + LOOPBACK_ISR_LATENCY;
+    uint32 Rounds   = LoopbackRoundTrips( 0x123u, 0u, 8u, &LatencySummary, &HostSummary );
+    uint32 Fps      = LoopbackSustained( 0x123u, 8u );
+    uint32 BusLimit = (uint32)( 1000000000u / Can_Model_FrameTime( &Model, 0x123u, 8u, FALSE ) );
+
+    LoopbackReport( "classic 500k", &LatencySummary, &HostSummary, Fps );
+
+    TEST_ASSERT_EQUAL_MESSAGE( LOOPBACK_SAMPLES, Rounds, "Every frame shall come back" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x123u, LastRxId, "Frame shall come back with the same id" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, RxOutOfSequence, "Frames shall come back in the order they were sent" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Model.Counters.RxLost, "No frame shall be lost" );
+    TEST_ASSERT_EQUAL_MESSAGE( RxIndications, TxConfirmations, "Every frame shall be confirmed" );
+    TEST_ASSERT_EQUAL_MESSAGE( (uint32)Shortest, LatencySummary.Min, "Shortest round trip is the empty frame" );
+    TEST_ASSERT_EQUAL_MESSAGE( (uint32)Longest, LatencySummary.Max, "Longest round trip is the eight bytes frame" );
+    TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE( ( BusLimit * 95u ) / 100u, Fps, "Bus shall be kept busy" );
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE( BusLimit, Fps, "Frames can not go faster than the bus" );
+}
+
+/**
+ * @brief   **Test round trip of FD frames at 500k/2M**
+ *
+ * Same as the classic scenario with payloads from 0 up to 64 bytes sent with bit rate switch, every
+ * length goes with the smallest DLC able to hold it so the empty frame is the shortest round trip.
+ */
+void test__Can_Loopback__fd_2M( void )
+{
+    Bench_Summary LatencySummary;
+    Bench_Summary HostSummary;
+    Can_IdType Id   = 0x123u | CAN_MODEL_ID_FD;
+    uint64 Shortest = Can_Model_FrameTime( &Model, Id, 0u, TRUE ) + LOOPBACK_ISR_LATENCY;
+    uint64 Longest  = Can_Model_FrameTime( &Model, Id, 64u, TRUE ) + LOOPBACK_ISR_LATENCY;
+    uint32 Rounds   = LoopbackRoundTrips( Id, 0u, 64u, &LatencySummary, &HostSummary );
+    uint32 Fps      = LoopbackSustained( Id, 64u );
+    uint32 BusLimit = (uint32)( 1000000000u / Can_Model_FrameTime( &Model, Id, 64u, TRUE ) );
+
+    LoopbackReport( "fd 500k/2M", &LatencySummary, &HostSummary, Fps );
+
+    TEST_ASSERT_EQUAL_MESSAGE( LOOPBACK_SAMPLES, Rounds, "Every frame shall come back" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, RxOutOfSequence, "Frames shall come back in the order they were sent" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Model.Counters.RxLost, "No frame shall be lost" );
+    TEST_ASSERT_EQUAL_MESSAGE( (uint32)Shortest, LatencySummary.Min, "Shortest round trip is the empty frame" );
+    TEST_ASSERT_EQUAL_MESSAGE( (uint32)Longest, LatencySummary.Max, "Longest round trip is the 64 bytes frame" );
+    TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE( ( BusLimit * 95u ) / 100u, Fps, "Bus shall be kept busy" );
+}
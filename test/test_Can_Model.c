@@ -0,0 +1,871 @@
+/**
+ * @file    test_Can_Model.c
+ * @brief   **Load testing for the Can Driver over the FDCAN model**
+ * @author  Diego Perez
+ *
+ * group of test cases running the low level Can driver against the behavioural FDCAN model from
+ * test/support, traces of frames are replayed at 500k, 1M and FD bit rates to check the driver
+ * receives and transmits every frame, how it behaves when the interrupt is served late and how
+ * much host time it takes per frame.
+ */
+#include "unity.h"
+#include "Registers.h"
+#include "Bfx.h"
+#include "Can_Cfg.h"
+#include "Can_Arch.h"
+#include "CanIf_Can.h"
+#include "Can_Model.h"
+#include "mock_Det.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MODEL_TRACE_FRAMES 200u /*!< Frames into the load traces */
+
+/**
+ * @brief   Mock register for CAN1
+ */
+Can_RegisterType CAN1_BASE;
+
+/**
+ * @brief   Mock register for CAN2
+ */
+Can_RegisterType CAN2_BASE;
+
+/**
+ * @brief   Mock register for SRAMCAN1
+ */
+SramCan_RegisterType SRAMCAN1_BASE;
+
+/**
+ * @brief   Mock register for SRAMCAN2
+ */
+SramCan_RegisterType SRAMCAN2_BASE;
+
+/**
+ * @brief   FDCAN model the driver runs over
+ */
+static Can_Model Model;
+
+/**
+ * @brief   Hardware unit used by the driver
+ */
+static Can_HwUnit ModelHwUnit;
+
+/**
+ * @brief   Controller states for the hardware unit
+ */
+static Can_ControllerStateType ModelStates[ 2u ];
+
+/**
+ * @brief   Frames used by the load traces
+ */
+static Can_ModelFrame Trace[ MODEL_TRACE_FRAMES ];
+
+/**
+ * @brief   Payload used by the traces
+ */
+static const uint8 Payload[ 64u ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+/**
+ * @brief   Frames indicated to CanIf
+ */
+static uint32 RxIndications;
+
+/**
+ * @brief   Last frame indicated to CanIf
+ */
+static Can_IdType LastRxId;
+
+/**
+ * @brief   Last frame payload indicated to CanIf
+ */
+static uint8 LastRxData[ 64u ];
+
+/**
+ * @brief   Last frame length indicated to CanIf
+ */
+static PduLengthType LastRxLength;
+
+/**
+ * @brief   Hardware object the last frame was received
+ */
+static Can_HwHandleType LastRxHoh;
+
+/**
+ * @brief   Tx confirmations indicated to CanIf
+ */
+static uint32 TxConfirmations;
+
+/**
+ * @brief   Pdus confirmed to CanIf in order
+ */
+static PduIdType TxConfirmed[ 8u ];
+
+/**
+ * @brief   Pdus whose transmission was cancelled by the driver, in order
+ */
+static PduIdType TxCancelled[ 4u ];
+
+/**
+ * @brief   Tx cancellations notified to CanIf
+ */
+static uint32 TxCancellations;
+
+/**
+ * @brief   Pdu CanIf writes once a cancellation is notified, the one waiting for a free buffer
+ */
+static const Can_PduType *TxRetry;
+
+/**
+ * @brief   Errors notified to CanIf
+ */
+static uint32 ErrorNotifications;
+
+/**
+ * @brief   CanIf keeps the Rx FIFO elements indicated until it releases them
+ */
+static boolean RxDeferred;
+
+/**
+ * @brief   Payloads indicated and held by CanIf, in order
+ */
+static const uint8 *RxHeld[ 4u ];
+
+/**
+ * @brief   Payloads held by CanIf
+ */
+static uint32 RxHeldCount;
+
+/**
+ * @brief   Upper layer buffer the copy once delivery mode copies the payloads into
+ */
+static uint8 RxCopyBuffer[ 64u ];
+
+/**
+ * @brief   Controller configuration with the Rx delivery mode under test
+ */
+static Can_Controller ModelRxController;
+
+/**
+ * @brief   Hardware objects pointing to the controller with the Rx delivery mode under test
+ */
+static Can_HardwareObject ModelRxHohs[ 3u ];
+
+/**
+ * @brief   Driver configuration with the Rx delivery mode under test
+ */
+static Can_ConfigType ModelRxConfig;
+
+/* clang-format off */
+static const Can_ControllerBaudrateConfig ModelBaudrates[ 2u ] =
+{
+    {
+        .BaudRateConfigID  = 0u,
+        .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 4u ),
+        .Dbtp              = CAN_DBTP_VALUE( 13u, 2u, 1u, 1u ),
+        .FdTxBitRateSwitch = STD_ON
+    },
+    {
+        .BaudRateConfigID  = 1u,
+        .Nbtp              = CAN_NBTP_VALUE( 13u, 2u, 1u, 4u ),
+        .Dbtp              = CAN_DBTP_TDC_VALUE( 13u, 2u, 1u, 1u ),
+        .Tdcr              = CAN_TDCR_VALUE( CAN_TDC_OFFSET( 13u, 1u ), 4u ),
+        .FdTxBitRateSwitch = STD_ON
+    }
+};
+
+static const Can_Controller ModelControllers[ 1u ] =
+{
+    {
+        .ControllerId         = 0u,
+        .Mode                 = CAN_MODE_NORMAL,
+        .FrameFormat          = CAN_FRAME_FD,
+        .ClockDivider         = CAN_CLOCK_DIV1,
+        .AutoRetransmission   = STD_OFF,
+        .TransmitPause        = STD_OFF,
+        .ProtocolException    = STD_OFF,
+        .TxFifoQueueMode      = CAN_TX_FIFO_OPERATION,
+        .BaudrateConfigsCount = 2u,
+        .CanReference         = CAN_FDCAN1,
+        .BaudrateConfigs      = ModelBaudrates,
+        .DefaultBaudrate      = &ModelBaudrates[ 0u ],
+        .ActiveITs            = CAN_IT_LIST_RX_FIFO0 | CAN_IT_LIST_RX_FIFO1 | CAN_IT_TX_COMPLETE | CAN_IT_DATA_PROTOCOL_ERROR
+    }
+};
+
+static const Can_HwFilter ModelFifo0Filters[ 1u ] =
+{
+    {
+        .HwFilterCode   = 0x100u,
+        .HwFilterMask   = 0x1FFu,
+        .HwFilterType   = CAN_FILTER_TYPE_RANGE,
+        .HwFilterIdType = CAN_ID_STANDARD
+    }
+};
+
+static const Can_HwFilter ModelFifo1Filters[ 1u ] =
+{
+    {
+        .HwFilterCode   = 0x18DA0000u,
+        .HwFilterMask   = 0x1FFF0000u,
+        .HwFilterType   = CAN_FILTER_TYPE_CLASSIC,
+        .HwFilterIdType = CAN_ID_EXTENDED
+    }
+};
+
+static const Can_HardwareObject ModelHohs[ 3u ] =
+{
+    {
+        .CanObjectId         = 0u,
+        .HandleType          = CAN_FULL,
+        .IdType              = CAN_ID_MIXED,
+        .ObjectPayloadLength = 64u,
+        .FdPaddingValue      = 0xCCu,
+        .ObjectType          = CAN_HOH_TYPE_TRANSMIT,
+        .ControllerRef       = &ModelControllers[ 0u ]
+    },
+    {
+        .CanObjectId         = 1u,
+        .HandleType          = CAN_FULL,
+        .IdType              = CAN_ID_STANDARD,
+        .ObjectPayloadLength = 64u,
+        .ObjectType          = CAN_HOH_TYPE_RECEIVE,
+        .RxFifo              = CAN_RX_FIFO0,
+        .HwFilter            = ModelFifo0Filters,
+        .HwFilterCount       = 1u,
+        .ControllerRef       = &ModelControllers[ 0u ]
+    },
+    {
+        .CanObjectId         = 2u,
+        .HandleType          = CAN_FULL,
+        .IdType              = CAN_ID_EXTENDED,
+        .ObjectPayloadLength = 64u,
+        .ObjectType          = CAN_HOH_TYPE_RECEIVE,
+        .RxFifo              = CAN_RX_FIFO1,
+        .HwFilter            = ModelFifo1Filters,
+        .HwFilterCount       = 1u,
+        .ControllerRef       = &ModelControllers[ 0u ]
+    }
+};
+
+static const Can_ConfigType ModelConfig =
+{
+    .Controllers      = ModelControllers,
+    .ControllersCount = 1u,
+    .Hohs             = ModelHohs,
+    .HohsCount        = 3u
+};
+/* clang-format on */
+
+/**
+ * @brief   CanIf reception indication, releases the Rx FIFO element into the model
+ */
+void CanIf_RxIndication( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr )
+{
+    RxIndications++;
+    LastRxId     = Mailbox->CanId;
+    LastRxHoh    = Mailbox->Hoh;
+    LastRxLength = PduInfoPtr->SduLength;
+    memcpy( LastRxData, PduInfoPtr->SduDataPtr, PduInfoPtr->SduLength );
+
+    if( RxDeferred == TRUE )
+    {
+        /* The element is released later on by the test */
+        RxHeld[ RxHeldCount % 4u ] = PduInfoPtr->SduDataPtr;
+        RxHeldCount++;
+    }
+    else if( PduInfoPtr->SduDataPtr == RxCopyBuffer )
+    {
+        /* Already acknowledged by the driver, the copy scenario only receives into Rx FIFO 0 */
+        Can_Model_RxAcknowledge( &Model, 0u );
+    }
+    else
+    {
+        Can_Model_RxIndication( &Model, PduInfoPtr );
+    }
+}
+
+/**
+ * @brief   Upper layer buffer for the copy once delivery mode
+ */
+static uint8 *ModelRxBuffer( const Can_HwType *Mailbox, PduLengthType Length )
+{
+    (void)Mailbox;
+    (void)Length;
+    return RxCopyBuffer;
+}
+
+/**
+ * @brief   Run the driver with another Rx delivery mode
+ *
+ * @param    Delivery Rx delivery mode, a value of @ref CAN_Rx_Delivery
+ */
+static void ModelSetRxDelivery( uint8 Delivery )
+{
+    ModelRxController                  = ModelControllers[ 0u ];
+    ModelRxController.RxDelivery       = Delivery;
+    ModelRxController.RxBufferCallback = ModelRxBuffer;
+    ModelRxConfig                      = ModelConfig;
+    ModelRxConfig.Controllers          = &ModelRxController;
+    ModelRxConfig.Hohs                 = ModelRxHohs;
+
+    for( uint8 Hoh = 0u; Hoh < 3u; Hoh++ )
+    {
+        ModelRxHohs[ Hoh ]               = ModelHohs[ Hoh ];
+        ModelRxHohs[ Hoh ].ControllerRef = &ModelRxController;
+    }
+
+    ModelHwUnit.Config = &ModelRxConfig;
+    RxDeferred         = ( Delivery == CAN_RX_DELIVERY_DEFERRED ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief   CanIf transmission confirmation, releases the Tx event into the model
+ */
+void CanIf_TxConfirmation( PduIdType CanTxPduId )
+{
+    TxConfirmed[ TxConfirmations % 8u ] = CanTxPduId;
+    TxConfirmations++;
+    Can_Model_TxConfirmation( &Model );
+}
+
+/**
+ * @brief   CanIf transmission cancellation, writes the Pdu waiting for the buffer freed
+ */
+void CanIf_CancelTxConfirmation( PduIdType CanTxPduId, const PduInfoType *PduInfoPtr )
+{
+    (void)PduInfoPtr;
+    TxCancelled[ TxCancellations % 4u ] = CanTxPduId;
+    TxCancellations++;
+
+    if( TxRetry != NULL_PTR )
+    {
+        (void)Can_Arch_Write( &ModelHwUnit, 0u, TxRetry );
+        TxRetry = NULL_PTR;
+    }
+}
+
+/**
+ * @brief   CanIf bus off notification
+ */
+void CanIf_ControllerBusOff( uint8 ControllerId )
+{
+    (void)ControllerId;
+}
+
+/**
+ * @brief   CanIf mode indication
+ */
+void CanIf_ControllerModeIndication( uint8 ControllerId, Can_ControllerStateType ControllerMode )
+{
+    (void)ControllerId;
+    (void)ControllerMode;
+}
+
+/**
+ * @brief   CanIf error passive notification
+ */
+void CanIf_ControllerErrorStatePassive( uint8 ControllerId, uint16 RxErrorCounter, uint16 TxErrorCounter )
+{
+    (void)ControllerId;
+    (void)RxErrorCounter;
+    (void)TxErrorCounter;
+}
+
+/**
+ * @brief   CanIf error notification
+ */
+void CanIf_ErrorNotification( uint8 ControllerId, Can_ErrorType CanError )
+{
+    (void)ControllerId;
+    (void)CanError;
+    ErrorNotifications++;
+}
+
+/**
+ * @brief   CanIf trigger transmit, every PDU is written with its data
+ */
+Std_ReturnType CanIf_TriggerTransmit( PduIdType TxPduId, PduInfoType *PduInfoPtr )
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_NOT_OK;
+}
+
+/**
+ * @brief   Interrupt line routed to the driver
+ */
+static void ModelIsr( void )
+{
+    Can_Arch_IsrMainHandler( &ModelHwUnit, 0u );
+}
+
+/**
+ * @brief   Fill the trace with frames back to back
+ *
+ * @param    Id First id, the rest are consecutive
+ * @param    Length Payload length
+ */
+static void ModelFillTrace( uint32 Id, uint8 Length )
+{
+    for( uint32 Frame = 0u; Frame < MODEL_TRACE_FRAMES; Frame++ )
+    {
+        Trace[ Frame ].Time   = 0u;
+        Trace[ Frame ].Id     = Id + ( Frame % 0x80u );
+        Trace[ Frame ].Length = Length;
+        Trace[ Frame ].Data   = Payload;
+    }
+}
+
+/**
+ * @brief   Print the load figures of the last run
+ *
+ * @param    Name Scenario name
+ */
+static void ModelReport( const char *Name )
+{
+    char Message[ 160u ];
+    uint32 Frames = Model.Counters.RxFrames + Model.Counters.TxFrames;
+    uint64 Load   = ( Model.Counters.IsrTime * 10000u ) / Model.Counters.BusTime;
+
+    (void)snprintf( Message, sizeof( Message ), "%s: %lu frames, %lu lost, %lu ns per frame, ISR load at full bus %lu.%02lu%%", Name,
+                    (unsigned long)Frames, (unsigned long)Model.Counters.RxLost,
+                    (unsigned long)( Model.Counters.IsrTime / ( ( Frames > 0u ) ? Frames : 1u ) ), (unsigned long)( Load / 100u ),
+                    (unsigned long)( Load % 100u ) );
+    TEST_MESSAGE( Message );
+}
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    memset( &CAN1_BASE, 0x00, sizeof( Can_RegisterType ) );
+    memset( &SRAMCAN1_BASE, 0x00, sizeof( SramCan_RegisterType ) );
+    CAN1->CCCR = 0x00000001;
+
+    RxIndications      = 0u;
+    LastRxId           = 0u;
+    LastRxLength       = 0u;
+    LastRxHoh          = 0u;
+    TxConfirmations    = 0u;
+    TxCancellations    = 0u;
+    TxRetry            = NULL_PTR;
+    ErrorNotifications = 0u;
+    RxDeferred         = FALSE;
+    RxHeldCount        = 0u;
+
+    ModelHwUnit.HwUnitState           = CAN_CS_READY;
+    ModelHwUnit.Config                = &ModelConfig;
+    ModelHwUnit.ControllerState       = ModelStates;
+    ModelHwUnit.ControllerState[ 0u ] = CAN_CS_STOPPED;
+    ModelHwUnit.DisableIntsLvl[ 0u ]  = 0u;
+
+    Can_Arch_Init( &ModelHwUnit, &ModelConfig, 0u );
+    (void)Can_Arch_SetControllerMode( &ModelHwUnit, 0u, CAN_CS_STARTED );
+    Can_Arch_EnableControllerInterrupts( &ModelHwUnit, 0u );
+
+    Can_Model_Init( &Model, CAN1, SRAMCAN1, 500000u, 2000000u );
+    Model.Isr = ModelIsr;
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   Frame time of classic and FD frames
+ *
+ * A classic standard frame with 8 bytes takes 111 bits, at 500k it is 222us, and the same frame
+ * with worst case stuffing takes 135 bits. An FD frame with 64 bytes at 500k/2M takes 29 bits at
+ * nominal rate and 550 bits at data rate.
+ */
+void test__Can_Model__frame_time( void )
+{
+    TEST_ASSERT_EQUAL_UINT64_MESSAGE( 222000u, Can_Model_FrameTime( &Model, 0x123u, 8u, FALSE ), "Wrong classic frame time" );
+    TEST_ASSERT_EQUAL_UINT64_MESSAGE( 58000u + 275000u, Can_Model_FrameTime( &Model, CAN_MODEL_ID_FD | 0x123u, 64u, TRUE ), "Wrong FD frame time" );
+
+    Model.StuffBits = TRUE;
+    TEST_ASSERT_EQUAL_UINT64_MESSAGE( 270000u, Can_Model_FrameTime( &Model, 0x123u, 8u, FALSE ), "Wrong stuffed frame time" );
+}
+
+/**
+ * @brief   Back to back classic frames at 500k
+ *
+ * A trace with frames back to back is received with the interrupt served right away, every frame
+ * is indicated to CanIf with its id and payload and the bus is busy all the time.
+ */
+void test__Can_Model__classic_500k_back_to_back( void )
+{
+    ModelFillTrace( 0x100u, 8u );
+    Can_Model_SetTrace( &Model, Trace, MODEL_TRACE_FRAMES );
+
+    Can_Model_Run( &Model, 1000000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( MODEL_TRACE_FRAMES, RxIndications, "Frames not indicated" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Model.Counters.RxLost, "Frames lost" );
+    TEST_ASSERT_EQUAL_MESSAGE( MODEL_TRACE_FRAMES, Model.Counters.RxRead, "Frames not released" );
+    TEST_ASSERT_EQUAL_UINT64_MESSAGE( MODEL_TRACE_FRAMES * 222000u, Model.Counters.BusTime, "Wrong bus time" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x100u + ( ( MODEL_TRACE_FRAMES - 1u ) % 0x80u ), LastRxId, "Wrong last id" );
+    TEST_ASSERT_EQUAL_MESSAGE( 8u, LastRxLength, "Wrong last length" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( Payload, LastRxData, 8u, "Wrong last payload" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, CAN1->RXF0S & 0x7Fu, "Rx FIFO 0 not empty" );
+    ModelReport( "classic 500k" );
+}
+
+/**
+ * @brief   Frames not passing the filters
+ *
+ * Standard frames out of the range filter are rejected by the model, extended frames matching the
+ * classic filter go to Rx FIFO 1 and are indicated with the extended id bit.
+ */
+void test__Can_Model__filters( void )
+{
+    static const Can_ModelFrame Frames[ 3u ] = {
+        { .Time = 0u, .Id = 0x200u, .Length = 8u },
+        { .Time = 0u, .Id = CAN_MODEL_ID_EXTENDED | 0x18DA00F1u, .Length = 8u },
+        { .Time = 0u, .Id = CAN_MODEL_ID_EXTENDED | 0x18DB00F1u, .Length = 8u },
+    };
+
+    Can_Model_SetTrace( &Model, Frames, 3u );
+    Can_Model_Run( &Model, 10000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Model.Counters.RxRejected, "Frames not rejected" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, RxIndications, "Frame not indicated" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x98DA00F1u, LastRxId, "Wrong extended id" );
+}
+
+/**
+ * @brief   Back to back frames at 1M and FD 1M/4M
+ *
+ * Classic frames at 1M and FD frames with 64 bytes at 1M/4M are received without losses while the
+ * interrupt is served within a frame time.
+ */
+void test__Can_Model__classic_1M_and_fd_4M( void )
+{
+    Can_Model_Init( &Model, CAN1, SRAMCAN1, 1000000u, 4000000u );
+    Model.Isr        = ModelIsr;
+    Model.IsrLatency = 20000u;
+    ModelFillTrace( 0x180u, 8u );
+    Can_Model_SetTrace( &Model, Trace, MODEL_TRACE_FRAMES );
+    Can_Model_Run( &Model, 1000000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( MODEL_TRACE_FRAMES, RxIndications, "Classic frames not indicated" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Model.Counters.RxLost, "Classic frames lost" );
+    ModelReport( "classic 1M" );
+
+    RxIndications = 0u;
+    Can_Model_Init( &Model, CAN1, SRAMCAN1, 1000000u, 4000000u );
+    Model.Isr        = ModelIsr;
+    Model.IsrLatency = 20000u;
+    ModelFillTrace( CAN_MODEL_ID_FD | 0x100u, 64u );
+    Can_Model_SetTrace( &Model, Trace, MODEL_TRACE_FRAMES );
+    Can_Model_Run( &Model, 1000000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( MODEL_TRACE_FRAMES, RxIndications, "FD frames not indicated" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Model.Counters.RxLost, "FD frames lost" );
+    TEST_ASSERT_EQUAL_MESSAGE( 64u, LastRxLength, "Wrong FD length" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( Payload, LastRxData, 64u, "Wrong FD payload" );
+    ModelReport( "FD 1M/4M" );
+}
+
+/**
+ * @brief   Interrupt served too late
+ *
+ * With the interrupt served five frame times after the flag, the three elements of the Rx FIFO 0
+ * fill up and the next frames are lost, the driver reports the lost frames and delivers the ones
+ * stored.
+ */
+void test__Can_Model__late_isr_loses_frames( void )
+{
+    Det_ReportRuntimeError_IgnoreAndReturn( E_OK );
+
+    Model.IsrLatency = 5u * 222000u;
+    ModelFillTrace( 0x100u, 8u );
+    Can_Model_SetTrace( &Model, Trace, 10u );
+    Can_Model_Run( &Model, 100000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Model.Counters.RxFrames + Model.Counters.RxLost, "Frames not accounted" );
+    TEST_ASSERT_NOT_EQUAL_MESSAGE( 0u, Model.Counters.RxLost, "No frames lost" );
+    TEST_ASSERT_EQUAL_MESSAGE( Model.Counters.RxFrames, RxIndications, "Stored frames not indicated" );
+    TEST_ASSERT_NOT_EQUAL_MESSAGE( 0u, ErrorNotifications, "Lost frames not notified" );
+}
+
+/**
+ * @brief   Transmission through the Tx FIFO
+ *
+ * Three frames fill the Tx FIFO and a fourth write is rejected as busy, once the bus runs every
+ * frame is confirmed to CanIf in order with its Pdu id taken from the Tx event FIFO.
+ */
+void test__Can_Model__tx_fifo( void )
+{
+    uint8 Data[ 8u ] = { 0 };
+    Can_PduType Pdu  = { .id = 0x123u, .length = 8u, .sdu = Data };
+
+    for( uint8 Frame = 0u; Frame < 3u; Frame++ )
+    {
+        Pdu.swPduHandle = 10u + Frame;
+        TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_Write( &ModelHwUnit, 0u, &Pdu ), "Frame not written" );
+        Can_Model_Sync( &Model );
+    }
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_BUSY, Can_Arch_Write( &ModelHwUnit, 0u, &Pdu ), "Full Tx FIFO not busy" );
+
+    Can_Model_Run( &Model, 10000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, Model.Counters.TxFrames, "Frames not sent" );
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, TxConfirmations, "Frames not confirmed" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, TxConfirmed[ 0u ], "Wrong first Pdu" );
+    TEST_ASSERT_EQUAL_MESSAGE( 11u, TxConfirmed[ 1u ], "Wrong second Pdu" );
+    TEST_ASSERT_EQUAL_MESSAGE( 12u, TxConfirmed[ 2u ], "Wrong third Pdu" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_Write( &ModelHwUnit, 0u, &Pdu ), "Empty Tx FIFO busy" );
+}
+
+/**
+ * @brief   Transmission and reception sharing the bus
+ *
+ * A frame from the driver with a lower id wins the arbitration against a trace frame ready at the
+ * same time, and in loop back mode the frames sent are received back through the filters.
+ */
+void test__Can_Model__arbitration_and_loopback( void )
+{
+    static const Can_ModelFrame Frames[ 1u ] = { { .Time = 0u, .Id = 0x1F0u, .Length = 8u } };
+    uint8 Data[ 8u ] = { 8, 7, 6, 5, 4, 3, 2, 1 };
+    Can_PduType Pdu  = { .id = 0x101u, .length = 8u, .sdu = Data, .swPduHandle = 5u };
+
+    CAN1->CCCR |= ( 1u << 7u );
+    CAN1->TEST |= ( 1u << 4u );
+
+    Can_Model_SetTrace( &Model, Frames, 1u );
+    (void)Can_Arch_Write( &ModelHwUnit, 0u, &Pdu );
+    Can_Model_Sync( &Model );
+    Can_Model_Run( &Model, 222000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Model.Counters.TxFrames, "Driver frame lost the arbitration" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, RxIndications, "Loop back frame not received" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x101u, LastRxId, "Wrong loop back id" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( Data, LastRxData, 8u, "Wrong loop back payload" );
+
+    Can_Model_Run( &Model, 1000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, RxIndications, "Trace frame not received" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1F0u, LastRxId, "Wrong trace id" );
+}
+
+/**
+ * @brief   Data phase at 5M through a transceiver with loop delay
+ *
+ * With 200ns of loop delay the bits sent at 5M come back after the data sample point, without
+ * delay compensation every FD frame fails with a bit error in the data phase and it is dropped
+ * since the automatic retransmission is disabled. Once the baudrate config with TDC is set the
+ * transmitter samples at the secondary sample point and the frames are sent and confirmed.
+ */
+void test__Can_Model__fd_5M_transmitter_delay_compensation( void )
+{
+    uint8 Data[ 64u ] = { 0 };
+    Can_PduType Pdu   = { .id = 0x40000123u, .length = 64u, .sdu = Data, .swPduHandle = 1u };
+
+    Can_Model_Init( &Model, CAN1, SRAMCAN1, 500000u, 5000000u );
+    Model.Isr       = ModelIsr;
+    Model.LoopDelay = 200u;
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_Write( &ModelHwUnit, 0u, &Pdu ), "Frame not written" );
+    Can_Model_Sync( &Model );
+    Can_Model_Run( &Model, 1000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Model.Counters.TxErrors, "Data phase not failed" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Model.Counters.TxFrames, "Frame sent without compensation" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, TxConfirmations, "Frame confirmed without compensation" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, ErrorNotifications, "Data phase error not notified" );
+
+    (void)Can_Arch_SetControllerMode( &ModelHwUnit, 0u, CAN_CS_STOPPED );
+    ModelHwUnit.ControllerState[ 0u ] = CAN_CS_STOPPED;
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_SetBaudrate( &ModelHwUnit, 0u, 1u ), "Baudrate not set" );
+    (void)Can_Arch_SetControllerMode( &ModelHwUnit, 0u, CAN_CS_STARTED );
+    ModelHwUnit.ControllerState[ 0u ] = CAN_CS_STARTED;
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_Write( &ModelHwUnit, 0u, &Pdu ), "Frame not written with TDC" );
+    Can_Model_Sync( &Model );
+    Can_Model_Run( &Model, 1000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Model.Counters.TxErrors, "Data phase failed with compensation" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Model.Counters.TxFrames, "Frame not sent with compensation" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, TxConfirmations, "Frame not confirmed with compensation" );
+}
+
+/**
+ * @brief   Payloads kept in message RAM until released
+ *
+ * With the deferred delivery mode the three frames received are indicated pointing into message
+ * RAM and their payloads are still there after the rest arrive, since the Rx FIFO 0 elements are
+ * held the fourth frame is lost. Once released the elements take new frames, a release with
+ * nothing held is refused.
+ */
+void test__Can_Model__deferred_rx_release( void )
+{
+    static const Can_ModelFrame Frames[ 5u ] = {
+        { .Time = 0u, .Id = 0x100u, .Length = 8u, .Data = &Payload[ 0u ] },
+        { .Time = 0u, .Id = 0x101u, .Length = 8u, .Data = &Payload[ 1u ] },
+        { .Time = 0u, .Id = 0x102u, .Length = 8u, .Data = &Payload[ 2u ] },
+        { .Time = 2000u, .Id = 0x103u, .Length = 8u, .Data = &Payload[ 3u ] },
+        { .Time = 4000u, .Id = 0x104u, .Length = 8u, .Data = &Payload[ 4u ] },
+    };
+
+    Det_ReportRuntimeError_IgnoreAndReturn( E_OK );
+    ModelSetRxDelivery( CAN_RX_DELIVERY_DEFERRED );
+    Can_Model_SetTrace( &Model, Frames, 5u );
+
+    Can_Model_Run( &Model, 3000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, RxIndications, "Frames not indicated" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Model.Counters.RxLost, "Frame not lost with the elements held" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( &Payload[ 0u ], RxHeld[ 0u ], 8u, "First payload overwritten" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( &Payload[ 1u ], RxHeld[ 1u ], 8u, "Second payload overwritten" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( &Payload[ 2u ], RxHeld[ 2u ], 8u, "Third payload overwritten" );
+
+    for( uint8 Held = 0u; Held < 3u; Held++ )
+    {
+        Can_Model_RxAcknowledge( &Model, 0u );
+        TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_ReleaseRxMessage( &ModelHwUnit, 1u ), "Element not released" );
+    }
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Can_Arch_ReleaseRxMessage( &ModelHwUnit, 1u ), "Release with nothing held" );
+
+    Can_Model_Run( &Model, 2000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 4u, RxIndications, "Frame not indicated after the release" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x104u, LastRxId, "Wrong id after the release" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( &Payload[ 4u ], RxHeld[ 3u ], 8u, "Wrong payload after the release" );
+}
+
+/**
+ * @brief   Elements stored with the interrupts disabled indicated on release
+ *
+ * With the deferred delivery mode two frames are indicated and held, the third one arrives while
+ * the controller interrupts are disabled and it is not indicated. Releasing the oldest element
+ * indicates the third frame right away, the two elements left are held.
+ */
+void test__Can_Model__deferred_rx_release_delivers_pending( void )
+{
+    static const Can_ModelFrame Frames[ 3u ] = {
+        { .Time = 0u, .Id = 0x100u, .Length = 8u, .Data = &Payload[ 0u ] },
+        { .Time = 0u, .Id = 0x101u, .Length = 8u, .Data = &Payload[ 1u ] },
+        { .Time = 2000u, .Id = 0x102u, .Length = 8u, .Data = &Payload[ 2u ] },
+    };
+
+    ModelSetRxDelivery( CAN_RX_DELIVERY_DEFERRED );
+    Can_Model_SetTrace( &Model, Frames, 3u );
+
+    Can_Model_Run( &Model, 1000000u );
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, RxIndications, "Frames not indicated" );
+
+    Can_Arch_DisableControllerInterrupts( &ModelHwUnit, 0u );
+    Can_Model_Run( &Model, 2000000u );
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, RxIndications, "Frame indicated with the interrupts disabled" );
+
+    /* The model takes the acknowledge first, the driver reads the fill level again after writing it */
+    Can_Model_RxAcknowledge( &Model, 0u );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_ReleaseRxMessage( &ModelHwUnit, 1u ), "Element not released" );
+    Can_Arch_EnableControllerInterrupts( &ModelHwUnit, 0u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, RxIndications, "Pending frame not indicated on release" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x102u, LastRxId, "Wrong id indicated on release" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( &Payload[ 2u ], RxHeld[ 2u ], 8u, "Wrong payload indicated on release" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000003u, CAN1->ILE, "Interrupt lines not enabled" );
+
+    Can_Model_RxAcknowledge( &Model, 0u );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_ReleaseRxMessage( &ModelHwUnit, 1u ), "Second element not released" );
+    Can_Model_RxAcknowledge( &Model, 0u );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_ReleaseRxMessage( &ModelHwUnit, 1u ), "Third element not released" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Can_Arch_ReleaseRxMessage( &ModelHwUnit, 1u ), "Release with nothing held" );
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, RxIndications, "Frame indicated twice" );
+}
+
+/**
+ * @brief   Payloads copied once into the upper layer buffer
+ *
+ * With the copy once delivery mode the FD frames are indicated with the payload already in the
+ * upper layer buffer, every element is released by the driver and no frame is lost.
+ */
+void test__Can_Model__copy_once_rx( void )
+{
+    Can_Model_Init( &Model, CAN1, SRAMCAN1, 1000000u, 4000000u );
+    Model.Isr = ModelIsr;
+    ModelSetRxDelivery( CAN_RX_DELIVERY_COPY );
+    ModelFillTrace( CAN_MODEL_ID_FD | 0x100u, 64u );
+    Can_Model_SetTrace( &Model, Trace, 10u );
+
+    Can_Model_Run( &Model, 10000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, RxIndications, "Frames not indicated" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Model.Counters.RxRead, "Elements not released" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Model.Counters.RxLost, "Frames lost" );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE( Payload, RxCopyBuffer, 64u, "Wrong payload copied" );
+}
+
+/**
+ * @brief   Lowest priority frame cancelled in favour of a higher priority one
+ *
+ * With the Tx queue full of frames with ids 0x300, 0x200 and 0x280 a write with id 0x050 is
+ * rejected as busy and the frame with id 0x300 is cancelled while a trace frame holds the bus.
+ * CanIf is notified and writes the frame with id 0x050 into the buffer freed, it goes out right
+ * after the trace frame ahead of the rest, and the cancelled frame goes out once written back.
+ */
+void test__Can_Model__tx_cancellation( void )
+{
+    static const Can_ModelFrame Frames[ 1u ] = { { .Time = 0u, .Id = 0x100u, .Length = 8u } };
+    static const Can_IdType Ids[ 3u ]        = { 0x300u, 0x200u, 0x280u };
+    uint8 Data[ 8u ]   = { 0 };
+    Can_PduType Pdu    = { .length = 8u, .sdu = Data };
+    Can_PduType Urgent = { .id = 0x050u, .length = 8u, .sdu = Data, .swPduHandle = 13u };
+    Can_HardwareObject Hohs[ 3u ];
+
+    /* Same configuration with the Tx queue and hardware cancellation */
+    ModelRxController                      = ModelControllers[ 0u ];
+    ModelRxController.TxFifoQueueMode      = CAN_TX_QUEUE_OPERATION;
+    ModelRxController.HardwareCancellation = STD_ON;
+    ModelRxController.ActiveITs |= CAN_IT_TX_ABORT_COMPLETE;
+    for( uint8 Hoh = 0u; Hoh < 3u; Hoh++ )
+    {
+        Hohs[ Hoh ]               = ModelHohs[ Hoh ];
+        Hohs[ Hoh ].ControllerRef = &ModelRxController;
+    }
+    ModelRxConfig                     = ModelConfig;
+    ModelRxConfig.Controllers         = &ModelRxController;
+    ModelRxConfig.Hohs                = Hohs;
+    ModelHwUnit.Config                = &ModelRxConfig;
+    ModelHwUnit.ControllerState[ 0u ] = CAN_CS_STOPPED;
+    Can_Arch_Init( &ModelHwUnit, &ModelRxConfig, 0u );
+    (void)Can_Arch_SetControllerMode( &ModelHwUnit, 0u, CAN_CS_STARTED );
+    Can_Arch_EnableControllerInterrupts( &ModelHwUnit, 0u );
+    Can_Model_Init( &Model, CAN1, SRAMCAN1, 500000u, 2000000u );
+    Model.Isr = ModelIsr;
+    Can_Model_SetTrace( &Model, Frames, 1u );
+
+    for( uint8 Frame = 0u; Frame < 3u; Frame++ )
+    {
+        Pdu.id          = Ids[ Frame ];
+        Pdu.swPduHandle = 10u + Frame;
+        TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_Write( &ModelHwUnit, 0u, &Pdu ), "Frame not written" );
+        Can_Model_Sync( &Model );
+    }
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_BUSY, Can_Arch_Write( &ModelHwUnit, 0u, &Urgent ), "Full Tx queue not busy" );
+    TxRetry = &Urgent;
+    Can_Model_Sync( &Model );
+    Can_Model_Run( &Model, 1000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, TxCancellations, "Cancellation not notified" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, TxCancelled[ 0u ], "Wrong Pdu cancelled" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, RxIndications, "Trace frame not received" );
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, TxConfirmations, "Frames not confirmed" );
+    TEST_ASSERT_EQUAL_MESSAGE( 13u, TxConfirmed[ 0u ], "High priority frame not sent first" );
+    TEST_ASSERT_EQUAL_MESSAGE( 11u, TxConfirmed[ 1u ], "Wrong second Pdu" );
+    TEST_ASSERT_EQUAL_MESSAGE( 12u, TxConfirmed[ 2u ], "Wrong third Pdu" );
+
+    Pdu.id          = 0x300u;
+    Pdu.swPduHandle = 10u;
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Can_Arch_Write( &ModelHwUnit, 0u, &Pdu ), "Cancelled frame not written back" );
+    Can_Model_Sync( &Model );
+    Can_Model_Run( &Model, 1000000u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 4u, Model.Counters.TxFrames, "Frames not sent" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, TxConfirmed[ 3u ], "Cancelled frame not sent" );
+}